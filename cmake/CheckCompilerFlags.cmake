@@ -19,6 +19,21 @@ endif()
 
 message(STATUS "Setting sizeof(integer_t) to ${INTEGER_T_SIZE}")
 
+# Option to use 32bit reference counters for zones, tuples of locations and
+# valuations of integer variables (saves memory, but limits the number of
+# references to 2^32-2)
+option(TCHECKER_COMPACT_REFCOUNT "Use 32bit reference counters when possible" OFF)
+if (TCHECKER_COMPACT_REFCOUNT)
+    message(STATUS "Using 32bit reference counters")
+endif()
+
+# Option to count operations on the hot paths of algorithms (inclusion checks,
+# covering checks, rejected successors, bytecode instructions, caches and pools)
+option(TCHECKER_COUNTERS "Count operations on the hot paths of algorithms" OFF)
+if (TCHECKER_COUNTERS)
+    message(STATUS "Counting operations on hot paths")
+endif()
+
 #
 # Check if "flag" is accepted by the current CXX compiler. If the flag is
 # supported its value is assigned to the variable "var"; else "var" is asigned
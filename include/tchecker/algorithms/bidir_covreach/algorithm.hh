@@ -0,0 +1,250 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_BIDIR_COVREACH_ALGORITHM_HH
+#define TCHECKER_ALGORITHMS_BIDIR_COVREACH_ALGORITHM_HH
+
+/*!
+ \file algorithm.hh
+ \brief Bidirectional reachability algorithm with covering
+ */
+
+#include <memory>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/bidir_covreach/stats.hh"
+#include "tchecker/algorithms/bwd_covreach/algorithm.hh"
+#include "tchecker/algorithms/covreach/algorithm.hh"
+#include "tchecker/algorithms/progress.hh"
+#include "tchecker/graph/subsumption_graph.hh"
+#include "tchecker/waiting/factory.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bidir_covreach {
+
+/*!
+ \class algorithm_t
+ \brief Bidirectional covering reachability algorithm: interleaves a forward
+ covering reachability search from the initial states and a backward covering
+ reachability search from the final states, and stops as soon as the two
+ searches meet
+ \tparam FWD_TS : type of forward transition system, see
+ tchecker::algorithms::covreach::algorithm_t
+ \tparam BWD_TS : type of backward transition system, see
+ tchecker::algorithms::bwd_covreach::algorithm_t
+ \tparam GRAPH : type of graph, used by both searches, see
+ tchecker::algorithms::covreach::algorithm_t. The hash function on nodes
+ in GRAPH must only depend on the values in the nodes, as nodes from one
+ search are looked up in the graph of the other search
+ \tparam NODE_MEET : meeting predicate on nodes, should be default constructible,
+ and callable with two parameters of type GRAPH::node_t const &, the first one
+ from the forward search and the second one from the backward search. It should
+ return true if some state in the first node is also in the second node, false
+ otherwise. Nodes that meet should have the same hash value w.r.t. the hash
+ function in GRAPH
+ \note the forward search is allowed to use an abstraction of the states as
+ long as every abstract state is simulated by a concrete one. The backward
+ search should be exact.
+*/
+template <class FWD_TS, class BWD_TS, class GRAPH, class NODE_MEET> class algorithm_t {
+public:
+  using node_sptr_t = typename GRAPH::node_sptr_t;
+
+  /*!
+   \brief Build forward and backward covering reachability graphs until they meet
+   \tparam COVERING : type of covering (see tchecker::algorithms::covreach::covering_t)
+   \param fwd_ts : forward transition system
+   \param bwd_ts : backward transition system
+   \param fwd_graph : graph of the forward search
+   \param bwd_graph : graph of the backward search
+   \param labels : accepting labels
+   \param policy : waiting list policy (used by both searches)
+   \pre labels is not empty
+   \post the two searches have been interleaved, one node at a time, until:
+   the forward search has reached a state that satisfies labels (the
+   corresponding node in fwd_graph is flagged final), or the backward search
+   has reached an initial state (the corresponding node in bwd_graph is flagged
+   initial), or a node in fwd_graph meets a node in bwd_graph (the node in
+   fwd_graph is flagged final and the node in bwd_graph is flagged initial), or
+   one of the searches has exhausted its state-space.
+   \return Statistics on the run
+   \throw std::invalid_argument : if labels is empty
+   */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  tchecker::algorithms::bidir_covreach::stats_t run(FWD_TS & fwd_ts, BWD_TS & bwd_ts, GRAPH & fwd_graph, GRAPH & bwd_graph,
+                                                    boost::dynamic_bitset<> const & labels,
+                                                    enum tchecker::waiting::policy_t policy)
+  {
+    if (labels.none())
+      throw std::invalid_argument("Bidirectional reachability requires a non-empty set of labels");
+
+    std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> fwd_waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+    std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> bwd_waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+    tchecker::algorithms::bidir_covreach::stats_t stats;
+    tchecker::algorithms::covreach::stats_t & fwd_stats = stats.fwd_stats();
+    tchecker::algorithms::covreach::stats_t & bwd_stats = stats.bwd_stats();
+    std::vector<node_sptr_t> nodes, covered_nodes;
+    bool done = false;
+
+    stats.set_start_time();
+
+    _fwd.expand_initial_nodes(fwd_ts, fwd_graph, nodes, fwd_stats);
+    for (node_sptr_t const & n : nodes)
+      fwd_waiting->insert(n);
+    nodes.clear();
+
+    _bwd.expand_final_nodes(bwd_ts, bwd_graph, labels, nodes, bwd_stats);
+    for (node_sptr_t const & n : nodes) {
+      bwd_waiting->insert(n);
+      if (!done && meet_bwd(n, fwd_graph, stats))
+        done = true;
+    }
+    nodes.clear();
+
+    while (!done && !fwd_waiting->empty() && !bwd_waiting->empty()) {
+      // forward step
+      node_sptr_t node = fwd_waiting->first();
+      fwd_waiting->remove_first();
+
+      ++fwd_stats.visited_states();
+
+      if (_fwd.accepting(node, fwd_ts, labels)) {
+        node->final(true);
+        stats.reachable() = true;
+        break;
+      }
+
+      _fwd.expand_next_nodes(node, fwd_ts, fwd_graph, nodes, fwd_stats);
+
+      for (node_sptr_t const & next_node : nodes) {
+        fwd_waiting->insert(next_node);
+        if (meet_fwd(next_node, bwd_graph, stats)) {
+          done = true;
+          break;
+        }
+        if constexpr (COVERING == tchecker::algorithms::covreach::COVERING_FULL) {
+          _fwd.remove_covered_nodes(fwd_graph, next_node, covered_nodes, fwd_stats);
+          for (node_sptr_t const & covered_node : covered_nodes)
+            fwd_waiting->remove(covered_node);
+          covered_nodes.clear();
+        }
+      }
+      nodes.clear();
+
+      if (done || bwd_waiting->empty())
+        break;
+
+      // backward step
+      node = bwd_waiting->first();
+      bwd_waiting->remove_first();
+
+      ++bwd_stats.visited_states();
+      tchecker::algorithms::publish_progress(fwd_stats.visited_states() + bwd_stats.visited_states(),
+                                             fwd_graph.nodes_count() + bwd_graph.nodes_count(),
+                                             fwd_stats.covered_states() + bwd_stats.covered_states(),
+                                             fwd_waiting->size() + bwd_waiting->size());
+
+      if (_bwd.accepting(node, bwd_ts)) {
+        node->initial(true);
+        stats.reachable() = true;
+        break;
+      }
+
+      _bwd.expand_prev_nodes(node, bwd_ts, bwd_graph, nodes, bwd_stats);
+
+      for (node_sptr_t const & prev_node : nodes) {
+        bwd_waiting->insert(prev_node);
+        if (meet_bwd(prev_node, fwd_graph, stats)) {
+          done = true;
+          break;
+        }
+        if constexpr (COVERING == tchecker::algorithms::covreach::COVERING_FULL) {
+          _bwd.remove_covered_nodes(bwd_graph, prev_node, covered_nodes, bwd_stats);
+          for (node_sptr_t const & covered_node : covered_nodes)
+            bwd_waiting->remove(covered_node);
+          covered_nodes.clear();
+        }
+      }
+      nodes.clear();
+    }
+
+    fwd_waiting->clear();
+    bwd_waiting->clear();
+
+    fwd_stats.stored_states() = fwd_graph.nodes_count();
+    bwd_stats.stored_states() = bwd_graph.nodes_count();
+    fwd_stats.reachable() = stats.reachable();
+    bwd_stats.reachable() = stats.reachable();
+
+    stats.set_end_time();
+
+    return stats;
+  }
+
+private:
+  /*!
+   \brief Check if a node from the forward search meets the backward search
+   \param n : a node from the forward search
+   \param bwd_graph : graph of the backward search
+   \param stats : statistics
+   \post if n meets a node n' in bwd_graph, then n has been flagged final, n' has
+   been flagged initial and stats has been updated
+   \return true if n meets a node in bwd_graph, false otherwise
+   */
+  bool meet_fwd(node_sptr_t const & n, GRAPH const & bwd_graph, tchecker::algorithms::bidir_covreach::stats_t & stats)
+  {
+    node_sptr_t meeting_node;
+    if (!bwd_graph.find_node(n, _node_meet, meeting_node))
+      return false;
+    n->final(true);
+    meeting_node->initial(true);
+    stats.met() = true;
+    stats.reachable() = true;
+    return true;
+  }
+
+  /*!
+   \brief Check if a node from the backward search meets the forward search
+   \param n : a node from the backward search
+   \param fwd_graph : graph of the forward search
+   \param stats : statistics
+   \post if n meets a node n' in fwd_graph, then n has been flagged initial, n'
+   has been flagged final and stats has been updated
+   \return true if n meets a node in fwd_graph, false otherwise
+   */
+  bool meet_bwd(node_sptr_t const & n, GRAPH const & fwd_graph, tchecker::algorithms::bidir_covreach::stats_t & stats)
+  {
+    node_sptr_t meeting_node;
+    auto reversed_meet = [&](typename GRAPH::node_t const & bwd_node, typename GRAPH::node_t const & fwd_node) {
+      return _node_meet(fwd_node, bwd_node);
+    };
+    if (!fwd_graph.find_node(n, reversed_meet, meeting_node))
+      return false;
+    n->initial(true);
+    meeting_node->final(true);
+    stats.met() = true;
+    stats.reachable() = true;
+    return true;
+  }
+
+  tchecker::algorithms::covreach::algorithm_t<FWD_TS, GRAPH> _fwd;     /*!< Forward search */
+  tchecker::algorithms::bwd_covreach::algorithm_t<BWD_TS, GRAPH> _bwd; /*!< Backward search */
+  NODE_MEET _node_meet;                                                /*!< Meeting predicate */
+};
+
+} // end of namespace bidir_covreach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_BIDIR_COVREACH_ALGORITHM_HH
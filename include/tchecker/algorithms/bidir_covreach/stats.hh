@@ -0,0 +1,113 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_BIDIR_COVREACH_STATS_HH
+#define TCHECKER_ALGORITHMS_BIDIR_COVREACH_STATS_HH
+
+#include <map>
+#include <string>
+
+#include "tchecker/algorithms/covreach/stats.hh"
+#include "tchecker/algorithms/stats.hh"
+
+/*!
+ \file stats.hh
+ \brief Statistics for bidirectional covering reachability algorithm
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bidir_covreach {
+
+/*!
+ \class stats_t
+ \brief Statistics for bidirectional covering reachability algorithm
+ */
+class stats_t : public tchecker::algorithms::stats_t {
+public:
+  /*!
+   \brief Constructor
+   */
+  stats_t();
+
+  /*!
+   \brief Accessor
+   \return A reference to the statistics of the forward search
+   \note running time in the returned statistics is irrelevant
+   */
+  tchecker::algorithms::covreach::stats_t & fwd_stats();
+
+  /*!
+   \brief Accessor
+   \return the statistics of the forward search
+   \note running time in the returned statistics is irrelevant
+   */
+  tchecker::algorithms::covreach::stats_t const & fwd_stats() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the statistics of the backward search
+   \note running time in the returned statistics is irrelevant
+   */
+  tchecker::algorithms::covreach::stats_t & bwd_stats();
+
+  /*!
+   \brief Accessor
+   \return the statistics of the backward search
+   \note running time in the returned statistics is irrelevant
+   */
+  tchecker::algorithms::covreach::stats_t const & bwd_stats() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the flag that tells if forward and backward searches met
+  */
+  bool & met();
+
+  /*!
+   \brief Accessor
+   \return true if forward and backward searches met, false otherwise
+  */
+  bool met() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the reachable state flag
+  */
+  bool & reachable();
+
+  /*!
+   \brief Accessor
+   \return true if a satisfying state is reachable, false otherwise
+  */
+  bool reachable() const;
+
+  /*!
+   \brief Extract statistics as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m. Counters are reported for the
+   forward search (FWD_ prefix), for the backward search (BWD_ prefix), and
+   summed over both searches (no prefix)
+  */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  tchecker::algorithms::covreach::stats_t _fwd_stats; /*!< Statistics of the forward search */
+  tchecker::algorithms::covreach::stats_t _bwd_stats; /*!< Statistics of the backward search */
+  bool _met;                                          /*!< Forward and backward searches met */
+  bool _reachable;                                    /*!< Reachability of satisfying state */
+};
+
+} // end of namespace bidir_covreach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_BIDIR_COVREACH_STATS_HH
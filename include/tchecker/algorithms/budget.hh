@@ -0,0 +1,126 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_BUDGET_HH
+#define TCHECKER_ALGORITHMS_BUDGET_HH
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+
+/*!
+ \file budget.hh
+ \brief Resource budgets for algorithms
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+/*!
+ \brief Status of a budget
+ */
+enum budget_status_t {
+  BUDGET_AVAILABLE,        /*!< No limit has been reached */
+  BUDGET_TIME_EXHAUSTED,   /*!< Time limit has been reached */
+  BUDGET_STATES_EXHAUSTED, /*!< Limit on the number of stored states has been reached */
+  BUDGET_MEMORY_EXHAUSTED, /*!< Memory limit has been reached */
+};
+
+/*!
+ \brief Output operator
+ \param os : output stream
+ \param status : budget status
+ \post status has been output to os
+ \return os after output
+ */
+std::ostream & operator<<(std::ostream & os, enum tchecker::algorithms::budget_status_t status);
+
+/*!
+ \class budget_t
+ \brief Limits on the running time, the number of stored states and the memory
+ used by an algorithm
+ \note a limit equal to 0 means no limit
+ */
+class budget_t {
+public:
+  /*!
+   \brief Type of functions that measure the memory used by an algorithm (in
+   bytes)
+   */
+  using memory_usage_t = std::function<std::size_t()>;
+
+  /*!
+   \brief Default number of checks between two checks of the time and memory
+   limits
+   */
+  static constexpr std::size_t CHECK_PERIOD = 1024;
+
+  /*!
+   \brief Constructor
+   \post this budget has no limit
+   */
+  budget_t();
+
+  /*!
+   \brief Constructor
+   \param time_limit : maximal running time in seconds (0 means no limit)
+   \param states_limit : maximal number of stored states (0 means no limit)
+   \param memory_limit : maximal memory in bytes (0 means no limit)
+   \param check_period : number of checks between two checks of the time and
+   memory limits
+   \pre check_period > 0
+   \throw std::invalid_argument : if check_period is 0
+   \note the memory limit is only checked once a memory measure has been set
+   (see memory_usage)
+   */
+  budget_t(std::size_t time_limit, std::size_t states_limit, std::size_t memory_limit,
+           std::size_t check_period = CHECK_PERIOD);
+
+  /*!
+   \brief Set memory measure
+   \param memory_usage : memory measure
+   \post memory_usage is called to check the memory limit
+   \note memory_usage is called once every check_period visited nodes, hence it
+   should be cheap (e.g. adding the size of the pools used by the algorithm)
+   */
+  void memory_usage(memory_usage_t const & memory_usage);
+
+  /*!
+   \brief Accessor
+   \return true if this budget has no limit, false otherwise
+   */
+  bool unlimited() const;
+
+  /*!
+   \brief Check budget
+   \param start_time : starting time of the algorithm
+   \param states : number of stored states
+   \return BUDGET_AVAILABLE if no limit has been reached, the status that
+   corresponds to the first exhausted limit otherwise
+   \note the states limit is checked at each call. The time and memory limits
+   are checked at the first call, and then once every check_period calls, hence
+   the clock is not read for every visited node
+   */
+  enum tchecker::algorithms::budget_status_t check(std::chrono::time_point<std::chrono::steady_clock> const & start_time,
+                                                   std::size_t states) const;
+
+private:
+  std::chrono::seconds _time_limit; /*!< Maximal running time */
+  std::size_t _states_limit;        /*!< Maximal number of stored states */
+  std::size_t _memory_limit;        /*!< Maximal memory */
+  memory_usage_t _memory_usage;     /*!< Memory measure */
+  std::size_t _check_period;        /*!< Number of checks between two checks of time and memory */
+  mutable std::size_t _countdown;   /*!< Number of checks before next check of time and memory */
+};
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_BUDGET_HH
@@ -0,0 +1,240 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_BWD_COVREACH_ALGORITHM_HH
+#define TCHECKER_ALGORITHMS_BWD_COVREACH_ALGORITHM_HH
+
+/*!
+ \file algorithm.hh
+ \brief Backward reachability algorithm with covering
+ */
+
+#include <iterator>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/covreach/algorithm.hh"
+#include "tchecker/algorithms/covreach/stats.hh"
+#include "tchecker/algorithms/progress.hh"
+#include "tchecker/graph/subsumption_graph.hh"
+#include "tchecker/waiting/factory.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bwd_covreach {
+
+/*!
+ \class algorithm_t
+ \brief Backward covering reachability algorithm
+ \tparam TS : type of transition system, should implement tchecker::ts::bwd_t
+ and tchecker::ts::inspector_t
+ \tparam GRAPH : type of graph, should derive from
+ tchecker::graph::subsumption::graph_t, and nodes of type GRAPH::shared_node_t
+ should have a method state_ptr() that yields a pointer to the corresponding
+ state in TS.
+ \note For correctness of the algorithm, the covering relation over nodes in GRAPH
+ should be a trace inclusion for the reversed transition relation, and it should
+ be irreflexive: a node should not cover itself
+ \note Edges in GRAPH are oriented backward: an edge from n to n' means that the
+ state in n' is a predecessor of the state in n in TS
+*/
+template <class TS, class GRAPH> class algorithm_t {
+public:
+  using node_sptr_t = typename GRAPH::node_sptr_t;
+
+  /*!
+   \brief Build a backward covering reachability graph of a transition system
+   from its final states
+   \tparam COVERING : type of covering. Set to COVERING_LEAF_NODES to cover only
+   non-maximal leaf nodes. Set to COVERING_FULL to cover all non-maximal nodes.
+   \param ts : a transition system
+   \param graph : a graph
+   \param labels : final labels
+   \param policy : waiting list policy
+   \pre labels is not empty
+   \post graph is a backward covering reachability graph of ts built from the
+   states that satisfy labels, until an initial state is reached if any, or
+   until the entire backward state-space has been exhausted.
+   Nodes built from states that satisfy labels are flagged final. The node
+   that contains an initial state, if any, is flagged initial.
+   A node is created for each maximal state in ts, and an edge is created for
+   each transition in ts. Actual edges correspond to transitions in ts. A
+   subsumption edge from node n1 to node n2 means that the actual predecessor of
+   n1 in ts is subsumed by n2.
+   The order in which the nodes of ts are visited depends on policy.
+   \return Statistics on the run
+   \throw std::invalid_argument : if labels is empty
+  */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  tchecker::algorithms::covreach::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+                                              enum tchecker::waiting::policy_t policy)
+  {
+    if (labels.none())
+      throw std::invalid_argument("Backward reachability requires a non-empty set of labels");
+
+    std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+    tchecker::algorithms::covreach::stats_t stats;
+    std::vector<node_sptr_t> nodes, covered_nodes;
+
+    stats.set_start_time();
+
+    expand_final_nodes(ts, graph, labels, nodes, stats);
+    for (node_sptr_t const & n : nodes)
+      waiting->insert(n);
+    nodes.clear();
+
+    while (!waiting->empty()) {
+      node_sptr_t node = waiting->first();
+      waiting->remove_first();
+
+      ++stats.visited_states();
+      tchecker::algorithms::publish_progress(stats.visited_states(), graph.nodes_count(), stats.covered_states(),
+                                             waiting->size());
+
+      if (accepting(node, ts)) {
+        node->initial(true);
+        stats.reachable() = true;
+        break;
+      }
+
+      expand_prev_nodes(node, ts, graph, nodes, stats);
+
+      for (node_sptr_t const & prev_node : nodes) {
+        waiting->insert(prev_node);
+        if constexpr (COVERING == tchecker::algorithms::covreach::COVERING_FULL) {
+          remove_covered_nodes(graph, prev_node, covered_nodes, stats);
+          for (node_sptr_t const & covered_node : covered_nodes)
+            waiting->remove(covered_node);
+          covered_nodes.clear();
+        }
+      }
+      nodes.clear();
+    }
+
+    waiting->clear();
+
+    stats.stored_states() = graph.nodes_count();
+
+    stats.set_end_time();
+
+    return stats;
+  }
+
+  /*!
+   \brief Create nodes for final states
+   \param ts : transition system
+   \param graph : a subsumption graph
+   \param labels : final labels
+   \param final_nodes : nodes container
+   \param stats : statistics
+   \post A node flagged final has been created in graph for each final state of
+   ts w.r.t. labels which is maximal w.r.t. the node covering in graph. All these
+   maximal nodes have been added to final_nodes
+   All covered final nodes have been counted in stats
+   */
+  void expand_final_nodes(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+                          std::vector<typename GRAPH::node_sptr_t> & final_nodes, tchecker::algorithms::covreach::stats_t & stats)
+  {
+    std::vector<typename TS::sst_t> sst;
+    typename GRAPH::node_sptr_t covering_node;
+
+    ts.final(labels, sst);
+    for (auto && [status, s, t] : sst) {
+      typename GRAPH::node_sptr_t n = graph.add_node(s);
+      n->final(true);
+      if (graph.is_covered(n, covering_node)) {
+        graph.remove_node(n);
+        ++stats.covered_states();
+      }
+      else
+        final_nodes.push_back(n);
+    }
+  }
+
+  /*!
+   \brief Create predecessor nodes of a node
+   \param node : a node
+   \param ts : a transition system
+   \param graph : a subsumption graph
+   \param prev_nodes : nodes container
+   \param stats : statistics
+   \post A node has been created in the graph for each predecessor of node that
+   is maximal in graph. An actual edge has been created from node to each
+   maximal predecessor. All maximal predecessors have been added to prev_nodes.
+   For each predecessor node that is not maximal, a subsumption edge has been
+   created from node to a covering node.
+   All covered predecessor nodes have been counted in stats.
+   */
+  void expand_prev_nodes(typename GRAPH::node_sptr_t const & node, TS & ts, GRAPH & graph,
+                         std::vector<typename GRAPH::node_sptr_t> & prev_nodes, tchecker::algorithms::covreach::stats_t & stats)
+  {
+    std::vector<typename TS::sst_t> sst;
+    typename GRAPH::node_sptr_t covering_node;
+
+    ts.prev(node->state_ptr(), sst);
+    for (auto && [status, s, t] : sst) {
+      ++stats.visited_transitions();
+      typename GRAPH::node_sptr_t prev_node = graph.add_node(s);
+      if (graph.is_covered(prev_node, covering_node)) {
+        graph.add_edge(node, covering_node, tchecker::graph::subsumption::EDGE_SUBSUMPTION, *t);
+        graph.remove_node(prev_node);
+        ++stats.covered_states();
+      }
+      else {
+        graph.add_edge(node, prev_node, tchecker::graph::subsumption::EDGE_ACTUAL, *t);
+        prev_nodes.push_back(prev_node);
+      }
+    }
+  }
+
+  /*!
+   \brief Remove non-maximal nodes
+   \param graph : a subsumption graph
+   \param node : a node
+   \param covered_nodes : a container of nodes
+   \param stats : statistics
+   \post All the nodes in graph that are covered by node have been removed from
+   graph and added to covered_nodes.
+   All incoming edges to covered nodes have been transformed into incoming
+   subsumption edges of node.
+   Removed nodes have been counted in stats
+  */
+  void remove_covered_nodes(GRAPH & graph, typename GRAPH::node_sptr_t const & node,
+                            std::vector<typename GRAPH::node_sptr_t> & covered_nodes,
+                            tchecker::algorithms::covreach::stats_t & stats)
+  {
+    auto covered_nodes_inserter = std::back_inserter(covered_nodes);
+
+    covered_nodes.clear();
+    graph.covered_nodes(node, covered_nodes_inserter);
+    for (typename GRAPH::node_sptr_t const & covered_node : covered_nodes) {
+      graph.move_incoming_edges(covered_node, node, tchecker::graph::subsumption::EDGE_SUBSUMPTION);
+      graph.remove_edges(covered_node);
+      graph.remove_node(covered_node);
+      ++stats.covered_states();
+    }
+  }
+
+  /*!
+   \brief Check if a node is accepting
+   \param n : a node
+   \param ts : a transition system
+   \return true if n contains an initial state of ts, false otherwise
+   */
+  bool accepting(node_sptr_t const & n, TS & ts) { return ts.is_initial(n->state_ptr()); }
+};
+
+} // end of namespace bwd_covreach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_BWD_COVREACH_ALGORITHM_HH
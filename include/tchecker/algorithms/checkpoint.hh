@@ -0,0 +1,96 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_CHECKPOINT_HH
+#define TCHECKER_ALGORITHMS_CHECKPOINT_HH
+
+#include <chrono>
+#include <functional>
+
+/*!
+ \file checkpoint.hh
+ \brief Periodic checkpointing of algorithms
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+/*!
+ \class checkpoint_t
+ \brief Periodic checkpoint of a search: calls a function on the waiting
+ container and the statistics of a search at regular time intervals
+ \tparam WAITING : type of waiting container
+ \tparam STATS : type of statistics
+ \note the function is called by the search algorithm between the visit of two
+ nodes, hence when the graph, the waiting container and the statistics are
+ consistent
+ */
+template <class WAITING, class STATS> class checkpoint_t {
+public:
+  /*!
+   \brief Type of checkpoint functions
+   */
+  using callback_t = std::function<void(WAITING &, STATS const &)>;
+
+  /*!
+   \brief Number of calls between two reads of the clock
+   */
+  static constexpr unsigned int CHECK_PERIOD = 1024;
+
+  /*!
+   \brief Constructor
+   \post this checkpoint is disabled
+   */
+  checkpoint_t() : _period(0), _countdown(CHECK_PERIOD) {}
+
+  /*!
+   \brief Constructor
+   \param period : time between two checkpoints
+   \param callback : checkpoint function
+   \post this checkpoint calls callback at most once every period. The first call
+   occurs after period. This checkpoint is disabled if period is zero or if
+   callback is empty
+   */
+  checkpoint_t(std::chrono::seconds period, callback_t const & callback)
+      : _period(callback ? period : std::chrono::seconds{0}), _next(std::chrono::steady_clock::now() + period),
+        _countdown(CHECK_PERIOD), _callback(callback)
+  {
+  }
+
+  /*!
+   \brief Checkpoint when due
+   \param waiting : waiting container
+   \param stats : statistics
+   \post the checkpoint function has been called on waiting and stats if the
+   period has elapsed since the last checkpoint (or since construction)
+   \note the clock is only read once every CHECK_PERIOD calls, and never if this
+   checkpoint is disabled
+   */
+  inline void operator()(WAITING & waiting, STATS const & stats)
+  {
+    if (_period.count() == 0 || --_countdown != 0)
+      return;
+    _countdown = CHECK_PERIOD;
+    if (std::chrono::steady_clock::now() < _next)
+      return;
+    _callback(waiting, stats);
+    _next = std::chrono::steady_clock::now() + _period;
+  }
+
+private:
+  std::chrono::seconds _period;                /*!< Time between two checkpoints (0 if disabled) */
+  std::chrono::steady_clock::time_point _next; /*!< Time of next checkpoint */
+  unsigned int _countdown;                     /*!< Number of calls before next read of the clock */
+  callback_t _callback;                        /*!< Checkpoint function */
+};
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_CHECKPOINT_HH
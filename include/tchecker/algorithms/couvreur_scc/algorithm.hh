@@ -9,13 +9,16 @@
 #define TCHECKER_ALGORITHMS_COUVREUR_SCC_ALGORITHM_HH
 
 #include <cassert>
+#include <functional>
 #include <stack>
 #include <vector>
 
 #include <boost/dynamic_bitset.hpp>
 
+#include "tchecker/algorithms/checkpoint.hh"
 #include "tchecker/algorithms/couvreur_scc/graph.hh"
 #include "tchecker/algorithms/couvreur_scc/stats.hh"
+#include "tchecker/algorithms/progress.hh"
 
 /*!
  \file algorithm.hh
@@ -98,6 +101,18 @@ template <class TS, class GRAPH> class generalized_algorithm_t {
 public:
   using node_sptr_t = typename GRAPH::node_sptr_t;
 
+  /*!
+   \brief Type of checkpoints. The stacks of the search are not saved, hence
+   the checkpoint function is called on the graph
+   */
+  using checkpoint_t = tchecker::algorithms::checkpoint_t<GRAPH, tchecker::algorithms::couvscc::stats_t>;
+
+  /*!
+   \brief Type of predicates on nodes that have already been expanded into the
+   graph (e.g. by a run saved in a checkpoint)
+   */
+  using expanded_t = std::function<bool(node_sptr_t const &)>;
+
   /*!
    \brief Check if a transition has an infinite run that satisfies a given set
    of labels and build the corresponding graph
@@ -115,17 +130,45 @@ public:
   tchecker::algorithms::couvscc::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels)
   {
     tchecker::algorithms::couvscc::stats_t stats;
+    checkpoint_t checkpoint;
 
     stats.set_start_time();
+    run(ts, graph, labels, expanded_t{}, stats, checkpoint);
+    stats.set_end_time();
 
+    return stats;
+  }
+
+  /*!
+   \brief Check if a transition has an infinite run that satisfies a given set
+   of labels and build the corresponding graph, reusing expanded nodes
+   \param ts : a transition system
+   \param graph : a graph
+   \param labels : accepting labels
+   \param expanded : predicate on the nodes of graph that have already been
+   expanded (empty if none)
+   \param stats : statistics
+   \param checkpoint : periodic checkpoint
+   \post same as run(ts, graph, labels), except that the successors of the
+   nodes that satisfy expanded are the targets of their outgoing edges in graph
+   instead of being computed by ts. Hence, if graph has been saved by an
+   interrupted run, along with its expanded nodes, the search replays the
+   interrupted run without calling ts, then continues it. checkpoint has been
+   called between two steps of the DFS
+   \note the start and end times in stats are not modified
+   */
+  void run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels, expanded_t const & expanded,
+           tchecker::algorithms::couvscc::stats_t & stats, checkpoint_t & checkpoint)
+  {
     _count = 0;
+    _expanded = expanded;
 
     std::vector<typename TS::sst_t> sst;
     ts.initial(sst);
     for (auto && [status, s, t] : sst) {
       auto && [is_new_node, initial_node] = graph.add_node(s);
       initial_node->initial(true);
-      couv_dfs(initial_node, ts, graph, labels, stats);
+      couv_dfs(initial_node, ts, graph, labels, stats, checkpoint);
       if (stats.cycle())
         break;
     }
@@ -133,10 +176,7 @@ public:
     stats.stored_states() = graph.nodes_count();
 
     empty_stacks();
-
-    stats.set_end_time();
-
-    return stats;
+    _expanded = expanded_t{};
   }
 
 private:
@@ -146,17 +186,20 @@ private:
    \param graph : a graph
    \param labels : accepting labels
    \param stats : statistics on the run
+   \param checkpoint : periodic checkpoint
    \param n : a node
    \post the DFS search in Couvreur's algorithm has been performed from n.
    stats.cycle() is true if an accepting cycle w.r.t labels has been found in
    ts, and false otherwise
    graph contains the part of ts that has been explored
+   checkpoint has been called between two steps of the search
   */
   void couv_dfs(node_sptr_t & n, TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
-                tchecker::algorithms::couvscc::stats_t & stats)
+                tchecker::algorithms::couvscc::stats_t & stats, checkpoint_t & checkpoint)
   {
     push(n, ts, graph, stats);
     while (!_todo.empty()) {
+      checkpoint(graph, stats);
       auto && [n, succ] = _todo.top();
       if (succ.empty()) {
         if (_roots.top().n == n)
@@ -236,6 +279,7 @@ private:
     _roots.push(roots_stack_entry_t{n, ts.labels(n->state_ptr())});
     _active.push(n);
     ++stats.visited_states();
+    tchecker::algorithms::publish_progress(stats.visited_states(), graph.nodes_count(), 0, _todo.size());
   }
 
   /*!
@@ -247,11 +291,21 @@ private:
    \post all successor nodes of n in ts have been added to graph (if not yet in)
    with corresponding edges
    visited transitions have been added to stats
+   If n has already been expanded, its successor nodes are taken from graph
+   instead
    \return all successor nodes of n
   */
   std::deque<node_sptr_t> expand_node(node_sptr_t & n, TS & ts, GRAPH & graph, tchecker::algorithms::couvscc::stats_t & stats)
   {
     std::deque<node_sptr_t> next_nodes;
+    if (_expanded && _expanded(n)) {
+      // outgoing edges are in reverse order of insertion
+      for (typename GRAPH::edge_sptr_t const & e : graph.outgoing_edges(n)) {
+        ++stats.visited_transitions();
+        next_nodes.push_front(graph.edge_tgt(e));
+      }
+      return next_nodes;
+    }
     std::vector<typename TS::sst_t> v;
     ts.next(n->state_ptr(), v);
     for (auto && [status, s, t] : v) {
@@ -311,6 +365,7 @@ private:
 
 private:
   unsigned int _count;                    /*!< DFS number counter */
+  expanded_t _expanded;                   /*!< Predicate on expanded nodes */
   std::stack<todo_stack_entry_t> _todo;   /*!< todo stack */
   std::stack<roots_stack_entry_t> _roots; /*!< roots stack */
   std::stack<node_sptr_t> _active;        /*!< active stack */
@@ -386,6 +441,18 @@ template <class TS, class GRAPH> class single_algorithm_t {
 public:
   using node_sptr_t = typename GRAPH::node_sptr_t;
 
+  /*!
+   \brief Type of checkpoints. The stacks of the search are not saved, hence
+   the checkpoint function is called on the graph
+   */
+  using checkpoint_t = tchecker::algorithms::checkpoint_t<GRAPH, tchecker::algorithms::couvscc::stats_t>;
+
+  /*!
+   \brief Type of predicates on nodes that have already been expanded into the
+   graph (e.g. by a run saved in a checkpoint)
+   */
+  using expanded_t = std::function<bool(node_sptr_t const &)>;
+
   /*!
    \brief Check if a transition has an infinite run that satisfies a given set
    of labels and build the corresponding graph
@@ -408,10 +475,43 @@ public:
       throw std::invalid_argument("*** tchecker::algorithms::couvscc::single_algorithm_t: single accepting condition required");
 
     tchecker::algorithms::couvscc::stats_t stats;
+    checkpoint_t checkpoint;
 
     stats.set_start_time();
+    run(ts, graph, labels, expanded_t{}, stats, checkpoint);
+    stats.set_end_time();
+
+    return stats;
+  }
+
+  /*!
+   \brief Check if a transition has an infinite run that satisfies a given set
+   of labels and build the corresponding graph, reusing expanded nodes
+   \param ts : a transition system
+   \param graph : a graph
+   \param labels : accepting labels
+   \param expanded : predicate on the nodes of graph that have already been
+   expanded (empty if none)
+   \param stats : statistics
+   \param checkpoint : periodic checkpoint
+   \pre labels is a single accepting condition
+   \post same as run(ts, graph, labels), except that the successors of the
+   nodes that satisfy expanded are the targets of their outgoing edges in graph
+   instead of being computed by ts. Hence, if graph has been saved by an
+   interrupted run, along with its expanded nodes, the search replays the
+   interrupted run without calling ts, then continues it. checkpoint has been
+   called between two steps of the DFS
+   \throw std::invalid_argument : if labels is not a single accepting label
+   \note the start and end times in stats are not modified
+   */
+  void run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels, expanded_t const & expanded,
+           tchecker::algorithms::couvscc::stats_t & stats, checkpoint_t & checkpoint)
+  {
+    if (labels.count() > 1)
+      throw std::invalid_argument("*** tchecker::algorithms::couvscc::single_algorithm_t: single accepting condition required");
 
     _count = 0;
+    _expanded = expanded;
 
     std::vector<typename TS::sst_t> sst;
     ts.initial(sst);
@@ -419,7 +519,7 @@ public:
       auto && [is_new_node, initial_node] = graph.add_node(s);
       initial_node->initial(true);
       initial_node->final(accepting(initial_node, ts, labels));
-      couv_dfs(initial_node, ts, graph, labels, stats);
+      couv_dfs(initial_node, ts, graph, labels, stats, checkpoint);
       if (stats.cycle())
         break;
     }
@@ -427,10 +527,7 @@ public:
     stats.stored_states() = graph.nodes_count();
 
     empty_stacks();
-
-    stats.set_end_time();
-
-    return stats;
+    _expanded = expanded_t{};
   }
 
 private:
@@ -440,17 +537,20 @@ private:
    \param graph : a graph
    \param labels : accepting labels
    \param stats : statistics on the run
+   \param checkpoint : periodic checkpoint
    \param n : a node
    \post the DFS search in Couvreur's algorithm has been performed from n.
    stats.cycle() is true if an accepting cycle w.r.t labels has been found in
    ts, and false otherwise
    graph contains the part of ts that has been explored
+   checkpoint has been called between two steps of the search
   */
   void couv_dfs(node_sptr_t & n, TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
-                tchecker::algorithms::couvscc::stats_t & stats)
+                tchecker::algorithms::couvscc::stats_t & stats, checkpoint_t & checkpoint)
   {
     push(n, ts, graph, labels, stats);
     while (!_todo.empty()) {
+      checkpoint(graph, stats);
       auto && [n, succ] = _todo.top();
       if (succ.empty()) {
         if (_roots.top().n == n)
@@ -530,6 +630,7 @@ private:
     _roots.push(roots_stack_entry_t{n});
     _active.push(n);
     ++stats.visited_states();
+    tchecker::algorithms::publish_progress(stats.visited_states(), graph.nodes_count(), 0, _todo.size());
   }
 
   /*!
@@ -543,12 +644,24 @@ private:
    with corresponding edges
    visited transitions have been added to stats
    final flga has been set to true for all acepting successor nodes of n
+   If n has already been expanded, its successor nodes are taken from graph
+   instead
    \return all successor nodes of n
   */
   std::deque<node_sptr_t> expand_node(node_sptr_t & n, TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
                                       tchecker::algorithms::couvscc::stats_t & stats)
   {
     std::deque<node_sptr_t> next_nodes;
+    if (_expanded && _expanded(n)) {
+      // outgoing edges are in reverse order of insertion
+      for (typename GRAPH::edge_sptr_t const & e : graph.outgoing_edges(n)) {
+        ++stats.visited_transitions();
+        node_sptr_t nextn = graph.edge_tgt(e);
+        nextn->final(accepting(nextn, ts, labels));
+        next_nodes.push_front(nextn);
+      }
+      return next_nodes;
+    }
     std::vector<typename TS::sst_t> v;
     ts.next(n->state_ptr(), v);
     for (auto && [status, s, t] : v) {
@@ -620,6 +733,7 @@ private:
 
 private:
   unsigned int _count;                    /*!< DFS number counter */
+  expanded_t _expanded;                   /*!< Predicate on expanded nodes */
   std::stack<todo_stack_entry_t> _todo;   /*!< todo stack */
   std::stack<roots_stack_entry_t> _roots; /*!< roots stack */
   std::stack<node_sptr_t> _active;        /*!< active stack */
@@ -13,13 +13,19 @@
  \brief Reachability algorithm with covering
  */
 
+#include <algorithm>
 #include <iterator>
 #include <vector>
 
 #include <boost/dynamic_bitset.hpp>
 
+#include "tchecker/algorithms/budget.hh"
+#include "tchecker/algorithms/checkpoint.hh"
 #include "tchecker/algorithms/covreach/stats.hh"
+#include "tchecker/algorithms/progress.hh"
 #include "tchecker/graph/subsumption_graph.hh"
+#include "tchecker/utils/profile.hh"
+#include "tchecker/utils/trace.hh"
 #include "tchecker/waiting/factory.hh"
 
 namespace tchecker {
@@ -53,6 +59,12 @@ template <class TS, class GRAPH> class algorithm_t {
 public:
   using node_sptr_t = typename GRAPH::node_sptr_t;
 
+  /*!
+   \brief Type of checkpoint
+   */
+  using checkpoint_t = tchecker::algorithms::checkpoint_t<tchecker::waiting::waiting_t<node_sptr_t>,
+                                                          tchecker::algorithms::covreach::stats_t>;
+
   /*!
    \brief Build a covering reachability graph of a transition system from its
    initial states
@@ -62,9 +74,10 @@ public:
    \param graph : a graph
    \param labels : accepting labels
    \param policy : waiting list policy
+   \param budget : resource budget
    \post graph is a covering reachability graph of ts built from its initial
    states, until a state that satisfies labels is reached if any, or until the
-   entire state-space has been exhausted.
+   entire state-space has been exhausted, or until budget is exhausted.
    A node is created for each maximal state in ts, and an edge is created for
    each transition in ts. Actual edges correspond to transitions in ts. A
    subsumption edge from node n1 to node n2 means that the actual successor of
@@ -72,14 +85,84 @@ public:
    The order in which the nodes of ts are visited depends on policy.
    \return Statistics on the run
    \note if labels is empty, the algorithm explores the entire state-space
+   \note if budget is exhausted, graph is a partial covering reachability graph
+   and the exhausted limit is reported in the statistics
   */
   template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
   tchecker::algorithms::covreach::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
-                                              enum tchecker::waiting::policy_t policy)
+                                              enum tchecker::waiting::policy_t policy,
+                                              tchecker::algorithms::budget_t const & budget = tchecker::algorithms::budget_t{})
+  {
+    std::vector<node_sptr_t> witnesses;
+    return run<COVERING>(ts, graph, std::vector<boost::dynamic_bitset<>>{labels}, policy, witnesses, budget);
+  }
+
+  /*!
+   \brief Continue building a covering reachability graph of a transition system
+   from a waiting container
+   \tparam COVERING : type of covering (see run above)
+   \param ts : a transition system
+   \param graph : a graph
+   \param labels : accepting labels
+   \param waiting : a waiting container
+   \param stats : statistics
+   \param checkpoint : periodic checkpoint
+   \param budget : resource budget
+   \pre the nodes in waiting belong to graph
+   \post graph has been extended from the nodes in waiting as described for run
+   above, until a state that satisfies labels is reached if any, or until waiting
+   is empty, or until budget is exhausted. The order in which the nodes are visited depends on the policy
+   implemented by waiting. stats has been updated with the visited, covered and
+   stored states, the visited transitions and the reachability of labels.
+   checkpoint has been called before the visit of each node. The budget status
+   has been set in stats.
+   \note this allows to resume a run from a saved graph, waiting container and
+   statistics
+   \note the start and end times in stats are not modified
+   */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  void run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels, tchecker::waiting::waiting_t<node_sptr_t> & waiting,
+           tchecker::algorithms::covreach::stats_t & stats, checkpoint_t & checkpoint,
+           tchecker::algorithms::budget_t const & budget = tchecker::algorithms::budget_t{})
+  {
+    std::vector<node_sptr_t> witnesses{node_sptr_t{nullptr}};
+    run_from_waiting<COVERING>(ts, graph, std::vector<boost::dynamic_bitset<>>{labels}, waiting, witnesses, stats, checkpoint,
+                               budget);
+  }
+
+  /*!
+   \brief Build a covering reachability graph of a transition system from its
+   initial states, answering several reachability queries at once
+   \tparam COVERING : type of covering (see run above)
+   \param ts : a transition system
+   \param graph : a graph
+   \param queries : accepting labels of each query
+   \param policy : waiting list policy
+   \param witnesses : witness nodes
+   \param budget : resource budget
+   \post graph is a covering reachability graph of ts built from its initial
+   states, until every query has been satisfied, or until the entire
+   state-space has been exhausted, or until budget is exhausted (see run above).
+   witnesses has the same size as queries, and witnesses[i] is a node of graph
+   that satisfies queries[i] if any, nullptr otherwise: the first visited one,
+   or the node that covered it with COVERING_FULL. Witness nodes are flagged
+   final, and they are expanded like any other node.
+   \return Statistics on the run, the reachability flag is set iff all queries
+   have been satisfied
+   \note an empty query is never satisfied. If all queries are empty, the
+   algorithm explores the entire state-space
+  */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  tchecker::algorithms::covreach::stats_t run(TS & ts, GRAPH & graph, std::vector<boost::dynamic_bitset<>> const & queries,
+                                              enum tchecker::waiting::policy_t policy, std::vector<node_sptr_t> & witnesses,
+                                              tchecker::algorithms::budget_t const & budget = tchecker::algorithms::budget_t{})
   {
     std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
     tchecker::algorithms::covreach::stats_t stats;
-    std::vector<node_sptr_t> nodes, covered_nodes;
+    checkpoint_t checkpoint;
+    std::vector<node_sptr_t> nodes;
+
+    witnesses.assign(queries.size(), node_sptr_t{nullptr});
 
     stats.set_start_time();
 
@@ -88,41 +171,43 @@ public:
       waiting->insert(n);
     nodes.clear();
 
-    while (!waiting->empty()) {
-      node_sptr_t node = waiting->first();
-      waiting->remove_first();
-
-      ++stats.visited_states();
-
-      if (accepting(node, ts, labels)) {
-        node->final(true);
-        stats.reachable() = true;
-        break;
-      }
-
-      expand_next_nodes(node, ts, graph, nodes, stats);
-
-      for (node_sptr_t const & next_node : nodes) {
-        waiting->insert(next_node);
-        if constexpr (COVERING == tchecker::algorithms::covreach::COVERING_FULL) {
-          remove_covered_nodes(graph, next_node, covered_nodes, stats);
-          for (node_sptr_t const & covered_node : covered_nodes)
-            waiting->remove(covered_node);
-          covered_nodes.clear();
-        }
-      }
-      nodes.clear();
-    }
-
-    waiting->clear();
-
-    stats.stored_states() = graph.nodes_count();
+    run_from_waiting<COVERING>(ts, graph, queries, *waiting, witnesses, stats, checkpoint, budget);
 
     stats.set_end_time();
 
     return stats;
   }
 
+  /*!
+   \brief Continue building a covering reachability graph of a transition system
+   from a waiting container, answering several reachability queries at once
+   \tparam COVERING : type of covering (see run above)
+   \param ts : a transition system
+   \param graph : a graph
+   \param queries : accepting labels of each query
+   \param waiting : a waiting container
+   \param witnesses : witness nodes
+   \param stats : statistics
+   \param checkpoint : periodic checkpoint
+   \param budget : resource budget
+   \pre the nodes in waiting belong to graph, witnesses has the same size as
+   queries, and witnesses[i] is nullptr if queries[i] has not been satisfied yet
+   \post graph has been extended from the nodes in waiting as described for run
+   above. checkpoint has been called before the visit of each node. The budget
+   status has been set in stats
+   \note this allows to resume a run from a saved graph, waiting container,
+   witnesses and statistics
+   \note the start and end times in stats are not modified
+   */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  void run(TS & ts, GRAPH & graph, std::vector<boost::dynamic_bitset<>> const & queries,
+           tchecker::waiting::waiting_t<node_sptr_t> & waiting, std::vector<node_sptr_t> & witnesses,
+           tchecker::algorithms::covreach::stats_t & stats, checkpoint_t & checkpoint,
+           tchecker::algorithms::budget_t const & budget = tchecker::algorithms::budget_t{})
+  {
+    run_from_waiting<COVERING>(ts, graph, queries, waiting, witnesses, stats, checkpoint, budget);
+  }
+
   /*!
    \brief Create nodes for initial states
    \param ts : transition system
@@ -176,8 +261,18 @@ public:
     ts.next(node->state_ptr(), sst);
     for (auto && [status, s, t] : sst) {
       ++stats.visited_transitions();
-      typename GRAPH::node_sptr_t next_node = graph.add_node(s);
-      if (graph.is_covered(next_node, covering_node)) {
+      typename GRAPH::node_sptr_t next_node;
+      {
+        tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_GRAPH};
+        next_node = graph.add_node(s);
+      }
+      bool covered = false;
+      {
+        tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_COVERING};
+        covered = graph.is_covered(next_node, covering_node);
+      }
+      tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_GRAPH};
+      if (covered) {
         graph.add_edge(node, covering_node, tchecker::graph::subsumption::EDGE_SUBSUMPTION, *t);
         graph.remove_node(next_node);
         ++stats.covered_states();
@@ -206,15 +301,23 @@ public:
                             tchecker::algorithms::covreach::stats_t & stats)
   {
     auto covered_nodes_inserter = std::back_inserter(covered_nodes);
+    tchecker::trace::time_point_t const start = tchecker::trace::timestamp();
 
     covered_nodes.clear();
-    graph.covered_nodes(node, covered_nodes_inserter);
+    {
+      tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_COVERING};
+      graph.covered_nodes(node, covered_nodes_inserter);
+    }
+    tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_GRAPH};
     for (typename GRAPH::node_sptr_t const & covered_node : covered_nodes) {
       graph.move_incoming_edges(covered_node, node, tchecker::graph::subsumption::EDGE_SUBSUMPTION);
       graph.remove_edges(covered_node);
       graph.remove_node(covered_node);
       ++stats.covered_states();
     }
+    if (!covered_nodes.empty())
+      tchecker::trace::span("remove covered nodes", "covering", start, tchecker::trace::timestamp(),
+                            {"nodes", static_cast<long long>(covered_nodes.size())});
   }
 
   /*!
@@ -229,6 +332,157 @@ public:
   {
     return !labels.none() && labels.is_subset_of(ts.labels(n->state_ptr())) && ts.is_valid_final(n->state_ptr());
   }
+
+private:
+  /*!
+   \brief Build a covering reachability graph of a transition system from a
+   waiting container
+   \tparam COVERING : type of covering (see run above)
+   \param ts : a transition system
+   \param graph : a graph
+   \param queries : accepting labels of each query
+   \param waiting : a waiting container
+   \param witnesses : witness nodes
+   \param stats : statistics
+   \param checkpoint : periodic checkpoint
+   \param budget : resource budget
+   \pre witnesses has the same size as queries
+   \post graph has been extended from the nodes in waiting until every
+   non-empty query has been satisfied, or until waiting is empty, or until
+   budget is exhausted. witnesses[i] is a node that satisfies queries[i] if any:
+   the first visited one, or the node that covered it. stats has been updated
+   with the visited, covered and stored states, the visited transitions and the
+   reachability of all queries. checkpoint has been called before the visit of
+   each node. The budget status has been set in stats.
+   \note the graph is fully explored if no query is pending (e.g. all queries
+   are empty)
+   */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING>
+  void run_from_waiting(TS & ts, GRAPH & graph, std::vector<boost::dynamic_bitset<>> const & queries,
+                        tchecker::waiting::waiting_t<node_sptr_t> & waiting, std::vector<node_sptr_t> & witnesses,
+                        tchecker::algorithms::covreach::stats_t & stats, checkpoint_t & checkpoint,
+                        tchecker::algorithms::budget_t const & budget)
+  {
+    std::vector<node_sptr_t> nodes, covered_nodes;
+    boost::dynamic_bitset<> pending = pending_queries(queries, witnesses);
+    tchecker::trace::batch_t batch{"expand", "exploration", tchecker::trace::EXPLORATION_BATCH};
+
+    while (!waiting.empty()) {
+      checkpoint(waiting, stats);
+
+      stats.budget_status() = budget.check(stats.start_time(), graph.nodes_count());
+      if (stats.budget_exhausted())
+        break;
+
+      node_sptr_t node;
+      {
+        tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_WAITING};
+        node = waiting.first();
+        waiting.remove_first();
+      }
+
+      ++stats.visited_states();
+      tchecker::algorithms::publish_progress(stats.visited_states(), graph.nodes_count(), stats.covered_states(),
+                                             waiting.size());
+
+      if (satisfy_queries(node, ts, queries, pending, witnesses) && pending.none())
+        break;
+
+      expand_next_nodes(node, ts, graph, nodes, stats);
+
+      for (node_sptr_t const & next_node : nodes) {
+        {
+          tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_WAITING};
+          waiting.insert(next_node);
+        }
+        if constexpr (COVERING == tchecker::algorithms::covreach::COVERING_FULL) {
+          remove_covered_nodes(graph, next_node, covered_nodes, stats);
+          tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_WAITING};
+          for (node_sptr_t const & covered_node : covered_nodes) {
+            waiting.remove(covered_node);
+            if (covered_node->final())
+              replace_witness(covered_node, next_node, witnesses);
+          }
+          covered_nodes.clear();
+        }
+      }
+      nodes.clear();
+
+      if (batch.tick()) {
+        tchecker::trace::counter("waiting", {"nodes", static_cast<long long>(waiting.size())});
+        tchecker::trace::counter("graph", {"stored", static_cast<long long>(graph.nodes_count())},
+                                 {"covered", static_cast<long long>(stats.covered_states())});
+      }
+    }
+
+    waiting.clear();
+
+    stats.stored_states() = graph.nodes_count();
+    stats.reachable() = !witnesses.empty() && std::all_of(witnesses.begin(), witnesses.end(),
+                                                          [](node_sptr_t const & n) { return n.ptr() != nullptr; });
+  }
+
+  /*!
+   \brief Compute pending queries
+   \param queries : accepting labels of each query
+   \param witnesses : witness nodes
+   \return the set of indices i such that queries[i] is not empty and
+   witnesses[i] is nullptr
+   */
+  static boost::dynamic_bitset<> pending_queries(std::vector<boost::dynamic_bitset<>> const & queries,
+                                                 std::vector<node_sptr_t> const & witnesses)
+  {
+    boost::dynamic_bitset<> pending{queries.size()};
+    for (std::size_t i = 0; i < queries.size(); ++i)
+      if (!queries[i].none() && witnesses[i].ptr() == nullptr)
+        pending.set(i);
+    return pending;
+  }
+
+  /*!
+   \brief Check pending queries on a node
+   \param n : a node
+   \param ts : a transition system
+   \param queries : accepting labels of each query
+   \param pending : pending queries
+   \param witnesses : witness nodes
+   \post for each pending query i that is satisfied by n, witnesses[i] is n, i
+   has been removed from pending, and n has been flagged final
+   \return true if n satisfies some pending query, false otherwise
+   */
+  bool satisfy_queries(node_sptr_t const & n, TS & ts, std::vector<boost::dynamic_bitset<>> const & queries,
+                       boost::dynamic_bitset<> & pending, std::vector<node_sptr_t> & witnesses)
+  {
+    bool satisfied = false;
+    for (std::size_t i = pending.find_first(); i != boost::dynamic_bitset<>::npos; i = pending.find_next(i))
+      if (accepting(n, ts, queries[i])) {
+        n->final(true);
+        witnesses[i] = n;
+        pending.reset(i);
+        satisfied = true;
+      }
+    return satisfied;
+  }
+
+  /*!
+   \brief Replace a covered witness node
+   \param covered_node : a node removed from the graph
+   \param covering_node : the node that covers covered_node
+   \param witnesses : witness nodes
+   \post every occurrence of covered_node in witnesses has been replaced by
+   covering_node, which has been flagged final
+   \note covering_node satisfies the same queries as covered_node since the
+   covering relation is a trace inclusion
+   */
+  static void replace_witness(node_sptr_t const & covered_node, node_sptr_t const & covering_node,
+                              std::vector<node_sptr_t> & witnesses)
+  {
+    for (node_sptr_t & w : witnesses)
+      if (w == covered_node) {
+        w = covering_node;
+        covering_node->final(true);
+      }
+  }
 };
 
 } // end of namespace covreach
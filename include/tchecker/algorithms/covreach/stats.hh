@@ -98,7 +98,8 @@ public:
   /*!
    \brief Extract statistics as attributes (key, value)
    \param m : attributes map
-   \post every statistics has been added to m
+   \post every statistics has been added to m. Reachability is unknown if no
+   satisfying state has been found before the budget was exhausted
   */
   void attributes(std::map<std::string, std::string> & m) const;
 
@@ -10,14 +10,17 @@
 
 #include <cassert>
 #include <deque>
+#include <functional>
 #include <iterator>
 #include <stack>
 #include <vector>
 
 #include <boost/dynamic_bitset.hpp>
 
+#include "tchecker/algorithms/checkpoint.hh"
 #include "tchecker/algorithms/ndfs/graph.hh"
 #include "tchecker/algorithms/ndfs/stats.hh"
+#include "tchecker/algorithms/progress.hh"
 
 /*!
  \file algorithm.hh
@@ -94,6 +97,18 @@ template <class TS, class GRAPH> class algorithm_t {
 public:
   using node_sptr_t = typename GRAPH::node_sptr_t;
 
+  /*!
+   \brief Type of checkpoints. The stacks of the search are not saved, hence
+   the checkpoint function is called on the graph
+   */
+  using checkpoint_t = tchecker::algorithms::checkpoint_t<GRAPH, tchecker::algorithms::ndfs::stats_t>;
+
+  /*!
+   \brief Type of predicates on nodes that have already been expanded into the
+   graph (e.g. by a run saved in a checkpoint)
+   */
+  using expanded_t = std::function<bool(node_sptr_t const &)>;
+
   /*!
    \brief Check if a transition has an infinite run that satisfies a given set
    of labels and build the corresponding graph
@@ -110,9 +125,36 @@ public:
   tchecker::algorithms::ndfs::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels)
   {
     tchecker::algorithms::ndfs::stats_t stats;
+    checkpoint_t checkpoint;
 
     stats.set_start_time();
+    run(ts, graph, labels, expanded_t{}, stats, checkpoint);
+    stats.set_end_time();
+
+    return stats;
+  }
 
+  /*!
+   \brief Check if a transition has an infinite run that satisfies a given set
+   of labels and build the corresponding graph, reusing expanded nodes
+   \param ts : a transition system
+   \param graph : a graph
+   \param labels : accepting labels
+   \param expanded : predicate on the nodes of graph that have already been
+   expanded (empty if none)
+   \param stats : statistics
+   \param checkpoint : periodic checkpoint
+   \post same as run(ts, graph, labels), except that the successors of the
+   nodes that satisfy expanded are the targets of their outgoing edges in graph
+   instead of being computed by ts. Hence, if graph has been saved by an
+   interrupted run, along with its expanded nodes, the search replays the
+   interrupted run without calling ts, then continues it. checkpoint has been
+   called between two steps of the blue DFS
+   \note the start and end times in stats are not modified
+   */
+  void run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels, expanded_t const & expanded,
+           tchecker::algorithms::ndfs::stats_t & stats, checkpoint_t & checkpoint)
+  {
     std::vector<typename TS::sst_t> sst;
     ts.initial(sst);
     for (auto && [status, s, t] : sst) {
@@ -120,16 +162,12 @@ public:
       initial_node->initial(true);
       initial_node->final(accepting(initial_node, ts, labels));
       if (initial_node->color() == tchecker::algorithms::ndfs::WHITE)
-        dfs_blue(ts, graph, labels, stats, initial_node);
+        dfs_blue(ts, graph, labels, expanded, stats, checkpoint, initial_node);
       if (stats.cycle())
         break;
     }
 
     stats.stored_states() = graph.nodes_count();
-
-    stats.set_end_time();
-
-    return stats;
   }
 
 private:
@@ -139,13 +177,25 @@ private:
    \param graph : a graph
    \param n : a node
    \param labels : accepting labels
+   \param expanded : predicate on expanded nodes
    \post all successor nodes of n in ts have been added to graph (if not yet in)
-   with corresponding edges, and flag final set to true if accepting w.r.t labels
+   with corresponding edges, and flag final set to true if accepting w.r.t labels.
+   If n satisfies expanded, its successor nodes are taken from graph instead
    \return all successor nodes of n
   */
-  std::deque<node_sptr_t> expand_node(TS & ts, GRAPH & graph, node_sptr_t & n, boost::dynamic_bitset<> const & labels)
+  std::deque<node_sptr_t> expand_node(TS & ts, GRAPH & graph, node_sptr_t & n, boost::dynamic_bitset<> const & labels,
+                                      expanded_t const & expanded)
   {
     std::deque<node_sptr_t> next_nodes;
+    if (expanded && expanded(n)) {
+      // outgoing edges are in reverse order of insertion
+      for (typename GRAPH::edge_sptr_t const & e : graph.outgoing_edges(n)) {
+        node_sptr_t nextn = graph.edge_tgt(e);
+        nextn->final(accepting(nextn, ts, labels));
+        next_nodes.push_front(nextn);
+      }
+      return next_nodes;
+    }
     std::vector<typename TS::sst_t> v;
     ts.next(n->state_ptr(), v);
     for (auto && [status, s, t] : v) {
@@ -185,19 +235,24 @@ private:
    \param ts : a transition system
    \param graph : a graph
    \param labels : accepting labels
+   \param expanded : predicate on expanded nodes
    \param stats : statistics
+   \param checkpoint : periodic checkpoint
    \param n : node
   */
-  void dfs_blue(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels, tchecker::algorithms::ndfs::stats_t & stats,
-                node_sptr_t & n)
+  void dfs_blue(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels, expanded_t const & expanded,
+                tchecker::algorithms::ndfs::stats_t & stats, checkpoint_t & checkpoint, node_sptr_t & n)
   {
     std::stack<blue_stack_entry_t> stack;
 
     n->color() = tchecker::algorithms::ndfs::CYAN;
-    stack.push(blue_stack_entry_t{n, expand_node(ts, graph, n, labels), true});
+    stack.push(blue_stack_entry_t{n, expand_node(ts, graph, n, labels, expanded), true});
     ++stats.visited_states_blue();
+    tchecker::algorithms::publish_progress(stats.visited_states_blue() + stats.visited_states_red(), graph.nodes_count(), 0,
+                                           stack.size());
 
     while (!stack.empty()) {
+      checkpoint(graph, stats);
       auto && [s, succ, allred] = stack.top();
       if (succ.empty()) {
         if (allred)
@@ -222,8 +277,10 @@ private:
         }
         else if (t->color() == tchecker::algorithms::ndfs::WHITE) {
           t->color() = tchecker::algorithms::ndfs::CYAN;
-          stack.push(blue_stack_entry_t{t, expand_node(ts, graph, t, labels), true});
+          stack.push(blue_stack_entry_t{t, expand_node(ts, graph, t, labels, expanded), true});
           ++stats.visited_states_blue();
+          tchecker::algorithms::publish_progress(stats.visited_states_blue() + stats.visited_states_red(),
+                                                 graph.nodes_count(), 0, stack.size());
         }
         else if (t->color() != tchecker::algorithms::ndfs::RED)
           allred = false;
@@ -300,6 +357,8 @@ private:
 
     stack.push(red_stack_entry_t{n, graph.outgoing_edges(n)});
     ++stats.visited_states_red();
+    tchecker::algorithms::publish_progress(stats.visited_states_blue() + stats.visited_states_red(), graph.nodes_count(), 0,
+                                           stack.size());
 
     while (!stack.empty()) {
       red_stack_entry_t & top = stack.top();
@@ -316,6 +375,8 @@ private:
           t->color() = tchecker::algorithms::ndfs::RED;
           stack.push(red_stack_entry_t{t, graph.outgoing_edges(t)});
           ++stats.visited_states_red();
+          tchecker::algorithms::publish_progress(stats.visited_states_blue() + stats.visited_states_red(),
+                                                 graph.nodes_count(), 0, stack.size());
         }
       }
     }
@@ -162,7 +162,8 @@ private:
     while (!waiting.empty()) {
       if (waiting.top().fully_explored()) {
         waiting.pop();
-        seq.pop_back();
+        if (!seq.empty()) // no edge leads to the root node n
+          seq.pop_back();
         continue;
       }
 
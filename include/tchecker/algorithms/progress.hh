@@ -0,0 +1,161 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_PROGRESS_HH
+#define TCHECKER_ALGORITHMS_PROGRESS_HH
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*!
+ \file progress.hh
+ \brief Periodic progress reports of running algorithms
+ \note Algorithms publish their progress in the main loop with relaxed atomic
+ stores (see publish_progress). A reporter thread reads the published values
+ periodically, hence reporting does not slow down the algorithms
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace details {
+
+extern std::atomic<unsigned long> progress_visited; /*!< Number of visited states */
+extern std::atomic<unsigned long> progress_stored;  /*!< Number of stored states */
+extern std::atomic<unsigned long> progress_covered; /*!< Number of covered states */
+extern std::atomic<std::size_t> progress_waiting;   /*!< Size of the waiting container */
+
+} // end of namespace details
+
+/*!
+ \brief Publish progress of the running algorithm
+ \param visited : number of visited states
+ \param stored : number of stored states
+ \param covered : number of covered states
+ \param waiting : size of the waiting container
+ \post the values have been published for progress reports
+ \note this function is meant to be called in the main loop of algorithms:
+ it only performs relaxed atomic stores
+ */
+inline void publish_progress(unsigned long visited, unsigned long stored, unsigned long covered, std::size_t waiting)
+{
+  tchecker::algorithms::details::progress_visited.store(visited, std::memory_order_relaxed);
+  tchecker::algorithms::details::progress_stored.store(stored, std::memory_order_relaxed);
+  tchecker::algorithms::details::progress_covered.store(covered, std::memory_order_relaxed);
+  tchecker::algorithms::details::progress_waiting.store(waiting, std::memory_order_relaxed);
+}
+
+/*!
+ \brief Parse a progress period
+ \param s : a string
+ \return the period in s: a positive number followed by a unit ms, s (default)
+ or m
+ \throw std::invalid_argument : if s is not a positive period
+ */
+std::chrono::milliseconds parse_progress_period(std::string const & s);
+
+/*!
+ \brief Current resident set size
+ \return current resident set size of the process in bytes, or the maximal
+ resident set size if the current one cannot be measured
+ */
+std::size_t current_rss();
+
+/*!
+ \brief Formats of progress reports
+ */
+enum progress_format_t {
+  PROGRESS_TEXT, /*!< One human-readable line per report */
+  PROGRESS_JSON, /*!< One JSON object per line */
+};
+
+/*!
+ \class progress_reporter_t
+ \brief Thread that periodically reports the progress published by the running
+ algorithm (see publish_progress)
+ \note each report gives the elapsed time, the number of visited, stored and
+ covered states, the size of the waiting container, the number of visited
+ states per second since the previous report, the current resident set size
+ and the memory allocated by pools
+ */
+class progress_reporter_t {
+public:
+  /*!
+   \brief Constructor
+   \param period : time between two reports
+   \param os : output stream
+   \param format : format of reports
+   \pre period > 0
+   \post a thread that outputs a report to os every period has been started
+   \throw std::invalid_argument : if period is not positive
+   \note published values are reset
+   */
+  progress_reporter_t(std::chrono::milliseconds period, std::ostream & os, enum tchecker::algorithms::progress_format_t format);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  progress_reporter_t(tchecker::algorithms::progress_reporter_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  progress_reporter_t(tchecker::algorithms::progress_reporter_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post the reporting thread has been stopped
+   */
+  ~progress_reporter_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::algorithms::progress_reporter_t & operator=(tchecker::algorithms::progress_reporter_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::algorithms::progress_reporter_t & operator=(tchecker::algorithms::progress_reporter_t &&) = delete;
+
+  /*!
+   \brief Output a report
+   \post a report of the published progress has been output
+   \note called by the reporting thread
+   */
+  void report();
+
+private:
+  /*!
+   \brief Body of the reporting thread
+   */
+  void run();
+
+  std::chrono::milliseconds _period;                              /*!< Time between two reports */
+  std::ostream & _os;                                             /*!< Output stream */
+  enum tchecker::algorithms::progress_format_t _format;           /*!< Format of reports */
+  std::chrono::time_point<std::chrono::steady_clock> _start_time; /*!< Starting time */
+  std::chrono::time_point<std::chrono::steady_clock> _last_time;  /*!< Time of last report */
+  unsigned long _last_visited;                                    /*!< Visited states at last report */
+  bool _stop;                                                     /*!< Stop flag */
+  std::mutex _mutex;                                              /*!< Mutex for stop flag */
+  std::condition_variable _cv;                                    /*!< Wakes up the thread when stopping */
+  std::thread _thread;                                            /*!< Reporting thread */
+};
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_PROGRESS_HH
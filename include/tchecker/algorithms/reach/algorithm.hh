@@ -8,12 +8,20 @@
 #ifndef TCHECKER_ALGORITHMS_REACH_ALGORITHM_HH
 #define TCHECKER_ALGORITHMS_REACH_ALGORITHM_HH
 
+#include <algorithm>
 #include <memory>
+#include <tuple>
+#include <vector>
 
 #include <boost/dynamic_bitset.hpp>
 
+#include "tchecker/algorithms/budget.hh"
+#include "tchecker/algorithms/checkpoint.hh"
+#include "tchecker/algorithms/progress.hh"
 #include "tchecker/algorithms/reach/stats.hh"
 #include "tchecker/basictypes.hh"
+#include "tchecker/utils/profile.hh"
+#include "tchecker/utils/trace.hh"
 #include "tchecker/waiting/factory.hh"
 
 /*!
@@ -41,6 +49,12 @@ template <class TS, class GRAPH> class algorithm_t {
 public:
   using node_sptr_t = typename GRAPH::node_sptr_t;
 
+  /*!
+   \brief Type of checkpoint
+   */
+  using checkpoint_t = tchecker::algorithms::checkpoint_t<tchecker::waiting::waiting_t<node_sptr_t>,
+                                                          tchecker::algorithms::reach::stats_t>;
+
   /*!
    \brief Build a reachability graph of a transition system from its initial
    states
@@ -48,37 +62,24 @@ public:
    \param graph : a graph
    \param labels : accepting labels
    \param policy : waiting list policy
+   \param budget : resource budget
    \post graph is built from a traversal of ts starting from its initial states,
-   until a state that satisfies labels is reached (if any).
+   until a state that satisfies labels is reached (if any), or until budget is
+   exhausted.
    A node is created for each reachable state in ts, and an edge is created for
    each transition in ts. The order in which the nodes of ts are visited depends
    on policy.
    \return statistics on the run
    \note if labels is empty, graph is the full reachability graph of ts
+   \note if budget is exhausted, graph is a partial reachability graph and the
+   exhausted limit is reported in the statistics
    */
   tchecker::algorithms::reach::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
-                                           enum tchecker::waiting::policy_t policy)
+                                           enum tchecker::waiting::policy_t policy,
+                                           tchecker::algorithms::budget_t const & budget = tchecker::algorithms::budget_t{})
   {
-    std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
-
-    tchecker::algorithms::reach::stats_t stats;
-
-    stats.set_start_time();
-
-    std::vector<typename TS::sst_t> sst;
-    ts.initial(sst);
-    for (auto && [status, s, t] : sst) {
-      auto && [is_new_node, initial_node] = graph.add_node(s);
-      initial_node->initial(true);
-      if (is_new_node)
-        waiting->insert(initial_node);
-    }
-
-    run_from_waiting(ts, graph, labels, *waiting, stats);
-
-    stats.set_end_time();
-
-    return stats;
+    std::vector<node_sptr_t> witnesses;
+    return run(ts, graph, std::vector<boost::dynamic_bitset<>>{labels}, policy, witnesses, budget);
   }
 
   /*!
@@ -101,62 +102,245 @@ public:
                                            tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting)
   {
     tchecker::algorithms::reach::stats_t stats;
+    checkpoint_t checkpoint;
 
     stats.set_start_time();
-    run_from_waiting(ts, graph, labels, waiting, stats);
+    run(ts, graph, labels, waiting, stats, checkpoint);
     stats.set_end_time();
 
     return stats;
   }
 
+  /*!
+  \brief Continue building a reachability graph of a transition system from a
+  waiting container
+  \param ts : a transition system
+  \param graph : a graph
+  \param labels : accepting labels
+  \param waiting : a waiting container
+  \param stats : statistics
+  \param checkpoint : periodic checkpoint
+  \param budget : resource budget
+  \pre the nodes in waiting belong to graph
+  \post graph is built from a traversal of ts starting from the nodes in
+  waiting, until a state that satisfies labels is reached (if any), or until
+  budget is exhausted.
+  stats has been updated with the visited states and transitions, and the
+  reachability of labels. checkpoint has been called before the visit of each
+  node.
+  \note this allows to resume a run from a saved graph, waiting container and
+  statistics
+  \note the start and end times in stats are not modified
+  */
+  void run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+           tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting, tchecker::algorithms::reach::stats_t & stats,
+           checkpoint_t & checkpoint, tchecker::algorithms::budget_t const & budget = tchecker::algorithms::budget_t{})
+  {
+    std::vector<node_sptr_t> witnesses{node_sptr_t{nullptr}};
+    run_from_waiting(ts, graph, std::vector<boost::dynamic_bitset<>>{labels}, waiting, witnesses, stats, checkpoint, budget);
+  }
+
+  /*!
+   \brief Build a reachability graph of a transition system from its initial
+   states, answering several reachability queries at once
+   \param ts : a transition system
+   \param graph : a graph
+   \param queries : accepting labels of each query
+   \param policy : waiting list policy
+   \param witnesses : witness nodes
+   \param budget : resource budget
+   \post graph is built from a traversal of ts starting from its initial states,
+   until every query has been satisfied, or until the entire state-space has
+   been exhausted, or until budget is exhausted.
+   witnesses has the same size as queries, and witnesses[i] is the first visited
+   node that satisfies queries[i] if any, nullptr otherwise. Witness nodes are
+   flagged final, and they are expanded like any other node.
+   \return statistics on the run, the reachability flag is set iff all queries
+   have been satisfied
+   \note an empty query is never satisfied. If all queries are empty, graph is
+   the full reachability graph of ts
+   */
+  tchecker::algorithms::reach::stats_t run(TS & ts, GRAPH & graph, std::vector<boost::dynamic_bitset<>> const & queries,
+                                           enum tchecker::waiting::policy_t policy, std::vector<node_sptr_t> & witnesses,
+                                           tchecker::algorithms::budget_t const & budget = tchecker::algorithms::budget_t{})
+  {
+    std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+
+    tchecker::algorithms::reach::stats_t stats;
+    checkpoint_t checkpoint;
+
+    witnesses.assign(queries.size(), node_sptr_t{nullptr});
+
+    stats.set_start_time();
+
+    std::vector<typename TS::sst_t> sst;
+    ts.initial(sst);
+    for (auto && [status, s, t] : sst) {
+      auto && [is_new_node, initial_node] = graph.add_node(s);
+      initial_node->initial(true);
+      if (is_new_node)
+        waiting->insert(initial_node);
+    }
+
+    run_from_waiting(ts, graph, queries, *waiting, witnesses, stats, checkpoint, budget);
+
+    stats.set_end_time();
+
+    return stats;
+  }
+
+  /*!
+   \brief Continue building a reachability graph of a transition system from a
+   waiting container, answering several reachability queries at once
+   \param ts : a transition system
+   \param graph : a graph
+   \param queries : accepting labels of each query
+   \param waiting : a waiting container
+   \param witnesses : witness nodes
+   \param stats : statistics
+   \param checkpoint : periodic checkpoint
+   \param budget : resource budget
+   \pre the nodes in waiting belong to graph, witnesses has the same size as
+   queries, and witnesses[i] is nullptr if queries[i] has not been satisfied yet
+   \post graph is built from a traversal of ts starting from the nodes in
+   waiting, as described for run above. checkpoint has been called before the
+   visit of each node. The budget status has been set in stats
+   \note this allows to resume a run from a saved graph, waiting container,
+   witnesses and statistics
+   \note the start and end times in stats are not modified
+   */
+  void run(TS & ts, GRAPH & graph, std::vector<boost::dynamic_bitset<>> const & queries,
+           tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting, std::vector<node_sptr_t> & witnesses,
+           tchecker::algorithms::reach::stats_t & stats, checkpoint_t & checkpoint,
+           tchecker::algorithms::budget_t const & budget = tchecker::algorithms::budget_t{})
+  {
+    run_from_waiting(ts, graph, queries, waiting, witnesses, stats, checkpoint, budget);
+  }
+
 private:
   /*!
   \brief Build a reachability graph of a transition system from a waiting
   container
   \param ts : a transition system
   \param graph : a graph
-  \param labels : accepting labels
+  \param queries : accepting labels of each query
   \param waiting : a waiting container
+  \param witnesses : witness nodes
   \param stats : statistics
+  \param checkpoint : periodic checkpoint
+  \param budget : resource budget
+  \pre witnesses has the same size as queries
   \post graph is built from a traversal of ts starting from the nodes in
-  waiting, until a state that satisfies labels is reached (if any).
+  waiting, until every non-empty query has been satisfied, or until budget is
+  exhausted.
   A node is created for each reachable state in ts, and an edge is
   created for each transition is ts. The order in which the nodes of ts are
   visited depends on the policy implemented by waiting.
-  The number of visited nodes and reachability of a satisfying node have been
-  set in stats.
+  witnesses[i] is the first visited node that satisfies queries[i] if any. The
+  number of visited nodes and the reachability of all queries have been set in
+  stats. checkpoint has been called before the visit of each node. The budget
+  status has been set in stats.
+  \note the graph is fully explored if no query is pending (e.g. all queries
+  are empty)
   */
-  void run_from_waiting(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+  void run_from_waiting(TS & ts, GRAPH & graph, std::vector<boost::dynamic_bitset<>> const & queries,
                         tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting,
-                        tchecker::algorithms::reach::stats_t & stats)
+                        std::vector<node_sptr_t> & witnesses, tchecker::algorithms::reach::stats_t & stats,
+                        checkpoint_t & checkpoint, tchecker::algorithms::budget_t const & budget)
   {
     std::vector<typename TS::sst_t> sst;
+    boost::dynamic_bitset<> pending = pending_queries(queries, witnesses);
+    tchecker::trace::batch_t batch{"expand", "exploration", tchecker::trace::EXPLORATION_BATCH};
 
     while (!waiting.empty()) {
-      node_sptr_t node = waiting.first();
-      waiting.remove_first();
+      checkpoint(waiting, stats);
+
+      stats.budget_status() = budget.check(stats.start_time(), graph.nodes_count());
+      if (stats.budget_exhausted())
+        break;
+
+      node_sptr_t node;
+      {
+        tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_WAITING};
+        node = waiting.first();
+        waiting.remove_first();
+      }
 
       ++stats.visited_states();
+      tchecker::algorithms::publish_progress(stats.visited_states(), graph.nodes_count(), 0, waiting.size());
 
-      if (accepting(node, ts, labels)) {
-        node->final(true);
-        stats.reachable() = true;
+      if (satisfy_queries(node, ts, queries, pending, witnesses) && pending.none())
         break;
-      }
 
       ts.next(node->state_ptr(), sst);
       for (auto && [status, s, t] : sst) {
-        auto && [is_new_node, next_node] = graph.add_node(s);
-        if (is_new_node)
-          waiting.insert(next_node);
-        graph.add_edge(node, next_node, *t);
+        std::tuple<bool, node_sptr_t> added;
+        {
+          tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_GRAPH};
+          added = graph.add_node(s);
+          graph.add_edge(node, std::get<1>(added), *t);
+        }
+        if (std::get<0>(added)) {
+          tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_WAITING};
+          waiting.insert(std::get<1>(added));
+        }
 
         ++stats.visited_transitions();
       }
       sst.clear();
+
+      if (batch.tick()) {
+        tchecker::trace::counter("waiting", {"nodes", static_cast<long long>(waiting.size())});
+        tchecker::trace::counter("graph", {"stored", static_cast<long long>(graph.nodes_count())});
+      }
     }
 
     waiting.clear();
+
+    stats.reachable() = !witnesses.empty() && std::all_of(witnesses.begin(), witnesses.end(),
+                                                          [](node_sptr_t const & n) { return n.ptr() != nullptr; });
+  }
+
+  /*!
+   \brief Compute pending queries
+   \param queries : accepting labels of each query
+   \param witnesses : witness nodes
+   \return the set of indices i such that queries[i] is not empty and
+   witnesses[i] is nullptr
+   */
+  static boost::dynamic_bitset<> pending_queries(std::vector<boost::dynamic_bitset<>> const & queries,
+                                                 std::vector<node_sptr_t> const & witnesses)
+  {
+    boost::dynamic_bitset<> pending{queries.size()};
+    for (std::size_t i = 0; i < queries.size(); ++i)
+      if (!queries[i].none() && witnesses[i].ptr() == nullptr)
+        pending.set(i);
+    return pending;
+  }
+
+  /*!
+   \brief Check pending queries on a node
+   \param n : a node
+   \param ts : a transition system
+   \param queries : accepting labels of each query
+   \param pending : pending queries
+   \param witnesses : witness nodes
+   \post for each pending query i that is satisfied by n, witnesses[i] is n, i
+   has been removed from pending, and n has been flagged final
+   \return true if n satisfies some pending query, false otherwise
+   */
+  bool satisfy_queries(node_sptr_t const & n, TS & ts, std::vector<boost::dynamic_bitset<>> const & queries,
+                       boost::dynamic_bitset<> & pending, std::vector<node_sptr_t> & witnesses)
+  {
+    bool satisfied = false;
+    for (std::size_t i = pending.find_first(); i != boost::dynamic_bitset<>::npos; i = pending.find_next(i))
+      if (accepting(n, ts, queries[i])) {
+        n->final(true);
+        witnesses[i] = n;
+        pending.reset(i);
+        satisfied = true;
+      }
+    return satisfied;
   }
 
   /*!
@@ -12,6 +12,8 @@
 #include <map>
 #include <string>
 
+#include "tchecker/algorithms/budget.hh"
+
 /*!
  \file stats.hh
  \brief Statistics for algorithms
@@ -27,8 +29,15 @@ namespace algorithms {
  */
 class stats_t {
 public:
+  /*!
+   \brief Constructor
+   */
+  stats_t();
+
   /*!
    \brief Set starting time
+   \post hot-path counters and profile have been reset (see tchecker::counters and
+   tchecker::profile)
   */
   void set_start_time();
 
@@ -55,6 +64,20 @@ public:
   */
   double running_time() const;
 
+  /*!
+   \brief Accessor
+   \return Reference to the running time of the runs that have been resumed by
+   this run, in seconds (0 if this run has not been resumed)
+   */
+  double & resumed_running_time();
+
+  /*!
+   \brief Accessor
+   \return Running time of the runs that have been resumed by this run, in
+   seconds (0 if this run has not been resumed)
+   */
+  double resumed_running_time() const;
+
   /*!
    \brief Accessor
    \return maximum resident set size, -1 if an error occurred
@@ -62,16 +85,44 @@ public:
   */
   long max_rss() const;
 
+  /*!
+   \brief Accessor
+   \return Reference to the budget status
+   */
+  enum tchecker::algorithms::budget_status_t & budget_status();
+
+  /*!
+   \brief Accessor
+   \return Budget status: BUDGET_AVAILABLE if the algorithm has not been stopped
+   by its budget, the exhausted limit otherwise
+   */
+  enum tchecker::algorithms::budget_status_t budget_status() const;
+
+  /*!
+   \brief Accessor
+   \return true if the algorithm has been stopped by its budget, false otherwise
+   */
+  bool budget_exhausted() const;
+
   /*!
    \brief Extract statistics as attributes (key, value)
    \param m : attributes map
-   \post Starting time, ending time and running time have been added to m
+   \post Starting time, ending time and running time have been added to m. The
+   running time only covers this run, and the total running time, including the
+   resumed runs, has been added to m if this run has resumed other runs. The
+   exhausted budget has been added to m if the algorithm has been stopped by its
+   budget. Hot-path counters have been added to m if TChecker has been built with
+   option TCHECKER_COUNTERS (see tchecker::counters::attributes). The time spent in
+   each phase has been added to m if profiling is enabled (see
+   tchecker::profile::attributes)
   */
   void attributes(std::map<std::string, std::string> & m) const;
 
 private:
   std::chrono::time_point<std::chrono::steady_clock> _start_time; /*!< Start time */
   std::chrono::time_point<std::chrono::steady_clock> _end_time;   /*!< End time */
+  double _resumed_running_time;                                   /*!< Running time of resumed runs (seconds) */
+  enum tchecker::algorithms::budget_status_t _budget_status;       /*!< Budget status */
 };
 
 } // end of namespace algorithms
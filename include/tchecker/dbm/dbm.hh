@@ -10,6 +10,7 @@
 
 #include <functional>
 #include <iostream>
+#include <vector>
 
 #include "tchecker/basictypes.hh"
 #include "tchecker/dbm/db.hh"
@@ -974,6 +975,76 @@ enum clock_position_t {
 enum tchecker::dbm::clock_position_t clock_position(tchecker::dbm::db_t const * dbm, tchecker::clock_id_t dim,
                                                     tchecker::clock_id_t x1, tchecker::clock_id_t x2);
 
+/*!
+ \class db_constraint_t
+ \brief Difference constraint x_i - x_j # c in a reduced DBM
+ */
+struct db_constraint_t {
+  tchecker::clock_id_t i; /*!< First clock */
+  tchecker::clock_id_t j; /*!< Second clock */
+  tchecker::dbm::db_t db; /*!< Difference bound #c on x_i - x_j */
+};
+
+/*!
+ \brief Reduce a DBM to a minimal set of constraints
+ \param dbm : a dbm
+ \param dim : dimension of dbm
+ \param constraints : container of constraints
+ \pre dbm is not nullptr (checked by assertion)
+ dbm is a dim*dim array of difference bounds
+ dbm is consistent (checked by assertion)
+ dbm is tight (checked by assertion)
+ dim >= 1 (checked by assertion)
+ \post constraints contains a minimal set of constraints that defines the same
+ zone as dbm (previous content of constraints has been removed). Clocks are
+ partitioned in classes of clocks that have a fixed difference in dbm. Each
+ class is represented by a cycle of constraints, and constraints between classes
+ that are implied by two other constraints have been removed (see Larsen, Larsson,
+ Pettersson and Yi, "Efficient verification of real-time systems: compact data
+ structure and state-space reduction", RTSS 1997)
+ \note constraints allows to store dbm with O(dim) constraints in most cases,
+ instead of dim*dim difference bounds. Use tchecker::dbm::expand to get dbm
+ back
+ */
+void reduce(tchecker::dbm::db_t const * dbm, tchecker::clock_id_t dim,
+            std::vector<tchecker::dbm::db_constraint_t> & constraints);
+
+/*!
+ \brief Expand a set of constraints into a DBM
+ \param dbm : a dbm
+ \param dim : dimension of dbm
+ \param constraints : constraints
+ \pre dbm is not nullptr (checked by assertion)
+ dbm is a dim*dim array of difference bounds
+ dim >= 1 (checked by assertion)
+ the clocks in constraints are less than dim (checked by assertion)
+ \post dbm is the tight DBM that represents the conjunction of constraints if it
+ is not empty, and dbm is empty otherwise
+ \return tchecker::dbm::EMPTY if the conjunction of constraints is empty,
+ tchecker::dbm::NON_EMPTY otherwise
+ \note tchecker::dbm::expand is the inverse of tchecker::dbm::reduce
+ */
+enum tchecker::dbm::status_t expand(tchecker::dbm::db_t * dbm, tchecker::clock_id_t dim,
+                                    std::vector<tchecker::dbm::db_constraint_t> const & constraints);
+
+/*!
+ \brief Inclusion predicate w.r.t. a reduced DBM
+ \param dbm : a dbm
+ \param dim : dimension of dbm
+ \param constraints : constraints
+ \pre dbm is not nullptr (checked by assertion)
+ dbm is a dim*dim array of difference bounds
+ dbm is tight (checked by assertion)
+ dim >= 1 (checked by assertion)
+ the clocks in constraints are less than dim (checked by assertion)
+ \return true if dbm is included in the conjunction of constraints, false
+ otherwise
+ \note this checks inclusion of dbm into a reduced DBM without expanding it, in
+ time linear in the number of constraints
+ */
+bool is_le(tchecker::dbm::db_t const * dbm, tchecker::clock_id_t dim,
+           std::vector<tchecker::dbm::db_constraint_t> const & constraints);
+
 } // end of namespace dbm
 
 } // end of namespace tchecker
@@ -9,6 +9,7 @@
 #define TCHECKER_EXPRESSION_STATIC_ANALYSIS_HH
 
 #include <unordered_set>
+#include <vector>
 
 #include "tchecker/basictypes.hh"
 #include "tchecker/expression/expression.hh"
@@ -120,6 +121,18 @@ struct has_clock_constraints_t {
  */
 tchecker::has_clock_constraints_t has_clock_constraints(tchecker::typed_expression_t const & expr);
 
+/*!
+ \brief Extract the clocks of diagonal clock constraints in a typed expression
+ \param expr : expression
+ \param diagonals : a vector of sets of clock IDs
+ \post for every diagonal clock constraint x - y # c in expr, the set of clock IDs
+ that x and y may refer to has been added to diagonals. For clock arrays x[e], the
+ entire range of IDs of array x is added if the value of e cannot be determined
+ statically (see tchecker::extract_lvalue_variable_ids)
+ */
+void extract_diagonal_clocks(tchecker::typed_expression_t const & expr,
+                             std::vector<std::unordered_set<tchecker::clock_id_t>> & diagonals);
+
 } // end of namespace tchecker
 
 #endif // TCHECKER_EXPRESSION_STATIC_ANALYSIS_HH
@@ -257,9 +257,7 @@ inline tchecker::state_status_t next(tchecker::ta::system_t const & system, tche
 
 /*!
  \brief Type of iterator over incoming edges
- \note this iterator ranges over the set of tuple of process locations and bounded integer
- variables valuations in the given system, the size of which is exponential in the number
- of locations and processes, as well as in the domains of bounded integer variables
+ \note see tchecker::ta::incoming_edges_iterator_t
  */
 using incoming_edges_iterator_t = tchecker::ta::incoming_edges_iterator_t;
 
@@ -272,10 +270,13 @@ using incoming_edges_range_t = tchecker::ta::incoming_edges_range_t;
  \brief Accessor to incoming edges
  \param system : a system
  \param vloc : tuple of locations
- \return range of incoming synchronized and asynchronous edges to vloc in system
+ \param intval : valuation of bounded integer variables
+ \return range of incoming synchronized and asynchronous edges to vloc in system, along
+ with candidate source valuations of bounded integer variables w.r.t. intval
  */
 tchecker::fsm::incoming_edges_range_t incoming_edges(tchecker::ta::system_t const & system,
-                                                     tchecker::const_vloc_sptr_t const & vloc);
+                                                     tchecker::const_vloc_sptr_t const & vloc,
+                                                     tchecker::const_intval_sptr_t const & intval);
 
 /*!
  \brief Dereference type for iterator over incoming edges
@@ -637,9 +638,10 @@ public:
    \brief Accessor
    \param s : state
    \return incoming edges to state s
-   \note the return range goes across all tuples of process locations and bounded integer variabkes
-   valuations in the given system. The number of such tuples is exponential in the number of locations
-   and processes, as well as the domains of bounded integer variables
+   \note the return range goes across all tuples of process locations in the given system, and for
+   each tuple of edges, across the candidate source valuations of the bounded integer variables (see
+   tchecker::ta::incoming_edges_iterator_t). The number of such tuples is exponential in the number of
+   locations and processes, and in the sizes of the intervals of candidate values
    */
   virtual incoming_edges_range_t incoming_edges(tchecker::fsm::const_state_sptr_t const & s);
 
@@ -111,6 +111,15 @@ public:
    */
   std::size_t memsize() const { return _node_pool.memsize(); }
 
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by this node allocator
+   */
+  tchecker::collection_stats_t collection_stats() const
+  {
+    return _node_pool.collection_stats();
+  }
+
 protected:
   tchecker::pool_t<NODE> _node_pool; /*!< Pool of nodes */
 };
@@ -203,6 +212,15 @@ public:
    */
   std::size_t memsize() const { return _edge_pool.memsize(); }
 
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by this edge allocator
+   */
+  tchecker::collection_stats_t collection_stats() const
+  {
+    return _edge_pool.collection_stats();
+  }
+
 protected:
   tchecker::pool_t<EDGE> _edge_pool; /*!< Pool of edges */
 };
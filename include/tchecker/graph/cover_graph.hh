@@ -8,6 +8,7 @@
 #ifndef TCHECKER_COVER_GRAPH_HH
 #define TCHECKER_COVER_GRAPH_HH
 
+#include "tchecker/utils/counters.hh"
 #include "tchecker/utils/hashtable.hh"
 #include "tchecker/utils/iterator.hh"
 
@@ -145,13 +146,18 @@ public:
    */
   bool is_covered(NODE_SPTR const & n, NODE_SPTR & covering_node) const
   {
+    [[maybe_unused]] unsigned long scanned = 0;
     auto && range = _nodes.collision_range(n);
     for (NODE_SPTR const & node : range) {
+      if constexpr (tchecker::counters::enabled())
+        ++scanned;
       if ((n != node) && _node_le(n, node)) {
+        count_covering_check(scanned);
         covering_node = node;
         return true;
       }
     }
+    count_covering_check(scanned);
     covering_node = nullptr;
     return false;
   }
@@ -173,6 +179,32 @@ public:
         ins = node;
   }
 
+  /*!
+   \brief Find a node in the graph that matches a given node
+   \param n : a node
+   \param pred : a predicate, callable with two NODE_SPTR arguments
+   \param node : a node
+   \post node is a node in this graph, with the same hash value as n, such that
+   pred(n, node) is true, if any, nullptr otherwise
+   \return true if a matching node has been found for n, false otherwise
+   \note Only the nodes which have the same hash value than n w.r.t. NODE_SPTR_HASH
+   are considered. In particular, n may belong to another graph as long as it can be
+   hashed by NODE_SPTR_HASH
+   \note this function ensures that n never matches itself
+   */
+  template <class PREDICATE> bool find_node(NODE_SPTR const & n, PREDICATE && pred, NODE_SPTR & node) const
+  {
+    auto && range = _nodes.collision_range(n);
+    for (NODE_SPTR const & candidate : range) {
+      if ((n != candidate) && pred(n, candidate)) {
+        node = candidate;
+        return true;
+      }
+    }
+    node = nullptr;
+    return false;
+  }
+
   /*!
    \brief Accessor
    \return Number of nodes in this graph
@@ -212,6 +244,18 @@ public:
   }
 
 private:
+  /*!
+   \brief Count a covering check
+   \param scanned : number of nodes scanned in the collision list
+   \post the counters of covering checks and of scanned nodes have been updated
+   */
+  static inline void count_covering_check(unsigned long scanned)
+  {
+    tchecker::counters::increment(tchecker::counters::COVER_CHECKS);
+    tchecker::counters::increment(tchecker::counters::COVER_SCANNED_NODES, scanned);
+    tchecker::counters::maximize(tchecker::counters::COVER_SCANNED_NODES_MAX, scanned);
+  }
+
   tchecker::collision_table_t<NODE_SPTR, NODE_SPTR_HASH> _nodes; /*!< Set of nodes */
   NODE_SPTR_LE _node_le;                                         /*!< Covering predicate on node pointers */
 };
@@ -15,6 +15,8 @@
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 
 #include "tchecker/basictypes.hh"
 #include "tchecker/utils/allocation_size.hh"
@@ -156,6 +158,65 @@ std::ostream & dot_output(std::ostream & os, GRAPH const & g, std::string const
   return os;
 }
 
+/*!
+ \brief Output a graph in graphviz DOT language, in storage order
+ \tparam GRAPH : type of graph, should provide types GRAPH::node_sptr_t,
+ GRAPH::edge_sptr_t, method GRAPH::nodes() that returns the range of nodes,
+ method GRAPH::nodes_count() that returns the number of nodes, and a method
+ GRAPH::outgoing_edges(n) that returns the range of outgoing edges of node n
+ \param os : output stream
+ \param g : a graph
+ \param name : graph name
+ \post the graph g has been output to os in the graphviz DOT language. The nodes
+ are output in the order of GRAPH::nodes() and identified by their position in
+ this order. The edges are output in the order of GRAPH::nodes() on their source
+ node, then in the order of GRAPH::outgoing_edges()
+ \throw std::runtime_error : if the source or target node of an edge is not in g
+ \note nodes and edges are output as they are visited, without being sorted:
+ this only stores the identifier of each node. The output is the same for two
+ graphs with the same nodes and edges stored in the same order (in particular
+ for two runs of a deterministic algorithm with the same parameters). The
+ output can be sorted afterwards with tck-sort-graph
+ */
+template <class GRAPH> std::ostream & dot_output_stream(std::ostream & os, GRAPH const & g, std::string const & name)
+{
+  using node_id_t = std::size_t;
+  using node_t = typename std::remove_reference<decltype(*std::declval<typename GRAPH::node_sptr_t>())>::type;
+
+  std::unordered_map<node_t const *, node_id_t> nodes_map;
+  nodes_map.reserve(g.nodes_count());
+
+  std::map<std::string, std::string> attr;
+
+  tchecker::graph::dot_output_header(os, name);
+
+  for (typename GRAPH::node_sptr_t const & n : g.nodes()) {
+    node_id_t const id = nodes_map.size();
+    nodes_map.emplace(&*n, id);
+    attr.clear();
+    g.attributes(n, attr);
+    tchecker::graph::dot_output_node(os, std::to_string(id), attr);
+  }
+
+  for (typename GRAPH::node_sptr_t const & n : g.nodes()) {
+    for (typename GRAPH::edge_sptr_t const & e : g.outgoing_edges(n)) {
+      auto it_src = nodes_map.find(&*g.edge_src(e));
+      if (it_src == nodes_map.end())
+        throw std::runtime_error("tchecker::graph::dot_output_stream: source node not found");
+      auto it_tgt = nodes_map.find(&*g.edge_tgt(e));
+      if (it_tgt == nodes_map.end())
+        throw std::runtime_error("tchecker::graph::dot_output_stream: target node not found");
+      attr.clear();
+      g.attributes(e, attr);
+      tchecker::graph::dot_output_edge(os, std::to_string(it_src->second), std::to_string(it_tgt->second), attr);
+    }
+  }
+
+  tchecker::graph::dot_output_footer(os);
+
+  return os;
+}
+
 } // end of namespace graph
 
 } // end of namespace tchecker
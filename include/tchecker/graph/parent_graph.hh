@@ -0,0 +1,357 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_PARENT_GRAPH_HH
+#define TCHECKER_PARENT_GRAPH_HH
+
+/*!
+ \file parent_graph.hh
+ \brief Graph that only keeps a pointer to the parent of each node
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <tuple>
+#include <vector>
+
+#include "tchecker/graph/allocators.hh"
+#include "tchecker/graph/find_graph.hh"
+#include "tchecker/syncprod/vedge.hh"
+#include "tchecker/utils/allocation_size.hh"
+#include "tchecker/utils/iterator.hh"
+#include "tchecker/utils/shared_objects.hh"
+
+namespace tchecker {
+
+namespace graph {
+
+namespace parent {
+
+/*!
+ \class node_t
+ \brief Type of parent graph node that inherits from NODE
+ \tparam NODE : type of user node
+ \note each node keeps a (non-owning) pointer to its parent node, and a shared
+ pointer to the vedge from its parent node
+ */
+template <class NODE> class node_t : public NODE, public tchecker::hashtable_object_t {
+public:
+  using NODE::NODE;
+
+  /*!
+   \brief Accessor
+   \return pointer to the parent of this node, nullptr if this node has no parent
+   */
+  inline tchecker::graph::parent::node_t<NODE> const * parent() const { return _parent; }
+
+  /*!
+   \brief Accessor
+   \return vedge from the parent of this node to this node
+   \pre this node has a parent (checked by assertion)
+   */
+  inline tchecker::const_vedge_sptr_t const & parent_vedge() const
+  {
+    assert(_parent != nullptr);
+    return _parent_vedge;
+  }
+
+  /*!
+   \brief Set parent
+   \param parent : parent node
+   \param vedge : vedge from parent to this node
+   \post parent is the parent of this node, and vedge is the vedge from parent to
+   this node
+   */
+  inline void set_parent(tchecker::graph::parent::node_t<NODE> const * parent, tchecker::const_vedge_sptr_t const & vedge)
+  {
+    _parent = parent;
+    _parent_vedge = vedge;
+  }
+
+private:
+  tchecker::graph::parent::node_t<NODE> const * _parent{nullptr}; /*!< Parent node */
+  tchecker::const_vedge_sptr_t _parent_vedge{nullptr};             /*!< Vedge from the parent node */
+};
+
+/*!
+ \brief Type of shared node
+ \tparam NODE : type of user node
+ */
+template <class NODE> using shared_node_t = tchecker::make_shared_t<tchecker::graph::parent::node_t<NODE>>;
+
+/*!
+ \brief Type of pointer to shared node
+ \tparam NODE : type of user node
+ */
+template <class NODE> using node_sptr_t = tchecker::intrusive_shared_ptr_t<tchecker::graph::parent::shared_node_t<NODE>>;
+
+} // end of namespace parent
+
+} // end of namespace graph
+
+/*!
+ \class allocation_size_t
+ \brief Specialisation of class allocation_size_t for type tchecker::graph::parent::node_t
+ */
+template <class NODE> class allocation_size_t<tchecker::graph::parent::node_t<NODE>> {
+public:
+  /*!
+   \brief Allocation size for objects of type tchecker::graph::parent::node_t
+   \note unused parameters
+   */
+  template <class... ARGS> static std::size_t alloc_size(ARGS &&...)
+  {
+    return sizeof(tchecker::graph::parent::node_t<NODE>);
+  }
+};
+
+namespace graph {
+
+namespace parent {
+
+/*!
+ \class graph_t
+ \brief Graph that allocates and stores nodes, and keeps a pointer to the parent
+ of each node instead of storing edges
+ \tparam NODE : type of nodes, should have a method initial() that tells if a
+ node is initial
+ \tparam NODE_HASH : hash function on nodes
+ \tparam NODE_EQUAL : equality predicate on nodes
+ \note this graph allocates nodes of type tchecker::graph::parent::node_t<NODE>.
+ The parent of a node is the source of the first edge added to the node. Hence,
+ the parent pointers form a spanning tree of the explored state-space rooted in
+ the initial nodes, which is enough to compute a path from an initial node to
+ any node, while using much less memory than a reachability graph
+ */
+template <class NODE, class NODE_HASH, class NODE_EQUAL> class graph_t {
+private:
+  // Forward declarations
+  class node_sptr_hash_t;
+  class node_sptr_equal_to_t;
+
+public:
+  /*!
+   \brief Type of nodes
+   */
+  using node_t = NODE;
+
+  /*!
+   \brief Type of shared nodes
+  */
+  using shared_node_t = tchecker::graph::parent::shared_node_t<NODE>;
+
+  /*!
+  \brief Type of pointer to shared nodes
+  */
+  using node_sptr_t = tchecker::graph::parent::node_sptr_t<NODE>;
+
+  /*!
+  \brief Constructor
+  \param block_size : number of objects allocated in a block
+  \param table_size : size of hash table
+  \param node_hash : hash function on nodes
+  \param node_equal_to : equality predicate on nodes
+  */
+  graph_t(std::size_t block_size, std::size_t table_size, NODE_HASH const & node_hash, NODE_EQUAL const & node_equal_to)
+      : _node_sptr_hash(node_hash), _node_sptr_equal_to(node_equal_to),
+        _find_graph(table_size, _node_sptr_hash, _node_sptr_equal_to), _node_pool(block_size)
+  {
+  }
+
+  /*!
+  \brief Copy constructor (deleted)
+  */
+  graph_t(tchecker::graph::parent::graph_t<NODE, NODE_HASH, NODE_EQUAL> const &) = delete;
+
+  /*!
+  \brief Move constructor (deleted)
+  */
+  graph_t(tchecker::graph::parent::graph_t<NODE, NODE_HASH, NODE_EQUAL> &&) = delete;
+
+  /*!
+  \brief Destructor
+  */
+  virtual ~graph_t() { clear(); }
+
+  /*!
+  \brief Assignment operator (deleted)
+  */
+  tchecker::graph::parent::graph_t<NODE, NODE_HASH, NODE_EQUAL> &
+  operator=(tchecker::graph::parent::graph_t<NODE, NODE_HASH, NODE_EQUAL> const &) = delete;
+
+  /*!
+  \brief Move-assignment operator (deleted)
+  */
+  tchecker::graph::parent::graph_t<NODE, NODE_HASH, NODE_EQUAL> &
+  operator=(tchecker::graph::parent::graph_t<NODE, NODE_HASH, NODE_EQUAL> &&) = delete;
+
+  /*!
+  \brief Clear the graph
+  \post the graph is empty
+  */
+  void clear()
+  {
+    _find_graph.clear();
+    _node_pool.destruct_all();
+  }
+
+  /*!
+  \brief Add a node
+  \param args : arguments to a constructor of type NODE
+  \post an instance of NODE(args) has been added to the graph if it does not
+  already contain an instance that is similar w.r.t. NODE_EQUAL
+  \return a pair (status, n) where status is true if n is a new node that has
+  been created and added to the graph, and status is false if the graph already
+  contains node n that is equivalent w.r.t NODE_HASH and NODE_EQUAL
+   */
+  template <class... ARGS> std::tuple<bool, node_sptr_t> add_node(ARGS &&... args)
+  {
+    node_sptr_t node = _node_pool.construct(args...);
+    auto && [found, n] = _find_graph.find(node);
+    if (found)
+      return std::make_tuple(false, n);
+    _find_graph.add_node(node);
+    return std::make_tuple(true, node);
+  }
+
+  /*!
+   \brief Add an edge
+   \tparam TRANSITION : type of transition, should have a method vedge_ptr()
+   that yields a tchecker::const_vedge_sptr_t
+   \param n1 : source node
+   \param n2 : target node
+   \param t : transition from n1 to n2
+   \pre n1 and n2 should be nodes of the graph
+   \post n1 is the parent of n2 and the vedge of t is the vedge from n1 to n2 if
+   n2 is not initial and has no parent yet. The graph is left unchanged otherwise
+   \note no edge is stored
+   */
+  template <class TRANSITION> void add_edge(node_sptr_t const & n1, node_sptr_t const & n2, TRANSITION const & t)
+  {
+    if (n2->initial() || n2->parent() != nullptr)
+      return;
+    n2->set_parent(n1.ptr(), t.vedge_ptr());
+  }
+
+  /*!
+   \brief Compute the path to a node
+   \param n : a node
+   \pre n is a node of this graph
+   \return a pair (root, vedges) where root is the first node along the parent
+   pointers from n that has no parent (an initial node), and vedges is the
+   sequence of vedges from root to n
+   */
+  std::tuple<tchecker::graph::parent::node_t<NODE> const *, std::vector<tchecker::const_vedge_sptr_t>>
+  path(node_sptr_t const & n) const
+  {
+    std::vector<tchecker::const_vedge_sptr_t> vedges;
+    tchecker::graph::parent::node_t<NODE> const * root = n.ptr();
+    while (root->parent() != nullptr) {
+      vedges.push_back(root->parent_vedge());
+      root = root->parent();
+    }
+    std::reverse(vedges.begin(), vedges.end());
+    return std::make_tuple(root, vedges);
+  }
+
+  /*!
+  \brief Type of node iterator
+  */
+  using const_node_iterator_t =
+      typename tchecker::graph::find::graph_t<node_sptr_t, node_sptr_hash_t, node_sptr_equal_to_t>::const_iterator_t;
+
+  /*!
+  \brief Accessor
+  \return range of nodes in the graph
+  */
+  inline tchecker::range_t<tchecker::graph::parent::graph_t<NODE, NODE_HASH, NODE_EQUAL>::const_node_iterator_t> nodes() const
+  {
+    return tchecker::make_range(_find_graph.begin(), _find_graph.end());
+  }
+
+  /*!
+   \brief Accessor
+   \return the number of nodes in this graph
+   */
+  inline std::size_t nodes_count() const { return _find_graph.size(); }
+
+  /*!
+   \brief Accessor
+   \return Memory allocated for the nodes of this graph (in bytes)
+   \note the memory used by internal containers is not included
+   */
+  inline std::size_t memsize() const { return _node_pool.memsize(); }
+
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by the allocator of this graph
+   */
+  inline tchecker::collection_stats_t collection_stats() const { return _node_pool.collection_stats(); }
+
+private:
+  /*!
+   \class node_sptr_hash_t
+   \brief Hash functor for node pointers
+   */
+  class node_sptr_hash_t {
+  public:
+    /*!
+     \brief Constructor
+     \param node_hash : hash function on nodes
+     \post this keeps of a copy of node_hash
+    */
+    node_sptr_hash_t(NODE_HASH const & node_hash) : _node_hash(node_hash) {}
+
+    /*!
+     \brief Hash function on shared pointers to nodes
+     \param n : a shared pointer to node
+     \return hash value for *n w.r.t. NODE_HASH
+     */
+    inline std::size_t operator()(node_sptr_t const & n) const { return _node_hash(*n); }
+
+  private:
+    NODE_HASH _node_hash; /*!< Hash function on nodes */
+  };
+
+  /*!
+   \class node_sptr_equal_to_t
+   \brief Equality functor for node pointers
+   */
+  class node_sptr_equal_to_t {
+  public:
+    /*!
+     \brief Constructor
+     \param node_eq : equality predicate on nodes
+     \post this keeps a copy of node_eq
+     */
+    node_sptr_equal_to_t(NODE_EQUAL const & node_eq) : _node_eq(node_eq) {}
+
+    /*!
+     \brief Equality predicate on shared pointers to nodes
+     \param n1 : a node
+     \param n2 : a node
+     \return true if *n1 and *n2 are equal w.r.t. NODE_EQUAL, false otherwise
+     */
+    inline bool operator()(node_sptr_t const & n1, node_sptr_t const & n2) const { return _node_eq(*n1, *n2); }
+
+  private:
+    NODE_EQUAL _node_eq; /*!< Equality predicate on nodes */
+  };
+
+  node_sptr_hash_t _node_sptr_hash;         /*!< Hash functor on shared pointers to nodes */
+  node_sptr_equal_to_t _node_sptr_equal_to; /*!< Equality functor on shared pointers to nodes */
+  tchecker::graph::find::graph_t<node_sptr_t, node_sptr_hash_t, node_sptr_equal_to_t> _find_graph; /*!< Node store */
+  tchecker::graph::node_pool_allocator_t<shared_node_t> _node_pool;                                /*!< Node pool allocator */
+};
+
+} // end of namespace parent
+
+} // end of namespace graph
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_PARENT_GRAPH_HH
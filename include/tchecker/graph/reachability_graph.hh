@@ -366,6 +366,24 @@ public:
    */
   inline std::size_t nodes_count() const { return _find_graph.size(); }
 
+  /*!
+   \brief Accessor
+   \return Memory allocated for the nodes and edges of this graph (in bytes)
+   \note the memory used by internal containers is not included
+   */
+  inline std::size_t memsize() const { return _node_pool.memsize() + _edge_pool.memsize(); }
+
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by the allocators of this graph
+   */
+  inline tchecker::collection_stats_t collection_stats() const
+  {
+    tchecker::collection_stats_t stats = _node_pool.collection_stats();
+    stats += _edge_pool.collection_stats();
+    return stats;
+  }
+
   /*!
   \brief Type of incoming edges iterator
   */
@@ -662,6 +680,24 @@ public:
    */
   inline std::size_t nodes_count() const { return _store_graph.size(); }
 
+  /*!
+   \brief Accessor
+   \return Memory allocated for the nodes and edges of this graph (in bytes)
+   \note the memory used by internal containers is not included
+   */
+  inline std::size_t memsize() const { return _node_pool.memsize() + _edge_pool.memsize(); }
+
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by the allocators of this graph
+   */
+  inline tchecker::collection_stats_t collection_stats() const
+  {
+    tchecker::collection_stats_t stats = _node_pool.collection_stats();
+    stats += _edge_pool.collection_stats();
+    return stats;
+  }
+
   /*!
   \brief Type of incoming edges iterator
   */
@@ -768,6 +804,21 @@ std::ostream & dot_output(std::ostream & os, GRAPH const & g, std::string const
   return tchecker::graph::dot_output<GRAPH, NODE_LE, EDGE_LE>(os, g, name);
 }
 
+/*!
+ \brief Output a graph in graphviz DOT language, in storage order
+ \tparam GRAPH : type of graph, should inherit from
+ tchecker::graph::reachability::graph_t or from tchecker::graph::reachability::multigraph_t
+ \param os : output stream
+ \param g : a graph
+ \param name : graph name
+ \post the graph g has been output to os in the graphviz DOT language. The nodes
+ and edges are output in storage order (see tchecker::graph::dot_output_stream)
+ */
+template <class GRAPH> std::ostream & dot_output_stream(std::ostream & os, GRAPH const & g, std::string const & name)
+{
+  return tchecker::graph::dot_output_stream<GRAPH>(os, g, name);
+}
+
 } // end of namespace reachability
 
 } // end of namespace graph
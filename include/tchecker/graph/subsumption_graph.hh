@@ -428,6 +428,22 @@ public:
     _cover_graph.covered_nodes(n, ins);
   }
 
+  /*!
+   \brief Find a node in this graph that matches a given node
+   \param n : a node
+   \param pred : a predicate, callable with two parameters of type NODE const &
+   \param node : a node
+   \post node points to a node in this graph with same hash value as n w.r.t.
+   NODE_HASH and such that pred(*n, *node) is true if any, nullptr otherwise
+   \return true if a matching node has been found, false otherwise
+   \note n does not need to be stored in this graph
+   */
+  template <class PREDICATE> bool find_node(node_sptr_t const & n, PREDICATE && pred, node_sptr_t & node) const
+  {
+    return _cover_graph.find_node(
+        n, [&](node_sptr_t const & n1, node_sptr_t const & n2) { return pred(*n1, *n2); }, node);
+  }
+
   /*!
    \brief Type of incoming edges iterator
   */
@@ -487,6 +503,24 @@ public:
    */
   inline std::size_t nodes_count() const { return _cover_graph.size(); }
 
+  /*!
+   \brief Accessor
+   \return Memory allocated for the nodes and edges of this graph (in bytes)
+   \note the memory used by internal containers is not included
+   */
+  inline std::size_t memsize() const { return _node_pool.memsize() + _edge_pool.memsize(); }
+
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by the allocators of this graph
+   */
+  inline tchecker::collection_stats_t collection_stats() const
+  {
+    tchecker::collection_stats_t stats = _node_pool.collection_stats();
+    stats += _edge_pool.collection_stats();
+    return stats;
+  }
+
   /*!
    \brief Type of iterator on nodes
   */
@@ -632,6 +666,21 @@ std::ostream & dot_output(std::ostream & os, GRAPH const & g, std::string const
   return tchecker::graph::dot_output<GRAPH, NODE_LE, EDGE_LE>(os, g, name);
 }
 
+/*!
+ \brief Output a graph in graphviz DOT language, in storage order
+ \tparam GRAPH : type of graph, should inherit from
+ tchecker::graph::subsumption::graph_t
+ \param os : output stream
+ \param g : a graph
+ \param name : graph name
+ \post the graph g has been output to os in the graphviz DOT language. The nodes
+ and edges are output in storage order (see tchecker::graph::dot_output_stream)
+ */
+template <class GRAPH> std::ostream & dot_output_stream(std::ostream & os, GRAPH const & g, std::string const & name)
+{
+  return tchecker::graph::dot_output_stream<GRAPH>(os, g, name);
+}
+
 } // end of namespace subsumption
 
 } // end of namespace graph
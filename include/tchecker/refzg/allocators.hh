@@ -169,7 +169,8 @@ public:
   void share(tchecker::intrusive_shared_ptr_t<STATE> const & p)
   {
     tchecker::ta::details::state_pool_allocator_t<STATE>::share(p);
-    p->zone_ptr() = _zone_cache->find_else_add(p->zone_ptr());
+    p->zone_ptr() =
+        _zone_cache->find_else_add(p->zone_ptr(), tchecker::counters::ZONE_CACHE_HITS, tchecker::counters::ZONE_CACHE_MISSES);
   }
 
   /*!
@@ -204,6 +205,17 @@ public:
    */
   std::size_t memsize() const { return tchecker::ta::details::state_pool_allocator_t<STATE>::memsize() + _zone_pool.memsize(); }
 
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by this state allocator
+   */
+  tchecker::collection_stats_t collection_stats() const
+  {
+    tchecker::collection_stats_t stats = tchecker::ta::details::state_pool_allocator_t<STATE>::collection_stats();
+    stats += _zone_pool.collection_stats();
+    return stats;
+  }
+
 protected:
   /*!
    \brief Construct state from a state
@@ -257,6 +269,7 @@ public:
   using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::share;
   using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::destruct_all;
   using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::memsize;
+  using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::collection_stats;
 
 protected:
   using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::construct_from_transition;
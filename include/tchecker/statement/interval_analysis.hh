@@ -0,0 +1,64 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_STATEMENT_INTERVAL_ANALYSIS_HH
+#define TCHECKER_STATEMENT_INTERVAL_ANALYSIS_HH
+
+#include "tchecker/expression/typed_expression.hh"
+#include "tchecker/statement/typed_statement.hh"
+#include "tchecker/variables/intvars.hh"
+
+/*!
+ \file interval_analysis.hh
+ \brief Interval analysis of expressions and statements over flat bounded integer variables
+ */
+
+namespace tchecker {
+
+/*!
+ \brief Narrow intervals of flat bounded integer variables w.r.t. a constraint
+ \param expr : typed expression
+ \param intervals : intervals of flat bounded integer variables
+ \pre intervals has one interval for each flat bounded integer variable in expr
+ \post intervals has been narrowed to a superset of the valuations in intervals that satisfy expr. Clock
+ constraints and local variables in expr are not taken into account
+ \return false if no valuation in intervals satisfies expr, true otherwise (the valuations in intervals may
+ still not satisfy expr)
+ */
+bool constrain_intervals(tchecker::typed_expression_t const & expr, tchecker::intvars_intervals_t & intervals);
+
+/*!
+ \brief Backward interval analysis of a statement
+ \param stmt : typed statement
+ \param intvars : flat bounded integer variables
+ \param intervals : intervals of values of intvars
+ \pre intervals has size intvars.size()
+ \post intervals has been set to a superset of the valuations of intvars from which stmt yields a
+ valuation in intervals. Variables that are not written by stmt keep their interval
+ \return false if stmt yields no valuation in intervals, true otherwise
+ \note while statements are not unrolled: the variables written by their body range over their domain
+ */
+bool backward_intervals(tchecker::typed_statement_t const & stmt, tchecker::flat_integer_variables_t const & intvars,
+                        tchecker::intvars_intervals_t & intervals);
+
+/*!
+ \brief Forward interval analysis of a statement
+ \param stmt : typed statement
+ \param intvars : flat bounded integer variables
+ \param intervals : intervals of values of intvars
+ \pre intervals has size intvars.size()
+ \post intervals has been set to a superset of the valuations of intvars that stmt yields from a
+ valuation in intervals. Variables that are not written by stmt keep their interval
+ \return false if stmt yields no valuation from intervals, true otherwise
+ \note while statements are not unrolled: the variables written by their body range over their domain
+ */
+bool forward_intervals(tchecker::typed_statement_t const & stmt, tchecker::flat_integer_variables_t const & intvars,
+                       tchecker::intvars_intervals_t & intervals);
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_STATEMENT_INTERVAL_ANALYSIS_HH
@@ -161,7 +161,8 @@ public:
   void share(tchecker::intrusive_shared_ptr_t<STATE> const & p)
   {
     tchecker::ts::state_pool_allocator_t<STATE>::share(p);
-    p->vloc_ptr() = _vloc_cache->find_else_add(p->vloc_ptr());
+    p->vloc_ptr() =
+        _vloc_cache->find_else_add(p->vloc_ptr(), tchecker::counters::VLOC_CACHE_HITS, tchecker::counters::VLOC_CACHE_MISSES);
   }
 
   /*!
@@ -193,6 +194,17 @@ public:
    */
   std::size_t memsize() const { return tchecker::ts::state_pool_allocator_t<STATE>::memsize() + _vloc_pool.memsize(); }
 
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by this state allocator
+   */
+  tchecker::collection_stats_t collection_stats() const
+  {
+    tchecker::collection_stats_t stats = tchecker::ts::state_pool_allocator_t<STATE>::collection_stats();
+    stats += _vloc_pool.collection_stats();
+    return stats;
+  }
+
 protected:
   /*!
    \brief Construct state
@@ -343,7 +355,8 @@ public:
   void share(tchecker::intrusive_shared_ptr_t<TRANSITION> const & p)
   {
     tchecker::ts::transition_pool_allocator_t<TRANSITION>::share(p);
-    p->vedge_ptr() = _vedge_cache->find_else_add(p->vedge_ptr());
+    p->vedge_ptr() = _vedge_cache->find_else_add(p->vedge_ptr(), tchecker::counters::VEDGE_CACHE_HITS,
+                                                 tchecker::counters::VEDGE_CACHE_MISSES);
   }
 
   /*!
@@ -378,6 +391,17 @@ public:
     return tchecker::ts::transition_pool_allocator_t<TRANSITION>::memsize() + _vedge_pool.memsize();
   }
 
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by this transitions allocator
+   */
+  tchecker::collection_stats_t collection_stats() const
+  {
+    tchecker::collection_stats_t stats = tchecker::ts::transition_pool_allocator_t<TRANSITION>::collection_stats();
+    stats += _vedge_pool.collection_stats();
+    return stats;
+  }
+
 protected:
   /*!
    \brief Construct a transition from a transition
@@ -191,7 +191,7 @@ int lexical_cmp(tchecker::vloc_t const & vloc1, tchecker::vloc_t const & vloc2);
 /*!
  \brief Type of shared tuple of locations
  */
-using shared_vloc_t = tchecker::make_shared_t<tchecker::vloc_t>;
+using shared_vloc_t = tchecker::make_shared_t<tchecker::vloc_t, tchecker::compact_refcount_t>;
 
 /*!
  \brief Type of shared pointer to a tuple of locations
@@ -163,7 +163,8 @@ public:
   void share(tchecker::intrusive_shared_ptr_t<STATE> const & p)
   {
     tchecker::syncprod::details::state_pool_allocator_t<STATE>::share(p);
-    p->intval_ptr() = _intval_cache->find_else_add(p->intval_ptr());
+    p->intval_ptr() = _intval_cache->find_else_add(p->intval_ptr(), tchecker::counters::INTVAL_CACHE_HITS,
+                                                   tchecker::counters::INTVAL_CACHE_MISSES);
   }
 
   /*!
@@ -199,6 +200,17 @@ public:
     return tchecker::syncprod::details::state_pool_allocator_t<STATE>::memsize() + _intval_pool.memsize();
   }
 
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by this state allocator
+   */
+  tchecker::collection_stats_t collection_stats() const
+  {
+    tchecker::collection_stats_t stats = tchecker::syncprod::details::state_pool_allocator_t<STATE>::collection_stats();
+    stats += _intval_pool.collection_stats();
+    return stats;
+  }
+
 protected:
   /*!
    \brief Construct state from a state
@@ -251,6 +263,7 @@ public:
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::share;
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::destruct_all;
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::memsize;
+  using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::collection_stats;
 
 protected:
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::construct_from_transition;
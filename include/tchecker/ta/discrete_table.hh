@@ -0,0 +1,141 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_TA_DISCRETE_TABLE_HH
+#define TCHECKER_TA_DISCRETE_TABLE_HH
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/syncprod/vloc.hh"
+#include "tchecker/utils/tree_table.hh"
+#include "tchecker/variables/intvars.hh"
+
+/*!
+ \file discrete_table.hh
+ \brief Tree-compressed storage of discrete parts of states of timed automata
+ */
+
+namespace tchecker {
+
+namespace ta {
+
+/*!
+ \class discrete_table_t
+ \brief Table of discrete parts (tuple of locations and valuation of bounded
+ integer variables) of states with tree compression
+ \note The tuple of locations and the integer valuation of a state are stored
+ as a single vector in a tchecker::tree_table_t. Hence, discrete parts that
+ differ in one location or in one variable share almost all their storage. A
+ stored discrete part is identified by an index. Discrete parts can be
+ decompressed into a tuple of locations and an integer valuation, and each
+ location or variable value can be accessed without decompressing
+ */
+class discrete_table_t {
+public:
+  /*!
+   \brief Type of index of stored discrete parts
+   */
+  using index_t = tchecker::tree_table_t::index_t;
+
+  /*!
+   \brief Constructor
+   \param processes_count : number of processes
+   \param intvars_count : number of (flattened) integer variables
+   \param table_size : initial size of internal tables
+   \post this table is empty
+   */
+  discrete_table_t(std::size_t processes_count, std::size_t intvars_count, std::size_t table_size = 1024);
+
+  /*!
+   \brief Insert a discrete part
+   \param vloc : tuple of locations
+   \param intval : integer valuation
+   \return (true, index) if (vloc, intval) has been added to this table with
+   index, and (false, index) if (vloc, intval) was already in this table with
+   index
+   \throw std::invalid_argument : if the size of vloc or intval does not match
+   the table
+   \throw std::overflow_error : if a value in intval does not fit in 32 bits, or
+   if the table is full
+   */
+  std::tuple<bool, tchecker::ta::discrete_table_t::index_t> insert(tchecker::vloc_t const & vloc,
+                                                                   tchecker::intval_t const & intval);
+
+  /*!
+   \brief Decompress a discrete part
+   \param index : index of a stored discrete part
+   \param vloc : tuple of locations
+   \param intval : integer valuation
+   \pre index has been returned by insert
+   \post vloc and intval contain the discrete part with index
+   \throw std::invalid_argument : if the size of vloc or intval does not match
+   the table
+   */
+  void get(tchecker::ta::discrete_table_t::index_t index, tchecker::vloc_t & vloc, tchecker::intval_t & intval) const;
+
+  /*!
+   \brief Accessor
+   \param index : index of a stored discrete part
+   \param pid : process identifier
+   \pre index has been returned by insert, and pid < processes_count()
+   \return location of process pid in the discrete part with index
+   */
+  tchecker::loc_id_t location(tchecker::ta::discrete_table_t::index_t index, tchecker::process_id_t pid) const;
+
+  /*!
+   \brief Accessor
+   \param index : index of a stored discrete part
+   \param id : integer variable identifier
+   \pre index has been returned by insert, and id < intvars_count()
+   \return value of variable id in the discrete part with index
+   */
+  tchecker::integer_t value(tchecker::ta::discrete_table_t::index_t index, tchecker::intvar_id_t id) const;
+
+  /*!
+   \brief Accessor
+   \return number of processes
+   */
+  inline std::size_t processes_count() const { return _processes_count; }
+
+  /*!
+   \brief Accessor
+   \return number of integer variables
+   */
+  inline std::size_t intvars_count() const { return _table.width() - _processes_count; }
+
+  /*!
+   \brief Accessor
+   \return number of discrete parts in this table
+   */
+  inline std::size_t size() const { return _table.size(); }
+
+  /*!
+   \brief Accessor
+   \return memory used by this table (in bytes)
+   */
+  std::size_t memsize() const;
+
+  /*!
+   \brief Clear
+   \post this table is empty
+   */
+  void clear();
+
+private:
+  std::size_t _processes_count;                                 /*!< Number of processes */
+  tchecker::tree_table_t _table;                                /*!< Tree-compressed table */
+  mutable std::vector<tchecker::tree_table_t::value_t> _buffer; /*!< Buffer for (de)compression */
+};
+
+} // end of namespace ta
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_TA_DISCRETE_TABLE_HH
@@ -8,6 +8,10 @@
 #ifndef TCHECKER_TA_STATIC_ANALYSIS_HH
 #define TCHECKER_TA_STATIC_ANALYSIS_HH
 
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
 #include "tchecker/ta/system.hh"
 
 /*!
@@ -53,6 +57,38 @@ bool has_non_constant_reset(tchecker::ta::system_t const & system);
  */
 bool has_shared_clocks(tchecker::ta::system_t const & system);
 
+/*!
+ \brief Partition of clocks into independence classes
+ \param system : a system of timed processes
+ \return a vector that maps each (flattened) clock ID x of system to the class of
+ x. Two clocks are in the same class if they appear in a common diagonal
+ constraint x - y # c in a guard or a location invariant, or in a common reset
+ x := y + c in the statement of a transition (transitively). Classes are
+ numbered from 0 in the increasing order of their smallest clock ID
+ \throw std::runtime_error : if clock updates cannot be computed from a statement
+ \note clock arrays with an offset that cannot be evaluated statically put all
+ the clocks in the array in the same class
+ \note clocks in distinct classes are never compared by a constraint. They are
+ still related by time elapse, however, hence a product of zones over the classes
+ over-approximates a zone over all clocks
+ */
+std::vector<std::size_t> clock_classes(tchecker::ta::system_t const & system);
+
+/*!
+ \brief Active clocks in locations
+ \param system : a system of timed processes
+ \return a vector that maps each location ID of system to the set of (flattened)
+ clock IDs that are active in the location. A clock is active in a location if
+ it may be read, by an invariant, a guard or the right-hand side of a clock reset
+ x := y + c, along some path from the location before it is reset
+ \throw std::runtime_error : if clock updates cannot be computed from a statement
+ \note the future behaviours from a location do not depend on the values of the
+ clocks that are not active in the location
+ \note the analysis is local to each process. A clock is active in a tuple of
+ locations if it is active in one of the locations
+ */
+std::vector<boost::dynamic_bitset<>> active_clocks(tchecker::ta::system_t const & system);
+
 } // end of namespace ta
 
 } // end of namespace tchecker
@@ -61,6 +61,28 @@ public:
    */
   system_t(tchecker::syncprod::system_t const & system);
 
+  /*!
+   \brief Constructor
+   \param system : system of timed processes
+   \param invariants : map location identifier -> invariant
+   \param guards : map edge identifier -> guard
+   \param statements : map edge identifier -> statement
+   \post this is a copy of system with invariants, guards and statements taken
+   from the parameters. The "invariant", "provided" and "do" attributes of system
+   are not parsed
+   \throw std::invalid_argument : if invariants does not have one expression per
+   location in system, if guards and statements do not have one expression
+   (resp. statement) per edge in system, if an invariant, a guard or a statement
+   does not typecheck, or if system has a transitions over a weakly synchronized
+   event
+   \note this avoids parsing attributes when invariants, guards and statements
+   have been parsed before (see tchecker::ta::write_cache)
+   */
+  system_t(tchecker::system::system_t const & system,
+           std::vector<std::shared_ptr<tchecker::expression_t const>> const & invariants,
+           std::vector<std::shared_ptr<tchecker::expression_t const>> const & guards,
+           std::vector<std::shared_ptr<tchecker::statement_t const>> const & statements);
+
   /*!
    \brief Copy constructor
    */
@@ -258,21 +280,37 @@ private:
 
   /*!
    \brief Compute data from syncprod::system_t
-   \throw std::invalid_argument : if system has a transition over a weakly synchronized event
+   \post the invariants, guards and statements in the attributes of locations
+   and edges have been parsed, typed and compiled
+   \throw std::invalid_argument : if parsing or compilation fails, or if system
+   has a transition over a weakly synchronized event
    */
   void compute_from_syncprod_system();
 
+  /*!
+   \brief Compute data from syncprod::system_t and parsed attributes
+   \param invariants : map location identifier -> invariant
+   \param guards : map edge identifier -> guard
+   \param statements : map edge identifier -> statement
+   \post invariants, guards and statements have been typed and compiled
+   \throw std::invalid_argument : if the sizes of invariants, guards or statements
+   do not match the number of locations and edges, if compilation fails, or if
+   system has a transition over a weakly synchronized event
+   */
+  void compute_from_expressions(std::vector<std::shared_ptr<tchecker::expression_t const>> const & invariants,
+                                std::vector<std::shared_ptr<tchecker::expression_t const>> const & guards,
+                                std::vector<std::shared_ptr<tchecker::statement_t const>> const & statements);
+
   /*!
    \brief Set location invariant
    \param id : location identifier
-   \param invariants : range of invariants (as strings)
-   \post all invariants have been parsed, typed, compiled and set as location id invariant
+   \param invariant : invariant expression
+   \post invariant has been typed, compiled and set as location id invariant
    \note all compilation errors have been reported to std::cerr
    \note previous invariant (if any) has been replaced by the new one
-   \throw std::invalid_argument : if compilation of invariants fails
+   \throw std::invalid_argument : if compilation of invariant fails
    */
-  void set_invariant(tchecker::loc_id_t id,
-                     tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & invariants);
+  void set_invariant(tchecker::loc_id_t id, tchecker::expression_t const & invariant);
 
   /*!
    \brief Set location urgent flag
@@ -285,25 +323,24 @@ private:
   /*!
    \brief Set edge guard (provided attribute)
    \param id : location identifier
-   \param guards : range of guards (as strings)
-   \post all guards have been parsed, typed, compiled and set as edge id guard
+   \param guard : guard expression
+   \post guard has been typed, compiled and set as edge id guard
    \note all compilation errors have been reported to std::cerr
    \note previous guard (if any) has been replaced by the new one
-   \throw std::invalid_argument : if compilation of guards fails
+   \throw std::invalid_argument : if compilation of guard fails
    */
-  void set_guards(tchecker::edge_id_t id, tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & guards);
+  void set_guard(tchecker::edge_id_t id, tchecker::expression_t const & guard);
 
   /*!
    \brief Set edge statement (do attribute)
    \param id : edge identifier
-   \param statements : range of statements (as strings)
-   \post all statements have been parsed, typed, compiled and set as edge id statement
+   \param statement : statement
+   \post statement has been typed, compiled and set as edge id statement
    \note all compilation errors have been reported to std::cerr
    \note previous statement (if any) has been replaced by the new one
-   \throw std::invalid_argument : if compilation of statements fails
+   \throw std::invalid_argument : if compilation of statement fails
    */
-  void set_statements(tchecker::edge_id_t id,
-                      tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & statements);
+  void set_statement(tchecker::edge_id_t id, tchecker::statement_t const & statement);
 
   mutable tchecker::vm_t _vm;                     /*!< Bytecode interpreter */
   std::vector<compiled_expression_t> _invariants; /*!< Map : location identifier -> invariant */
@@ -0,0 +1,85 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_TA_SYSTEM_CACHE_HH
+#define TCHECKER_TA_SYSTEM_CACHE_HH
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "tchecker/ta/system.hh"
+
+/*!
+ \file system_cache.hh
+ \brief Cache of precompiled systems of timed processes
+
+ A cache file stores a system of timed processes after parsing: its symbol
+ tables, its processes, locations, edges and synchronizations with their
+ attributes, and the parsed invariants, guards and statements. Loading a
+ cache file only type checks and compiles invariants, guards and statements,
+ which is linear in their size, and skips the system parser and the parsing of
+ attributes. Cache files are keyed by a hash of the model, and versioned: a
+ cache file written for another model, by another version of the format, or
+ with another size of integers is ignored.
+ */
+
+namespace tchecker {
+
+namespace ta {
+
+/*!
+ \brief Key of a model in the cache
+ \param model : contents of a model file
+ \return a key that identifies model (64-bits FNV-1a hash and size of model)
+ */
+std::string model_cache_key(std::string const & model);
+
+/*!
+ \brief Write a system to a cache
+ \param os : output stream
+ \param system : system of timed processes
+ \param key : key of the model of system (see tchecker::ta::model_cache_key)
+ \post system has been written to os along with key
+ \throw std::runtime_error : if writing to os fails
+ */
+void write_cache(std::ostream & os, tchecker::ta::system_t const & system, std::string const & key);
+
+/*!
+ \brief Read a system from a cache
+ \param is : input stream
+ \param key : key of a model (see tchecker::ta::model_cache_key)
+ \return the system of timed processes in is, nullptr if is has been written
+ for another key, by another version of the cache format, or with another size
+ of integers
+ \throw std::runtime_error : if is is not a valid cache
+ */
+std::shared_ptr<tchecker::ta::system_t> read_cache(std::istream & is, std::string const & key);
+
+/*!
+ \brief Load a system of timed processes using a cache
+ \param filename : model file name (standard input if empty)
+ \param cache_dir : cache directory
+ \return the system of timed processes in filename, nullptr if parsing failed
+ \post the system has been read from file cache_dir/<key>.tckm if it exists
+ and is a valid cache for filename, where key is the key of the contents of
+ filename. Otherwise, filename has been parsed and the system has been written
+ to file cache_dir/<key>.tckm (warnings are reported to std::cerr if the cache
+ cannot be read or written)
+ \post all parsing errors have been reported to std::cerr
+ \throw std::runtime_error : if filename cannot be read
+ \throw std::invalid_argument : if the system in filename is not a valid system
+ of timed processes
+ \note stale cache files are never removed from cache_dir
+ */
+std::shared_ptr<tchecker::ta::system_t const> load_system(std::string const & filename, std::string const & cache_dir);
+
+} // end of namespace ta
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_TA_SYSTEM_CACHE_HH
@@ -115,13 +115,117 @@ inline tchecker::state_status_t initial(tchecker::ta::system_t const & system, t
 // Final edges
 
 /*!
+ \class final_iterator_t
  \brief Type of iterator over final edges
- \note this iterator ranges over the set of tuples of process locations and bounded integer variables valuations
- in the given system, the size of which is exponential in the number of locations and processes, as well as in the
- domains of bounded integer variables
+ \note this iterator ranges over the tuples of process locations that match a set of labels and, for
+ each tuple of locations, over the valuations of bounded integer variables that may be final. Candidate
+ valuations are restricted to intervals that contain the initial valuation if the tuple of locations is
+ initial, and the valuations reached by every tuple of incoming edges from the valuations that satisfy
+ its guards and source invariants (see tchecker::forward_intervals). Intervals are then narrowed w.r.t.
+ the invariants of the tuple of locations (see tchecker::constrain_intervals). Tuples of locations with
+ no candidate valuation are skipped. Any state on a run from an initial state is initial or has a
+ predecessor, hence other final states are not needed in backward reachability analysis
+ \note the number of tuples of locations is exponential in the number of locations and processes, and the
+ number of candidate valuations is exponential in the number of bounded integer variables
 */
-using final_iterator_t = tchecker::ta::edges_valuations_iterator_t<tchecker::syncprod::final_range_t,
-                                                                   tchecker::flat_integer_variables_valuations_range_t>;
+class final_iterator_t {
+public:
+  /*!
+   \brief Constructor
+   \param system : a system
+   \param final_range : range of final tuples of locations in system
+   \post this iterates over the tuples of locations in final_range, and for each tuple of
+   locations, over its candidate final valuations
+   \note this keeps a reference on system
+   */
+  final_iterator_t(tchecker::ta::system_t const & system, tchecker::syncprod::final_range_t const & final_range);
+
+  /*!
+   \brief Copy constructor
+   */
+  final_iterator_t(tchecker::ta::final_iterator_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  final_iterator_t(tchecker::ta::final_iterator_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~final_iterator_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::ta::final_iterator_t & operator=(tchecker::ta::final_iterator_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::ta::final_iterator_t & operator=(tchecker::ta::final_iterator_t &&) = delete;
+
+  /*!
+   \brief Equality check
+   \return true if this iterator is past-the-end
+   */
+  inline bool operator==(tchecker::end_iterator_t const &) const { return at_end(); }
+
+  /*!
+   \brief Disequality check
+   \return true if this iterator is not past-the-end
+   */
+  inline bool operator!=(tchecker::end_iterator_t const & it) const { return !(*this == it); }
+
+  /*!
+   \brief Dereference operator
+   \return the tuple <l, v> of final tuple of locations l and flat bounded integer variables
+   valuation v that is pointed to by this iterator
+   \pre this iterator is not past-the-end (checked by assertion)
+   */
+  decltype(auto) operator*()
+  {
+    assert(!at_end());
+    return std::make_tuple(*_locs_it, *_valuations_it);
+  }
+
+  /*!
+   \brief Increment operator
+   \return this after incrementation
+   \pre this iterator is not past-the-end (checked by assertion)
+   */
+  tchecker::ta::final_iterator_t & operator++();
+
+private:
+  /*!
+   \brief Check for past-the-end iterator
+   \return true if this operator is past-the-end
+   */
+  inline bool at_end() const { return (_locs_it == _locs_range.end()); }
+
+  /*!
+   \brief Move to the first tuple of locations with candidate final valuations
+   \post this iterator points to the first candidate valuation of the first tuple of locations from
+   the current one that has candidate valuations, or this iterator is past-the-end
+   */
+  void skip_to_valuations();
+
+  /*!
+   \brief Reset the range of valuations
+   \pre this iterator is not past-the-end
+   \post the range of valuations has been set to the candidate final valuations of the current
+   tuple of locations
+   \return false if the current tuple of locations has no candidate final valuation, true otherwise
+   */
+  bool reset_valuations();
+
+  tchecker::ta::system_t const * _system;                                                /*!< System */
+  tchecker::syncprod::final_range_t _locs_range;                                         /*!< Range of tuples of locations */
+  tchecker::syncprod::final_range_t::begin_iterator_t _locs_it;                          /*!< Iterator over tuples of locations */
+  tchecker::intvars_intervals_t _intervals;                                              /*!< Intervals of candidates */
+  tchecker::flat_integer_variables_valuations_range_t _valuations_range;                 /*!< Range of valuations */
+  tchecker::flat_integer_variables_valuations_range_t::begin_iterator_t _valuations_it; /*!< Iterator over valuations */
+};
 
 /*!
 \brief Type of range of iterators over final states
@@ -132,7 +236,8 @@ using final_range_t = tchecker::range_t<tchecker::ta::final_iterator_t, tchecker
  \brief Accessor to final edges
  \param system : a system
  \param labels : a set of labels
- \return range of final edges, i.e. edges to tuple of locations that match labels
+ \return range of final edges, i.e. edges to tuple of locations that match labels, along
+ with candidate final valuations of bounded integer variables (see tchecker::ta::final_iterator_t)
  */
 tchecker::ta::final_range_t final_edges(tchecker::ta::system_t const & system, boost::dynamic_bitset<> const & labels);
 
@@ -282,14 +387,122 @@ inline tchecker::state_status_t next(tchecker::ta::system_t const & system, tche
 // Incoming edges
 
 /*!
+ \class incoming_edges_iterator_t
  \brief Type of iterator over incoming edges
- \note this iterator ranges over the set of tuple of process locations and bounded integer
- variables valuations in the given system, the size of which is exponential in the number
- of locations and processes, as well as in the domains of bounded integer variables
+ \note this iterator ranges over the tuples of incoming edges to a tuple of locations and, for
+ each tuple of edges, over the valuations of bounded integer variables that may be sources of
+ the tuple of edges. Candidate valuations are restricted to intervals computed backward from
+ the target valuation: through the statements of the tuple of edges (see
+ tchecker::backward_intervals), then w.r.t. the guards of the edges and the invariants of the
+ source locations (see tchecker::constrain_intervals). Variables that are not written by the
+ tuple of edges keep their value from the target valuation. Tuples of edges with no candidate
+ valuation are skipped. Candidates are over-approximations: they are checked by
+ tchecker::ta::prev
  */
-using incoming_edges_iterator_t =
-    tchecker::ta::edges_valuations_iterator_t<tchecker::syncprod::incoming_edges_range_t,
-                                              tchecker::flat_integer_variables_valuations_range_t>;
+class incoming_edges_iterator_t {
+public:
+  /*!
+   \brief Constructor
+   \param system : a system
+   \param edges_range : range of incoming tuples of edges in system
+   \param vloc : target tuple of locations
+   \param intval : target valuation of bounded integer variables
+   \post this iterates over the tuples of edges in edges_range, and for each tuple of edges,
+   over the candidate source valuations w.r.t. vloc and intval
+   \note this keeps a reference on system and shared pointers on vloc and intval
+   */
+  incoming_edges_iterator_t(tchecker::ta::system_t const & system,
+                            tchecker::syncprod::incoming_edges_range_t const & edges_range,
+                            tchecker::const_vloc_sptr_t const & vloc, tchecker::const_intval_sptr_t const & intval);
+
+  /*!
+   \brief Copy constructor
+   */
+  incoming_edges_iterator_t(tchecker::ta::incoming_edges_iterator_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  incoming_edges_iterator_t(tchecker::ta::incoming_edges_iterator_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~incoming_edges_iterator_t() = default;
+
+  /*!
+   \brief Assignment operator
+   */
+  tchecker::ta::incoming_edges_iterator_t & operator=(tchecker::ta::incoming_edges_iterator_t const &) = default;
+
+  /*!
+   \brief Move-assignment operator
+   */
+  tchecker::ta::incoming_edges_iterator_t & operator=(tchecker::ta::incoming_edges_iterator_t &&) = default;
+
+  /*!
+   \brief Equality check
+   \return true if this iterator is past-the-end
+   */
+  inline bool operator==(tchecker::end_iterator_t const &) const { return at_end(); }
+
+  /*!
+   \brief Disequality check
+   \return true if this iterator is not past-the-end
+   */
+  inline bool operator!=(tchecker::end_iterator_t const & it) const { return !(*this == it); }
+
+  /*!
+   \brief Dereference operator
+   \return the tuple <e, v> of incoming edges e and flat bounded integer variables valuation v
+   that is pointed to by this iterator
+   \pre this iterator is not past-the-end (checked by assertion)
+   */
+  decltype(auto) operator*()
+  {
+    assert(!at_end());
+    return std::make_tuple(*_edges_it, *_valuations_it);
+  }
+
+  /*!
+   \brief Increment operator
+   \return this after incrementation
+   \pre this iterator is not past-the-end (checked by assertion)
+   */
+  tchecker::ta::incoming_edges_iterator_t & operator++();
+
+private:
+  /*!
+   \brief Check for past-the-end iterator
+   \return true if this operator is past-the-end
+   */
+  inline bool at_end() const { return (_edges_it == _edges_range.end()); }
+
+  /*!
+   \brief Move to the first tuple of edges with candidate source valuations
+   \post this iterator points to the first candidate valuation of the first tuple of edges from the
+   current one that has candidate valuations, or this iterator is past-the-end
+   */
+  void skip_to_valuations();
+
+  /*!
+   \brief Reset the range of valuations
+   \pre this iterator is not past-the-end
+   \post the range of valuations has been set to the candidate source valuations of the current
+   tuple of edges
+   \return false if the current tuple of edges has no candidate source valuation, true otherwise
+   */
+  bool reset_valuations();
+
+  tchecker::ta::system_t const * _system;                                                /*!< System */
+  tchecker::syncprod::incoming_edges_range_t _edges_range;                               /*!< Range of edges */
+  tchecker::syncprod::incoming_edges_range_t::begin_iterator_t _edges_it;                /*!< Iterator over range of edges */
+  tchecker::const_vloc_sptr_t _vloc;                                                     /*!< Target tuple of locations */
+  tchecker::const_intval_sptr_t _intval;                                                 /*!< Target valuation */
+  tchecker::intvars_intervals_t _intervals;                                              /*!< Intervals of candidates */
+  tchecker::flat_integer_variables_valuations_range_t _valuations_range;                 /*!< Range of valuations */
+  tchecker::flat_integer_variables_valuations_range_t::begin_iterator_t _valuations_it; /*!< Iterator over valuations */
+};
 
 /*!
 \brief Type of range of incoming edges
@@ -300,10 +513,13 @@ using incoming_edges_range_t = tchecker::range_t<tchecker::ta::incoming_edges_it
  \brief Accessor to incoming edges
  \param system : a system
  \param vloc : tuple of locations
- \return range of incoming synchronized and asynchronous edges to vloc in system
+ \param intval : valuation of bounded integer variables
+ \return range of incoming synchronized and asynchronous edges to vloc in system, along
+ with candidate source valuations of bounded integer variables w.r.t. target valuation intval
  */
 tchecker::ta::incoming_edges_range_t incoming_edges(tchecker::ta::system_t const & system,
-                                                    tchecker::const_vloc_sptr_t const & vloc);
+                                                    tchecker::const_vloc_sptr_t const & vloc,
+                                                    tchecker::const_intval_sptr_t const & intval);
 
 /*!
  \brief Dereference type for iterator over incoming edges
@@ -723,9 +939,10 @@ public:
    \brief Accessor
    \param s : state
    \return incoming edges to state s
-   \note the return range goes across all tuples of process locations and bounded integer variabkes
-   valuations in the given system. The number of such tuples is exponential in the number of locations
-   and processes, as well as the domains of bounded integer variables
+   \note the return range goes across all tuples of process locations in the given system, and for
+   each tuple of edges, across the candidate source valuations of the bounded integer variables (see
+   tchecker::ta::incoming_edges_iterator_t). The number of such tuples is exponential in the number of
+   locations and processes, and in the sizes of the intervals of candidate values
    */
   virtual incoming_edges_range_t incoming_edges(tchecker::ta::const_state_sptr_t const & s);
 
@@ -143,6 +143,15 @@ public:
    */
   std::size_t memsize() const { return _state_pool.memsize(); }
 
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by this state allocator
+   */
+  tchecker::collection_stats_t collection_stats() const
+  {
+    return _state_pool.collection_stats();
+  }
+
 protected:
   /*!
    \brief Construct a state from a state
@@ -282,6 +291,15 @@ public:
    */
   std::size_t memsize() const { return _transition_pool.memsize(); }
 
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by this transition allocator
+   */
+  tchecker::collection_stats_t collection_stats() const
+  {
+    return _transition_pool.collection_stats();
+  }
+
 protected:
   /*!
    \brief Construct a transition from a transition
@@ -0,0 +1,122 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_BITSTATE_HH
+#define TCHECKER_BITSTATE_HH
+
+#include <cstdint>
+#include <vector>
+
+/*!
+ \file bitstate.hh
+ \brief Bitstate hashing (approximate set of hash values)
+ */
+
+namespace tchecker {
+
+/*!
+ \class bitstate_t
+ \brief Approximate set of objects represented by their hash value in a bit
+ array with k hash functions (Bloom filter)
+ \note An object is stored by setting k bits in the array. An object is
+ considered in the set if its k bits are set. Hence, objects are never missed,
+ but an object that has never been added may be considered in the set (hash
+ collision). Used to store the visited states of a search, it under-approximates
+ the reachable state space with a few bits per state (see Holzmann, "An analysis
+ of bitstate hashing", Formal Methods in System Design, 1998)
+ */
+class bitstate_t {
+public:
+  /*!
+   \brief Constructor
+   \param log2_bits : logarithm in base 2 of the number of bits
+   \param hashes : number of hash functions
+   \pre 3 <= log2_bits <= 48 and 1 <= hashes <= 64
+   \post this set is empty
+   \throw std::invalid_argument : if log2_bits or hashes are out of range
+   \throw std::bad_alloc : if the bit array cannot be allocated
+   */
+  bitstate_t(unsigned int log2_bits, unsigned int hashes);
+
+  /*!
+   \brief Find or add an object
+   \param hash : hash value of an object
+   \return true if the object with hash value hash has been added, false if it
+   was (considered) already in this set
+   \post the k bits of hash are set
+   \note the k positions are computed from hash by double hashing. hash should be
+   a good 64-bits hash value
+   */
+  bool find_else_add(uint64_t hash);
+
+  /*!
+   \brief Accessor
+   \return number of bits
+   */
+  inline uint64_t bits() const { return _mask + 1; }
+
+  /*!
+   \brief Accessor
+   \return number of hash functions
+   */
+  inline unsigned int hashes() const { return _hashes; }
+
+  /*!
+   \brief Accessor
+   \return number of bits that are set
+   */
+  inline uint64_t set_bits() const { return _set_bits; }
+
+  /*!
+   \brief Accessor
+   \return number of objects that have been added
+   */
+  inline uint64_t size() const { return _size; }
+
+  /*!
+   \brief Accessor
+   \return fraction of bits that are set
+   */
+  double fill_ratio() const;
+
+  /*!
+   \brief Accessor
+   \return probability that an object that is not in this set is considered in
+   the set: (fill ratio)^k
+   \note the fill ratio only increases, hence this bounds the probability that
+   a new object has been missed at any point since this set was created
+   */
+  double omission_probability() const;
+
+  /*!
+   \brief Accessor
+   \return expected number of objects that have been considered in this set when
+   they were not: sum of the omission probabilities at each addition
+   \note this estimates the number of states that a search has missed due to
+   hash collisions (assuming that as many new objects were tested as objects
+   added)
+   */
+  inline double expected_omissions() const { return _expected_omissions; }
+
+  /*!
+   \brief Accessor
+   \return memory used by this set (in bytes)
+   */
+  std::size_t memsize() const;
+
+private:
+  std::vector<uint64_t> _words; /*!< Bit array */
+  uint64_t _mask;               /*!< Number of bits - 1 */
+  unsigned int _hashes;         /*!< Number of hash functions */
+  uint64_t _set_bits;           /*!< Number of bits set */
+  uint64_t _size;               /*!< Number of objects added */
+  double _expected_omissions;   /*!< Expected number of missed objects */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_BITSTATE_HH
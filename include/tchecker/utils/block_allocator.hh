@@ -0,0 +1,128 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_BLOCK_ALLOCATOR_HH
+#define TCHECKER_BLOCK_ALLOCATOR_HH
+
+#include <cstddef>
+
+/*!
+ \file block_allocator.hh
+ \brief Allocation of large blocks of memory, with support for huge pages
+ */
+
+namespace tchecker {
+
+/*!
+ \brief Policies for huge pages
+ */
+enum huge_pages_t {
+  HUGE_PAGES_AUTO,        /*!< Transparent huge pages for blocks of at least HUGE_PAGE_SIZE bytes, heap otherwise */
+  HUGE_PAGES_NONE,        /*!< Blocks are allocated on the heap */
+  HUGE_PAGES_TRANSPARENT, /*!< Blocks are mapped in memory, with transparent huge pages */
+  HUGE_PAGES_EXPLICIT,    /*!< Blocks are mapped on reserved huge pages (transparent huge pages if none is left) */
+};
+
+/*!
+ \brief Size of huge pages
+ */
+constexpr std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+/*!
+ \brief Set the policy for huge pages
+ \param policy : policy for huge pages
+ \post block allocators created from now on follow policy
+ \note the default policy is HUGE_PAGES_AUTO
+ */
+void set_huge_pages(enum tchecker::huge_pages_t policy);
+
+/*!
+ \brief Accessor
+ \return the policy for huge pages
+ */
+enum tchecker::huge_pages_t huge_pages();
+
+/*!
+ \brief Accessor
+ \return memory currently allocated by all block allocators in the process
+ (in bytes)
+ \note this function can be called from any thread
+ */
+std::size_t allocated_blocks_memory();
+
+/*!
+ \class block_allocator_t
+ \brief Allocator of blocks of fixed size
+ \note Blocks are either allocated on the heap, or mapped in memory (mmap) on
+ huge pages (transparent or explicit) when supported by the system. Mapped
+ blocks are aligned on huge pages, and bound to the NUMA node of the thread
+ that allocates them (preferred policy, on Linux). The backend is chosen at
+ construction from the policy for huge pages and the size of blocks. Using
+ huge pages reduces TLB misses when large state spaces are stored
+ */
+class block_allocator_t {
+public:
+  /*!
+   \brief Backends
+   */
+  enum backend_t {
+    BACKEND_HEAP,             /*!< operator new */
+    BACKEND_MMAP_TRANSPARENT, /*!< mmap, with transparent huge pages */
+    BACKEND_MMAP_EXPLICIT,    /*!< mmap on reserved huge pages */
+  };
+
+  /*!
+   \brief Constructor
+   \param block_size : size of blocks (in bytes)
+   \post this allocator allocates blocks of block_size bytes using the backend
+   chosen from block_size and tchecker::huge_pages()
+   */
+  explicit block_allocator_t(std::size_t block_size);
+
+  /*!
+   \brief Allocate a block
+   \return pointer to a block of block_size bytes
+   \throw std::bad_alloc : if the block cannot be allocated
+   \note the memory of the block is not initialized
+   */
+  void * allocate();
+
+  /*!
+   \brief Deallocate a block
+   \param block : a block
+   \pre block has been allocated by this allocator
+   \post block has been deallocated
+   */
+  void deallocate(void * block);
+
+  /*!
+   \brief Accessor
+   \return size of blocks
+   */
+  inline std::size_t block_size() const { return _block_size; }
+
+  /*!
+   \brief Accessor
+   \return backend used to allocate blocks
+   */
+  inline enum backend_t backend() const { return _backend; }
+
+private:
+  /*!
+   \brief Map a block in memory
+   \return pointer to the block, nullptr if the block cannot be mapped
+   */
+  void * map();
+
+  std::size_t _block_size;  /*!< Size of blocks */
+  std::size_t _mapped_size; /*!< Size of mapped blocks (multiple of HUGE_PAGE_SIZE) */
+  enum backend_t _backend;  /*!< Backend */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_BLOCK_ALLOCATOR_HH
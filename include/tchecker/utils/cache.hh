@@ -16,8 +16,10 @@
 #include <limits>
 #include <vector>
 
+#include "tchecker/utils/counters.hh"
 #include "tchecker/utils/hashtable.hh"
 #include "tchecker/utils/pool.hh"
+#include "tchecker/utils/trace.hh"
 
 namespace tchecker {
 
@@ -44,7 +46,7 @@ public:
    \brief Constructor
    \param table_size : size of the hash table
    */
-  cache_t(std::size_t table_size = 65536) : _hashtable(table_size, _hash, _equal) {}
+  cache_t(std::size_t table_size = 65536) : _hashtable(table_size, _hash, _equal), _cursor(0) {}
 
   /*!
    \brief Copy-construction
@@ -81,6 +83,23 @@ public:
    */
   inline SPTR find_else_add(SPTR const & o) { return _hashtable.find_else_add(o); }
 
+  /*!
+   \brief Object caching with counting of hits and misses
+   \param o : object
+   \param hits : counter of objects found in the cache
+   \param misses : counter of objects added to the cache
+   \return see find_else_add(o)
+   \post see find_else_add(o). hits has been incremented if an equivalent object
+   was in the cache, and misses has been incremented otherwise (see
+   tchecker::counters::lookup)
+   */
+  inline SPTR find_else_add(SPTR const & o, enum tchecker::counters::counter_t hits, enum tchecker::counters::counter_t misses)
+  {
+    SPTR cached = _hashtable.find_else_add(o);
+    tchecker::counters::lookup(hits, misses, cached != o);
+    return cached;
+  }
+
   /*!
    \brief Membership predicate
    \param o : object
@@ -107,6 +126,7 @@ public:
    */
   virtual std::size_t collect()
   {
+    tchecker::trace::time_point_t const start = tchecker::trace::timestamp();
     std::size_t const previous_size = _hashtable.size();
     typename tchecker::hashtable_t<SPTR, HASH, EQUAL>::iterator_t it = _hashtable.begin();
     while (it != _hashtable.end()) {
@@ -115,6 +135,32 @@ public:
       else
         ++it;
     }
+    trace_collect(start, previous_size);
+    return previous_size - _hashtable.size();
+  }
+
+  /*!
+   \brief Incremental garbage collection
+   \param n : number of objects to inspect
+   \post The objects with reference counter 1 in the buckets of the hash table
+   from the collection cursor have been removed from this cache, until at least
+   n objects have been inspected or all buckets have been visited. The cursor
+   has been moved to the next bucket
+   \return number of collected objects
+   */
+  virtual std::size_t collect_incremental(std::size_t n)
+  {
+    tchecker::trace::time_point_t const start = tchecker::trace::timestamp();
+    std::size_t const previous_size = _hashtable.size();
+    std::size_t const buckets = _hashtable.bucket_count();
+    std::size_t inspected = 0;
+    for (std::size_t i = 0; i < buckets && inspected < n; ++i) {
+      if (_cursor >= buckets) // the table may have grown or shrunk
+        _cursor = 0;
+      inspected += _hashtable.remove_if(_cursor, [](SPTR const & o) { return o->refcount() == 1; });
+      ++_cursor;
+    }
+    trace_collect(start, previous_size);
     return previous_size - _hashtable.size();
   }
 
@@ -125,9 +171,26 @@ public:
   inline std::size_t size() const { return _hashtable.size(); }
 
 private:
+  /*!
+   \brief Trace a collection
+   \param start : start time of the collection
+   \param previous_size : size of the cache before the collection
+   \post a span with the number of collected objects, and the number of objects
+   and buckets in the hash table after collection has been emitted if tracing is
+   enabled
+   */
+  void trace_collect(tchecker::trace::time_point_t const & start, std::size_t previous_size) const
+  {
+    tchecker::trace::span("cache collect", "gc", start, tchecker::trace::timestamp(),
+                          {"collected", static_cast<long long>(previous_size - _hashtable.size())},
+                          {"objects", static_cast<long long>(_hashtable.size())},
+                          {"buckets", static_cast<long long>(_hashtable.bucket_count())});
+  }
+
   HASH _hash;                                          /*! Hash function */
   EQUAL _equal;                                        /*!< Equality predicate */
   tchecker::hashtable_t<SPTR, HASH, EQUAL> _hashtable; /*!< Table of stored objects */
+  std::size_t _cursor;                                 /*!< Next bucket inspected by incremental collection */
 };
 
 /*!
@@ -0,0 +1,167 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_COUNTERS_HH
+#define TCHECKER_COUNTERS_HH
+
+#include <map>
+#include <string>
+
+#include "tchecker/config.hh"
+
+/*!
+ \file counters.hh
+ \brief Counters of operations on the hot paths of algorithms
+ \note Counters are only maintained when TChecker is built with option
+ TCHECKER_COUNTERS. Otherwise, counting functions are empty and have no cost
+ */
+
+namespace tchecker {
+
+namespace counters {
+
+/*!
+ \brief Counters
+ */
+enum counter_t {
+  ZONE_INCLUSION_CHECKS = 0,     /*!< Number of zone inclusion checks (is_le) */
+  ZONE_INCLUSION_SUCCESSES,      /*!< Number of successful zone inclusion checks */
+  ALU_INCLUSION_CHECKS,          /*!< Number of aLU inclusion checks (is_alu_le, is_alu_star_le, is_sync_alu_le) */
+  ALU_INCLUSION_SUCCESSES,       /*!< Number of successful aLU inclusion checks */
+  COVER_CHECKS,                  /*!< Number of covering checks in cover graphs */
+  COVER_SCANNED_NODES,           /*!< Number of nodes scanned in collision lists by covering checks */
+  COVER_SCANNED_NODES_MAX,       /*!< Maximal number of nodes scanned by a covering check */
+  SUCCESSORS_DISCRETE_REJECTED,  /*!< Number of successors rejected by guards, invariants or statements on integer variables */
+  SUCCESSORS_ZONE_EMPTY,         /*!< Number of successors rejected due to an empty zone */
+  VM_INSTRUCTIONS,               /*!< Number of bytecode instructions interpreted */
+  VLOC_CACHE_HITS,               /*!< Number of tuples of locations found in cache */
+  VLOC_CACHE_MISSES,             /*!< Number of tuples of locations added to cache */
+  VEDGE_CACHE_HITS,              /*!< Number of tuples of edges found in cache */
+  VEDGE_CACHE_MISSES,            /*!< Number of tuples of edges added to cache */
+  INTVAL_CACHE_HITS,             /*!< Number of valuations of integer variables found in cache */
+  INTVAL_CACHE_MISSES,           /*!< Number of valuations of integer variables added to cache */
+  ZONE_CACHE_HITS,               /*!< Number of zones found in cache */
+  ZONE_CACHE_MISSES,             /*!< Number of zones added to cache */
+  POOL_BLOCKS,                   /*!< Number of blocks allocated by pools */
+  COUNTERS_COUNT,                /*!< Number of counters (not a counter) */
+};
+
+namespace details {
+
+/*!
+ \brief Values of counters
+ \note counters are shared by all algorithms in the process, and they are not
+ thread-safe
+ */
+extern unsigned long values[tchecker::counters::COUNTERS_COUNT];
+
+} // end of namespace details
+
+/*!
+ \brief Check if counters are maintained
+ \return true if TChecker has been built with option TCHECKER_COUNTERS, false
+ otherwise
+ */
+inline constexpr bool enabled()
+{
+#ifdef TCHECKER_COUNTERS
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*!
+ \brief Increment a counter
+ \param c : a counter
+ \param n : increment
+ \post c has been incremented by n if counters are enabled
+ */
+inline void increment([[maybe_unused]] enum tchecker::counters::counter_t c, [[maybe_unused]] unsigned long n = 1)
+{
+#ifdef TCHECKER_COUNTERS
+  tchecker::counters::details::values[c] += n;
+#endif
+}
+
+/*!
+ \brief Count a check
+ \param checks : counter of checks
+ \param successes : counter of successful checks
+ \param result : result of the check
+ \post checks has been incremented, and successes has been incremented if
+ result is true, if counters are enabled
+ \return result
+ */
+inline bool check([[maybe_unused]] enum tchecker::counters::counter_t checks,
+                  [[maybe_unused]] enum tchecker::counters::counter_t successes, bool result)
+{
+#ifdef TCHECKER_COUNTERS
+  ++tchecker::counters::details::values[checks];
+  if (result)
+    ++tchecker::counters::details::values[successes];
+#endif
+  return result;
+}
+
+/*!
+ \brief Count a lookup in a cache
+ \param hits : counter of hits
+ \param misses : counter of misses
+ \param hit : true if the object has been found in the cache
+ \post hits has been incremented if hit is true, and misses otherwise, if
+ counters are enabled
+ */
+inline void lookup([[maybe_unused]] enum tchecker::counters::counter_t hits,
+                   [[maybe_unused]] enum tchecker::counters::counter_t misses, [[maybe_unused]] bool hit)
+{
+#ifdef TCHECKER_COUNTERS
+  ++tchecker::counters::details::values[hit ? hits : misses];
+#endif
+}
+
+/*!
+ \brief Update a maximum
+ \param c : a counter
+ \param n : a value
+ \post c has been set to n if n is greater than c, if counters are enabled
+ */
+inline void maximize([[maybe_unused]] enum tchecker::counters::counter_t c, [[maybe_unused]] unsigned long n)
+{
+#ifdef TCHECKER_COUNTERS
+  if (n > tchecker::counters::details::values[c])
+    tchecker::counters::details::values[c] = n;
+#endif
+}
+
+/*!
+ \brief Accessor
+ \param c : a counter
+ \return value of c (0 if counters are disabled)
+ */
+inline unsigned long value(enum tchecker::counters::counter_t c) { return tchecker::counters::details::values[c]; }
+
+/*!
+ \brief Reset all counters
+ \post all counters are 0
+ */
+void reset();
+
+/*!
+ \brief Extract counters as attributes (key, value)
+ \param m : attributes map
+ \post all counters, the success rates of inclusion checks, and the average
+ number of nodes scanned by covering checks have been added to m if counters are
+ enabled. m is unchanged otherwise
+ */
+void attributes(std::map<std::string, std::string> & m);
+
+} // end of namespace counters
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_COUNTERS_HH
@@ -0,0 +1,217 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_DISK_HASHSET_HH
+#define TCHECKER_DISK_HASHSET_HH
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+/*!
+ \file disk_hashset.hh
+ \brief Disk-backed set of keys with batched lookups
+ */
+
+namespace tchecker {
+
+/*!
+ \class disk_hashset_t
+ \brief Set of keys (byte strings) stored in a memory-mapped file, with an
+ in-memory cache of recently inserted keys
+ \note Keys are partitioned by their hash value. Each partition is stored in
+ the file as a list of blocks (the collision list of the partition). Queries
+ are answered in batches (delayed duplicate detection): the keys in a batch
+ that are not found in the cache are grouped by partition, and each partition
+ is then scanned at most once for the whole batch. Keys that are not found are
+ appended to their partition. Every key is written to the file, hence the cache
+ can be dropped at any time: it holds two generations of recently inserted
+ keys, and the oldest generation is dropped when the newest one is full. The
+ file is removed when the set is destroyed.
+ This is meant to store sets of states that do not fit in memory, at the cost
+ of disk accesses (see Stern and Dill, "Using magnetic disk instead of main
+ memory in the Murphi verifier", CAV 1998)
+ */
+class disk_hashset_t {
+public:
+  /*!
+   \brief Constructor
+   \param filename : name of the file
+   \param cache_size : maximal size of the cache of recently inserted keys (in
+   bytes)
+   \param partitions : number of partitions
+   \pre partitions > 0
+   \post this set is empty, and filename has been created (or truncated)
+   \throw std::invalid_argument : if partitions is 0
+   \throw std::runtime_error : if filename cannot be created
+   */
+  disk_hashset_t(std::string const & filename, std::size_t cache_size, std::size_t partitions = 4096);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  disk_hashset_t(tchecker::disk_hashset_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  disk_hashset_t(tchecker::disk_hashset_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post the file has been unmapped and removed
+   */
+  ~disk_hashset_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::disk_hashset_t & operator=(tchecker::disk_hashset_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::disk_hashset_t & operator=(tchecker::disk_hashset_t &&) = delete;
+
+  /*!
+   \brief Find or add a batch of keys
+   \param keys : keys
+   \param added : flags
+   \post every key in keys belongs to this set. added[i] is true if keys[i] has
+   been added to this set, and false if keys[i] was already in this set (or
+   appears earlier in keys)
+   \throw std::runtime_error : if the file cannot be extended
+   */
+  void find_else_add(std::vector<std::string> const & keys, std::vector<bool> & added);
+
+  /*!
+   \brief Accessor
+   \return number of keys in this set
+   */
+  inline std::size_t size() const { return _size; }
+
+  /*!
+   \brief Accessor
+   \return memory used by this set (in bytes), excluding the file
+   */
+  std::size_t memsize() const;
+
+  /*!
+   \brief Accessor
+   \return number of bytes read from the file
+   */
+  inline uint64_t bytes_read() const { return _bytes_read; }
+
+  /*!
+   \brief Accessor
+   \return number of bytes written to the file
+   */
+  inline uint64_t bytes_written() const { return _bytes_written; }
+
+  /*!
+   \brief Accessor
+   \return number of batches of keys that have been looked up in the file
+   */
+  inline uint64_t batches() const { return _batches; }
+
+  /*!
+   \brief Accessor
+   \return number of keys that have been found in the cache
+   */
+  inline uint64_t cache_hits() const { return _cache_hits; }
+
+private:
+  /*!
+   \brief Header of blocks in the file
+   */
+  struct block_header_t {
+    uint64_t next;     /*!< Offset of next block in the partition (NO_BLOCK if none) */
+    uint64_t capacity; /*!< Number of bytes available for keys in the block */
+    uint64_t used;     /*!< Number of bytes used by keys in the block */
+  };
+
+  /*!
+   \brief Partition of keys
+   */
+  struct partition_t {
+    uint64_t head; /*!< Offset of the first block (NO_BLOCK if none) */
+    uint64_t tail; /*!< Offset of the last block (NO_BLOCK if none) */
+  };
+
+  /*!
+   \brief Partition of a key
+   \param key : a key
+   \return index of the partition of key
+   */
+  std::size_t partition(std::string_view key) const;
+
+  /*!
+   \brief Check membership in the cache
+   \param key : a key
+   \return true if key is in the cache, false otherwise
+   */
+  bool cached(std::string const & key) const;
+
+  /*!
+   \brief Add a key to the cache
+   \param key : a key
+   \post key has been added to the newest generation of the cache. The oldest
+   generation has been dropped if the newest one was full
+   */
+  void cache(std::string const & key);
+
+  /*!
+   \brief Append a key to a partition
+   \param p : index of a partition
+   \param key : a key
+   \post key has been written to the last block of partition p (a new block has
+   been allocated if needed)
+   \throw std::runtime_error : if the file cannot be extended
+   */
+  void append(std::size_t p, std::string const & key);
+
+  /*!
+   \brief Allocate a block in the file
+   \param capacity : number of bytes needed for keys
+   \return offset of the allocated block
+   \post the block has been allocated at the end of the file, the file has been
+   extended and remapped if needed
+   \throw std::runtime_error : if the file cannot be extended
+   */
+  uint64_t allocate_block(uint64_t capacity);
+
+  /*!
+   \brief Accessor
+   \param offset : offset of a block
+   \return header of the block at offset
+   */
+  inline tchecker::disk_hashset_t::block_header_t * header(uint64_t offset)
+  {
+    return reinterpret_cast<tchecker::disk_hashset_t::block_header_t *>(_map + offset);
+  }
+
+  std::string _filename;                                          /*!< Name of the file */
+  int _fd;                                                        /*!< File descriptor */
+  char * _map;                                                    /*!< Memory mapping of the file */
+  uint64_t _map_size;                                             /*!< Size of the mapping (and of the file) */
+  uint64_t _end;                                                  /*!< Offset of the end of the last block */
+  std::vector<tchecker::disk_hashset_t::partition_t> _partitions; /*!< Partitions */
+  std::unordered_set<std::string> _cache[2];                      /*!< Cache (newest generation first) */
+  std::size_t _cache_bytes;                                       /*!< Size of the newest generation of the cache */
+  std::size_t _cache_size;                                        /*!< Maximal size of the cache */
+  std::size_t _size;                                              /*!< Number of keys */
+  uint64_t _bytes_read;                                           /*!< Number of bytes read from the file */
+  uint64_t _bytes_written;                                        /*!< Number of bytes written to the file */
+  uint64_t _batches;                                              /*!< Number of batches looked up in the file */
+  uint64_t _cache_hits;                                           /*!< Number of keys found in the cache */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_DISK_HASHSET_HH
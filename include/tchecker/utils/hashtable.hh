@@ -772,6 +772,36 @@ public:
     return true;
   }
 
+  /*!
+   \brief Accessor
+   \return number of buckets in this hash table
+   */
+  inline std::size_t bucket_count() const { return _table.bucket_count(); }
+
+  /*!
+   \brief Remove elements in a bucket
+   \param n : index of a bucket
+   \param pred : predicate over elements
+   \pre n < bucket_count()
+   \post all the elements in bucket n that satisfy pred have been removed from
+   this hash table
+   \return number of elements in bucket n before removal
+   */
+  template <class PRED> std::size_t remove_if(std::size_t n, PRED && pred)
+  {
+    std::size_t inspected = 0;
+    for (auto it = _table.begin(n); it != _table.end(n); ++inspected) {
+      if (pred(*it)) {
+        SPTR const o = *it;
+        ++it;
+        _table.erase(o);
+      }
+      else
+        ++it;
+    }
+    return inspected;
+  }
+
 protected:
   std::unordered_set<SPTR, HASH, EQUAL> _table; /*!< Container */
 };
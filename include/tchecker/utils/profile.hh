@@ -0,0 +1,162 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_PROFILE_HH
+#define TCHECKER_PROFILE_HH
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+/*!
+ \file profile.hh
+ \brief Time spent in the phases of exploration algorithms
+ \note Profiling is disabled by default. When it is disabled, a scoped timer
+ costs a test of a global flag
+ */
+
+namespace tchecker {
+
+namespace profile {
+
+/*!
+ \brief Phases of exploration algorithms
+ */
+enum phase_t {
+  PHASE_DISCRETE = 0,  /*!< Discrete part of transitions (tuples of edges, integer variables, bytecode) */
+  PHASE_SEMANTICS,     /*!< Zone semantics */
+  PHASE_EXTRAPOLATION, /*!< Zone extrapolation */
+  PHASE_SHARING,       /*!< Sharing of state and transition components (hash-consing) */
+  PHASE_COVERING,      /*!< Covering checks */
+  PHASE_GRAPH,         /*!< Graph maintenance (nodes and edges) */
+  PHASE_WAITING,       /*!< Waiting container operations */
+  PHASES_COUNT,        /*!< Number of phases (not a phase) */
+};
+
+namespace details {
+
+/*!
+ \brief Profiling flag
+ */
+extern bool enabled;
+
+/*!
+ \brief Time spent in each phase, in nanoseconds
+ \note accumulated times are shared by all algorithms in the process, and they
+ are not thread-safe
+ */
+extern std::uint64_t nanoseconds[tchecker::profile::PHASES_COUNT];
+
+/*!
+ \brief Number of timed calls in each phase
+ */
+extern std::uint64_t calls[tchecker::profile::PHASES_COUNT];
+
+} // end of namespace details
+
+/*!
+ \brief Enable or disable profiling
+ \param enable : profiling flag
+ \post phases are timed if and only if enable is true
+ */
+void enable(bool enable);
+
+/*!
+ \brief Accessor
+ \return true if profiling is enabled, false otherwise
+ */
+inline bool enabled() { return tchecker::profile::details::enabled; }
+
+/*!
+ \brief Reset the time spent in each phase
+ \post the time spent and the number of calls in each phase are 0
+ */
+void reset();
+
+/*!
+ \brief Accessor
+ \param phase : a phase
+ \return time spent in phase in seconds
+ */
+double seconds(enum tchecker::profile::phase_t phase);
+
+/*!
+ \brief Extract profile as attributes (key, value)
+ \param m : attributes map
+ \param total : total running time in seconds
+ \post the time spent and the number of calls in each phase, as well as the
+ time spent out of all phases w.r.t. total, have been added to m if profiling
+ is enabled. m is unchanged otherwise
+ */
+void attributes(std::map<std::string, std::string> & m, double total);
+
+/*!
+ \class scoped_timer_t
+ \brief Adds the time from its construction to its destruction to a phase
+ \note timers should not be nested, as the time spent in the inner phase would
+ be counted twice
+ */
+class scoped_timer_t {
+public:
+  /*!
+   \brief Constructor
+   \param phase : a phase
+   \post this timer has started if profiling is enabled
+   */
+  explicit inline scoped_timer_t(enum tchecker::profile::phase_t phase)
+      : _phase(phase), _running(tchecker::profile::details::enabled)
+  {
+    if (_running)
+      _start = std::chrono::steady_clock::now();
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  scoped_timer_t(tchecker::profile::scoped_timer_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  scoped_timer_t(tchecker::profile::scoped_timer_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post the time since construction has been added to the phase of this timer
+   if it has started
+   */
+  inline ~scoped_timer_t()
+  {
+    if (_running) {
+      std::chrono::nanoseconds const d = std::chrono::steady_clock::now() - _start;
+      tchecker::profile::details::nanoseconds[_phase] += static_cast<std::uint64_t>(d.count());
+      ++tchecker::profile::details::calls[_phase];
+    }
+  }
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::profile::scoped_timer_t & operator=(tchecker::profile::scoped_timer_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::profile::scoped_timer_t & operator=(tchecker::profile::scoped_timer_t &&) = delete;
+
+private:
+  enum tchecker::profile::phase_t _phase;                    /*!< Timed phase */
+  bool _running;                                             /*!< Running flag */
+  std::chrono::time_point<std::chrono::steady_clock> _start; /*!< Start time */
+};
+
+} // end of namespace profile
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_PROFILE_HH
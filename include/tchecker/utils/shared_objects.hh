@@ -8,8 +8,10 @@
 #ifndef TCHECKER_SHARED_OBJECTS_HH
 #define TCHECKER_SHARED_OBJECTS_HH
 
+#include <cstdint>
 #include <exception>
 #include <limits>
+#include <type_traits>
 
 #if BOOST_VERSION <= 106600
 #include <boost/functional/hash.hpp>
@@ -17,6 +19,7 @@
 #include <boost/container_hash/hash.hpp>
 #endif
 
+#include "tchecker/config.hh"
 #include "tchecker/utils/allocation_size.hh"
 
 /*!
@@ -28,12 +31,26 @@ namespace tchecker {
 
 // shared objects
 
+/*!
+ \brief Type of reference counter for shared objects that need at most 4-bytes
+ alignment (see tchecker::make_shared_t)
+ \note 32-bits counters save 4 bytes per object, but a shared object cannot be
+ referenced more than about 2^32 times. They are used when TChecker is built with
+ option TCHECKER_COMPACT_REFCOUNT
+ */
+#ifdef TCHECKER_COMPACT_REFCOUNT
+using compact_refcount_t = uint32_t;
+#else
+using compact_refcount_t = std::size_t;
+#endif
+
 /*!
  \class make_shared_t
  \brief Functor to create a shared class from a given class. Adds a reference
  counter to the given class.
  \tparam T : type to share
- \tparam REFCOUNT : type of the reference counter. Must be an unsigned type.
+ \tparam REFCOUNT : type of the reference counter. Must be an unsigned type,
+ and its size must be a multiple of the alignment of T
  \tparam RESERVED : number of reserved values of the reference counter
  \note The reference counter is stored by allocating sizeof(REFCOUNT) extra
  bytes of memory. These bytes are stored at the beginning of the allocated
@@ -48,7 +65,7 @@ namespace tchecker {
 template <class T, class REFCOUNT = std::size_t, std::size_t RESERVED = 1> class make_shared_t final : public T {
 
   static_assert(std::is_unsigned<REFCOUNT>::value, "REFCOUNT must be an unsigned type");
-  static_assert(sizeof(REFCOUNT) % alignof(T *) == 0, "REFCOUNT size must be a multiple of pointer alignment");
+  static_assert(sizeof(REFCOUNT) % alignof(T) == 0, "REFCOUNT size must be a multiple of the alignment of T");
 
 public:
   /*!
@@ -225,32 +242,33 @@ private:
    */
   constexpr refcount_t * refcount_addr() const
   {
-    return (reinterpret_cast<refcount_t *>(const_cast<tchecker::make_shared_t<T> *>(this)) - 1);
+    return (reinterpret_cast<refcount_t *>(const_cast<tchecker::make_shared_t<T, REFCOUNT, RESERVED> *>(this)) - 1);
   }
 };
 
 // allocation size for shared objects
 
 /*!
- \class allocation_size_t<make_shared_t<T>>
+ \class allocation_size_t<make_shared_t<T, REFCOUNT, RESERVED>>
  \brief Specialization of class tchecker::allocation_size_t for type
  tchecker::make_shared_t
  \note A specialization of tchecker::allocation_size_t should be defined for
  type T in namespace tchecker
  */
-template <class T> class allocation_size_t<tchecker::make_shared_t<T>> {
+template <class T, class REFCOUNT, std::size_t RESERVED>
+class allocation_size_t<tchecker::make_shared_t<T, REFCOUNT, RESERVED>> {
 public:
   /*!
    \brief Accessor
    \param args : parameters needed to determine the allocation size of T
-   \return Allocation size for objects of type tchecker::make_shared_t<T>,
+   \return Allocation size for objects of type tchecker::make_shared_t<T, REFCOUNT, RESERVED>,
    which is the size needed by T: tchecker::allocation_size_t<T>().size(args)
    plus the bytes for the reference counter
    */
   template <class... ARGS> static constexpr std::size_t alloc_size(ARGS &&... args)
   {
     // allocation size for T + size of reference counter
-    return (tchecker::allocation_size_t<T>().alloc_size(args...) + sizeof(typename tchecker::make_shared_t<T>::refcount_t));
+    return (tchecker::allocation_size_t<T>().alloc_size(args...) + sizeof(REFCOUNT));
   }
 };
 
@@ -0,0 +1,294 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_TRACE_HH
+#define TCHECKER_TRACE_HH
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*!
+ \file trace.hh
+ \brief Timeline of exploration runs in the Chrome trace event format (readable
+ by chrome://tracing and Perfetto)
+ \note Tracing is disabled unless a trace writer exists. When it is disabled,
+ emitting an event costs a test of a global pointer. Events are buffered in
+ memory and written to the trace file by a background thread
+ */
+
+namespace tchecker {
+
+namespace trace {
+
+/*!
+ \brief Type of timestamps
+ */
+using time_point_t = std::chrono::time_point<std::chrono::steady_clock>;
+
+/*!
+ \brief Argument of an event
+ \note the name should be a string literal, no argument when name is nullptr
+ */
+struct arg_t {
+  char const * name = nullptr; /*!< Name */
+  long long value = 0;         /*!< Value */
+};
+
+/*!
+ \brief Maximal number of arguments of an event
+ */
+constexpr std::size_t EVENT_ARGS = 3;
+
+/*!
+ \brief Trace event
+ \note name and category should be string literals
+ */
+struct event_t {
+  char const * name;                       /*!< Name */
+  char const * category;                   /*!< Category */
+  char phase;                              /*!< 'X' for spans, 'C' for counters */
+  tchecker::trace::time_point_t start;     /*!< Start time */
+  tchecker::trace::time_point_t end;       /*!< End time (spans only) */
+  tchecker::trace::arg_t args[EVENT_ARGS]; /*!< Arguments */
+};
+
+/*!
+ \brief Number of iterations in the spans of exploration loops
+ */
+constexpr std::size_t EXPLORATION_BATCH = 1024;
+
+class writer_t;
+
+namespace details {
+
+/*!
+ \brief Writer of the trace file (nullptr when tracing is disabled)
+ */
+extern tchecker::trace::writer_t * writer;
+
+} // end of namespace details
+
+/*!
+ \brief Accessor
+ \return true if tracing is enabled, false otherwise
+ */
+inline bool enabled() { return tchecker::trace::details::writer != nullptr; }
+
+/*!
+ \brief Timestamp
+ \return current time if tracing is enabled, the epoch otherwise (which avoids
+ reading the clock when tracing is disabled)
+ */
+inline tchecker::trace::time_point_t timestamp()
+{
+  return (tchecker::trace::enabled() ? std::chrono::steady_clock::now() : tchecker::trace::time_point_t{});
+}
+
+/*!
+ \brief Emit an event
+ \param event : an event
+ \pre tracing is enabled
+ \post event has been buffered for output
+ */
+void emit(tchecker::trace::event_t const & event);
+
+/*!
+ \brief Emit a span
+ \param name : name of the span
+ \param category : category of the span
+ \param start : start time
+ \param end : end time
+ \param a0 : argument
+ \param a1 : argument
+ \param a2 : argument
+ \post a span from start to end has been emitted if tracing is enabled
+ */
+inline void span(char const * name, char const * category, tchecker::trace::time_point_t start,
+                 tchecker::trace::time_point_t end, tchecker::trace::arg_t a0 = {}, tchecker::trace::arg_t a1 = {},
+                 tchecker::trace::arg_t a2 = {})
+{
+  if (tchecker::trace::enabled())
+    tchecker::trace::emit(tchecker::trace::event_t{name, category, 'X', start, end, {a0, a1, a2}});
+}
+
+/*!
+ \brief Emit a counter
+ \param name : name of the counter
+ \param a0 : value of the counter (series a0.name)
+ \param a1 : value of the counter (series a1.name)
+ \post the values of the counter at the current time have been emitted if
+ tracing is enabled
+ */
+inline void counter(char const * name, tchecker::trace::arg_t a0, tchecker::trace::arg_t a1 = {})
+{
+  if (tchecker::trace::enabled()) {
+    tchecker::trace::time_point_t const now = std::chrono::steady_clock::now();
+    tchecker::trace::emit(tchecker::trace::event_t{name, "counter", 'C', now, now, {a0, a1, {}}});
+  }
+}
+
+/*!
+ \class batch_t
+ \brief Groups iterations of a loop into spans
+ */
+class batch_t {
+public:
+  /*!
+   \brief Constructor
+   \param name : name of spans
+   \param category : category of spans
+   \param size : number of iterations in each span
+   \pre size > 0
+   */
+  batch_t(char const * name, char const * category, std::size_t size)
+      : _name(name), _category(category), _size(size), _count(0), _start(tchecker::trace::timestamp())
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  batch_t(tchecker::trace::batch_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  batch_t(tchecker::trace::batch_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post the span of the last iterations has been emitted if tracing is enabled
+   */
+  ~batch_t()
+  {
+    if (_count > 0)
+      tchecker::trace::span(_name, _category, _start, tchecker::trace::timestamp(),
+                            {"iterations", static_cast<long long>(_count)});
+  }
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::trace::batch_t & operator=(tchecker::trace::batch_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::trace::batch_t & operator=(tchecker::trace::batch_t &&) = delete;
+
+  /*!
+   \brief Count an iteration
+   \return true if a span has been emitted (i.e. a batch of iterations is
+   complete and tracing is enabled), false otherwise
+   */
+  inline bool tick()
+  {
+    if (!tchecker::trace::enabled())
+      return false;
+    if (++_count < _size)
+      return false;
+    tchecker::trace::time_point_t const now = std::chrono::steady_clock::now();
+    tchecker::trace::span(_name, _category, _start, now, {"iterations", static_cast<long long>(_count)});
+    _start = now;
+    _count = 0;
+    return true;
+  }
+
+private:
+  char const * _name;                   /*!< Name of spans */
+  char const * _category;               /*!< Category of spans */
+  std::size_t _size;                    /*!< Number of iterations in a span */
+  std::size_t _count;                   /*!< Number of iterations in current span */
+  tchecker::trace::time_point_t _start; /*!< Start time of current span */
+};
+
+/*!
+ \class writer_t
+ \brief Writer of a trace file
+ \note tracing is enabled as long as a writer exists. Only one writer can exist
+ at a time. Events should be emitted from a single thread
+ */
+class writer_t {
+public:
+  /*!
+   \brief Constructor
+   \param filename : name of the trace file
+   \post tracing has been enabled, events are written to filename
+   \throw std::runtime_error : if filename cannot be opened, or if another
+   writer exists
+   */
+  explicit writer_t(std::string const & filename);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  writer_t(tchecker::trace::writer_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  writer_t(tchecker::trace::writer_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post tracing has been disabled, all buffered events have been written and
+   the trace file has been closed
+   */
+  ~writer_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::trace::writer_t & operator=(tchecker::trace::writer_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::trace::writer_t & operator=(tchecker::trace::writer_t &&) = delete;
+
+  /*!
+   \brief Buffer an event
+   \param event : an event
+   \post event has been buffered. Full buffers are handed over to the writing
+   thread
+   */
+  void emit(tchecker::trace::event_t const & event);
+
+private:
+  /*!
+   \brief Body of the writing thread
+   */
+  void run();
+
+  /*!
+   \brief Output an event
+   \param event : an event
+   \post event has been written to the trace file
+   */
+  void write(tchecker::trace::event_t const & event);
+
+  std::ofstream _ofs;                                       /*!< Trace file */
+  tchecker::trace::time_point_t _origin;                    /*!< Origin of timestamps */
+  std::vector<tchecker::trace::event_t> _buffer;            /*!< Events being buffered */
+  std::vector<std::vector<tchecker::trace::event_t>> _full; /*!< Buffers waiting to be written */
+  bool _stop;                                               /*!< Stop flag */
+  std::mutex _mutex;                                        /*!< Mutex on full buffers and stop flag */
+  std::condition_variable _cv;                              /*!< Wakes up the writing thread */
+  std::thread _thread;                                      /*!< Writing thread */
+};
+
+} // end of namespace trace
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_TRACE_HH
@@ -0,0 +1,222 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_TREE_TABLE_HH
+#define TCHECKER_TREE_TABLE_HH
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+/*!
+ \file tree_table.hh
+ \brief Tree compression of fixed-width vectors
+ */
+
+namespace tchecker {
+
+/*!
+ \class tree_table_t
+ \brief Table of fixed-width vectors of 32-bit values with tree compression
+ \note Each vector is stored as a balanced binary tree: the leaves are the
+ values in the vector, and each internal node is a pair of indices of its two
+ sub-trees. Pairs are hash-consed in one table per internal node. Hence vectors
+ that only differ in a few positions share most of their internal nodes: adding
+ a vector that differs from a stored one in a single position only stores
+ O(log width) new pairs. A stored vector is identified by the index of its root
+ pair (see Blom, Lisser, van de Pol and Weber, "A database approach to
+ distributed state-space generation", 2009)
+ */
+class tree_table_t {
+public:
+  /*!
+   \brief Type of values in vectors
+   */
+  using value_t = uint32_t;
+
+  /*!
+   \brief Type of index of stored vectors
+   */
+  using index_t = uint32_t;
+
+  /*!
+   \brief Constructor
+   \param width : width of vectors
+   \param table_size : initial size of internal tables
+   \post this table is empty
+   */
+  tree_table_t(std::size_t width, std::size_t table_size = 1024);
+
+  /*!
+   \brief Insert a vector
+   \param v : a vector
+   \pre v is an array of width() values
+   \return (true, index) if v has been added to this table with index, and
+   (false, index) if v was already in this table with index
+   \throw std::overflow_error : if the number of pairs in an internal table
+   exceeds the range of index_t
+   */
+  std::tuple<bool, tchecker::tree_table_t::index_t> insert(tchecker::tree_table_t::value_t const * v);
+
+  /*!
+   \brief Accessor
+   \param index : index of a stored vector
+   \param v : a vector
+   \pre index has been returned by insert
+   v is an array of width() values
+   \post v contains the vector with index
+   */
+  void get(tchecker::tree_table_t::index_t index, tchecker::tree_table_t::value_t * v) const;
+
+  /*!
+   \brief Accessor
+   \param index : index of a stored vector
+   \param i : position in the vector
+   \pre index has been returned by insert
+   i < width()
+   \return value at position i in the vector with index
+   \note this gives access to one value in O(log width) without decompressing
+   the whole vector
+   */
+  tchecker::tree_table_t::value_t get(tchecker::tree_table_t::index_t index, std::size_t i) const;
+
+  /*!
+   \brief Accessor
+   \return width of vectors
+   */
+  inline std::size_t width() const { return _width; }
+
+  /*!
+   \brief Accessor
+   \return number of vectors in this table
+   */
+  std::size_t size() const;
+
+  /*!
+   \brief Accessor
+   \return memory used by this table (in bytes)
+   */
+  std::size_t memsize() const;
+
+  /*!
+   \brief Clear
+   \post this table is empty
+   */
+  void clear();
+
+private:
+  /*!
+   \class pair_table_t
+   \brief Hash-consed table of pairs of indices
+   \note indices of pairs are stable: a pair keeps its index until the table is
+   cleared
+   */
+  class pair_table_t {
+  public:
+    /*!
+     \brief Constructor
+     \param table_size : initial size of the table
+     */
+    pair_table_t(std::size_t table_size);
+
+    /*!
+     \brief Find or add a pair
+     \param p : a pair encoded as a 64-bit value
+     \return (true, index) if p has been added with index, (false, index) if p
+     was already in the table with index
+     \throw std::overflow_error : if the number of pairs exceeds the range of
+     index_t
+     */
+    std::tuple<bool, tchecker::tree_table_t::index_t> find_else_add(uint64_t p);
+
+    /*!
+     \brief Accessor
+     \param index : index of a pair
+     \pre index has been returned by find_else_add
+     \return pair with index, encoded as a 64-bit value
+     */
+    inline uint64_t pair(tchecker::tree_table_t::index_t index) const { return _pairs[index]; }
+
+    /*!
+     \brief Accessor
+     \return number of pairs in this table
+     */
+    inline std::size_t size() const { return _pairs.size(); }
+
+    /*!
+     \brief Accessor
+     \return memory used by this table (in bytes)
+     */
+    std::size_t memsize() const;
+
+    /*!
+     \brief Clear
+     \post this table is empty
+     */
+    void clear();
+
+  private:
+    /*!
+     \brief Double the number of slots
+     \post all pairs have been re-indexed in the new slots
+     */
+    void grow();
+
+    std::vector<uint64_t> _pairs;                        /*!< Pairs, in order of insertion */
+    std::vector<tchecker::tree_table_t::index_t> _slots; /*!< Open-addressing index of pairs */
+  };
+
+  /*!
+   \class node_t
+   \brief Internal node of the tree: covers positions [lo, hi) in vectors, with
+   left sub-tree on [lo, mid) and right sub-tree on [mid, hi)
+   \note a sub-tree of size 0 is encoded by value 0, a sub-tree of size 1 by its
+   value, and larger sub-trees by the index of their root pair
+   */
+  struct node_t {
+    std::size_t lo;    /*!< First position */
+    std::size_t mid;   /*!< Split position */
+    std::size_t hi;    /*!< Past-the-end position */
+    std::size_t left;  /*!< Index of left internal node (meaningful if mid - lo > 1) */
+    std::size_t right; /*!< Index of right internal node (meaningful if hi - mid > 1) */
+  };
+
+  /*!
+   \brief Build internal nodes
+   \param lo : first position
+   \param hi : past-the-end position
+   \return index of the internal node that covers [lo, hi)
+   \post internal nodes for [lo, hi) have been added
+   */
+  std::size_t build(std::size_t lo, std::size_t hi);
+
+  /*!
+   \brief Insert a sub-vector
+   \param node : internal node
+   \param v : a vector
+   \return (true, index) if the sub-vector of v covered by node has been added
+   with index, (false, index) otherwise
+   */
+  std::tuple<bool, tchecker::tree_table_t::index_t> insert(std::size_t node, tchecker::tree_table_t::value_t const * v);
+
+  /*!
+   \brief Decompress a sub-vector
+   \param node : internal node
+   \param index : index of a pair in the table of node
+   \param v : a vector
+   \post the positions of v covered by node have been set from index
+   */
+  void get(std::size_t node, tchecker::tree_table_t::index_t index, tchecker::tree_table_t::value_t * v) const;
+
+  std::size_t _width;                                        /*!< Width of vectors */
+  std::vector<node_t> _nodes;                                /*!< Internal nodes (root is first) */
+  std::vector<tchecker::tree_table_t::pair_table_t> _tables; /*!< Table of pairs of each internal node */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_TREE_TABLE_HH
@@ -10,6 +10,8 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "tchecker/basictypes.hh"
 #include "tchecker/utils/allocation_size.hh"
@@ -174,6 +176,31 @@ using flat_integer_variables_valuations_value_t =
 tchecker::flat_integer_variables_valuations_range_t
 flat_integer_variables_valuations_range(tchecker::flat_integer_variables_t const & intvars);
 
+/*!
+ \brief Type of closed intervals of integers [first, second]
+ \note an interval is empty if first > second
+ */
+using integer_interval_t = std::pair<tchecker::integer_t, tchecker::integer_t>;
+
+/*!
+ \brief Type of intervals of values of flat integer variables, indexed by variable identifiers
+ */
+using intvars_intervals_t = std::vector<tchecker::integer_interval_t>;
+
+/*!
+ \brief Return the range of valuations of flat integer variables within intervals
+ \param intvars : flat bounded integer variables
+ \param intervals : intervals of values of intvars
+ \pre intervals has size intvars.size(), and no interval in intervals is empty
+ \return the range of valuations of intvars where each variable ranges over its interval in intervals
+ \throw std::invalid_argument : if intervals does not have size intvars.size(), or if an interval is empty
+ \throw std::overflow_error : if the upper bound of an interval plus 1 cannot be represented as an tchecker::integer_t
+ \note the size of the range is the product of the sizes of the intervals
+ */
+tchecker::flat_integer_variables_valuations_range_t
+flat_integer_variables_valuations_range(tchecker::flat_integer_variables_t const & intvars,
+                                        tchecker::intvars_intervals_t const & intervals);
+
 // Integer variables valuation
 
 /*!
@@ -361,13 +388,18 @@ int lexical_cmp(tchecker::intval_t const & intval1, tchecker::intval_t const & i
 /*!
  \brief Type of shared integer variables valuation
  */
-using shared_intval_t = tchecker::make_shared_t<tchecker::intval_t>;
+using shared_intval_t = tchecker::make_shared_t<tchecker::intval_t, tchecker::compact_refcount_t>;
 
 /*!
  \brief Type of shared pointer to integer variables valuation
 */
 using intval_sptr_t = tchecker::intrusive_shared_ptr_t<tchecker::shared_intval_t>;
 
+/*!
+ \brief Type of shared pointer to const integer variables valuation
+*/
+using const_intval_sptr_t = tchecker::intrusive_shared_ptr_t<tchecker::shared_intval_t const>;
+
 } // end of namespace tchecker
 
 #endif // TCHECKER_INTVARS_HH
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "tchecker/basictypes.hh"
+#include "tchecker/utils/counters.hh"
 #include "tchecker/variables/clocks.hh"
 #include "tchecker/variables/intvars.hh"
 
@@ -194,6 +195,7 @@ public:
     _return = false;
 
     do {
+      tchecker::counters::increment(tchecker::counters::VM_INSTRUCTIONS);
       try {
         eval = interpret_instruction(bytecode, intval, clkconstr, clkreset);
       }
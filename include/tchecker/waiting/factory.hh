@@ -10,6 +10,7 @@
 
 #include <stdexcept>
 #include <functional>
+#include <vector>
 
 #include "tchecker/waiting/pqueue.hh"
 #include "tchecker/waiting/queue.hh"
@@ -70,6 +71,57 @@ template <class T, class Compare> tchecker::waiting::waiting_t<T> * factory(enum
   }
 }
 
+/*!
+ \brief Fill a waiting container
+ \tparam T : type of waiting elements
+ \tparam ITERATOR : type of iterator over elements, should be bidirectional
+ \param waiting : a waiting container
+ \param policy : waiting policy implemented by waiting
+ \param begin : iterator to first element
+ \param end : past-the-end iterator
+ \pre waiting is empty, and policy is the waiting policy of waiting
+ \post the elements in range [begin, end) have been inserted in waiting, in
+ such a way that waiting yields them in the same order as the range (except
+ for priority queues, where the order is determined by priorities)
+ */
+template <class T, class ITERATOR>
+void fill(tchecker::waiting::waiting_t<T> & waiting, enum policy_t policy, ITERATOR begin, ITERATOR end)
+{
+  if (policy == tchecker::waiting::STACK || policy == tchecker::waiting::FAST_REMOVE_STACK) {
+    while (end != begin) {
+      --end;
+      waiting.insert(*end);
+    }
+  }
+  else {
+    for (; begin != end; ++begin)
+      waiting.insert(*begin);
+  }
+}
+
+/*!
+ \brief Accessor to the elements of a waiting container
+ \tparam T : type of waiting elements
+ \param waiting : a waiting container
+ \param policy : waiting policy implemented by waiting
+ \param v : a vector of elements
+ \pre policy is the waiting policy of waiting
+ \post all the elements in waiting have been appended to v, in the order in
+ which waiting yields them. waiting contains the same elements as before, in
+ the same order
+ \note complexity is linear in the size of waiting (elements are removed from
+ waiting and inserted back)
+ */
+template <class T> void elements(tchecker::waiting::waiting_t<T> & waiting, enum policy_t policy, std::vector<T> & v)
+{
+  std::size_t const start = v.size();
+  while (!waiting.empty()) {
+    v.push_back(waiting.first());
+    waiting.remove_first();
+  }
+  tchecker::waiting::fill(waiting, policy, v.begin() + start, v.end());
+}
+
 } // end of namespace waiting
 
 } // end of namespace tchecker
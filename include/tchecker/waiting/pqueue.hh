@@ -39,6 +39,12 @@ public:
    */
   virtual inline bool empty() { return _s.empty(); }
 
+  /*!
+   \brief Accessor
+   \return number of elements in the container
+   */
+  virtual inline std::size_t size() { return _s.size(); }
+
   /*!
    \brief Clear the container
    \post this container is empty
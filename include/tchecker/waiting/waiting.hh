@@ -9,6 +9,7 @@
 #define TCHECKER_WAITING_HH
 
 #include <cassert>
+#include <cstddef>
 
 /*!
  \file waiting.hh
@@ -45,6 +46,13 @@ public:
    */
   virtual bool empty() = 0;
 
+  /*!
+   \brief Accessor
+   \return number of elements stored in the container
+   \note elements that have been removed (see remove) may still be counted
+   */
+  virtual std::size_t size() = 0;
+
   /*!
    \brief Clear the container
    \post this container is empty
@@ -166,6 +174,13 @@ public:
     return _w.empty();
   }
 
+  /*!
+   \brief Accessor
+   \return number of elements stored in the container, including elements that
+   are not waiting anymore but have not been removed yet
+   */
+  virtual std::size_t size() { return _w.size(); }
+
   /*!
    \brief Clear the container
    \post this container is empty
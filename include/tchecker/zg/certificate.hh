@@ -0,0 +1,443 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_CERTIFICATE_HH
+#define TCHECKER_ZG_CERTIFICATE_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/dbm/db.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/zg/state.hh"
+
+/*!
+ \file certificate.hh
+ \brief Binary certificates: graphs over the zone graph in a compact binary
+ format
+
+ A binary certificate consists of a header, a table of node records and a
+ table of edge records. The header contains the name of the system, the names
+ of processes, events, labels, locations (with their process and their
+ labels), the process and the event of each edge, the names of the flattened
+ integer variables and clocks, and the table of the tuples of edges that
+ appear in the graph. Node records have a fixed size: flags, tuple of location
+ identifiers, integer valuation and DBM. Edge records consist of the source
+ node, the target node, the identifier of the tuple of edges, and the type of
+ edge. Numbers are stored in the native byte order and all records are aligned,
+ hence certificates can be read through a memory mapping (see reader_t), but
+ they are not portable across architectures.
+ */
+
+namespace tchecker {
+
+namespace zg {
+
+namespace certificate {
+
+/*!
+ \brief Kind of graph in a certificate
+ */
+enum graph_kind_t : uint32_t {
+  KIND_REACHABILITY = 0, /*!< Reachability graph (edges have no type) */
+  KIND_SUBSUMPTION = 1,  /*!< Subsumption graph (actual and subsumption edges) */
+};
+
+/*!
+ \brief Flags of node records
+ */
+enum node_flags_t : uint32_t {
+  NODE_INITIAL = 1, /*!< Initial node */
+  NODE_FINAL = 2,   /*!< Final node */
+};
+
+/*!
+ \brief Edge record
+ */
+struct edge_record_t {
+  uint64_t src;       /*!< Index of source node */
+  uint64_t tgt;       /*!< Index of target node */
+  uint32_t vedge;     /*!< Index of tuple of edges */
+  uint32_t edge_type; /*!< Type of edge (see tchecker::graph::subsumption::edge_type_t) */
+};
+
+/*!
+ \brief Location in the symbol tables of a certificate
+ */
+struct location_t {
+  tchecker::process_id_t pid;               /*!< Process identifier */
+  std::string name;                         /*!< Name */
+  std::vector<tchecker::label_id_t> labels; /*!< Labels */
+};
+
+/*!
+ \brief Edge in the symbol tables of a certificate
+ */
+struct edge_t {
+  tchecker::process_id_t pid;    /*!< Process identifier */
+  tchecker::event_id_t event_id; /*!< Event identifier */
+};
+
+/*!
+ \brief Symbol tables of a certificate
+ \note identifiers are indices in the tables
+ */
+struct symbols_t {
+  std::string name;                                             /*!< Name of the system */
+  std::vector<std::string> processes;                           /*!< Names of processes */
+  std::vector<std::string> events;                              /*!< Names of events */
+  std::vector<std::string> labels;                              /*!< Names of labels */
+  std::vector<tchecker::zg::certificate::location_t> locations; /*!< Locations */
+  std::vector<tchecker::zg::certificate::edge_t> edges;         /*!< Edges */
+  std::vector<std::string> intvars;                             /*!< Names of flattened integer variables */
+  std::vector<std::string> clocks;                              /*!< Names of flattened clocks (without the zero clock) */
+  std::vector<std::vector<tchecker::edge_id_t>> vedges;         /*!< Tuples of edges */
+};
+
+/*!
+ \brief Node of a certificate
+ \note pointers refer to the memory of the certificate
+ */
+struct node_t {
+  uint32_t flags;                     /*!< Flags (see node_flags_t) */
+  tchecker::loc_id_t const * vloc;    /*!< Tuple of locations (one per process) */
+  tchecker::integer_t const * intval; /*!< Integer valuation (one per flattened integer variable) */
+  tchecker::dbm::db_t const * dbm;    /*!< DBM (dim*dim difference bounds) */
+};
+
+/*!
+ \class writer_t
+ \brief Writer of binary certificates
+ \note nodes and edges should be written in order, after construction
+ */
+class writer_t {
+public:
+  /*!
+   \brief Constructor
+   \param os : output stream
+   \param system : a system of timed processes
+   \param name : name of the graph
+   \param kind : kind of graph
+   \param nodes_count : number of nodes
+   \param edges_count : number of edges
+   \param vedges : tuples of edges in the graph
+   \post the header of the certificate has been written to os
+   \throw std::runtime_error : if writing failed
+   */
+  writer_t(std::ostream & os, tchecker::ta::system_t const & system, std::string const & name,
+           enum tchecker::zg::certificate::graph_kind_t kind, uint64_t nodes_count, uint64_t edges_count,
+           std::vector<std::vector<tchecker::edge_id_t>> const & vedges);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  writer_t(tchecker::zg::certificate::writer_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  writer_t(tchecker::zg::certificate::writer_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  ~writer_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::zg::certificate::writer_t & operator=(tchecker::zg::certificate::writer_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::zg::certificate::writer_t & operator=(tchecker::zg::certificate::writer_t &&) = delete;
+
+  /*!
+   \brief Write a node
+   \param s : a state
+   \param initial : initial flag
+   \param final : final flag
+   \post the record of a node with state s and flags initial and final has been
+   written
+   \throw std::runtime_error : if the number of nodes exceeds the number given at
+   construction, if s does not match the system, or if writing failed
+   */
+  void write_node(tchecker::zg::state_t const & s, bool initial, bool final);
+
+  /*!
+   \brief Write an edge
+   \param src : index of source node
+   \param tgt : index of target node
+   \param vedge : index of tuple of edges
+   \param edge_type : type of edge
+   \pre all nodes have been written
+   \post the record of the edge has been written
+   \throw std::runtime_error : if the nodes have not all been written, if the
+   number of edges exceeds the number given at construction, or if writing
+   failed
+   */
+  void write_edge(uint64_t src, uint64_t tgt, uint32_t vedge, uint32_t edge_type);
+
+  /*!
+   \brief Close the certificate
+   \post the end marker has been written and the output stream has been flushed
+   \throw std::runtime_error : if some nodes or edges have not been written, or
+   if writing failed
+   */
+  void close();
+
+private:
+  /*!
+   \brief Write raw bytes
+   \param p : pointer to bytes
+   \param size : number of bytes
+   \post size bytes from p have been written
+   \throw std::runtime_error : if writing failed
+   */
+  void write_raw(void const * p, std::size_t size);
+
+  /*!
+   \brief Write an unsigned integer
+   \param n : an unsigned integer
+   \post n has been written as a 64-bits unsigned integer
+   */
+  void write(uint64_t n);
+
+  /*!
+   \brief Write a string
+   \param s : a string
+   \post the length of s and the characters of s, padded to a multiple of 8
+   bytes, have been written
+   */
+  void write(std::string const & s);
+
+  std::ostream & _os;        /*!< Output stream */
+  std::size_t _processes;    /*!< Number of processes */
+  std::size_t _intvars;      /*!< Number of flattened integer variables */
+  tchecker::clock_id_t _dim; /*!< Dimension of zones */
+  uint64_t _nodes_count;     /*!< Number of nodes */
+  uint64_t _edges_count;     /*!< Number of edges */
+  uint64_t _written_nodes;   /*!< Number of written nodes */
+  uint64_t _written_edges;   /*!< Number of written edges */
+  std::vector<char> _record; /*!< Buffer for node records */
+};
+
+namespace details {
+
+/*!
+ \brief Detects subsumption graphs (i.e. graphs with a method edge_type)
+ */
+template <class GRAPH, class = void> struct is_subsumption_graph : std::false_type {
+};
+
+/*!
+ \brief Detects subsumption graphs (i.e. graphs with a method edge_type)
+ */
+template <class GRAPH>
+struct is_subsumption_graph<GRAPH, std::void_t<decltype(std::declval<GRAPH const &>().edge_type(
+                                       std::declval<typename GRAPH::edge_sptr_t const &>()))>> : std::true_type {
+};
+
+} // end of namespace details
+
+/*!
+ \brief Write a graph as a binary certificate
+ \tparam GRAPH : type of graph, nodes should have methods state() that yields
+ a tchecker::zg::state_t, initial() and final(), and edges should have a method
+ vedge() that yields a tchecker::vedge_t
+ \param os : output stream
+ \param g : a graph
+ \param system : system of timed processes of g
+ \param name : name of the graph
+ \post g has been written to os as a binary certificate. Nodes are written in
+ the order of g.nodes(), and edges in the order of their source node. The only
+ extra memory is an index of the nodes and the table of tuples of edges
+ \throw std::runtime_error : if writing failed
+ */
+template <class GRAPH>
+void write(std::ostream & os, GRAPH const & g, tchecker::ta::system_t const & system, std::string const & name)
+{
+  constexpr bool subsumption = tchecker::zg::certificate::details::is_subsumption_graph<GRAPH>::value;
+
+  // tuples of edges and number of edges
+  std::map<std::vector<tchecker::edge_id_t>, uint32_t> vedges_index;
+  std::vector<std::vector<tchecker::edge_id_t>> vedges;
+  std::vector<tchecker::edge_id_t> v;
+  uint64_t edges_count = 0;
+  for (typename GRAPH::node_sptr_t const & n : g.nodes()) {
+    for (typename GRAPH::edge_sptr_t const & e : g.outgoing_edges(n)) {
+      ++edges_count;
+      v.assign(e->vedge().begin(), e->vedge().end());
+      if (vedges_index.emplace(v, static_cast<uint32_t>(vedges.size())).second)
+        vedges.push_back(v);
+    }
+  }
+
+  enum tchecker::zg::certificate::graph_kind_t const kind =
+      (subsumption ? tchecker::zg::certificate::KIND_SUBSUMPTION : tchecker::zg::certificate::KIND_REACHABILITY);
+  tchecker::zg::certificate::writer_t writer{os, system, name, kind, g.nodes_count(), edges_count, vedges};
+
+  // nodes
+  std::unordered_map<void const *, uint64_t> index;
+  index.reserve(g.nodes_count());
+  for (typename GRAPH::node_sptr_t const & n : g.nodes()) {
+    index.emplace(&*n, index.size());
+    writer.write_node(n->state(), n->initial(), n->final());
+  }
+
+  // edges, in the order of their source node
+  for (typename GRAPH::node_sptr_t const & n : g.nodes()) {
+    uint64_t const src = index.at(&*n);
+    for (typename GRAPH::edge_sptr_t const & e : g.outgoing_edges(n)) {
+      v.assign(e->vedge().begin(), e->vedge().end());
+      uint32_t edge_type = 0;
+      if constexpr (subsumption)
+        edge_type = static_cast<uint32_t>(g.edge_type(e));
+      writer.write_edge(src, index.at(&*g.edge_tgt(e)), vedges_index.at(v), edge_type);
+    }
+  }
+
+  writer.close();
+}
+
+/*!
+ \class reader_t
+ \brief Reader of binary certificates
+ \note the certificate is mapped in memory: nodes and edges are accessed
+ without reading the whole file
+ */
+class reader_t {
+public:
+  /*!
+   \brief Constructor
+   \param filename : name of certificate file
+   \post the certificate has been mapped in memory, and its header has been read
+   \throw std::runtime_error : if filename cannot be mapped, or if it is not a
+   valid certificate for the sizes of integers and difference bounds of this
+   build
+   */
+  explicit reader_t(std::string const & filename);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  reader_t(tchecker::zg::certificate::reader_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  reader_t(tchecker::zg::certificate::reader_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post the certificate has been unmapped
+   */
+  ~reader_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::zg::certificate::reader_t & operator=(tchecker::zg::certificate::reader_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::zg::certificate::reader_t & operator=(tchecker::zg::certificate::reader_t &&) = delete;
+
+  /*!
+   \brief Accessor
+   \return symbol tables
+   */
+  inline tchecker::zg::certificate::symbols_t const & symbols() const { return _symbols; }
+
+  /*!
+   \brief Accessor
+   \return kind of graph
+   */
+  inline enum tchecker::zg::certificate::graph_kind_t kind() const { return _kind; }
+
+  /*!
+   \brief Accessor
+   \return dimension of zones
+   */
+  inline tchecker::clock_id_t dim() const { return _dim; }
+
+  /*!
+   \brief Accessor
+   \return number of nodes
+   */
+  inline std::size_t nodes_count() const { return _nodes_count; }
+
+  /*!
+   \brief Accessor
+   \return number of edges
+   */
+  inline std::size_t edges_count() const { return _edges_count; }
+
+  /*!
+   \brief Accessor
+   \param i : index of node
+   \pre i < nodes_count() (checked by assertion)
+   \return i-th node
+   */
+  tchecker::zg::certificate::node_t node(std::size_t i) const;
+
+  /*!
+   \brief Accessor
+   \param i : index of edge
+   \pre i < edges_count() (checked by assertion)
+   \return i-th edge
+   \note edges are sorted w.r.t. their source node
+   */
+  tchecker::zg::certificate::edge_record_t const & edge(std::size_t i) const;
+
+private:
+  std::string _filename;                                   /*!< Name of certificate file */
+  char const * _data;                                      /*!< Mapped certificate */
+  std::size_t _size;                                       /*!< Size of mapped certificate */
+  tchecker::zg::certificate::symbols_t _symbols;           /*!< Symbol tables */
+  enum tchecker::zg::certificate::graph_kind_t _kind;      /*!< Kind of graph */
+  tchecker::clock_id_t _dim;                               /*!< Dimension of zones */
+  std::size_t _nodes_count;                                /*!< Number of nodes */
+  std::size_t _edges_count;                                /*!< Number of edges */
+  std::size_t _vloc_offset;                                /*!< Offset of tuple of locations in node records */
+  std::size_t _intval_offset;                              /*!< Offset of integer valuation in node records */
+  std::size_t _dbm_offset;                                 /*!< Offset of DBM in node records */
+  std::size_t _record_size;                                /*!< Size of node records */
+  char const * _nodes;                                     /*!< Node records */
+  tchecker::zg::certificate::edge_record_t const * _edges; /*!< Edge records */
+};
+
+/*!
+ \brief Output a certificate in graphviz DOT language
+ \param os : output stream
+ \param reader : a certificate
+ \post the graph in reader has been output to os in the graphviz DOT language,
+ with the same attributes as the graph output by tck-reach. Nodes and edges are
+ output in the order of the certificate (see tchecker::graph::dot_output_stream)
+ \return os after output
+ \throw std::runtime_error : if an identifier in the certificate is out of the
+ symbol tables
+ */
+std::ostream & dot_output(std::ostream & os, tchecker::zg::certificate::reader_t const & reader);
+
+} // end of namespace certificate
+
+} // end of namespace zg
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_CERTIFICATE_HH
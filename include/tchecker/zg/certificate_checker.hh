@@ -0,0 +1,201 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_CERTIFICATE_CHECKER_HH
+#define TCHECKER_ZG_CERTIFICATE_CHECKER_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/stats.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/zg/certificate.hh"
+
+/*!
+ \file certificate_checker.hh
+ \brief Independent checking of binary certificates of unreachability
+
+ A certificate of unreachability is a set of nodes over the zone graph that is
+ an inductive invariant: every initial state of the zone graph is covered by a
+ node, every successor of every node is covered by a node, and no node
+ satisfies the searched labels. The edges in the certificate are not used. The
+ nodes are checked independently of each other, hence checking is distributed
+ over several threads, each with its own zone graph.
+ */
+
+namespace tchecker {
+
+namespace zg {
+
+namespace certificate {
+
+/*!
+ \brief Covering relations
+ */
+enum covering_t {
+  COVERING_INCLUSION, /*!< Zone inclusion (for reach and covreach certificates) */
+  COVERING_ALU,       /*!< aLU subsumption (for aLU-covreach certificates) */
+};
+
+/*!
+ \brief Types of violations
+ */
+enum violation_type_t {
+  VIOLATION_INVALID_NODE,        /*!< Node that is not a state of the zone graph */
+  VIOLATION_FINAL_NODE,          /*!< Node that satisfies the searched labels */
+  VIOLATION_UNCOVERED_INITIAL,   /*!< Initial state not covered by any node */
+  VIOLATION_UNCOVERED_SUCCESSOR, /*!< Successor of a node not covered by any node */
+};
+
+/*!
+ \brief Violation of the inductive invariant
+ */
+struct violation_t {
+  enum tchecker::zg::certificate::violation_type_t type; /*!< Type of violation */
+  uint64_t node;                                         /*!< Node (or initial state) index */
+  std::string state;                                     /*!< Offending state (empty if invalid node) */
+  std::string vedge;                                     /*!< Tuple of edges to offending successor */
+};
+
+/*!
+ \brief Output a violation
+ \param os : output stream
+ \param violation : a violation
+ \post violation has been output to os
+ \return os after output
+ */
+std::ostream & operator<<(std::ostream & os, tchecker::zg::certificate::violation_t const & violation);
+
+/*!
+ \class check_stats_t
+ \brief Statistics of certificate checking
+ */
+class check_stats_t : public tchecker::algorithms::stats_t {
+public:
+  /*!
+   \brief Constructor
+   */
+  check_stats_t();
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of checked nodes
+   */
+  unsigned long & checked_nodes();
+
+  /*!
+   \brief Accessor
+   \return the number of checked nodes
+   */
+  unsigned long checked_nodes() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of initial states
+   */
+  unsigned long & initial_states();
+
+  /*!
+   \brief Accessor
+   \return the number of initial states
+   */
+  unsigned long initial_states() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of computed successors
+   */
+  unsigned long & successors();
+
+  /*!
+   \brief Accessor
+   \return the number of computed successors
+   */
+  unsigned long successors() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of violations
+   */
+  unsigned long & violations();
+
+  /*!
+   \brief Accessor
+   \return the number of violations
+   */
+  unsigned long violations() const;
+
+  /*!
+   \brief Accessor
+   \return true if the certificate is valid (i.e. there is no violation), false
+   otherwise
+   */
+  inline bool valid() const { return _violations == 0; }
+
+  /*!
+   \brief Extract statistics as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m
+   */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  unsigned long _checked_nodes;  /*!< Number of checked nodes */
+  unsigned long _initial_states; /*!< Number of initial states */
+  unsigned long _successors;     /*!< Number of computed successors */
+  unsigned long _violations;     /*!< Number of violations */
+};
+
+/*!
+ \brief Check that a certificate has been computed from a system
+ \param reader : a certificate
+ \param system : a system of timed processes
+ \throw std::runtime_error : if the processes, events, labels, locations,
+ edges, integer variables or clocks in reader do not match system
+ */
+void check_symbols(tchecker::zg::certificate::reader_t const & reader, tchecker::ta::system_t const & system);
+
+/*!
+ \brief Check a certificate of unreachability
+ \param reader : a certificate
+ \param system : system of timed processes of the certificate
+ \param labels : searched labels
+ \param covering : covering relation
+ \param threads : number of threads
+ \param max_violations : maximal number of reported violations
+ \param block_size : number of objects allocated in a block by each zone graph
+ \param table_size : size of hash tables
+ \param violations : container of violations
+ \pre check_symbols(reader, *system) does not throw, threads > 0
+ \post the nodes in reader have been checked against the zone graph of system
+ with elapsed semantics and local LU+ extrapolation (as used by tck-reach), by
+ threads threads. The first max_violations violations, ordered w.r.t. their
+ type and their node, have been added to violations
+ \return statistics on the check, with the total number of violations
+ \throw std::runtime_error : if clock bounds cannot be computed for system
+ */
+tchecker::zg::certificate::check_stats_t check(tchecker::zg::certificate::reader_t const & reader,
+                                               std::shared_ptr<tchecker::ta::system_t const> const & system,
+                                               boost::dynamic_bitset<> const & labels,
+                                               enum tchecker::zg::certificate::covering_t covering, std::size_t threads,
+                                               std::size_t max_violations, std::size_t block_size, std::size_t table_size,
+                                               std::vector<tchecker::zg::certificate::violation_t> & violations);
+
+} // end of namespace certificate
+
+} // end of namespace zg
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_CERTIFICATE_CHECKER_HH
@@ -9,6 +9,9 @@
 #define TCHECKER_ZG_EXTRAPOLATION_HH
 
 #include <memory>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
 
 #include "tchecker/basictypes.hh"
 #include "tchecker/clockbounds/clockbounds.hh"
@@ -445,6 +448,70 @@ public:
   virtual void extrapolate(tchecker::dbm::db_t * dbm, tchecker::clock_id_t dim, tchecker::vloc_t const & vloc);
 };
 
+/*!
+ \class active_clocks_extrapolation_t
+ \brief Zone extrapolation that frees the clocks that are not active in a tuple of
+ locations, then applies another zone extrapolation
+ \note clocks that are not active in a tuple of locations are reset before they
+ are read (see tchecker::ta::active_clocks). Freeing them preserves the future
+ behaviours from a zone, and makes zones that only differ on inactive clocks
+ equal
+ */
+class active_clocks_extrapolation_t final : public tchecker::zg::extrapolation_t {
+public:
+  /*!
+   \brief Constructor
+   \param active_clocks : map from location IDs to sets of active clocks
+   \param extrapolation : zone extrapolation
+   \pre active_clocks has been computed by tchecker::ta::active_clocks
+   \note this keeps a pointer on extrapolation
+   */
+  active_clocks_extrapolation_t(std::vector<boost::dynamic_bitset<>> const & active_clocks,
+                                std::shared_ptr<tchecker::zg::extrapolation_t> const & extrapolation);
+
+  /*!
+  \brief Copy constructor
+  */
+  active_clocks_extrapolation_t(tchecker::zg::active_clocks_extrapolation_t const & e) = default;
+
+  /*!
+  \brief Move constructor
+  */
+  active_clocks_extrapolation_t(tchecker::zg::active_clocks_extrapolation_t && e) = default;
+
+  /*!
+  \brief Destructor
+  */
+  virtual ~active_clocks_extrapolation_t() = default;
+
+  /*!
+  \brief Assignment operator
+  */
+  tchecker::zg::active_clocks_extrapolation_t & operator=(tchecker::zg::active_clocks_extrapolation_t const & e) = default;
+
+  /*!
+  \brief Move-assignment operator
+  */
+  tchecker::zg::active_clocks_extrapolation_t & operator=(tchecker::zg::active_clocks_extrapolation_t && e) = default;
+
+  /*!
+  \brief Zone extrapolation
+  \param dbm : a dbm
+  \param dim : dimension of dbm
+  \param vloc : a tuple of locations
+  \pre dbm is tight and not empty. dim is 1 plus the number of clocks in the map
+  of active clocks (checked by assertion)
+  \post the clocks that are not active in any location in vloc have been freed in
+  dbm, then the extrapolation has been applied to dbm
+ */
+  virtual void extrapolate(tchecker::dbm::db_t * dbm, tchecker::clock_id_t dim, tchecker::vloc_t const & vloc);
+
+private:
+  std::vector<boost::dynamic_bitset<>> _active_clocks;           /*!< Map : location ID -> active clocks */
+  boost::dynamic_bitset<> _vloc_active_clocks;                   /*!< Active clocks in a tuple of locations */
+  std::shared_ptr<tchecker::zg::extrapolation_t> _extrapolation; /*!< Zone extrapolation */
+};
+
 /*!
  \brief Type of extrapolation
 */
@@ -460,6 +527,14 @@ enum extrapolation_type_t {
   EXTRA_M_PLUS_LOCAL,   /*!< see tchecker::zg::local_extra_m_plus_t */
 };
 
+/*!
+ \brief Type of clock reduction
+*/
+enum clock_reduction_type_t {
+  NO_CLOCK_REDUCTION,      /*!< No clock reduction */
+  ACTIVE_CLOCKS_REDUCTION, /*!< see tchecker::zg::active_clocks_extrapolation_t */
+};
+
 /*!
  \brief Zone extrapolation factory
  \param extrapolation_type : type of extrapolation
@@ -486,6 +561,25 @@ tchecker::zg::extrapolation_t * extrapolation_factory(enum extrapolation_type_t
 tchecker::zg::extrapolation_t * extrapolation_factory(enum extrapolation_type_t extrapolation_type,
                                                       tchecker::clockbounds::clockbounds_t const & clock_bounds);
 
+/*!
+ \brief Zone extrapolation factory with clock reduction
+ \param extrapolation_type : type of extrapolation
+ \param clock_reduction_type : type of clock reduction
+ \param system : system of timed processes
+ \return a zone extrapolation of type extrapolation_type using clock bounds
+ inferred from system, that first frees inactive clocks if clock_reduction_type
+ is tchecker::zg::ACTIVE_CLOCKS_REDUCTION, nullptr if clock bounds cannot be
+ inferred from system
+ \note the returned extrapolation must be deallocated by the caller
+ \throw std::invalid_argument : if extrapolation_type or clock_reduction_type is
+ unknown
+ \throw std::runtime_error : if clock bounds or active clocks cannot be computed
+ for system
+ */
+tchecker::zg::extrapolation_t * extrapolation_factory(enum extrapolation_type_t extrapolation_type,
+                                                      enum clock_reduction_type_t clock_reduction_type,
+                                                      tchecker::ta::system_t const & system);
+
 } // end of namespace zg
 
 } // end of namespace tchecker
@@ -0,0 +1,118 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_REDUCED_ZONE_HH
+#define TCHECKER_ZG_REDUCED_ZONE_HH
+
+#include <cstddef>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/dbm/db.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/zg/zone.hh"
+
+/*!
+ \file reduced_zone.hh
+ \brief Zones stored as a minimal set of constraints
+ */
+
+namespace tchecker {
+
+namespace zg {
+
+/*!
+ \class reduced_zone_t
+ \brief Zone stored as a minimal set of difference constraints (see
+ tchecker::dbm::reduce)
+ \note a reduced zone has O(dim) constraints in most cases, instead of the
+ dim*dim difference bounds of a tchecker::zg::zone_t. It is meant to store zones
+ that are mostly used for inclusion checks (see tchecker::zg::is_le), and that
+ are expanded when they are needed as DBMs
+ */
+class reduced_zone_t {
+public:
+  /*!
+   \brief Constructor
+   \param zone : a zone
+   \pre zone is not empty (checked by assertion)
+   \post this reduced zone represents the same set of valuations as zone
+   */
+  explicit reduced_zone_t(tchecker::zg::zone_t const & zone);
+
+  /*!
+   \brief Copy constructor
+   */
+  reduced_zone_t(tchecker::zg::reduced_zone_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  reduced_zone_t(tchecker::zg::reduced_zone_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~reduced_zone_t() = default;
+
+  /*!
+   \brief Assignment operator
+   */
+  tchecker::zg::reduced_zone_t & operator=(tchecker::zg::reduced_zone_t const &) = default;
+
+  /*!
+   \brief Move-assignment operator
+   */
+  tchecker::zg::reduced_zone_t & operator=(tchecker::zg::reduced_zone_t &&) = default;
+
+  /*!
+   \brief Accessor
+   \return dimension of the DBM represented by this reduced zone
+   */
+  inline tchecker::clock_id_t dim() const { return _dim; }
+
+  /*!
+   \brief Accessor
+   \return constraints of this reduced zone
+   */
+  inline std::vector<tchecker::dbm::db_constraint_t> const & constraints() const { return _constraints; }
+
+  /*!
+   \brief Expansion to a DBM
+   \param dbm : a DBM
+   \pre dbm is a dim()*dim() array of difference bounds
+   \post dbm is the tight DBM represented by this reduced zone
+   */
+  void expand(tchecker::dbm::db_t * dbm) const;
+
+  /*!
+   \brief Accessor
+   \return number of bytes used by this reduced zone, including its constraints
+   */
+  std::size_t memsize() const;
+
+private:
+  tchecker::clock_id_t _dim;                                /*!< Dimension of the DBM */
+  std::vector<tchecker::dbm::db_constraint_t> _constraints; /*!< Non-redundant constraints */
+};
+
+/*!
+ \brief Inclusion check
+ \param zone : a zone
+ \param reduced_zone : a reduced zone
+ \pre zone and reduced_zone have the same dimension (checked by assertion)
+ \return true if zone is included in reduced_zone, false otherwise
+ \note this takes time linear in the number of constraints of reduced_zone (see
+ tchecker::dbm::is_le)
+ */
+bool is_le(tchecker::zg::zone_t const & zone, tchecker::zg::reduced_zone_t const & reduced_zone);
+
+} // end of namespace zg
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_REDUCED_ZONE_HH
@@ -31,7 +31,7 @@ namespace zg {
 /*!
 \brief Type of shared zone, DBM implementation
 */
-using shared_zone_t = tchecker::make_shared_t<tchecker::zg::zone_t>;
+using shared_zone_t = tchecker::make_shared_t<tchecker::zg::zone_t, tchecker::compact_refcount_t>;
 
 /*!
 \brief Type of shared pointer to zone, DBM implementation
@@ -343,9 +343,7 @@ inline tchecker::state_status_t next(tchecker::ta::system_t const & system, tche
 
 /*!
  \brief Type of iterator over incoming edges
- \note this iterator ranges over the set of tuple of process locations and bounded integer
- variables valuations in the given system, the size of which is exponential in the number
- of locations and processes, as well as in the domains of bounded integer variables
+ \note see tchecker::ta::incoming_edges_iterator_t
  */
 using incoming_edges_iterator_t = tchecker::ta::incoming_edges_iterator_t;
 
@@ -358,12 +356,15 @@ using incoming_edges_range_t = tchecker::ta::incoming_edges_range_t;
  \brief Accessor to incoming edges
  \param system : a system
  \param vloc : tuple of locations
- \return range of incoming synchronized and asynchronous edges to vloc in system
+ \param intval : valuation of bounded integer variables
+ \return range of incoming synchronized and asynchronous edges to vloc in system, along
+ with candidate source valuations of bounded integer variables w.r.t. intval
  */
 inline tchecker::zg::incoming_edges_range_t incoming_edges(tchecker::ta::system_t const & system,
-                                                           tchecker::const_vloc_sptr_t const & vloc)
+                                                           tchecker::const_vloc_sptr_t const & vloc,
+                                                           tchecker::const_intval_sptr_t const & intval)
 {
-  return tchecker::ta::incoming_edges(system, vloc);
+  return tchecker::ta::incoming_edges(system, vloc, intval);
 }
 
 /*!
@@ -794,9 +795,10 @@ public:
    \brief Accessor
    \param s : state
    \return incoming edges to state s
-   \note the return range goes across all tuples of process locations and bounded integer variabkes
-   valuations in the given system. The number of such tuples is exponential in the number of locations
-   and processes, as well as the domains of bounded integer variables
+   \note the return range goes across all tuples of process locations in the given system, and for
+   each tuple of edges, across the candidate source valuations of the bounded integer variables (see
+   tchecker::ta::incoming_edges_iterator_t). The number of such tuples is exponential in the number of
+   locations and processes, and in the sizes of the intervals of candidate values
    */
   virtual incoming_edges_range_t incoming_edges(tchecker::zg::const_state_sptr_t const & s);
 
@@ -848,6 +850,40 @@ public:
   virtual void build(std::map<std::string, std::string> const & attributes, std::vector<sst_t> & v,
                      tchecker::state_status_t mask = tchecker::STATE_OK);
 
+  /*!
+   \brief State building from raw components
+   \param vloc : identifiers of locations, one for each process
+   \param intval : values of the flattened bounded integer variables
+   \param dbm : DBM of the zone, row by row
+   \return a state with tuple of locations vloc, integer valuation intval and
+   zone dbm. The state shares its internal components if sharing_type is
+   tchecker::ts::SHARING
+   \throw std::invalid_argument : if the size of vloc, intval or dbm does not
+   match the system of this zone graph
+   \note no check is performed on the values in vloc, intval and dbm. This is
+   meant to rebuild states that have been computed by a zone graph over the same
+   system (e.g. states saved in a file)
+   */
+  tchecker::zg::state_sptr_t build_state(std::vector<tchecker::loc_id_t> const & vloc,
+                                         std::vector<tchecker::integer_t> const & intval,
+                                         std::vector<tchecker::dbm::db_t> const & dbm);
+
+  /*!
+   \brief Transition building from a tuple of edges
+   \param vedge : identifiers of edges, one for each process (tchecker::NO_EDGE
+   for processes that are not involved)
+   \return a transition with tuple of edges vedge. The transition shares its
+   internal components if sharing_type is tchecker::ts::SHARING
+   \throw std::invalid_argument : if the size of vedge does not match the system
+   of this zone graph
+   \note the synchronization identifier of the returned transition is
+   tchecker::NO_SYNC, and its invariants, guard and reset are empty. No check is
+   performed on the values in vedge. This is meant to rebuild the edges of a
+   graph that has been computed by a zone graph over the same system (e.g. edges
+   saved in a file) without computing the successors of their source states
+   */
+  tchecker::zg::transition_sptr_t build_transition(std::vector<tchecker::edge_id_t> const & vedge);
+
   // split
 
   /*!
@@ -950,6 +986,37 @@ public:
   */
   inline enum tchecker::ts::sharing_type_t sharing_type() const { return _sharing_type; }
 
+  /*!
+   \brief Accessor
+   \return Memory allocated for the states and transitions of this zone graph
+   (in bytes)
+   */
+  inline std::size_t memsize() const { return _state_allocator.memsize() + _transition_allocator.memsize(); }
+
+  /*!
+   \brief Accessor
+   \return Statistics on the collections of unused memory by the allocators of this zone graph
+   */
+  inline tchecker::collection_stats_t collection_stats() const
+  {
+    tchecker::collection_stats_t stats = _state_allocator.collection_stats();
+    stats += _transition_allocator.collection_stats();
+    return stats;
+  }
+
+  /*!
+   \brief Collect unused states and transitions
+   \post states and transitions that are not referenced anymore (and their
+   components) have been released to the allocators of this zone graph
+   \note states and transitions are only reused by this zone graph after they
+   have been collected
+   */
+  inline void collect()
+  {
+    _state_allocator.collect();
+    _transition_allocator.collect();
+  }
+
 private:
   /*!
    \brief Clone and constrain a state
@@ -1012,6 +1079,29 @@ tchecker::zg::zg_t * factory(std::shared_ptr<tchecker::ta::system_t const> const
                              enum tchecker::zg::extrapolation_type_t extrapolation_type, std::size_t block_size,
                              std::size_t table_size);
 
+/*!
+ \brief Factory of zone graphs with clock bounds computed from system, and clock
+ reduction
+ \param system : system of timed processes
+ \param sharing_type : type of sharing
+ \param semantics_type : type of zone semantics
+ \param extrapolation_type : type of zone extrapolation
+ \param clock_reduction_type : type of clock reduction
+ \param block_size : number of objects allocated in a block
+ \param table_size : size of hash tables
+ \return a zone graph over system with zone semantics defined from semantics_type,
+ and zone extrapolation defined from extrapolation_type and clock_reduction_type
+ (see tchecker::zg::extrapolation_factory), and allocation of block_size objects
+ at a time, nullptr if clock bounds cannot be inferred from system
+ \throw std::runtime_error : if clock bounds or active clocks cannot be computed
+ for system
+ */
+tchecker::zg::zg_t * factory(std::shared_ptr<tchecker::ta::system_t const> const & system,
+                             enum tchecker::ts::sharing_type_t sharing_type, enum tchecker::zg::semantics_type_t semantics_type,
+                             enum tchecker::zg::extrapolation_type_t extrapolation_type,
+                             enum tchecker::zg::clock_reduction_type_t clock_reduction_type, std::size_t block_size,
+                             std::size_t table_size);
+
 /*!
  \brief Factory of zone graphs with given clock bounds
  \param system : system of timed processes
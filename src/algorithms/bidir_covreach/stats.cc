@@ -0,0 +1,74 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <sstream>
+
+#include "tchecker/algorithms/bidir_covreach/stats.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bidir_covreach {
+
+stats_t::stats_t() : _met(false), _reachable(false) {}
+
+tchecker::algorithms::covreach::stats_t & stats_t::fwd_stats() { return _fwd_stats; }
+
+tchecker::algorithms::covreach::stats_t const & stats_t::fwd_stats() const { return _fwd_stats; }
+
+tchecker::algorithms::covreach::stats_t & stats_t::bwd_stats() { return _bwd_stats; }
+
+tchecker::algorithms::covreach::stats_t const & stats_t::bwd_stats() const { return _bwd_stats; }
+
+bool & stats_t::met() { return _met; }
+
+bool stats_t::met() const { return _met; }
+
+bool & stats_t::reachable() { return _reachable; }
+
+bool stats_t::reachable() const { return _reachable; }
+
+void stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  tchecker::algorithms::stats_t::attributes(m);
+
+  std::stringstream sstream;
+
+  auto add_counter = [&](std::string const & key, unsigned long fwd, unsigned long bwd) {
+    sstream.str("");
+    sstream << fwd;
+    m["FWD_" + key] = sstream.str();
+
+    sstream.str("");
+    sstream << bwd;
+    m["BWD_" + key] = sstream.str();
+
+    sstream.str("");
+    sstream << fwd + bwd;
+    m[key] = sstream.str();
+  };
+
+  add_counter("VISITED_STATES", _fwd_stats.visited_states(), _bwd_stats.visited_states());
+  add_counter("VISITED_TRANSITIONS", _fwd_stats.visited_transitions(), _bwd_stats.visited_transitions());
+  add_counter("COVERED_STATES", _fwd_stats.covered_states(), _bwd_stats.covered_states());
+  add_counter("STORED_STATES", _fwd_stats.stored_states(), _bwd_stats.stored_states());
+
+  sstream.str("");
+  sstream << std::boolalpha << _met;
+  m["SEARCHES_MET"] = sstream.str();
+
+  sstream.str("");
+  sstream << std::boolalpha << _reachable;
+  m["REACHABLE"] = sstream.str();
+}
+
+} // end of namespace bidir_covreach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -0,0 +1,75 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <stdexcept>
+
+#include "tchecker/algorithms/budget.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+std::ostream & operator<<(std::ostream & os, enum tchecker::algorithms::budget_status_t status)
+{
+  switch (status) {
+  case tchecker::algorithms::BUDGET_AVAILABLE:
+    return os << "none";
+  case tchecker::algorithms::BUDGET_TIME_EXHAUSTED:
+    return os << "time";
+  case tchecker::algorithms::BUDGET_STATES_EXHAUSTED:
+    return os << "states";
+  case tchecker::algorithms::BUDGET_MEMORY_EXHAUSTED:
+    return os << "memory";
+  default:
+    throw std::invalid_argument("Unknown budget status");
+  }
+}
+
+budget_t::budget_t()
+    : _time_limit(0), _states_limit(0), _memory_limit(0), _check_period(tchecker::algorithms::budget_t::CHECK_PERIOD),
+      _countdown(0)
+{
+}
+
+budget_t::budget_t(std::size_t time_limit, std::size_t states_limit, std::size_t memory_limit, std::size_t check_period)
+    : _time_limit(time_limit), _states_limit(states_limit), _memory_limit(memory_limit), _check_period(check_period),
+      _countdown(0)
+{
+  if (_check_period == 0)
+    throw std::invalid_argument("Check period should be positive");
+}
+
+void budget_t::memory_usage(tchecker::algorithms::budget_t::memory_usage_t const & memory_usage)
+{
+  _memory_usage = memory_usage;
+}
+
+bool budget_t::unlimited() const
+{
+  return (_time_limit.count() == 0) && (_states_limit == 0) && (_memory_limit == 0 || !_memory_usage);
+}
+
+enum tchecker::algorithms::budget_status_t
+budget_t::check(std::chrono::time_point<std::chrono::steady_clock> const & start_time, std::size_t states) const
+{
+  if (_states_limit != 0 && states >= _states_limit)
+    return tchecker::algorithms::BUDGET_STATES_EXHAUSTED;
+  if (_countdown != 0) {
+    --_countdown;
+    return tchecker::algorithms::BUDGET_AVAILABLE;
+  }
+  _countdown = _check_period - 1;
+  if (_memory_limit != 0 && _memory_usage && _memory_usage() >= _memory_limit)
+    return tchecker::algorithms::BUDGET_MEMORY_EXHAUSTED;
+  if (_time_limit.count() != 0 && std::chrono::steady_clock::now() - start_time >= _time_limit)
+    return tchecker::algorithms::BUDGET_TIME_EXHAUSTED;
+  return tchecker::algorithms::BUDGET_AVAILABLE;
+}
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -58,7 +58,10 @@ void stats_t::attributes(std::map<std::string, std::string> & m) const
   m["STORED_STATES"] = sstream.str();
 
   sstream.str("");
-  sstream << std::boolalpha << _reachable;
+  if (!_reachable && budget_exhausted())
+    sstream << "unknown";
+  else
+    sstream << std::boolalpha << _reachable;
   m["REACHABLE"] = sstream.str();
 }
 
@@ -0,0 +1,142 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <stdexcept>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "tchecker/algorithms/progress.hh"
+#include "tchecker/utils/block_allocator.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace details {
+
+std::atomic<unsigned long> progress_visited{0};
+
+std::atomic<unsigned long> progress_stored{0};
+
+std::atomic<unsigned long> progress_covered{0};
+
+std::atomic<std::size_t> progress_waiting{0};
+
+} // end of namespace details
+
+std::chrono::milliseconds parse_progress_period(std::string const & s)
+{
+  char * end = nullptr;
+  double const value = std::strtod(s.c_str(), &end);
+  if (end == s.c_str() || !(value > 0))
+    throw std::invalid_argument("Expecting a positive period: " + s);
+
+  std::string const unit{end};
+  double ms = 0;
+  if (unit.empty() || unit == "s")
+    ms = value * 1000;
+  else if (unit == "ms")
+    ms = value;
+  else if (unit == "m")
+    ms = value * 60000;
+  else
+    throw std::invalid_argument("Unknown unit of period: " + s);
+
+  if (ms < 1)
+    throw std::invalid_argument("Expecting a period of at least 1ms: " + s);
+  return std::chrono::milliseconds{static_cast<long long>(ms)};
+}
+
+std::size_t current_rss()
+{
+#if defined(__linux__)
+  std::FILE * f = std::fopen("/proc/self/statm", "r");
+  if (f != nullptr) {
+    unsigned long size = 0, resident = 0;
+    int const res = std::fscanf(f, "%lu %lu", &size, &resident);
+    std::fclose(f);
+    if (res == 2)
+      return static_cast<std::size_t>(resident) * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  }
+#endif
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == -1)
+    return 0;
+#if defined(__APPLE__)
+  return static_cast<std::size_t>(usage.ru_maxrss); // bytes
+#else
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024; // kilobytes
+#endif
+}
+
+/* progress_reporter_t */
+
+progress_reporter_t::progress_reporter_t(std::chrono::milliseconds period, std::ostream & os,
+                                         enum tchecker::algorithms::progress_format_t format)
+    : _period(period), _os(os), _format(format), _start_time(std::chrono::steady_clock::now()), _last_time(_start_time),
+      _last_visited(0), _stop(false)
+{
+  if (_period.count() <= 0)
+    throw std::invalid_argument("Progress period should be positive");
+  tchecker::algorithms::publish_progress(0, 0, 0, 0);
+  _thread = std::thread(&progress_reporter_t::run, this);
+}
+
+progress_reporter_t::~progress_reporter_t()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cv.notify_one();
+  _thread.join();
+}
+
+void progress_reporter_t::report()
+{
+  auto const now = std::chrono::steady_clock::now();
+  unsigned long const visited = details::progress_visited.load(std::memory_order_relaxed);
+  unsigned long const stored = details::progress_stored.load(std::memory_order_relaxed);
+  unsigned long const covered = details::progress_covered.load(std::memory_order_relaxed);
+  std::size_t const waiting = details::progress_waiting.load(std::memory_order_relaxed);
+
+  double const elapsed = std::chrono::duration<double>(now - _start_time).count();
+  double const delta = std::chrono::duration<double>(now - _last_time).count();
+  double const rate = (delta > 0 && visited >= _last_visited ? (visited - _last_visited) / delta : 0.0);
+  std::size_t const rss = tchecker::algorithms::current_rss();
+  std::size_t const pools = tchecker::allocated_blocks_memory();
+
+  _last_time = now;
+  _last_visited = visited;
+
+  if (_format == tchecker::algorithms::PROGRESS_JSON)
+    _os << std::fixed << std::setprecision(3) << "{\"time\":" << elapsed << ",\"visited\":" << visited
+        << ",\"stored\":" << stored << ",\"covered\":" << covered << ",\"waiting\":" << waiting
+        << ",\"states_per_second\":" << std::setprecision(1) << rate << ",\"rss\":" << rss << ",\"pools\":" << pools << "}"
+        << std::endl;
+  else
+    _os << std::fixed << std::setprecision(1) << "PROGRESS " << elapsed << "s visited " << visited << " stored " << stored
+        << " covered " << covered << " waiting " << waiting << " (" << rate << " states/s) rss "
+        << static_cast<double>(rss) / (1 << 20) << "MB pools " << static_cast<double>(pools) / (1 << 20) << "MB"
+        << std::endl;
+  _os << std::defaultfloat;
+}
+
+void progress_reporter_t::run()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (!_cv.wait_for(lock, _period, [this]() { return _stop; }))
+    report();
+}
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -43,7 +43,10 @@ void stats_t::attributes(std::map<std::string, std::string> & m) const
   m["VISITED_TRANSITIONS"] = sstream.str();
 
   sstream.str("");
-  sstream << std::boolalpha << _reachable;
+  if (!_reachable && budget_exhausted())
+    sstream << "unknown";
+  else
+    sstream << std::boolalpha << _reachable;
   m["REACHABLE"] = sstream.str();
 }
 
@@ -9,12 +9,21 @@
 #include <sys/resource.h>
 
 #include "tchecker/algorithms/stats.hh"
+#include "tchecker/utils/counters.hh"
+#include "tchecker/utils/profile.hh"
 
 namespace tchecker {
 
 namespace algorithms {
 
-void stats_t::set_start_time() { _start_time = std::chrono::steady_clock::now(); }
+stats_t::stats_t() : _resumed_running_time(0.0), _budget_status(tchecker::algorithms::BUDGET_AVAILABLE) {}
+
+void stats_t::set_start_time()
+{
+  tchecker::counters::reset();
+  tchecker::profile::reset();
+  _start_time = std::chrono::steady_clock::now();
+}
 
 std::chrono::time_point<std::chrono::steady_clock> stats_t::start_time() const { return _start_time; }
 
@@ -28,6 +37,10 @@ double stats_t::running_time() const
   return duration.count();
 }
 
+double & stats_t::resumed_running_time() { return _resumed_running_time; }
+
+double stats_t::resumed_running_time() const { return _resumed_running_time; }
+
 long stats_t::max_rss() const
 {
   struct rusage usage;
@@ -37,6 +50,12 @@ long stats_t::max_rss() const
   return usage.ru_maxrss;
 }
 
+enum tchecker::algorithms::budget_status_t & stats_t::budget_status() { return _budget_status; }
+
+enum tchecker::algorithms::budget_status_t stats_t::budget_status() const { return _budget_status; }
+
+bool stats_t::budget_exhausted() const { return (_budget_status != tchecker::algorithms::BUDGET_AVAILABLE); }
+
 void stats_t::attributes(std::map<std::string, std::string> & m) const
 {
   std::stringstream sstream;
@@ -44,9 +63,24 @@ void stats_t::attributes(std::map<std::string, std::string> & m) const
   sstream << running_time();
   m["RUNNING_TIME_SECONDS"] = sstream.str();
 
+  if (_resumed_running_time > 0.0) {
+    sstream.str("");
+    sstream << _resumed_running_time + running_time();
+    m["TOTAL_RUNNING_TIME_SECONDS"] = sstream.str();
+  }
+
   sstream.str("");
   sstream << max_rss();
   m["MEMORY_MAX_RSS"] = sstream.str();
+
+  if (budget_exhausted()) {
+    sstream.str("");
+    sstream << _budget_status;
+    m["BUDGET_EXHAUSTED"] = sstream.str();
+  }
+
+  tchecker::counters::attributes(m);
+  tchecker::profile::attributes(m, running_time());
 }
 
 } // end of namespace algorithms
@@ -1216,6 +1216,87 @@ enum tchecker::dbm::clock_position_t clock_position(tchecker::dbm::db_t const *
   return tchecker::dbm::CLK_SYNCHRONIZABLE;
 }
 
+void reduce(tchecker::dbm::db_t const * dbm, tchecker::clock_id_t dim,
+            std::vector<tchecker::dbm::db_constraint_t> & constraints)
+{
+  assert(dbm != nullptr);
+  assert(dim >= 1);
+  assert(tchecker::dbm::is_consistent(dbm, dim));
+  assert(tchecker::dbm::is_tight(dbm, dim));
+
+  constraints.clear();
+
+  // Partition clocks w.r.t. zero cycles: rep[i] is the smallest clock in the
+  // class of i, and last[r] is the last clock added to the class of r
+  std::vector<tchecker::clock_id_t> rep(dim), last(dim);
+  for (tchecker::clock_id_t i = 0; i < dim; ++i) {
+    rep[i] = i;
+    last[i] = i;
+    for (tchecker::clock_id_t j = 0; j < i; ++j)
+      if ((rep[j] == j) && (tchecker::dbm::sum(DBM(i, j), DBM(j, i)) == tchecker::dbm::LE_ZERO)) {
+        rep[i] = j;
+        break;
+      }
+    // chain the clocks in each class
+    tchecker::clock_id_t r = rep[i];
+    if (r != i) {
+      constraints.push_back({last[r], i, DBM(last[r], i)});
+      last[r] = i;
+    }
+  }
+
+  // close each chain into a cycle
+  for (tchecker::clock_id_t r = 0; r < dim; ++r)
+    if ((rep[r] == r) && (last[r] != r))
+      constraints.push_back({last[r], r, DBM(last[r], r)});
+
+  // keep non-redundant constraints between representatives
+  for (tchecker::clock_id_t i = 0; i < dim; ++i) {
+    if (rep[i] != i)
+      continue;
+    for (tchecker::clock_id_t j = 0; j < dim; ++j) {
+      if ((j == i) || (rep[j] != j) || (DBM(i, j) == tchecker::dbm::LT_INFINITY))
+        continue;
+      bool redundant = false;
+      for (tchecker::clock_id_t k = 0; k < dim && !redundant; ++k)
+        redundant = ((k != i) && (k != j) && (rep[k] == k) && (tchecker::dbm::sum(DBM(i, k), DBM(k, j)) == DBM(i, j)));
+      if (!redundant)
+        constraints.push_back({i, j, DBM(i, j)});
+    }
+  }
+}
+
+enum tchecker::dbm::status_t expand(tchecker::dbm::db_t * dbm, tchecker::clock_id_t dim,
+                                    std::vector<tchecker::dbm::db_constraint_t> const & constraints)
+{
+  assert(dbm != nullptr);
+  assert(dim >= 1);
+
+  tchecker::dbm::universal(dbm, dim);
+  for (tchecker::dbm::db_constraint_t const & c : constraints) {
+    assert(c.i < dim);
+    assert(c.j < dim);
+    DBM(c.i, c.j) = tchecker::dbm::min(DBM(c.i, c.j), c.db);
+  }
+  return tchecker::dbm::tighten(dbm, dim);
+}
+
+bool is_le(tchecker::dbm::db_t const * dbm, tchecker::clock_id_t dim,
+           std::vector<tchecker::dbm::db_constraint_t> const & constraints)
+{
+  assert(dbm != nullptr);
+  assert(dim >= 1);
+  assert(tchecker::dbm::is_tight(dbm, dim));
+
+  for (tchecker::dbm::db_constraint_t const & c : constraints) {
+    assert(c.i < dim);
+    assert(c.j < dim);
+    if (DBM(c.i, c.j) > c.db)
+      return false;
+  }
+  return true;
+}
+
 } // end of namespace dbm
 
 } // end of namespace tchecker
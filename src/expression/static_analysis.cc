@@ -768,4 +768,98 @@ tchecker::has_clock_constraints_t has_clock_constraints(tchecker::typed_expressi
   return v.has_clock_constraints();
 }
 
+/* extract_diagonal_clocks */
+
+namespace details {
+
+/*!
+ \class diagonal_clocks_visitor_t
+ \brief Visitor of typed expressions for extracting the clocks of diagonal clock constraints
+ */
+class diagonal_clocks_visitor_t : public tchecker::typed_expression_visitor_t {
+public:
+  /*!
+   \brief Constructor
+   \param diagonals : a vector of sets of clock IDs
+   \note this keeps a reference on diagonals
+   */
+  diagonal_clocks_visitor_t(std::vector<std::unordered_set<tchecker::clock_id_t>> & diagonals) : _diagonals(diagonals) {}
+
+  /*!
+   \brief Copy constructor
+   */
+  diagonal_clocks_visitor_t(tchecker::details::diagonal_clocks_visitor_t const &) = default;
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~diagonal_clocks_visitor_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::details::diagonal_clocks_visitor_t & operator=(tchecker::details::diagonal_clocks_visitor_t const &) = delete;
+
+  /*!
+   \brief Move assignment operator (deleted)
+   */
+  tchecker::details::diagonal_clocks_visitor_t & operator=(tchecker::details::diagonal_clocks_visitor_t &&) = delete;
+
+  /*!
+   \brief Treat diagonal clock constraint
+   \post the set of clock IDs in expr has been added to _diagonals
+   */
+  virtual void visit(tchecker::typed_diagonal_clkconstr_expression_t const & expr)
+  {
+    std::unordered_set<tchecker::clock_id_t> clocks;
+    for (tchecker::typed_lvalue_expression_t const * clock : {&expr.first_clock(), &expr.second_clock()}) {
+      tchecker::range_t<tchecker::variable_id_t> ids = tchecker::extract_lvalue_variable_ids(*clock);
+      for (tchecker::clock_id_t x = ids.begin(); x != ids.end(); ++x)
+        clocks.insert(x);
+    }
+    _diagonals.push_back(clocks);
+  }
+
+  /* Other visitors: recursion or do nothing */
+
+  virtual void visit(tchecker::typed_simple_clkconstr_expression_t const &) {}
+
+  virtual void visit(tchecker::typed_var_expression_t const &) {}
+
+  virtual void visit(tchecker::typed_bounded_var_expression_t const &) {}
+
+  virtual void visit(tchecker::typed_array_expression_t const &) {}
+
+  virtual void visit(tchecker::typed_int_expression_t const &) {}
+
+  virtual void visit(tchecker::typed_par_expression_t const & expr) { expr.expr().visit(*this); }
+
+  virtual void visit(tchecker::typed_binary_expression_t const & expr)
+  {
+    expr.left_operand().visit(*this);
+    expr.right_operand().visit(*this);
+  }
+
+  virtual void visit(tchecker::typed_unary_expression_t const & expr) { expr.operand().visit(*this); }
+
+  virtual void visit(tchecker::typed_ite_expression_t const & expr)
+  {
+    expr.condition().visit(*this);
+    expr.then_value().visit(*this);
+    expr.else_value().visit(*this);
+  }
+
+private:
+  std::vector<std::unordered_set<tchecker::clock_id_t>> & _diagonals; /*!< Sets of clock IDs of diagonal constraints */
+};
+
+} // end of namespace details
+
+void extract_diagonal_clocks(tchecker::typed_expression_t const & expr,
+                             std::vector<std::unordered_set<tchecker::clock_id_t>> & diagonals)
+{
+  tchecker::details::diagonal_clocks_visitor_t v(diagonals);
+  expr.visit(v);
+}
+
 } // end of namespace tchecker
@@ -83,9 +83,10 @@ tchecker::state_status_t next(tchecker::ta::system_t const & system, tchecker::v
 // Incoming edges
 
 tchecker::fsm::incoming_edges_range_t incoming_edges(tchecker::ta::system_t const & system,
-                                                     tchecker::const_vloc_sptr_t const & vloc)
+                                                     tchecker::const_vloc_sptr_t const & vloc,
+                                                     tchecker::const_intval_sptr_t const & intval)
 {
-  return tchecker::ta::incoming_edges(system, vloc);
+  return tchecker::ta::incoming_edges(system, vloc, intval);
 }
 
 // Previous state
@@ -232,7 +233,7 @@ void fsm_t::final(boost::dynamic_bitset<> const & labels, std::vector<sst_t> & v
 
 incoming_edges_range_t fsm_t::incoming_edges(tchecker::fsm::const_state_sptr_t const & s)
 {
-  return tchecker::fsm::incoming_edges(*_system, s->vloc_ptr());
+  return tchecker::fsm::incoming_edges(*_system, s->vloc_ptr(), s->intval_ptr());
 }
 
 void fsm_t::prev(tchecker::fsm::const_state_sptr_t const & s, incoming_edges_value_t const & in_edge, std::vector<sst_t> & v,
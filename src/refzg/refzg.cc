@@ -13,6 +13,8 @@
 #include "tchecker/dbm/db.hh"
 #include "tchecker/dbm/refdbm.hh"
 #include "tchecker/refzg/refzg.hh"
+#include "tchecker/utils/counters.hh"
+#include "tchecker/utils/profile.hh"
 #include "tchecker/variables/static_analysis.hh"
 
 namespace tchecker {
@@ -71,17 +73,28 @@ tchecker::state_status_t next(tchecker::ta::system_t const & system, tchecker::v
 
   boost::dynamic_bitset<> const src_delay_allowed = tchecker::ta::delay_allowed(system, *r, *vloc);
 
-  tchecker::state_status_t status =
-      tchecker::ta::next(system, vloc, intval, vedge, sync_id, src_invariant, guard, reset, tgt_invariant, sync_edges);
-  if (status != tchecker::STATE_OK)
+  tchecker::state_status_t status = tchecker::STATE_OK;
+  {
+    tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_DISCRETE};
+    status = tchecker::ta::next(system, vloc, intval, vedge, sync_id, src_invariant, guard, reset, tgt_invariant, sync_edges);
+  }
+  if (status != tchecker::STATE_OK) {
+    tchecker::counters::increment(tchecker::counters::SUCCESSORS_DISCRETE_REJECTED);
     return status;
+  }
 
   boost::dynamic_bitset<> const tgt_delay_allowed = tchecker::ta::delay_allowed(system, *r, *vloc);
   boost::dynamic_bitset<> const sync_refclocks = tchecker::ta::sync_refclocks(system, *r, *vedge);
 
   tchecker::dbm::db_t * rdbm = zone->dbm();
-  return semantics.next(rdbm, *r, src_delay_allowed, src_invariant, sync_refclocks, guard, reset, tgt_delay_allowed,
-                        tgt_invariant, spread);
+  {
+    tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_SEMANTICS};
+    status = semantics.next(rdbm, *r, src_delay_allowed, src_invariant, sync_refclocks, guard, reset, tgt_delay_allowed,
+                            tgt_invariant, spread);
+  }
+  if (status != tchecker::STATE_OK)
+    tchecker::counters::increment(tchecker::counters::SUCCESSORS_ZONE_EMPTY);
+  return status;
 }
 
 tchecker::state_status_t prev(tchecker::ta::system_t const & system, tchecker::vloc_sptr_t const & vloc,
@@ -249,6 +262,7 @@ void refzg_t::next(tchecker::refzg::const_state_sptr_t const & s, outgoing_edges
   tchecker::state_status_t status = tchecker::refzg::next(*_system, *nexts, *nextt, *_semantics, _spread, out_edge);
   if (status & mask) {
     if (_sharing_type == tchecker::ts::SHARING) {
+      tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_SHARING};
       share(nexts);
       share(nextt);
     }
@@ -289,7 +303,7 @@ void refzg_t::final(boost::dynamic_bitset<> const & labels, std::vector<sst_t> &
 
 incoming_edges_range_t refzg_t::incoming_edges(tchecker::refzg::const_state_sptr_t const & s)
 {
-  return tchecker::refzg::incoming_edges(*_system, s->vloc_ptr());
+  return tchecker::refzg::incoming_edges(*_system, s->vloc_ptr(), s->intval_ptr());
 }
 
 void refzg_t::prev(tchecker::refzg::const_state_sptr_t const & s, incoming_edges_value_t const & in_edge,
@@ -9,6 +9,7 @@
 
 #include "tchecker/dbm/refdbm.hh"
 #include "tchecker/refzg/zone.hh"
+#include "tchecker/utils/counters.hh"
 
 namespace tchecker {
 
@@ -40,7 +41,9 @@ bool zone_t::operator!=(tchecker::refzg::zone_t const & zone) const { return !(*
 
 bool zone_t::operator<=(tchecker::refzg::zone_t const & zone) const
 {
-  return (_ref_clocks == zone._ref_clocks) && tchecker::refdbm::is_le(dbm_ptr(), zone.dbm_ptr(), *_ref_clocks);
+  return (_ref_clocks == zone._ref_clocks) &&
+         tchecker::counters::check(tchecker::counters::ZONE_INCLUSION_CHECKS, tchecker::counters::ZONE_INCLUSION_SUCCESSES,
+                                   tchecker::refdbm::is_le(dbm_ptr(), zone.dbm_ptr(), *_ref_clocks));
 }
 
 bool zone_t::is_am_star_le(tchecker::refzg::zone_t const & zone, tchecker::clockbounds::map_t const & m) const
@@ -52,7 +55,8 @@ bool zone_t::is_alu_star_le(tchecker::refzg::zone_t const & zone, tchecker::cloc
                             tchecker::clockbounds::map_t const & u) const
 {
   return (_ref_clocks == zone._ref_clocks) &&
-         tchecker::refdbm::is_alu_star_le(dbm_ptr(), zone.dbm_ptr(), *_ref_clocks, l.ptr(), u.ptr());
+         tchecker::counters::check(tchecker::counters::ALU_INCLUSION_CHECKS, tchecker::counters::ALU_INCLUSION_SUCCESSES,
+                                   tchecker::refdbm::is_alu_star_le(dbm_ptr(), zone.dbm_ptr(), *_ref_clocks, l.ptr(), u.ptr()));
 }
 
 bool zone_t::is_time_elapse_am_star_le(tchecker::refzg::zone_t const & zone, tchecker::clockbounds::map_t const & m) const
@@ -65,14 +69,17 @@ bool zone_t::is_time_elapse_alu_star_le(tchecker::refzg::zone_t const & zone, tc
                                         tchecker::clockbounds::map_t const & u) const
 {
   return (_ref_clocks == zone._ref_clocks) &&
-         tchecker::refdbm::is_time_elapse_alu_star_le(dbm_ptr(), zone.dbm_ptr(), *_ref_clocks, l.ptr(), u.ptr());
+         tchecker::counters::check(
+             tchecker::counters::ALU_INCLUSION_CHECKS, tchecker::counters::ALU_INCLUSION_SUCCESSES,
+             tchecker::refdbm::is_time_elapse_alu_star_le(dbm_ptr(), zone.dbm_ptr(), *_ref_clocks, l.ptr(), u.ptr()));
 }
 
 bool zone_t::is_sync_alu_le(tchecker::refzg::zone_t const & zone, tchecker::clockbounds::map_t const & l,
                             tchecker::clockbounds::map_t const & u) const
 {
   return (_ref_clocks == zone._ref_clocks) &&
-         tchecker::refdbm::is_sync_alu_le(dbm_ptr(), zone.dbm_ptr(), *_ref_clocks, l.ptr(), u.ptr());
+         tchecker::counters::check(tchecker::counters::ALU_INCLUSION_CHECKS, tchecker::counters::ALU_INCLUSION_SUCCESSES,
+                                   tchecker::refdbm::is_sync_alu_le(dbm_ptr(), zone.dbm_ptr(), *_ref_clocks, l.ptr(), u.ptr()));
 }
 
 int zone_t::lexical_cmp(tchecker::refzg::zone_t const & zone) const
@@ -0,0 +1,924 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+
+#include "tchecker/expression/static_analysis.hh"
+#include "tchecker/statement/interval_analysis.hh"
+#include "tchecker/statement/static_analysis.hh"
+
+namespace tchecker {
+
+namespace details {
+
+/*!
+ \brief Type of intervals used in computations: integer values are represented as 64-bits
+ integers to avoid overflows on arithmetic operations
+ \note an interval is empty if first > second
+ */
+using interval_t = std::pair<std::int64_t, std::int64_t>;
+
+/*!< Interval of all integer values */
+static interval_t const top_interval{std::numeric_limits<tchecker::integer_t>::min(),
+                                     std::numeric_limits<tchecker::integer_t>::max()};
+
+/*!< Empty interval */
+static interval_t const empty_interval{1, 0};
+
+/*!< Interval of boolean values */
+static interval_t const bool_interval{0, 1};
+
+/*!< Interval of value true */
+static interval_t const true_interval{1, 1};
+
+/*!< Interval of value false */
+static interval_t const false_interval{0, 0};
+
+/*!
+ \brief Emptiness check
+ \param i : interval
+ \return true if i is empty, false otherwise
+ */
+static inline bool empty(interval_t const & i) { return i.first > i.second; }
+
+/*!
+ \brief Clamp an interval to the values of tchecker::integer_t
+ \param i : interval
+ \return i restricted to the values that can be represented as a tchecker::integer_t
+ \note the VM fails on values that cannot be represented as a tchecker::integer_t
+ */
+static inline interval_t clamp(interval_t const & i)
+{
+  if (empty(i))
+    return empty_interval;
+  return {std::max(i.first, top_interval.first), std::min(i.second, top_interval.second)};
+}
+
+/*!
+ \brief Intersection
+ \param i1 : interval
+ \param i2 : interval
+ \return intersection of i1 and i2
+ */
+static inline interval_t intersect(interval_t const & i1, interval_t const & i2)
+{
+  return {std::max(i1.first, i2.first), std::min(i1.second, i2.second)};
+}
+
+/*!
+ \brief Convex hull
+ \param i1 : interval
+ \param i2 : interval
+ \return smallest interval that contains i1 and i2
+ */
+static inline interval_t hull(interval_t const & i1, interval_t const & i2)
+{
+  if (empty(i1))
+    return i2;
+  if (empty(i2))
+    return i1;
+  return {std::min(i1.first, i2.first), std::max(i1.second, i2.second)};
+}
+
+/*!
+ \brief Saturating addition
+ \param a : integer
+ \param b : integer
+ \return a + b, saturated to the range of std::int64_t
+ \note saturated bounds are sound for intervals: they are clamped to the values of
+ tchecker::integer_t afterwards (see clamp), and the VM fails outside of these values
+ */
+static inline std::int64_t add(std::int64_t a, std::int64_t b)
+{
+  if (b > 0 && a > std::numeric_limits<std::int64_t>::max() - b)
+    return std::numeric_limits<std::int64_t>::max();
+  if (b < 0 && a < std::numeric_limits<std::int64_t>::min() - b)
+    return std::numeric_limits<std::int64_t>::min();
+  return a + b;
+}
+
+/*!
+ \brief Saturating subtraction
+ \param a : integer
+ \param b : integer
+ \return a - b, saturated to the range of std::int64_t
+ */
+static inline std::int64_t sub(std::int64_t a, std::int64_t b)
+{
+  if (b < 0 && a > std::numeric_limits<std::int64_t>::max() + b)
+    return std::numeric_limits<std::int64_t>::max();
+  if (b > 0 && a < std::numeric_limits<std::int64_t>::min() + b)
+    return std::numeric_limits<std::int64_t>::min();
+  return a - b;
+}
+
+/*!
+ \brief Saturating negation
+ \param a : integer
+ \return -a, saturated to the range of std::int64_t
+ */
+static inline std::int64_t neg(std::int64_t a)
+{
+  return (a == std::numeric_limits<std::int64_t>::min() ? std::numeric_limits<std::int64_t>::max() : -a);
+}
+
+/*!
+ \brief Saturating multiplication
+ \param a : integer
+ \param b : integer
+ \return a * b, saturated to the range of std::int64_t
+ */
+static inline std::int64_t mul(std::int64_t a, std::int64_t b)
+{
+  std::int64_t const max = std::numeric_limits<std::int64_t>::max();
+  std::int64_t const min = std::numeric_limits<std::int64_t>::min();
+  if (a == 0 || b == 0)
+    return 0;
+  if (a > 0) {
+    if (b > 0)
+      return (a > max / b ? max : a * b);
+    return (b < min / a ? min : a * b);
+  }
+  if (b > 0)
+    return (a < min / b ? min : a * b);
+  return (a < max / b ? max : a * b);
+}
+
+/*!
+ \brief Saturating division
+ \param a : integer
+ \param b : non-zero integer
+ \return a / b, saturated to the range of std::int64_t
+ */
+static inline std::int64_t div(std::int64_t a, std::int64_t b)
+{
+  assert(b != 0);
+  if (a == std::numeric_limits<std::int64_t>::min() && b == -1)
+    return std::numeric_limits<std::int64_t>::max();
+  return a / b;
+}
+
+/*!
+ \brief Saturating absolute value
+ \param a : integer
+ \return |a|, saturated to the range of std::int64_t
+ */
+static inline std::int64_t abs(std::int64_t a) { return (a < 0 ? neg(a) : a); }
+
+/*!
+ \brief Remove a value from an interval
+ \param i : interval
+ \param v : value
+ \return i without v if v is a bound of i, i otherwise
+ */
+static inline interval_t exclude(interval_t const & i, std::int64_t v)
+{
+  if (i.first == v)
+    return {add(v, 1), i.second};
+  if (i.second == v)
+    return {i.first, sub(v, 1)};
+  return i;
+}
+
+/*!
+ \brief Check if an interval contains a single value
+ \param i : interval
+ \return true if i contains exactly one value, false otherwise
+ */
+static inline bool is_point(interval_t const & i) { return i.first == i.second; }
+
+/*!
+ \brief Interval of the domain of a flat bounded integer variable
+ \param intvars : flat bounded integer variables
+ \param id : variable identifier
+ \return interval of the values of variable id in intvars
+ */
+static inline tchecker::integer_interval_t domain(tchecker::flat_integer_variables_t const & intvars, tchecker::intvar_id_t id)
+{
+  return {intvars.info(id).min(), intvars.info(id).max()};
+}
+
+/*!
+ \brief Check if an expression type is the type of a (non local) integer variable
+ \param type : expression type
+ \return true if type is the type of a bounded integer variable or array
+ */
+static inline bool is_intvar(enum tchecker::expression_type_t type)
+{
+  return (type == tchecker::EXPR_TYPE_INTVAR) || (type == tchecker::EXPR_TYPE_INTARRAY);
+}
+
+/*!
+ \brief Convex hull of intervals of variables
+ \param intervals : intervals of variables
+ \param other : intervals of variables
+ \pre intervals and other have the same size, and no interval in intervals or other is empty
+ \post every interval in intervals has been set to the smallest interval that contains it and the
+ interval of the same variable in other
+ */
+static void join(tchecker::intvars_intervals_t & intervals, tchecker::intvars_intervals_t const & other)
+{
+  assert(intervals.size() == other.size());
+  for (tchecker::intvar_id_t id = 0; id < intervals.size(); ++id)
+    intervals[id] = {std::min(intervals[id].first, other[id].first), std::max(intervals[id].second, other[id].second)};
+}
+
+/*!
+ \class interval_evaluator_t
+ \brief Computes an interval of the values of an expression over intervals of variables
+ */
+class interval_evaluator_t : public tchecker::typed_expression_visitor_t {
+public:
+  /*!
+   \brief Constructor
+   \param intervals : intervals of flat bounded integer variables
+   \note this keeps a reference on intervals
+   */
+  interval_evaluator_t(tchecker::intvars_intervals_t const & intervals) : _intervals(intervals), _value(top_interval) {}
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~interval_evaluator_t() = default;
+
+  /*!
+   \brief Evaluation
+   \param expr : typed expression
+   \return an interval that contains all the values of expr over intervals (empty if expr cannot be
+   evaluated over intervals)
+   */
+  interval_t evaluate(tchecker::typed_expression_t const & expr)
+  {
+    expr.visit(*this);
+    return _value;
+  }
+
+  virtual void visit(tchecker::typed_int_expression_t const & expr) { _value = {expr.value(), expr.value()}; }
+
+  virtual void visit(tchecker::typed_var_expression_t const & expr) { _value = variable(expr); }
+
+  virtual void visit(tchecker::typed_bounded_var_expression_t const & expr) { _value = variable(expr); }
+
+  virtual void visit(tchecker::typed_array_expression_t const & expr)
+  {
+    tchecker::typed_var_expression_t const & var = expr.variable();
+    if (!is_intvar(var.type())) {
+      _value = top_interval;
+      return;
+    }
+    interval_t const offset =
+        intersect(evaluate(expr.offset()), {0, static_cast<std::int64_t>(var.size()) - 1}); // VM fails outside
+    interval_t value = empty_interval;
+    for (std::int64_t k = offset.first; k <= offset.second; ++k) {
+      tchecker::integer_interval_t const & i = _intervals[var.id() + k];
+      value = hull(value, {i.first, i.second});
+    }
+    _value = value;
+  }
+
+  virtual void visit(tchecker::typed_par_expression_t const & expr) { expr.expr().visit(*this); }
+
+  virtual void visit(tchecker::typed_binary_expression_t const & expr)
+  {
+    interval_t const l = evaluate(expr.left_operand());
+    interval_t const r = evaluate(expr.right_operand());
+    if (empty(l) || empty(r)) {
+      _value = empty_interval;
+      return;
+    }
+
+    switch (expr.binary_operator()) {
+    case tchecker::EXPR_OP_LAND:
+      if (l == false_interval || r == false_interval)
+        _value = false_interval;
+      else if (!contains(l, 0) && !contains(r, 0))
+        _value = true_interval;
+      else
+        _value = bool_interval;
+      break;
+    case tchecker::EXPR_OP_LT:
+      _value = compare(l.second < r.first, l.first >= r.second);
+      break;
+    case tchecker::EXPR_OP_LE:
+      _value = compare(l.second <= r.first, l.first > r.second);
+      break;
+    case tchecker::EXPR_OP_EQ:
+      _value = compare(is_point(l) && l == r, empty(intersect(l, r)));
+      break;
+    case tchecker::EXPR_OP_NEQ:
+      _value = compare(empty(intersect(l, r)), is_point(l) && l == r);
+      break;
+    case tchecker::EXPR_OP_GE:
+      _value = compare(l.first >= r.second, l.second < r.first);
+      break;
+    case tchecker::EXPR_OP_GT:
+      _value = compare(l.first > r.second, l.second <= r.first);
+      break;
+    case tchecker::EXPR_OP_MINUS:
+      _value = clamp({sub(l.first, r.second), sub(l.second, r.first)});
+      break;
+    case tchecker::EXPR_OP_PLUS:
+      _value = clamp({add(l.first, r.first), add(l.second, r.second)});
+      break;
+    case tchecker::EXPR_OP_TIMES: {
+      std::int64_t const p[4] = {mul(l.first, r.first), mul(l.first, r.second), mul(l.second, r.first),
+                                 mul(l.second, r.second)};
+      _value = clamp({*std::min_element(p, p + 4), *std::max_element(p, p + 4)});
+      break;
+    }
+    case tchecker::EXPR_OP_DIV:
+      if (contains(r, 0)) // quotient bounded by the absolute value of the dividend
+        _value = clamp({neg(magnitude(l)), magnitude(l)});
+      else {
+        // division is monotone in each operand when the divisor has a constant sign
+        std::int64_t const q[4] = {div(l.first, r.first), div(l.first, r.second), div(l.second, r.first),
+                                   div(l.second, r.second)};
+        _value = clamp({*std::min_element(q, q + 4), *std::max_element(q, q + 4)});
+      }
+      break;
+    case tchecker::EXPR_OP_MOD: {
+      std::int64_t const m = std::min(magnitude(l), magnitude(r) - 1); // |l % r| < |r|
+      if (l.first >= 0)
+        _value = {0, m};
+      else if (l.second <= 0)
+        _value = {-m, 0};
+      else
+        _value = {-m, m};
+      break;
+    }
+    default:
+      _value = top_interval;
+    }
+  }
+
+  virtual void visit(tchecker::typed_unary_expression_t const & expr)
+  {
+    interval_t const i = evaluate(expr.operand());
+    if (empty(i)) {
+      _value = empty_interval;
+      return;
+    }
+    if (expr.unary_operator() == tchecker::EXPR_OP_NEG)
+      _value = clamp({neg(i.second), neg(i.first)});
+    else // EXPR_OP_LNOT
+      _value = compare(i == false_interval, !contains(i, 0));
+  }
+
+  virtual void visit(tchecker::typed_simple_clkconstr_expression_t const &) { _value = bool_interval; }
+
+  virtual void visit(tchecker::typed_diagonal_clkconstr_expression_t const &) { _value = bool_interval; }
+
+  virtual void visit(tchecker::typed_ite_expression_t const & expr)
+  {
+    interval_t const c = evaluate(expr.condition());
+    if (empty(c)) {
+      _value = empty_interval;
+      return;
+    }
+    if (c == false_interval)
+      expr.else_value().visit(*this);
+    else if (!contains(c, 0))
+      expr.then_value().visit(*this);
+    else
+      _value = hull(evaluate(expr.then_value()), evaluate(expr.else_value()));
+  }
+
+private:
+  /*!
+   \brief Interval of a variable
+   \param expr : variable expression
+   \return interval of expr if it is a bounded integer variable, top interval otherwise
+   */
+  interval_t variable(tchecker::typed_var_expression_t const & expr) const
+  {
+    if (!is_intvar(expr.type()))
+      return top_interval;
+    tchecker::integer_interval_t const & i = _intervals[expr.id()];
+    return {i.first, i.second};
+  }
+
+  /*!
+   \brief Membership check
+   \return true if v is in i, false otherwise
+   */
+  static inline bool contains(interval_t const & i, std::int64_t v) { return i.first <= v && v <= i.second; }
+
+  /*!
+   \brief Largest absolute value in an interval
+   */
+  static inline std::int64_t magnitude(interval_t const & i)
+  {
+    return std::max(tchecker::details::abs(i.first), tchecker::details::abs(i.second));
+  }
+
+  /*!
+   \brief Interval of a comparison
+   \param always_true : true if the comparison holds for all values
+   \param always_false : true if the comparison holds for no value
+   \return interval of the comparison
+   */
+  static inline interval_t compare(bool always_true, bool always_false)
+  {
+    return (always_true ? true_interval : (always_false ? false_interval : bool_interval));
+  }
+
+  tchecker::intvars_intervals_t const & _intervals; /*!< Intervals of variables */
+  interval_t _value;                                /*!< Interval of visited expression */
+};
+
+/*!
+ \class interval_narrower_t
+ \brief Narrows intervals of variables to the values where an expression evaluates within an interval
+ (HC4-revise style propagation: forward evaluation then backward projection on each operand)
+ */
+class interval_narrower_t : public tchecker::typed_expression_visitor_t {
+public:
+  /*!
+   \brief Constructor
+   \param intervals : intervals of flat bounded integer variables
+   \note this keeps a reference on intervals
+   */
+  interval_narrower_t(tchecker::intvars_intervals_t & intervals)
+      : _intervals(intervals), _evaluator(intervals), _target(top_interval), _empty(false)
+  {
+  }
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~interval_narrower_t() = default;
+
+  /*!
+   \brief Narrowing
+   \param expr : typed expression
+   \param target : interval
+   \post intervals have been narrowed to a superset of their values where expr evaluates in target
+   \return false if expr cannot evaluate in target over intervals, true otherwise
+   */
+  bool narrow(tchecker::typed_expression_t const & expr, interval_t const & target)
+  {
+    if (_empty)
+      return false;
+    interval_t const value = intersect(_evaluator.evaluate(expr), target);
+    if (empty(value)) {
+      _empty = true;
+      return false;
+    }
+    interval_t const saved_target = _target;
+    _target = value;
+    expr.visit(*this);
+    _target = saved_target;
+    return !_empty;
+  }
+
+  virtual void visit(tchecker::typed_int_expression_t const &) {}
+
+  virtual void visit(tchecker::typed_var_expression_t const & expr) { variable(expr, 0); }
+
+  virtual void visit(tchecker::typed_bounded_var_expression_t const & expr) { variable(expr, 0); }
+
+  virtual void visit(tchecker::typed_array_expression_t const & expr)
+  {
+    interval_t const offset = _evaluator.evaluate(expr.offset());
+    if (is_point(offset))
+      variable(expr.variable(), offset.first);
+  }
+
+  virtual void visit(tchecker::typed_par_expression_t const & expr) { narrow(expr.expr(), _target); }
+
+  virtual void visit(tchecker::typed_binary_expression_t const & expr)
+  {
+    tchecker::typed_expression_t const & left = expr.left_operand();
+    tchecker::typed_expression_t const & right = expr.right_operand();
+    interval_t const l = _evaluator.evaluate(left);
+    interval_t const r = _evaluator.evaluate(right);
+    enum tchecker::binary_operator_t op = expr.binary_operator();
+
+    if (tchecker::predicate(op)) {
+      if (_target == false_interval)
+        op = negate(op);
+      else if (_target != true_interval)
+        return;
+    }
+
+    switch (op) {
+    case tchecker::EXPR_OP_LAND:
+      if (_target == true_interval) {
+        narrow(left, true_interval);
+        narrow(right, true_interval);
+      }
+      break;
+    case tchecker::EXPR_OP_LT:
+      narrow(left, {top_interval.first, sub(r.second, 1)});
+      narrow(right, {add(l.first, 1), top_interval.second});
+      break;
+    case tchecker::EXPR_OP_LE:
+      narrow(left, {top_interval.first, r.second});
+      narrow(right, {l.first, top_interval.second});
+      break;
+    case tchecker::EXPR_OP_EQ:
+      narrow(left, r);
+      narrow(right, l);
+      break;
+    case tchecker::EXPR_OP_NEQ:
+      if (is_point(r))
+        narrow(left, exclude(l, r.first));
+      if (is_point(l))
+        narrow(right, exclude(r, l.first));
+      break;
+    case tchecker::EXPR_OP_GE:
+      narrow(left, {r.first, top_interval.second});
+      narrow(right, {top_interval.first, l.second});
+      break;
+    case tchecker::EXPR_OP_GT:
+      narrow(left, {add(r.first, 1), top_interval.second});
+      narrow(right, {top_interval.first, sub(l.second, 1)});
+      break;
+    case tchecker::EXPR_OP_MINUS: // left - right in target
+      narrow(left, {add(_target.first, r.first), add(_target.second, r.second)});
+      narrow(right, {sub(l.first, _target.second), sub(l.second, _target.first)});
+      break;
+    case tchecker::EXPR_OP_PLUS: // left + right in target
+      narrow(left, {sub(_target.first, r.second), sub(_target.second, r.first)});
+      narrow(right, {sub(_target.first, l.second), sub(_target.second, l.first)});
+      break;
+    default: // no narrowing for *, / and %
+      break;
+    }
+  }
+
+  virtual void visit(tchecker::typed_unary_expression_t const & expr)
+  {
+    if (expr.unary_operator() == tchecker::EXPR_OP_NEG)
+      narrow(expr.operand(), {neg(_target.second), neg(_target.first)});
+    else if (_target == true_interval) // EXPR_OP_LNOT
+      narrow(expr.operand(), false_interval);
+    else if (_target == false_interval)
+      narrow(expr.operand(), exclude(_evaluator.evaluate(expr.operand()), 0));
+  }
+
+  virtual void visit(tchecker::typed_simple_clkconstr_expression_t const &) {}
+
+  virtual void visit(tchecker::typed_diagonal_clkconstr_expression_t const &) {}
+
+  virtual void visit(tchecker::typed_ite_expression_t const & expr)
+  {
+    interval_t const c = _evaluator.evaluate(expr.condition());
+    if (c == false_interval)
+      narrow(expr.else_value(), _target);
+    else if (c.first > 0 || c.second < 0)
+      narrow(expr.then_value(), _target);
+  }
+
+private:
+  /*!
+   \brief Narrow the interval of a variable to target
+   \param expr : variable expression
+   \param offset : offset in expr
+   \post the interval of the variable at offset in expr has been intersected with target if expr is a
+   bounded integer variable and offset is within its size. Nothing happens otherwise
+   */
+  void variable(tchecker::typed_var_expression_t const & expr, std::int64_t offset)
+  {
+    if (!is_intvar(expr.type()) || offset < 0 || offset >= static_cast<std::int64_t>(expr.size()))
+      return;
+    tchecker::integer_interval_t & i = _intervals[expr.id() + offset];
+    interval_t const narrowed = intersect({i.first, i.second}, _target);
+    if (empty(narrowed)) {
+      _empty = true;
+      return;
+    }
+    i = {static_cast<tchecker::integer_t>(narrowed.first), static_cast<tchecker::integer_t>(narrowed.second)};
+  }
+
+  /*!
+   \brief Negation of a comparison operator
+   \param op : comparison operator
+   \return the operator that holds exactly when op does not hold
+   */
+  static enum tchecker::binary_operator_t negate(enum tchecker::binary_operator_t op)
+  {
+    switch (op) {
+    case tchecker::EXPR_OP_LT:
+      return tchecker::EXPR_OP_GE;
+    case tchecker::EXPR_OP_LE:
+      return tchecker::EXPR_OP_GT;
+    case tchecker::EXPR_OP_EQ:
+      return tchecker::EXPR_OP_NEQ;
+    case tchecker::EXPR_OP_NEQ:
+      return tchecker::EXPR_OP_EQ;
+    case tchecker::EXPR_OP_GE:
+      return tchecker::EXPR_OP_LT;
+    case tchecker::EXPR_OP_GT:
+      return tchecker::EXPR_OP_LE;
+    default:
+      return op;
+    }
+  }
+
+  tchecker::intvars_intervals_t & _intervals;                /*!< Intervals of variables */
+  tchecker::details::interval_evaluator_t _evaluator;         /*!< Evaluator over _intervals */
+  interval_t _target;                                        /*!< Target interval of visited expression */
+  bool _empty;                                               /*!< Flag: no valuation in _intervals */
+};
+
+/*!
+ \class backward_intervals_visitor_t
+ \brief Computes intervals of variables before a statement from intervals after the statement
+ */
+class backward_intervals_visitor_t : public tchecker::typed_statement_visitor_t {
+public:
+  /*!
+   \brief Constructor
+   \param intvars : flat bounded integer variables
+   \param intervals : intervals of intvars
+   \note this keeps references on intvars and intervals
+   */
+  backward_intervals_visitor_t(tchecker::flat_integer_variables_t const & intvars, tchecker::intvars_intervals_t & intervals)
+      : _intvars(intvars), _intervals(intervals), _empty(false)
+  {
+  }
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~backward_intervals_visitor_t() = default;
+
+  /*!
+   \brief Accessor
+   \return true if no valuation leads to intervals
+   */
+  inline bool empty() const { return _empty; }
+
+  /*!
+   \brief Visitor
+   \post the intervals of the variables that may be assigned by stmt have been set to their domain,
+   then narrowed to the values where the right-hand side of stmt evaluates within the interval of the
+   assigned variable after stmt
+   */
+  virtual void visit(tchecker::typed_assign_statement_t const & stmt)
+  {
+    tchecker::typed_lvalue_expression_t const & lvalue = stmt.lvalue();
+    if ((lvalue.type() != tchecker::EXPR_TYPE_INTVAR) && (lvalue.type() != tchecker::EXPR_TYPE_INTLVALUE))
+      return; // local variable
+
+    tchecker::range_t<tchecker::variable_id_t> ids = tchecker::extract_lvalue_variable_ids(lvalue);
+    interval_t assigned = empty_interval;
+    for (tchecker::intvar_id_t id = ids.begin(); id != ids.end(); ++id) {
+      assigned = hull(assigned, {_intervals[id].first, _intervals[id].second});
+      _intervals[id] = domain(_intvars, id);
+    }
+
+    tchecker::details::interval_narrower_t narrower(_intervals);
+    if (!narrower.narrow(stmt.rvalue(), assigned))
+      _empty = true;
+  }
+
+  virtual void visit(tchecker::typed_int_to_clock_assign_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_clock_to_clock_assign_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_sum_to_clock_assign_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_nop_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_sequence_statement_t const & stmt)
+  {
+    stmt.second().visit(*this);
+    if (!_empty)
+      stmt.first().visit(*this);
+  }
+
+  /*!
+   \brief Visitor
+   \post intervals is the hull of the intervals before each branch that satisfy the condition of
+   the branch
+   */
+  virtual void visit(tchecker::typed_if_statement_t const & stmt)
+  {
+    tchecker::intvars_intervals_t then_intervals{_intervals};
+    bool const then_empty = !tchecker::backward_intervals(stmt.then_stmt(), _intvars, then_intervals) ||
+                            !tchecker::constrain_intervals(stmt.condition(), then_intervals);
+
+    tchecker::intvars_intervals_t else_intervals{_intervals};
+    tchecker::details::interval_narrower_t narrower(else_intervals);
+    bool const else_empty = !tchecker::backward_intervals(stmt.else_stmt(), _intvars, else_intervals) ||
+                            !narrower.narrow(stmt.condition(), false_interval);
+
+    if (then_empty && else_empty)
+      _empty = true;
+    else if (then_empty)
+      _intervals = else_intervals;
+    else if (else_empty)
+      _intervals = then_intervals;
+    else {
+      _intervals = then_intervals;
+      join(_intervals, else_intervals);
+    }
+  }
+
+  /*!
+   \brief Visitor
+   \post the condition of stmt does not hold on intervals, and the intervals of the variables
+   that may be written by the body of stmt have been set to their domain
+   */
+  virtual void visit(tchecker::typed_while_statement_t const & stmt)
+  {
+    tchecker::details::interval_narrower_t narrower(_intervals);
+    if (!narrower.narrow(stmt.condition(), false_interval)) {
+      _empty = true;
+      return;
+    }
+
+    std::unordered_set<tchecker::clock_id_t> clocks;
+    std::unordered_set<tchecker::intvar_id_t> intvars;
+    tchecker::extract_written_variables(stmt.statement(), clocks, intvars);
+    for (tchecker::intvar_id_t id : intvars)
+      _intervals[id] = domain(_intvars, id);
+  }
+
+  virtual void visit(tchecker::typed_local_var_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_local_array_statement_t const &) {}
+
+private:
+  tchecker::flat_integer_variables_t const & _intvars; /*!< Flat bounded integer variables */
+  tchecker::intvars_intervals_t & _intervals;          /*!< Intervals of variables */
+  bool _empty;                                         /*!< Flag: no valuation leads to _intervals */
+};
+
+/*!
+ \class forward_intervals_visitor_t
+ \brief Computes intervals of variables after a statement from intervals before the statement
+ */
+class forward_intervals_visitor_t : public tchecker::typed_statement_visitor_t {
+public:
+  /*!
+   \brief Constructor
+   \param intvars : flat bounded integer variables
+   \param intervals : intervals of intvars
+   \note this keeps references on intvars and intervals
+   */
+  forward_intervals_visitor_t(tchecker::flat_integer_variables_t const & intvars, tchecker::intvars_intervals_t & intervals)
+      : _intvars(intvars), _intervals(intervals), _empty(false)
+  {
+  }
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~forward_intervals_visitor_t() = default;
+
+  /*!
+   \brief Accessor
+   \return true if stmt cannot be applied to any valuation in intervals
+   */
+  inline bool empty() const { return _empty; }
+
+  /*!
+   \brief Visitor
+   \post the interval of the variable assigned by stmt has been set to the interval of the
+   right-hand side of stmt, within the domain of the variable (the VM fails outside of the domain).
+   If the assigned cell of an array is not known statically, the interval of each cell that may be
+   assigned has been extended with the value of the right-hand side
+   */
+  virtual void visit(tchecker::typed_assign_statement_t const & stmt)
+  {
+    tchecker::typed_lvalue_expression_t const & lvalue = stmt.lvalue();
+    if ((lvalue.type() != tchecker::EXPR_TYPE_INTVAR) && (lvalue.type() != tchecker::EXPR_TYPE_INTLVALUE))
+      return; // local variable
+
+    tchecker::details::interval_evaluator_t evaluator(_intervals);
+    interval_t const value = evaluator.evaluate(stmt.rvalue());
+    tchecker::range_t<tchecker::variable_id_t> ids = tchecker::extract_lvalue_variable_ids(lvalue);
+    bool const single = (ids.begin() + 1 == ids.end());
+
+    bool assigned = false;
+    for (tchecker::intvar_id_t id = ids.begin(); id != ids.end(); ++id) {
+      tchecker::integer_interval_t const d = domain(_intvars, id);
+      interval_t const v = intersect(value, {d.first, d.second});
+      if (tchecker::details::empty(v))
+        continue;
+      assigned = true;
+      tchecker::integer_interval_t & i = _intervals[id];
+      interval_t const j = (single ? v : hull({i.first, i.second}, v));
+      i = {static_cast<tchecker::integer_t>(j.first), static_cast<tchecker::integer_t>(j.second)};
+    }
+    if (!assigned)
+      _empty = true;
+  }
+
+  virtual void visit(tchecker::typed_int_to_clock_assign_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_clock_to_clock_assign_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_sum_to_clock_assign_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_nop_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_sequence_statement_t const & stmt)
+  {
+    stmt.first().visit(*this);
+    if (!_empty)
+      stmt.second().visit(*this);
+  }
+
+  /*!
+   \brief Visitor
+   \post intervals is the hull of the intervals after each branch, applied to the intervals that
+   satisfy the condition of the branch
+   */
+  virtual void visit(tchecker::typed_if_statement_t const & stmt)
+  {
+    tchecker::intvars_intervals_t then_intervals{_intervals};
+    bool const then_empty = !tchecker::constrain_intervals(stmt.condition(), then_intervals) ||
+                            !tchecker::forward_intervals(stmt.then_stmt(), _intvars, then_intervals);
+
+    tchecker::intvars_intervals_t else_intervals{_intervals};
+    tchecker::details::interval_narrower_t narrower(else_intervals);
+    bool const else_empty = !narrower.narrow(stmt.condition(), false_interval) ||
+                            !tchecker::forward_intervals(stmt.else_stmt(), _intvars, else_intervals);
+
+    if (then_empty && else_empty)
+      _empty = true;
+    else if (then_empty)
+      _intervals = else_intervals;
+    else if (else_empty)
+      _intervals = then_intervals;
+    else {
+      _intervals = then_intervals;
+      join(_intervals, else_intervals);
+    }
+  }
+
+  /*!
+   \brief Visitor
+   \post the intervals of the variables that may be written by the body of stmt have been set to
+   their domain, then intervals have been narrowed to the valuations where the condition of stmt
+   does not hold
+   */
+  virtual void visit(tchecker::typed_while_statement_t const & stmt)
+  {
+    std::unordered_set<tchecker::clock_id_t> clocks;
+    std::unordered_set<tchecker::intvar_id_t> intvars;
+    tchecker::extract_written_variables(stmt.statement(), clocks, intvars);
+    for (tchecker::intvar_id_t id : intvars)
+      _intervals[id] = domain(_intvars, id);
+
+    tchecker::details::interval_narrower_t narrower(_intervals);
+    if (!narrower.narrow(stmt.condition(), false_interval))
+      _empty = true;
+  }
+
+  virtual void visit(tchecker::typed_local_var_statement_t const &) {}
+
+  virtual void visit(tchecker::typed_local_array_statement_t const &) {}
+
+private:
+  tchecker::flat_integer_variables_t const & _intvars; /*!< Flat bounded integer variables */
+  tchecker::intvars_intervals_t & _intervals;          /*!< Intervals of variables */
+  bool _empty;                                         /*!< Flag: stmt cannot be applied to _intervals */
+};
+
+} // end of namespace details
+
+/* constrain_intervals */
+
+bool constrain_intervals(tchecker::typed_expression_t const & expr, tchecker::intvars_intervals_t & intervals)
+{
+  tchecker::details::interval_narrower_t narrower(intervals);
+  return narrower.narrow(expr, tchecker::details::true_interval);
+}
+
+/* backward_intervals */
+
+bool backward_intervals(tchecker::typed_statement_t const & stmt, tchecker::flat_integer_variables_t const & intvars,
+                        tchecker::intvars_intervals_t & intervals)
+{
+  assert(intervals.size() == intvars.size());
+  tchecker::details::backward_intervals_visitor_t v(intvars, intervals);
+  stmt.visit(v);
+  return !v.empty();
+}
+
+/* forward_intervals */
+
+bool forward_intervals(tchecker::typed_statement_t const & stmt, tchecker::flat_integer_variables_t const & intvars,
+                       tchecker::intvars_intervals_t & intervals)
+{
+  assert(intervals.size() == intvars.size());
+  tchecker::details::forward_intervals_visitor_t v(intvars, intervals);
+  stmt.visit(v);
+  return !v.empty();
+}
+
+} // end of namespace tchecker
@@ -97,7 +97,7 @@ boost::dynamic_bitset<> final_iterator_t::locations_labels(value_type_t const &
 void final_iterator_t::advance_while_not_final()
 {
   while (_it != tchecker::past_the_end_iterator) {
-    if (_final_labels <= locations_labels(*_it))
+    if (_final_labels.is_subset_of(locations_labels(*_it)))
       break;
     ++_it;
   };
@@ -0,0 +1,74 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include "tchecker/ta/discrete_table.hh"
+
+namespace tchecker {
+
+namespace ta {
+
+discrete_table_t::discrete_table_t(std::size_t processes_count, std::size_t intvars_count, std::size_t table_size)
+    : _processes_count(processes_count), _table(processes_count + intvars_count, table_size),
+      _buffer(processes_count + intvars_count)
+{
+}
+
+std::tuple<bool, tchecker::ta::discrete_table_t::index_t> discrete_table_t::insert(tchecker::vloc_t const & vloc,
+                                                                                   tchecker::intval_t const & intval)
+{
+  if (vloc.size() != _processes_count || intval.size() != intvars_count())
+    throw std::invalid_argument("tchecker::ta::discrete_table_t: size mismatch");
+
+  for (std::size_t pid = 0; pid < _processes_count; ++pid)
+    _buffer[pid] = vloc[pid];
+  for (std::size_t id = 0; id < intval.size(); ++id) {
+    if (intval[id] < std::numeric_limits<int32_t>::min() || intval[id] > std::numeric_limits<int32_t>::max())
+      throw std::overflow_error("tchecker::ta::discrete_table_t: integer value does not fit in 32 bits");
+    _buffer[_processes_count + id] = static_cast<uint32_t>(static_cast<int32_t>(intval[id]));
+  }
+
+  return _table.insert(_buffer.data());
+}
+
+void discrete_table_t::get(tchecker::ta::discrete_table_t::index_t index, tchecker::vloc_t & vloc,
+                           tchecker::intval_t & intval) const
+{
+  if (vloc.size() != _processes_count || intval.size() != intvars_count())
+    throw std::invalid_argument("tchecker::ta::discrete_table_t: size mismatch");
+
+  _table.get(index, _buffer.data());
+
+  for (std::size_t pid = 0; pid < _processes_count; ++pid)
+    vloc[pid] = _buffer[pid];
+  for (std::size_t id = 0; id < intval.size(); ++id)
+    intval[id] = static_cast<tchecker::integer_t>(static_cast<int32_t>(_buffer[_processes_count + id]));
+}
+
+tchecker::loc_id_t discrete_table_t::location(tchecker::ta::discrete_table_t::index_t index, tchecker::process_id_t pid) const
+{
+  return _table.get(index, pid);
+}
+
+tchecker::integer_t discrete_table_t::value(tchecker::ta::discrete_table_t::index_t index, tchecker::intvar_id_t id) const
+{
+  return static_cast<tchecker::integer_t>(static_cast<int32_t>(_table.get(index, _processes_count + id)));
+}
+
+std::size_t discrete_table_t::memsize() const
+{
+  return _table.memsize() + _buffer.capacity() * sizeof(tchecker::tree_table_t::value_t);
+}
+
+void discrete_table_t::clear() { _table.clear(); }
+
+} // end of namespace ta
+
+} // end of namespace tchecker
@@ -5,7 +5,12 @@
  *
  */
 
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
 #include "tchecker/expression/static_analysis.hh"
+#include "tchecker/statement/clock_updates.hh"
 #include "tchecker/statement/static_analysis.hh"
 #include "tchecker/system/static_analysis.hh"
 #include "tchecker/ta/static_analysis.hh"
@@ -71,6 +76,135 @@ bool has_shared_clocks(tchecker::ta::system_t const & system)
   return access_map.has_shared_variable(tchecker::VTYPE_CLOCK);
 }
 
+/*!
+ \brief Find the representative of a clock
+ \param parent : union-find forest over clock IDs
+ \param x : clock ID
+ \return representative of the class of x in parent
+ \post paths in parent have been compressed
+ */
+static tchecker::clock_id_t find_class(std::vector<tchecker::clock_id_t> & parent, tchecker::clock_id_t x)
+{
+  while (parent[x] != x) {
+    parent[x] = parent[parent[x]];
+    x = parent[x];
+  }
+  return x;
+}
+
+/*!
+ \brief Merge the classes of two clocks
+ \param parent : union-find forest over clock IDs
+ \param x : clock ID
+ \param y : clock ID
+ \post x and y have the same representative in parent
+ */
+static void merge_classes(std::vector<tchecker::clock_id_t> & parent, tchecker::clock_id_t x, tchecker::clock_id_t y)
+{
+  tchecker::clock_id_t const rx = find_class(parent, x), ry = find_class(parent, y);
+  if (rx < ry)
+    parent[ry] = rx;
+  else
+    parent[rx] = ry;
+}
+
+std::vector<std::size_t> clock_classes(tchecker::ta::system_t const & system)
+{
+  tchecker::clock_id_t const clock_nb = static_cast<tchecker::clock_id_t>(system.clocks_count(tchecker::VK_FLATTENED));
+
+  std::vector<tchecker::clock_id_t> parent(clock_nb);
+  for (tchecker::clock_id_t x = 0; x < clock_nb; ++x)
+    parent[x] = x;
+
+  // Diagonal constraints in location invariants and edge guards
+  std::vector<std::unordered_set<tchecker::clock_id_t>> diagonals;
+  for (tchecker::system::loc_const_shared_ptr_t const & loc : system.locations())
+    tchecker::extract_diagonal_clocks(system.invariant(loc->id()), diagonals);
+  for (tchecker::system::edge_const_shared_ptr_t const & edge : system.edges())
+    tchecker::extract_diagonal_clocks(system.guard(edge->id()), diagonals);
+
+  for (std::unordered_set<tchecker::clock_id_t> const & clocks : diagonals)
+    for (tchecker::clock_id_t x : clocks)
+      merge_classes(parent, *clocks.begin(), x);
+
+  // Clock resets x := y + c in edge statements
+  for (tchecker::system::edge_const_shared_ptr_t const & edge : system.edges()) {
+    tchecker::clock_updates_map_t clock_updates = tchecker::compute_clock_updates(clock_nb, system.statement(edge->id()));
+    for (tchecker::clock_id_t x = 0; x < clock_nb; ++x) {
+      if (clock_updates[x].empty())
+        throw std::runtime_error("Cannot compute clock updates from statement");
+      for (tchecker::clock_update_t const & up : clock_updates[x])
+        if (up.clock_id() != tchecker::REFCLOCK_ID)
+          merge_classes(parent, x, up.clock_id());
+    }
+  }
+
+  // Number classes (the representative of a class is its smallest clock ID)
+  std::vector<std::size_t> classes(clock_nb);
+  std::size_t classes_count = 0;
+  for (tchecker::clock_id_t x = 0; x < clock_nb; ++x) {
+    tchecker::clock_id_t const rx = find_class(parent, x);
+    classes[x] = (rx == x ? classes_count++ : classes[rx]);
+  }
+  return classes;
+}
+
+std::vector<boost::dynamic_bitset<>> active_clocks(tchecker::ta::system_t const & system)
+{
+  std::size_t const clock_nb = system.clocks_count(tchecker::VK_FLATTENED);
+  std::unordered_set<tchecker::clock_id_t> clocks;
+  std::unordered_set<tchecker::intvar_id_t> intvars;
+
+  // Clocks read by location invariants
+  std::vector<boost::dynamic_bitset<>> active(system.locations_count(), boost::dynamic_bitset<>(clock_nb));
+  for (tchecker::system::loc_const_shared_ptr_t const & loc : system.locations()) {
+    clocks.clear();
+    tchecker::extract_variables(system.invariant(loc->id()), clocks, intvars);
+    for (tchecker::clock_id_t x : clocks)
+      active[loc->id()][x] = 1;
+  }
+
+  // Clocks read by edge guards, and clocks read by edge statements for each clock
+  // assigned by the statement
+  std::vector<boost::dynamic_bitset<>> guard_clocks(system.edges_count(), boost::dynamic_bitset<>(clock_nb));
+  std::vector<std::vector<boost::dynamic_bitset<>>> update_clocks(system.edges_count());
+  for (tchecker::system::edge_const_shared_ptr_t const & edge : system.edges()) {
+    clocks.clear();
+    tchecker::extract_variables(system.guard(edge->id()), clocks, intvars);
+    for (tchecker::clock_id_t x : clocks)
+      guard_clocks[edge->id()][x] = 1;
+
+    tchecker::clock_updates_map_t clock_updates = tchecker::compute_clock_updates(clock_nb, system.statement(edge->id()));
+    update_clocks[edge->id()].resize(clock_nb, boost::dynamic_bitset<>(clock_nb));
+    for (tchecker::clock_id_t x = 0; x < clock_nb; ++x) {
+      if (clock_updates[x].empty())
+        throw std::runtime_error("Cannot compute clock updates from statement");
+      for (tchecker::clock_update_t const & up : clock_updates[x])
+        if (up.clock_id() != tchecker::REFCLOCK_ID)
+          update_clocks[edge->id()][x][up.clock_id()] = 1;
+    }
+  }
+
+  // Backward propagation along edges until fixpoint
+  boost::dynamic_bitset<> before(clock_nb);
+  bool updated = true;
+  while (updated) {
+    updated = false;
+    for (tchecker::system::edge_const_shared_ptr_t const & edge : system.edges()) {
+      boost::dynamic_bitset<> const & after = active[edge->tgt()];
+      before = guard_clocks[edge->id()];
+      for (std::size_t x = after.find_first(); x != boost::dynamic_bitset<>::npos; x = after.find_next(x))
+        before |= update_clocks[edge->id()][x];
+      if (!before.is_subset_of(active[edge->src()])) {
+        active[edge->src()] |= before;
+        updated = true;
+      }
+    }
+  }
+
+  return active;
+}
+
 } // end of namespace ta
 
 } // end of namespace tchecker
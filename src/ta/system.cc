@@ -41,6 +41,15 @@ system_t::system_t(tchecker::syncprod::system_t const & system) : tchecker::sync
   compute_from_syncprod_system();
 }
 
+system_t::system_t(tchecker::system::system_t const & system,
+                   std::vector<std::shared_ptr<tchecker::expression_t const>> const & invariants,
+                   std::vector<std::shared_ptr<tchecker::expression_t const>> const & guards,
+                   std::vector<std::shared_ptr<tchecker::statement_t const>> const & statements)
+    : tchecker::syncprod::system_t(system)
+{
+  compute_from_expressions(invariants, guards, statements);
+}
+
 system_t::system_t(tchecker::ta::system_t const & system)
     : tchecker::syncprod::system_t(system.as_syncprod_system()), _vm(system._vm)
 {
@@ -112,37 +121,6 @@ tchecker::bytecode_t const * system_t::invariant_bytecode(tchecker::loc_id_t id)
   return _invariants[id]._compiled_expr.get();
 }
 
-void system_t::compute_from_syncprod_system()
-{
-  _invariants.clear();
-  _guards.clear();
-  _statements.clear();
-  _urgent.reset();
-
-  tchecker::loc_id_t const locations_count = this->locations_count();
-  tchecker::edge_id_t const edges_count = this->edges_count();
-
-  _invariants.resize(locations_count);
-  _guards.resize(edges_count);
-  _statements.resize(edges_count);
-  _urgent.resize(locations_count);
-
-  for (tchecker::loc_id_t const id : this->locations_identifiers()) {
-    auto const & attributes = tchecker::syncprod::system_t::location(id)->attributes();
-    set_invariant(id, attributes.range("invariant"));
-    set_urgent(id, attributes.range("urgent"));
-  }
-
-  for (tchecker::edge_id_t const id : this->edges_identifiers()) {
-    auto const & attributes = tchecker::syncprod::system_t::edge(id)->attributes();
-    set_guards(id, attributes.range("provided"));
-    set_statements(id, attributes.range("do"));
-  }
-
-  if (tchecker::ta::has_guarded_weakly_synchronized_event(*this))
-    throw std::invalid_argument("Transitions over weakly synchronized events should not have guards");
-}
-
 static std::shared_ptr<tchecker::expression_t>
 conjunction_from_attributes(tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & attributes,
                             tchecker::integer_variables_t const & localvars, tchecker::integer_variables_t const & intvars,
@@ -182,19 +160,116 @@ conjunction_from_attributes(tchecker::range_t<tchecker::system::attributes_t::co
   return expr;
 }
 
-void system_t::set_invariant(tchecker::loc_id_t id,
-                             tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & invariants)
+static std::shared_ptr<tchecker::statement_t>
+sequence_from_attributes(tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & attributes,
+                         tchecker::integer_variables_t const & localvars, tchecker::integer_variables_t const & intvars,
+                         tchecker::clock_variables_t const & clocks)
+{
+  std::shared_ptr<tchecker::statement_t> stmt{nullptr};
+
+  for (auto && attr : attributes) {
+    // parse
+    std::shared_ptr<tchecker::statement_t> value_stmt{
+        tchecker::parsing::parse_statement(attr.parsing_position().value_position(), attr.value())};
+
+    if (value_stmt.get() == nullptr)
+      return nullptr;
+
+    // type check
+    std::shared_ptr<tchecker::typed_statement_t> typed_value_stmt{
+        tchecker::typecheck(*value_stmt, localvars, intvars, clocks, [&](std::string const & e) {
+          std::cerr << tchecker::log_error << attr.parsing_position().value_position() << " " << e << std::endl;
+        })};
+
+    // aggregate
+    if (stmt.get() != nullptr)
+      stmt = std::make_shared<tchecker::sequence_statement_t>(stmt, value_stmt);
+    else
+      stmt = value_stmt;
+  }
+
+  // empty list of statements
+  if (stmt.get() == nullptr)
+    stmt = std::make_shared<tchecker::nop_statement_t>();
+
+  return stmt;
+}
+
+void system_t::compute_from_syncprod_system()
 {
   tchecker::integer_variables_t localvars;
 
-  std::shared_ptr<tchecker::expression_t> invariant_expr{
-      conjunction_from_attributes(invariants, localvars, integer_variables(), clock_variables())};
-  if (invariant_expr.get() == nullptr)
-    throw std::invalid_argument("Syntax error");
+  std::vector<std::shared_ptr<tchecker::expression_t const>> invariants(this->locations_count());
+  std::vector<std::shared_ptr<tchecker::expression_t const>> guards(this->edges_count());
+  std::vector<std::shared_ptr<tchecker::statement_t const>> statements(this->edges_count());
+
+  for (tchecker::loc_id_t const id : this->locations_identifiers()) {
+    auto const & attributes = tchecker::syncprod::system_t::location(id)->attributes();
+    invariants[id] = conjunction_from_attributes(attributes.range("invariant"), localvars, integer_variables(),
+                                                 clock_variables());
+    if (invariants[id].get() == nullptr)
+      throw std::invalid_argument("Syntax error");
+  }
+
+  for (tchecker::edge_id_t const id : this->edges_identifiers()) {
+    auto const & attributes = tchecker::syncprod::system_t::edge(id)->attributes();
+    guards[id] = conjunction_from_attributes(attributes.range("provided"), localvars, integer_variables(), clock_variables());
+    if (guards[id].get() == nullptr)
+      throw std::invalid_argument("Syntax error");
+    statements[id] = sequence_from_attributes(attributes.range("do"), localvars, integer_variables(), clock_variables());
+    if (statements[id].get() == nullptr)
+      throw std::invalid_argument("Syntax error");
+  }
+
+  compute_from_expressions(invariants, guards, statements);
+}
+
+void system_t::compute_from_expressions(std::vector<std::shared_ptr<tchecker::expression_t const>> const & invariants,
+                                        std::vector<std::shared_ptr<tchecker::expression_t const>> const & guards,
+                                        std::vector<std::shared_ptr<tchecker::statement_t const>> const & statements)
+{
+  _invariants.clear();
+  _guards.clear();
+  _statements.clear();
+  _urgent.reset();
+
+  tchecker::loc_id_t const locations_count = this->locations_count();
+  tchecker::edge_id_t const edges_count = this->edges_count();
+
+  if (invariants.size() != locations_count || guards.size() != edges_count || statements.size() != edges_count)
+    throw std::invalid_argument("Invariants, guards and statements do not match locations and edges");
+
+  _invariants.resize(locations_count);
+  _guards.resize(edges_count);
+  _statements.resize(edges_count);
+  _urgent.resize(locations_count);
+
+  for (tchecker::loc_id_t const id : this->locations_identifiers()) {
+    if (invariants[id].get() == nullptr)
+      throw std::invalid_argument("Missing invariant");
+    set_invariant(id, *invariants[id]);
+    set_urgent(id, tchecker::syncprod::system_t::location(id)->attributes().range("urgent"));
+  }
+
+  for (tchecker::edge_id_t const id : this->edges_identifiers()) {
+    if (guards[id].get() == nullptr || statements[id].get() == nullptr)
+      throw std::invalid_argument("Missing guard or statement");
+    set_guard(id, *guards[id]);
+    set_statement(id, *statements[id]);
+  }
+
+  if (tchecker::ta::has_guarded_weakly_synchronized_event(*this))
+    throw std::invalid_argument("Transitions over weakly synchronized events should not have guards");
+}
+
+void system_t::set_invariant(tchecker::loc_id_t id, tchecker::expression_t const & invariant)
+{
+  tchecker::integer_variables_t localvars;
 
   std::shared_ptr<tchecker::typed_expression_t> invariant_typed_expr{
-      tchecker::typecheck(*invariant_expr, localvars, integer_variables(), clock_variables())};
-  assert(tchecker::bool_valued(invariant_typed_expr->type()));
+      tchecker::typecheck(invariant, localvars, integer_variables(), clock_variables())};
+  if (!tchecker::bool_valued(invariant_typed_expr->type()))
+    throw std::invalid_argument("Invariant is not bool valued");
 
   try {
     std::shared_ptr<tchecker::bytecode_t> invariant_bytecode{tchecker::compile(*invariant_typed_expr),
@@ -215,19 +290,14 @@ void system_t::set_urgent(tchecker::loc_id_t id,
     _urgent[id] = 1;
 }
 
-void system_t::set_guards(tchecker::edge_id_t id,
-                          tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & guards)
+void system_t::set_guard(tchecker::edge_id_t id, tchecker::expression_t const & guard)
 {
   tchecker::integer_variables_t localvars;
 
-  std::shared_ptr<tchecker::expression_t> guard_expr{
-      conjunction_from_attributes(guards, localvars, integer_variables(), clock_variables())};
-  if (guard_expr.get() == nullptr)
-    throw std::invalid_argument("Syntax error");
-
   std::shared_ptr<tchecker::typed_expression_t> guard_typed_expr{
-      tchecker::typecheck(*guard_expr, localvars, integer_variables(), clock_variables())};
-  assert(tchecker::bool_valued(guard_typed_expr->type()));
+      tchecker::typecheck(guard, localvars, integer_variables(), clock_variables())};
+  if (!tchecker::bool_valued(guard_typed_expr->type()))
+    throw std::invalid_argument("Guard is not bool valued");
 
   try {
     std::shared_ptr<tchecker::bytecode_t> guard_bytecode{tchecker::compile(*guard_typed_expr),
@@ -241,53 +311,12 @@ void system_t::set_guards(tchecker::edge_id_t id,
   }
 }
 
-static std::shared_ptr<tchecker::statement_t>
-sequence_from_attributes(tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & attributes,
-                         tchecker::integer_variables_t const & localvars, tchecker::integer_variables_t const & intvars,
-                         tchecker::clock_variables_t const & clocks)
-{
-  std::shared_ptr<tchecker::statement_t> stmt{nullptr};
-
-  for (auto && attr : attributes) {
-    // parse
-    std::shared_ptr<tchecker::statement_t> value_stmt{
-        tchecker::parsing::parse_statement(attr.parsing_position().value_position(), attr.value())};
-
-    if (value_stmt.get() == nullptr)
-      return nullptr;
-
-    // type check
-    std::shared_ptr<tchecker::typed_statement_t> typed_value_stmt{
-        tchecker::typecheck(*value_stmt, localvars, intvars, clocks, [&](std::string const & e) {
-          std::cerr << tchecker::log_error << attr.parsing_position().value_position() << " " << e << std::endl;
-        })};
-
-    // aggregate
-    if (stmt.get() != nullptr)
-      stmt = std::make_shared<tchecker::sequence_statement_t>(stmt, value_stmt);
-    else
-      stmt = value_stmt;
-  }
-
-  // empty list of statements
-  if (stmt.get() == nullptr)
-    stmt = std::make_shared<tchecker::nop_statement_t>();
-
-  return stmt;
-}
-
-void system_t::set_statements(tchecker::edge_id_t id,
-                              tchecker::range_t<tchecker::system::attributes_t::const_iterator_t> const & statements)
+void system_t::set_statement(tchecker::edge_id_t id, tchecker::statement_t const & statement)
 {
   tchecker::integer_variables_t localvars;
 
-  std::shared_ptr<tchecker::statement_t> stmt{
-      sequence_from_attributes(statements, localvars, integer_variables(), clock_variables())};
-  if (stmt.get() == nullptr)
-    throw std::invalid_argument("Syntax error");
-
   std::shared_ptr<tchecker::typed_statement_t> typed_stmt{
-      tchecker::typecheck(*stmt, localvars, integer_variables(), clock_variables(),
+      tchecker::typecheck(statement, localvars, integer_variables(), clock_variables(),
                           [](std::string const & e) { std::cerr << tchecker::log_error << e << std::endl; })};
 
   try {
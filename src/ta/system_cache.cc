@@ -0,0 +1,754 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <unistd.h>
+
+#include "tchecker/expression/expression.hh"
+#include "tchecker/parsing/parsing.hh"
+#include "tchecker/statement/statement.hh"
+#include "tchecker/ta/system_cache.hh"
+#include "tchecker/utils/log.hh"
+
+namespace tchecker {
+
+namespace ta {
+
+static char const header_magic[8] = {'T', 'C', 'K', 'M', 'O', 'D', 'L', '1'}; /*!< Cache header marker */
+static char const end_magic[8] = {'T', 'C', 'K', 'M', 'D', 'E', 'N', 'D'};    /*!< Cache end marker */
+
+static constexpr uint64_t cache_version = 1; /*!< Version of the cache format */
+
+/*!
+ \brief Tags of expressions in cache files
+ */
+enum expression_tag_t : uint64_t {
+  EXPR_TAG_INT,
+  EXPR_TAG_VAR,
+  EXPR_TAG_ARRAY,
+  EXPR_TAG_PAR,
+  EXPR_TAG_UNARY,
+  EXPR_TAG_BINARY,
+  EXPR_TAG_ITE,
+};
+
+/*!
+ \brief Tags of statements in cache files
+ */
+enum statement_tag_t : uint64_t {
+  STMT_TAG_NOP,
+  STMT_TAG_ASSIGN,
+  STMT_TAG_SEQUENCE,
+  STMT_TAG_IF,
+  STMT_TAG_WHILE,
+  STMT_TAG_LOCAL_VAR,
+  STMT_TAG_LOCAL_ARRAY,
+};
+
+std::string model_cache_key(std::string const & model)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL; // FNV-1a offset basis
+  for (char c : model) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ULL; // FNV-1a prime
+  }
+
+  char hex[17];
+  std::snprintf(hex, sizeof(hex), "%016" PRIx64, hash);
+  return std::string{hex} + "-" + std::to_string(model.size());
+}
+
+namespace details {
+
+/*!
+ \class cache_writer_t
+ \brief Writer of cache files
+ */
+class cache_writer_t {
+public:
+  /*!
+   \brief Constructor
+   \param os : output stream
+   */
+  explicit cache_writer_t(std::ostream & os) : _os(os) {}
+
+  /*!
+   \brief Write raw bytes
+   \param p : pointer to bytes
+   \param size : number of bytes
+   \post size bytes from p have been written to the output stream
+   \throw std::runtime_error : if writing fails
+   */
+  void write_raw(void const * p, std::size_t size)
+  {
+    _os.write(reinterpret_cast<char const *>(p), static_cast<std::streamsize>(size));
+    if (_os.fail())
+      throw std::runtime_error("Unable to write model cache");
+  }
+
+  /*!
+   \brief Write an unsigned integer
+   \param n : an unsigned integer
+   \post n has been written as a 64-bits unsigned integer
+   */
+  void write(uint64_t n) { write_raw(&n, sizeof(n)); }
+
+  /*!
+   \brief Write an integer
+   \param n : an integer
+   \post n has been written as a 64-bits signed integer
+   */
+  void write_integer(tchecker::integer_t n)
+  {
+    int64_t const m = n;
+    write_raw(&m, sizeof(m));
+  }
+
+  /*!
+   \brief Write a string
+   \param s : a string
+   \post the size of s followed by the characters of s have been written
+   */
+  void write(std::string const & s)
+  {
+    write(static_cast<uint64_t>(s.size()));
+    write_raw(s.data(), s.size());
+  }
+
+  /*!
+   \brief Write attributes
+   \param attributes : attributes
+   \post the number of attributes followed by the key, the value and the
+   parsing positions of each attribute have been written
+   */
+  void write(tchecker::system::attributes_t const & attributes)
+  {
+    auto && range = attributes.range();
+    write(static_cast<uint64_t>(std::distance(range.begin(), range.end())));
+    for (tchecker::system::attr_t const & attr : range) {
+      write(attr.key());
+      write(attr.value());
+      write(attr.parsing_position().key_position());
+      write(attr.parsing_position().value_position());
+    }
+  }
+
+private:
+  std::ostream & _os; /*!< Output stream */
+};
+
+/*!
+ \class expression_writer_t
+ \brief Expression visitor that writes expressions to cache files
+ \note typed expressions are written as the untyped expressions they have been
+ built from
+ */
+class expression_writer_t : public tchecker::expression_visitor_t {
+public:
+  /*!
+   \brief Constructor
+   \param writer : cache writer
+   */
+  explicit expression_writer_t(tchecker::ta::details::cache_writer_t & writer) : _writer(writer) {}
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~expression_writer_t() = default;
+
+  /*!
+   \brief Visitors
+   \post the visited expression has been written
+   */
+  virtual void visit(tchecker::int_expression_t const & expr)
+  {
+    _writer.write(EXPR_TAG_INT);
+    _writer.write_integer(expr.value());
+  }
+
+  virtual void visit(tchecker::var_expression_t const & expr)
+  {
+    _writer.write(EXPR_TAG_VAR);
+    _writer.write(expr.name());
+  }
+
+  virtual void visit(tchecker::array_expression_t const & expr)
+  {
+    _writer.write(EXPR_TAG_ARRAY);
+    _writer.write(expr.variable().name());
+    expr.offset().visit(*this);
+  }
+
+  virtual void visit(tchecker::par_expression_t const & expr)
+  {
+    _writer.write(EXPR_TAG_PAR);
+    expr.expr().visit(*this);
+  }
+
+  virtual void visit(tchecker::unary_expression_t const & expr)
+  {
+    _writer.write(EXPR_TAG_UNARY);
+    _writer.write(static_cast<uint64_t>(expr.unary_operator()));
+    expr.operand().visit(*this);
+  }
+
+  virtual void visit(tchecker::binary_expression_t const & expr)
+  {
+    _writer.write(EXPR_TAG_BINARY);
+    _writer.write(static_cast<uint64_t>(expr.binary_operator()));
+    expr.left_operand().visit(*this);
+    expr.right_operand().visit(*this);
+  }
+
+  virtual void visit(tchecker::ite_expression_t const & expr)
+  {
+    _writer.write(EXPR_TAG_ITE);
+    expr.condition().visit(*this);
+    expr.then_value().visit(*this);
+    expr.else_value().visit(*this);
+  }
+
+private:
+  tchecker::ta::details::cache_writer_t & _writer; /*!< Cache writer */
+};
+
+/*!
+ \class statement_writer_t
+ \brief Statement visitor that writes statements to cache files
+ \note typed statements are written as the untyped statements they have been
+ built from
+ */
+class statement_writer_t : public tchecker::statement_visitor_t {
+public:
+  /*!
+   \brief Constructor
+   \param writer : cache writer
+   */
+  explicit statement_writer_t(tchecker::ta::details::cache_writer_t & writer) : _writer(writer), _expression_writer(writer) {}
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~statement_writer_t() = default;
+
+  /*!
+   \brief Visitors
+   \post the visited statement has been written
+   */
+  virtual void visit(tchecker::nop_statement_t const &) { _writer.write(STMT_TAG_NOP); }
+
+  virtual void visit(tchecker::assign_statement_t const & stmt)
+  {
+    _writer.write(STMT_TAG_ASSIGN);
+    static_cast<tchecker::expression_t const &>(stmt.lvalue()).visit(_expression_writer);
+    stmt.rvalue().visit(_expression_writer);
+  }
+
+  virtual void visit(tchecker::sequence_statement_t const & stmt)
+  {
+    _writer.write(STMT_TAG_SEQUENCE);
+    stmt.first().visit(*this);
+    stmt.second().visit(*this);
+  }
+
+  virtual void visit(tchecker::if_statement_t const & stmt)
+  {
+    _writer.write(STMT_TAG_IF);
+    stmt.condition().visit(_expression_writer);
+    stmt.then_stmt().visit(*this);
+    stmt.else_stmt().visit(*this);
+  }
+
+  virtual void visit(tchecker::while_statement_t const & stmt)
+  {
+    _writer.write(STMT_TAG_WHILE);
+    stmt.condition().visit(_expression_writer);
+    stmt.statement().visit(*this);
+  }
+
+  virtual void visit(tchecker::local_var_statement_t const & stmt)
+  {
+    _writer.write(STMT_TAG_LOCAL_VAR);
+    _writer.write(stmt.variable().name());
+    stmt.initial_value().visit(_expression_writer);
+  }
+
+  virtual void visit(tchecker::local_array_statement_t const & stmt)
+  {
+    _writer.write(STMT_TAG_LOCAL_ARRAY);
+    _writer.write(stmt.variable().name());
+    stmt.size().visit(_expression_writer);
+  }
+
+private:
+  tchecker::ta::details::cache_writer_t & _writer;                 /*!< Cache writer */
+  tchecker::ta::details::expression_writer_t _expression_writer; /*!< Writer of expressions */
+};
+
+/*!
+ \class cache_reader_t
+ \brief Reader of cache files
+ */
+class cache_reader_t {
+public:
+  /*!
+   \brief Constructor
+   \param data : contents of a cache file
+   */
+  explicit cache_reader_t(std::string const & data) : _data(data), _offset(0) {}
+
+  /*!
+   \brief Accessor
+   \return true if all bytes have been read, false otherwise
+   */
+  inline bool at_end() const { return _offset == _data.size(); }
+
+  /*!
+   \brief Skip bytes
+   \param size : number of bytes
+   \return pointer to the skipped bytes
+   \throw std::runtime_error : if there are less than size bytes left
+   */
+  char const * skip(std::size_t size)
+  {
+    if (size > _data.size() - _offset)
+      throw std::runtime_error("Truncated model cache");
+    char const * p = _data.data() + _offset;
+    _offset += size;
+    return p;
+  }
+
+  /*!
+   \brief Read an unsigned integer
+   \return the 64-bits unsigned integer at current offset
+   \throw std::runtime_error : if there are less than 8 bytes left
+   */
+  uint64_t read()
+  {
+    uint64_t n;
+    std::memcpy(&n, skip(sizeof(n)), sizeof(n));
+    return n;
+  }
+
+  /*!
+   \brief Read a size
+   \return the 64-bits unsigned integer at current offset
+   \throw std::runtime_error : if there are less than 8 bytes left, or if the
+   size is greater than the size of the cache
+   */
+  std::size_t read_size()
+  {
+    uint64_t const n = read();
+    if (n > _data.size())
+      throw std::runtime_error("Invalid model cache");
+    return static_cast<std::size_t>(n);
+  }
+
+  /*!
+   \brief Read an integer
+   \return the 64-bits signed integer at current offset
+   \throw std::runtime_error : if there are less than 8 bytes left, or if the
+   integer does not fit in tchecker::integer_t
+   */
+  tchecker::integer_t read_integer()
+  {
+    int64_t n;
+    std::memcpy(&n, skip(sizeof(n)), sizeof(n));
+    if (n < std::numeric_limits<tchecker::integer_t>::min() || n > std::numeric_limits<tchecker::integer_t>::max())
+      throw std::runtime_error("Invalid model cache");
+    return static_cast<tchecker::integer_t>(n);
+  }
+
+  /*!
+   \brief Read a string
+   \return the string at current offset
+   \throw std::runtime_error : if the string is truncated
+   */
+  std::string read_string()
+  {
+    std::size_t const length = read_size();
+    return std::string(skip(length), length);
+  }
+
+  /*!
+   \brief Read attributes
+   \return the attributes at current offset
+   \throw std::runtime_error : if the attributes are truncated
+   */
+  tchecker::system::attributes_t read_attributes()
+  {
+    tchecker::system::attributes_t attributes;
+    std::size_t const count = read_size();
+    for (std::size_t i = 0; i < count; ++i) {
+      std::string const key = read_string();
+      std::string const value = read_string();
+      std::string const key_position = read_string();
+      std::string const value_position = read_string();
+      attributes.add_attribute(key, value, tchecker::system::attr_parsing_position_t{key_position, value_position});
+    }
+    return attributes;
+  }
+
+  /*!
+   \brief Read an expression
+   \return the expression at current offset
+   \throw std::runtime_error : if the expression is truncated or invalid
+   */
+  std::shared_ptr<tchecker::expression_t const> read_expression()
+  {
+    switch (read()) {
+    case EXPR_TAG_INT:
+      return std::make_shared<tchecker::int_expression_t>(read_integer());
+    case EXPR_TAG_VAR:
+      return std::make_shared<tchecker::var_expression_t>(read_string());
+    case EXPR_TAG_ARRAY: {
+      auto variable = std::make_shared<tchecker::var_expression_t const>(read_string());
+      return std::make_shared<tchecker::array_expression_t>(variable, read_expression());
+    }
+    case EXPR_TAG_PAR:
+      return std::make_shared<tchecker::par_expression_t>(read_expression());
+    case EXPR_TAG_UNARY: {
+      uint64_t const op = read();
+      if (op > tchecker::EXPR_OP_LNOT)
+        throw std::runtime_error("Invalid model cache");
+      return std::make_shared<tchecker::unary_expression_t>(static_cast<enum tchecker::unary_operator_t>(op),
+                                                            read_expression());
+    }
+    case EXPR_TAG_BINARY: {
+      uint64_t const op = read();
+      if (op > tchecker::EXPR_OP_MOD)
+        throw std::runtime_error("Invalid model cache");
+      auto left = read_expression();
+      return std::make_shared<tchecker::binary_expression_t>(static_cast<enum tchecker::binary_operator_t>(op), left,
+                                                             read_expression());
+    }
+    case EXPR_TAG_ITE: {
+      auto condition = read_expression();
+      auto then_value = read_expression();
+      return std::make_shared<tchecker::ite_expression_t>(condition, then_value, read_expression());
+    }
+    default:
+      throw std::runtime_error("Invalid model cache");
+    }
+  }
+
+  /*!
+   \brief Read a statement
+   \return the statement at current offset
+   \throw std::runtime_error : if the statement is truncated or invalid
+   */
+  std::shared_ptr<tchecker::statement_t const> read_statement()
+  {
+    switch (read()) {
+    case STMT_TAG_NOP:
+      return std::make_shared<tchecker::nop_statement_t>();
+    case STMT_TAG_ASSIGN: {
+      auto lvalue = std::dynamic_pointer_cast<tchecker::lvalue_expression_t const>(read_expression());
+      if (lvalue == nullptr)
+        throw std::runtime_error("Invalid model cache");
+      return std::make_shared<tchecker::assign_statement_t>(lvalue, read_expression());
+    }
+    case STMT_TAG_SEQUENCE: {
+      auto first = read_statement();
+      return std::make_shared<tchecker::sequence_statement_t>(first, read_statement());
+    }
+    case STMT_TAG_IF: {
+      auto condition = read_expression();
+      auto then_stmt = read_statement();
+      return std::make_shared<tchecker::if_statement_t>(condition, then_stmt, read_statement());
+    }
+    case STMT_TAG_WHILE: {
+      auto condition = read_expression();
+      return std::make_shared<tchecker::while_statement_t>(condition, read_statement());
+    }
+    case STMT_TAG_LOCAL_VAR: {
+      auto variable = std::make_shared<tchecker::var_expression_t const>(read_string());
+      return std::make_shared<tchecker::local_var_statement_t>(variable, read_expression());
+    }
+    case STMT_TAG_LOCAL_ARRAY: {
+      auto variable = std::make_shared<tchecker::var_expression_t const>(read_string());
+      return std::make_shared<tchecker::local_array_statement_t>(variable, read_expression());
+    }
+    default:
+      throw std::runtime_error("Invalid model cache");
+    }
+  }
+
+private:
+  std::string const & _data; /*!< Contents of cache file */
+  std::size_t _offset;       /*!< Current offset */
+};
+
+} // end of namespace details
+
+void write_cache(std::ostream & os, tchecker::ta::system_t const & system, std::string const & key)
+{
+  tchecker::ta::details::cache_writer_t writer{os};
+  tchecker::system::system_t const & sys = system.as_system_system();
+
+  writer.write_raw(header_magic, sizeof(header_magic));
+  writer.write(cache_version);
+  writer.write(static_cast<uint64_t>(sizeof(tchecker::integer_t)));
+  writer.write(key);
+
+  writer.write(sys.name());
+  writer.write(sys.attributes());
+
+  writer.write(static_cast<uint64_t>(sys.events_count()));
+  for (tchecker::event_id_t id = 0; id < sys.events_count(); ++id) {
+    writer.write(sys.event_name(id));
+    writer.write(sys.event_attributes(id));
+  }
+
+  tchecker::clock_variables_t const & clocks = sys.clock_variables();
+  writer.write(static_cast<uint64_t>(clocks.size(tchecker::VK_DECLARED)));
+  for (tchecker::clock_id_t id : clocks.identifiers(tchecker::VK_DECLARED)) {
+    writer.write(clocks.name(id));
+    writer.write(static_cast<uint64_t>(clocks.info(id).size()));
+    writer.write(sys.clock_attributes(id));
+  }
+
+  tchecker::integer_variables_t const & intvars = sys.integer_variables();
+  writer.write(static_cast<uint64_t>(intvars.size(tchecker::VK_DECLARED)));
+  for (tchecker::intvar_id_t id : intvars.identifiers(tchecker::VK_DECLARED)) {
+    tchecker::intvar_info_t const & info = intvars.info(id);
+    writer.write(intvars.name(id));
+    writer.write(static_cast<uint64_t>(info.size()));
+    writer.write_integer(info.min());
+    writer.write_integer(info.max());
+    writer.write_integer(info.initial_value());
+    writer.write(sys.intvar_attributes(id));
+  }
+
+  writer.write(static_cast<uint64_t>(sys.processes_count()));
+  for (tchecker::process_id_t pid = 0; pid < sys.processes_count(); ++pid) {
+    writer.write(sys.process_name(pid));
+    writer.write(sys.process_attributes(pid));
+  }
+
+  writer.write(static_cast<uint64_t>(sys.locations_count()));
+  for (tchecker::loc_id_t id = 0; id < sys.locations_count(); ++id) {
+    tchecker::system::loc_const_shared_ptr_t const & loc = sys.location(id);
+    writer.write(static_cast<uint64_t>(loc->pid()));
+    writer.write(loc->name());
+    writer.write(loc->attributes());
+  }
+
+  writer.write(static_cast<uint64_t>(sys.edges_count()));
+  for (tchecker::edge_id_t id = 0; id < sys.edges_count(); ++id) {
+    tchecker::system::edge_const_shared_ptr_t const & edge = sys.edge(id);
+    writer.write(static_cast<uint64_t>(edge->pid()));
+    writer.write(static_cast<uint64_t>(edge->src()));
+    writer.write(static_cast<uint64_t>(edge->tgt()));
+    writer.write(static_cast<uint64_t>(edge->event_id()));
+    writer.write(edge->attributes());
+  }
+
+  writer.write(static_cast<uint64_t>(sys.synchronizations_count()));
+  for (tchecker::system::synchronization_t const & sync : sys.synchronizations()) {
+    writer.write(static_cast<uint64_t>(sync.size()));
+    for (tchecker::system::sync_constraint_t const & constr : sync.synchronization_constraints()) {
+      writer.write(static_cast<uint64_t>(constr.pid()));
+      writer.write(static_cast<uint64_t>(constr.event_id()));
+      writer.write(static_cast<uint64_t>(constr.strength()));
+    }
+    writer.write(sync.attributes());
+  }
+
+  tchecker::ta::details::expression_writer_t expression_writer{writer};
+  for (tchecker::loc_id_t id = 0; id < system.locations_count(); ++id)
+    static_cast<tchecker::expression_t const &>(system.invariant(id)).visit(expression_writer);
+
+  tchecker::ta::details::statement_writer_t statement_writer{writer};
+  for (tchecker::edge_id_t id = 0; id < system.edges_count(); ++id) {
+    static_cast<tchecker::expression_t const &>(system.guard(id)).visit(expression_writer);
+    static_cast<tchecker::statement_t const &>(system.statement(id)).visit(statement_writer);
+  }
+
+  writer.write_raw(end_magic, sizeof(end_magic));
+  os.flush();
+  if (os.fail())
+    throw std::runtime_error("Unable to write model cache");
+}
+
+std::shared_ptr<tchecker::ta::system_t> read_cache(std::istream & is, std::string const & key)
+{
+  std::string const data{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+  if (is.bad())
+    throw std::runtime_error("Unable to read model cache");
+
+  tchecker::ta::details::cache_reader_t reader{data};
+
+  if (std::memcmp(reader.skip(sizeof(header_magic)), header_magic, sizeof(header_magic)) != 0)
+    throw std::runtime_error("Not a model cache");
+  if (reader.read() != cache_version || reader.read() != sizeof(tchecker::integer_t) || reader.read_string() != key)
+    return nullptr;
+
+  try {
+    std::string const name = reader.read_string();
+    tchecker::system::system_t sys{name, reader.read_attributes()};
+
+    std::size_t const events_count = reader.read_size();
+    for (std::size_t id = 0; id < events_count; ++id) {
+      std::string const event_name = reader.read_string();
+      sys.add_event(event_name, reader.read_attributes());
+    }
+
+    std::size_t const clocks_count = reader.read_size();
+    for (std::size_t i = 0; i < clocks_count; ++i) {
+      std::string const clock_name = reader.read_string();
+      std::size_t const size = reader.read_size();
+      sys.add_clock(clock_name, static_cast<tchecker::clock_id_t>(size), reader.read_attributes());
+    }
+
+    std::size_t const intvars_count = reader.read_size();
+    for (std::size_t i = 0; i < intvars_count; ++i) {
+      std::string const intvar_name = reader.read_string();
+      std::size_t const size = reader.read_size();
+      tchecker::integer_t const min = reader.read_integer();
+      tchecker::integer_t const max = reader.read_integer();
+      tchecker::integer_t const initial = reader.read_integer();
+      sys.add_intvar(intvar_name, static_cast<tchecker::intvar_id_t>(size), min, max, initial, reader.read_attributes());
+    }
+
+    std::size_t const processes_count = reader.read_size();
+    for (std::size_t pid = 0; pid < processes_count; ++pid) {
+      std::string const process_name = reader.read_string();
+      sys.add_process(process_name, reader.read_attributes());
+    }
+
+    std::size_t const locations_count = reader.read_size();
+    for (std::size_t id = 0; id < locations_count; ++id) {
+      tchecker::process_id_t const pid = static_cast<tchecker::process_id_t>(reader.read_size());
+      std::string const loc_name = reader.read_string();
+      sys.add_location(pid, loc_name, reader.read_attributes());
+    }
+
+    std::size_t const edges_count = reader.read_size();
+    for (std::size_t id = 0; id < edges_count; ++id) {
+      tchecker::process_id_t const pid = static_cast<tchecker::process_id_t>(reader.read_size());
+      tchecker::loc_id_t const src = static_cast<tchecker::loc_id_t>(reader.read_size());
+      tchecker::loc_id_t const tgt = static_cast<tchecker::loc_id_t>(reader.read_size());
+      tchecker::event_id_t const event_id = static_cast<tchecker::event_id_t>(reader.read_size());
+      sys.add_edge(pid, src, tgt, event_id, reader.read_attributes());
+    }
+
+    std::size_t const syncs_count = reader.read_size();
+    for (std::size_t id = 0; id < syncs_count; ++id) {
+      std::vector<tchecker::system::sync_constraint_t> constraints;
+      std::size_t const size = reader.read_size();
+      for (std::size_t i = 0; i < size; ++i) {
+        tchecker::process_id_t const pid = static_cast<tchecker::process_id_t>(reader.read_size());
+        tchecker::event_id_t const event_id = static_cast<tchecker::event_id_t>(reader.read_size());
+        uint64_t const strength = reader.read();
+        if (strength != tchecker::SYNC_WEAK && strength != tchecker::SYNC_STRONG)
+          throw std::runtime_error("Invalid model cache");
+        constraints.emplace_back(pid, event_id, static_cast<enum tchecker::sync_strength_t>(strength));
+      }
+      sys.add_synchronization(constraints, reader.read_attributes());
+    }
+
+    std::vector<std::shared_ptr<tchecker::expression_t const>> invariants(locations_count);
+    for (std::size_t id = 0; id < locations_count; ++id)
+      invariants[id] = reader.read_expression();
+
+    std::vector<std::shared_ptr<tchecker::expression_t const>> guards(edges_count);
+    std::vector<std::shared_ptr<tchecker::statement_t const>> statements(edges_count);
+    for (std::size_t id = 0; id < edges_count; ++id) {
+      guards[id] = reader.read_expression();
+      statements[id] = reader.read_statement();
+    }
+
+    if (std::memcmp(reader.skip(sizeof(end_magic)), end_magic, sizeof(end_magic)) != 0 || !reader.at_end())
+      throw std::runtime_error("Invalid model cache");
+
+    return std::make_shared<tchecker::ta::system_t>(sys, invariants, guards, statements);
+  }
+  catch (std::invalid_argument const & e) {
+    throw std::runtime_error(std::string{"Invalid model cache: "} + e.what());
+  }
+}
+
+std::shared_ptr<tchecker::ta::system_t const> load_system(std::string const & filename, std::string const & cache_dir)
+{
+  std::string model;
+  if (filename.empty())
+    model.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+  else {
+    std::ifstream ifs{filename, std::ios::in | std::ios::binary};
+    if (!ifs.is_open())
+      throw std::runtime_error("Unable to open model file " + filename);
+    model.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    if (ifs.bad())
+      throw std::runtime_error("Unable to read model file " + filename);
+  }
+
+  std::string const key = tchecker::ta::model_cache_key(model);
+  std::string const cache_file = cache_dir + "/" + key + ".tckm";
+
+  std::ifstream cache{cache_file, std::ios::in | std::ios::binary};
+  if (cache.is_open()) {
+    try {
+      std::shared_ptr<tchecker::ta::system_t const> system{tchecker::ta::read_cache(cache, key)};
+      if (system != nullptr)
+        return system;
+    }
+    catch (std::exception const & e) {
+      std::cerr << tchecker::log_warning << "ignoring model cache " << cache_file << ": " << e.what() << std::endl;
+    }
+  }
+
+  // parse from a copy of the model that has been hashed
+  unsigned int const errors = tchecker::log_error_count();
+  std::FILE * f = ::fmemopen(model.data(), model.size(), "r");
+  if (f == nullptr)
+    throw std::runtime_error("Unable to read model file " + filename);
+  std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{nullptr};
+  try {
+    sysdecl = tchecker::parsing::parse_system_declaration(f, filename);
+  }
+  catch (...) {
+    std::fclose(f);
+    throw;
+  }
+  std::fclose(f);
+  if (sysdecl == nullptr || tchecker::log_error_count() > errors)
+    return nullptr;
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+
+  // write to a temporary file first, as concurrent runs may share the cache
+  std::string const tmp_file = cache_file + ".tmp" + std::to_string(::getpid());
+  try {
+    {
+      std::ofstream ofs{tmp_file, std::ios::out | std::ios::binary | std::ios::trunc};
+      if (!ofs.is_open())
+        throw std::runtime_error("Unable to create " + tmp_file);
+      tchecker::ta::write_cache(ofs, *system, key);
+    }
+    if (std::rename(tmp_file.c_str(), cache_file.c_str()) != 0)
+      throw std::runtime_error("Unable to rename " + tmp_file + " to " + cache_file);
+  }
+  catch (std::exception const & e) {
+    std::remove(tmp_file.c_str());
+    std::cerr << tchecker::log_warning << "model cache not written: " << e.what() << std::endl;
+  }
+
+  return system;
+}
+
+} // end of namespace ta
+
+} // end of namespace tchecker
@@ -5,8 +5,11 @@
  *
  */
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
+#include "tchecker/statement/interval_analysis.hh"
 #include "tchecker/ta/ta.hh"
 
 namespace tchecker {
@@ -48,10 +51,125 @@ tchecker::state_status_t initial(tchecker::ta::system_t const & system, tchecker
   return tchecker::STATE_OK;
 }
 
+/* final_iterator_t */
+
+final_iterator_t::final_iterator_t(tchecker::ta::system_t const & system, tchecker::syncprod::final_range_t const & final_range)
+    : _system(&system), _locs_range(final_range), _locs_it(_locs_range.begin()),
+      _intervals(system.integer_variables().flattened().size()),
+      _valuations_range(tchecker::flat_integer_variables_valuations_iterator_t{}, tchecker::past_the_end_iterator),
+      _valuations_it(_valuations_range.begin())
+{
+  skip_to_valuations();
+}
+
+tchecker::ta::final_iterator_t & final_iterator_t::operator++()
+{
+  assert(!at_end());
+  // Increment valuations iterator if range is not empty, we are done if iterator not at end
+  if (!_valuations_range.empty()) {
+    ++_valuations_it;
+    if (_valuations_it != _valuations_range.end())
+      return *this;
+  }
+  // Increment locations iterator, and move to the next tuple of locations with candidate valuations
+  ++_locs_it;
+  skip_to_valuations();
+  return *this;
+}
+
+void final_iterator_t::skip_to_valuations()
+{
+  while (!at_end() && !reset_valuations())
+    ++_locs_it;
+}
+
+/*!
+ \brief Join intervals of values of variables
+ \param intervals : intervals of variables
+ \param other : intervals of variables
+ \param empty : true if intervals is empty
+ \post intervals has been set to other if empty is true, and to the smallest intervals that contain intervals
+ and other otherwise
+ */
+static void join_intervals(tchecker::intvars_intervals_t & intervals, tchecker::intvars_intervals_t const & other, bool empty)
+{
+  if (empty) {
+    intervals = other;
+    return;
+  }
+  for (tchecker::intvar_id_t id = 0; id < intervals.size(); ++id)
+    intervals[id] = {std::min(intervals[id].first, other[id].first), std::max(intervals[id].second, other[id].second)};
+}
+
+bool final_iterator_t::reset_valuations()
+{
+  auto const & intvars = _system->integer_variables().flattened();
+  tchecker::syncprod::system_t const & sp_system = _system->as_syncprod_system();
+
+  std::vector<tchecker::loc_id_t> locs;
+  for (auto && loc : *_locs_it)
+    locs.push_back(loc->id());
+
+  bool empty = true;
+
+  // initial valuation if locs is an initial tuple of locations
+  if (std::all_of(locs.begin(), locs.end(), [&](tchecker::loc_id_t id) { return sp_system.is_initial_location(id); })) {
+    for (tchecker::intvar_id_t id = 0; id < intvars.size(); ++id)
+      _intervals[id] = {intvars.info(id).initial_value(), intvars.info(id).initial_value()};
+    empty = false;
+  }
+
+  // valuations reached by incoming tuples of edges (vloc is only needed to compute the range)
+  tchecker::shared_vloc_t * vloc = tchecker::shared_vloc_t::allocate_and_construct(static_cast<unsigned int>(locs.size()));
+  std::copy(locs.begin(), locs.end(), vloc->begin());
+  try {
+    tchecker::const_vloc_sptr_t vloc_sptr{vloc};
+    tchecker::intvars_intervals_t intervals(intvars.size());
+    std::vector<tchecker::loc_id_t> src_locs(locs.size());
+    for (auto && sync_edges : tchecker::syncprod::incoming_edges(sp_system, vloc_sptr)) {
+      for (tchecker::intvar_id_t id = 0; id < intvars.size(); ++id)
+        intervals[id] = {intvars.info(id).min(), intvars.info(id).max()};
+
+      std::copy(locs.begin(), locs.end(), src_locs.begin());
+      for (tchecker::system::edge_const_shared_ptr_t const & e : sync_edges.edges)
+        src_locs[e->pid()] = e->src();
+
+      bool reached = std::all_of(src_locs.begin(), src_locs.end(), [&](tchecker::loc_id_t id) {
+        return tchecker::constrain_intervals(_system->invariant(id), intervals);
+      });
+      for (tchecker::system::edge_const_shared_ptr_t const & e : sync_edges.edges)
+        reached = reached && tchecker::constrain_intervals(_system->guard(e->id()), intervals);
+      for (tchecker::system::edge_const_shared_ptr_t const & e : sync_edges.edges)
+        reached = reached && tchecker::forward_intervals(_system->statement(e->id()), intvars, intervals);
+
+      if (reached) {
+        join_intervals(_intervals, intervals, empty);
+        empty = false;
+      }
+    }
+  }
+  catch (...) {
+    tchecker::shared_vloc_t::destruct_and_deallocate(vloc);
+    throw;
+  }
+  tchecker::shared_vloc_t::destruct_and_deallocate(vloc);
+
+  if (empty)
+    return false;
+
+  // final valuations satisfy the invariants of locs
+  for (tchecker::loc_id_t id : locs)
+    if (!tchecker::constrain_intervals(_system->invariant(id), _intervals))
+      return false;
+
+  _valuations_range = tchecker::flat_integer_variables_valuations_range(intvars, _intervals);
+  _valuations_it = _valuations_range.begin();
+  return true;
+}
+
 tchecker::ta::final_range_t final_edges(tchecker::ta::system_t const & system, boost::dynamic_bitset<> const & labels)
 {
-  tchecker::ta::final_iterator_t it{tchecker::syncprod::final_edges(system.as_syncprod_system(), labels),
-                                    tchecker::flat_integer_variables_valuations_range(system.integer_variables().flattened())};
+  tchecker::ta::final_iterator_t it{system, tchecker::syncprod::final_edges(system.as_syncprod_system(), labels)};
   return tchecker::make_range(it, tchecker::past_the_end_iterator);
 }
 
@@ -134,12 +252,79 @@ tchecker::state_status_t next(tchecker::ta::system_t const & system, tchecker::v
   return tchecker::STATE_OK;
 }
 
+/* incoming_edges_iterator_t */
+
+incoming_edges_iterator_t::incoming_edges_iterator_t(tchecker::ta::system_t const & system,
+                                                     tchecker::syncprod::incoming_edges_range_t const & edges_range,
+                                                     tchecker::const_vloc_sptr_t const & vloc,
+                                                     tchecker::const_intval_sptr_t const & intval)
+    : _system(&system), _edges_range(edges_range), _edges_it(_edges_range.begin()), _vloc(vloc), _intval(intval),
+      _intervals(system.integer_variables().flattened().size()),
+      _valuations_range(tchecker::flat_integer_variables_valuations_iterator_t{}, tchecker::past_the_end_iterator),
+      _valuations_it(_valuations_range.begin())
+{
+  skip_to_valuations();
+}
+
+tchecker::ta::incoming_edges_iterator_t & incoming_edges_iterator_t::operator++()
+{
+  assert(!at_end());
+  // Increment valuations iterator if range is not empty, we are done if iterator not at end
+  if (!_valuations_range.empty()) {
+    ++_valuations_it;
+    if (_valuations_it != _valuations_range.end())
+      return *this;
+  }
+  // Increment edges iterator, and move to the next tuple of edges with candidate valuations
+  ++_edges_it;
+  skip_to_valuations();
+  return *this;
+}
+
+void incoming_edges_iterator_t::skip_to_valuations()
+{
+  while (!at_end() && !reset_valuations())
+    ++_edges_it;
+}
+
+bool incoming_edges_iterator_t::reset_valuations()
+{
+  assert(!at_end());
+  auto const & intvars = _system->integer_variables().flattened();
+  for (tchecker::intvar_id_t id = 0; id < intvars.size(); ++id)
+    _intervals[id] = {(*_intval)[id], (*_intval)[id]};
+
+  // statements are applied in the order of the edges: go backward from the last one
+  std::vector<tchecker::system::edge_const_shared_ptr_t> edges;
+  for (tchecker::system::edge_const_shared_ptr_t const & e : (*_edges_it).edges)
+    edges.push_back(e);
+  for (auto it = edges.rbegin(); it != edges.rend(); ++it)
+    if (!tchecker::backward_intervals(_system->statement((*it)->id()), intvars, _intervals))
+      return false;
+
+  // source valuations satisfy the guards and the invariants of source locations
+  for (tchecker::system::edge_const_shared_ptr_t const & e : edges)
+    if (!tchecker::constrain_intervals(_system->guard(e->id()), _intervals))
+      return false;
+
+  std::vector<tchecker::loc_id_t> vloc_src(_vloc->begin(), _vloc->end());
+  for (tchecker::system::edge_const_shared_ptr_t const & e : edges)
+    vloc_src[e->pid()] = e->src();
+  for (tchecker::loc_id_t loc_id : vloc_src)
+    if (!tchecker::constrain_intervals(_system->invariant(loc_id), _intervals))
+      return false;
+
+  _valuations_range = tchecker::flat_integer_variables_valuations_range(intvars, _intervals);
+  _valuations_it = _valuations_range.begin();
+  return true;
+}
+
 tchecker::ta::incoming_edges_range_t incoming_edges(tchecker::ta::system_t const & system,
-                                                    tchecker::const_vloc_sptr_t const & vloc)
+                                                    tchecker::const_vloc_sptr_t const & vloc,
+                                                    tchecker::const_intval_sptr_t const & intval)
 {
-  tchecker::ta::incoming_edges_iterator_t it{
-      tchecker::syncprod::incoming_edges(system.as_syncprod_system(), vloc),
-      tchecker::flat_integer_variables_valuations_range(system.integer_variables().flattened())};
+  tchecker::ta::incoming_edges_iterator_t it{system, tchecker::syncprod::incoming_edges(system.as_syncprod_system(), vloc),
+                                             vloc, intval};
   return tchecker::make_range(it, tchecker::past_the_end_iterator);
 }
 
@@ -219,9 +404,15 @@ tchecker::state_status_t prev(tchecker::ta::system_t const & system, tchecker::v
   std::vector<tchecker::integer_t> intval_src(intval->capacity());
   copy(intval_src, *intval);
 
-  // Apply transition forward to check enabledness and target state
-  tchecker::state_status_t status =
-      tchecker::ta::next(system, vloc, intval, vedge, sync_id, src_invariant, guard, reset, tgt_invariant, sync_edges);
+  // Apply transition forward to check enabledness and target state (a candidate source valuation
+  // that makes the statements fail, e.g. with an out-of-bounds value, is not a predecessor)
+  tchecker::state_status_t status = tchecker::STATE_OK;
+  try {
+    status = tchecker::ta::next(system, vloc, intval, vedge, sync_id, src_invariant, guard, reset, tgt_invariant, sync_edges);
+  }
+  catch (std::out_of_range const &) {
+    status = tchecker::STATE_INTVARS_STATEMENT_FAILED;
+  }
   if (status != tchecker::STATE_OK)
     return status;
 
@@ -432,7 +623,7 @@ void ta_t::final(boost::dynamic_bitset<> const & labels, std::vector<sst_t> & v,
 
 incoming_edges_range_t ta_t::incoming_edges(tchecker::ta::const_state_sptr_t const & s)
 {
-  return tchecker::ta::incoming_edges(*_system, s->vloc_ptr());
+  return tchecker::ta::incoming_edges(*_system, s->vloc_ptr(), s->intval_ptr());
 }
 
 void ta_t::prev(tchecker::ta::const_state_sptr_t const & s, incoming_edges_value_t const & in_edge, std::vector<sst_t> & v,
@@ -0,0 +1,113 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstring>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "tchecker/utils/log.hh"
+#include "tchecker/zg/certificate.hh"
+
+/*!
+ \file tck-cert-dot.cc
+ \brief Conversion of binary graph certificates to the graphviz DOT language
+ */
+
+static struct option long_options[] = {{"output", required_argument, 0, 'o'}, {"help", no_argument, 0, 'h'}, {0, 0, 0, 0}};
+
+static char * const options = (char *)"ho:";
+
+void usage(char * progname)
+{
+  std::cerr << "Usage: " << progname << " [options] file" << std::endl;
+  std::cerr << "   -o file     output file (default: standard output)" << std::endl;
+  std::cerr << "   -h          help" << std::endl;
+  std::cerr << "file is a binary graph certificate output by tck-reach -C graph --format bin" << std::endl;
+}
+
+static bool help = false;
+static std::string output_file = "";
+
+int parse_command_line(int argc, char * argv[])
+{
+  while (true) {
+    int long_option_index = -1;
+    int c = getopt_long(argc, argv, options, long_options, &long_option_index);
+
+    if (c == -1)
+      break;
+
+    if (c == ':')
+      throw std::runtime_error("Missing option parameter");
+    else if (c == '?')
+      throw std::runtime_error("Unknown command-line option");
+    else if (c != 0) {
+      switch (c) {
+      case 'h':
+        help = true;
+        break;
+      case 'o':
+        if (strcmp(optarg, "") == 0)
+          throw std::invalid_argument("Invalid empty output file name");
+        output_file = optarg;
+        break;
+      default:
+        throw std::runtime_error("This should never be executed");
+        break;
+      }
+    }
+    else
+      throw std::runtime_error("This also should never be executed");
+  }
+
+  return optind;
+}
+
+/*!
+ \brief Main function
+*/
+int main(int argc, char * argv[])
+{
+  try {
+    int optindex = parse_command_line(argc, argv);
+
+    if (help) {
+      usage(argv[0]);
+      return EXIT_SUCCESS;
+    }
+
+    if (argc - optindex != 1) {
+      std::cerr << "Expecting exactly one certificate file" << std::endl;
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+    tchecker::zg::certificate::reader_t reader{argv[optindex]};
+
+    std::unique_ptr<std::ofstream> ofs{nullptr};
+    if (output_file != "") {
+      ofs = std::make_unique<std::ofstream>(output_file, std::ios::out);
+      if (!ofs->is_open())
+        throw std::runtime_error("Cannot open output file " + output_file);
+    }
+    std::ostream & os = (ofs != nullptr ? *ofs : std::cout);
+
+    tchecker::zg::certificate::dot_output(os, reader);
+    os.flush();
+    if (!os)
+      throw std::runtime_error("Cannot write output");
+  }
+  catch (std::exception & e) {
+    std::cerr << tchecker::log_error << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
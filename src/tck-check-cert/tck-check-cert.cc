@@ -0,0 +1,219 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstring>
+#include <getopt.h>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tchecker/parsing/parsing.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/log.hh"
+#include "tchecker/zg/certificate.hh"
+#include "tchecker/zg/certificate_checker.hh"
+
+/*!
+ \file tck-check-cert.cc
+ \brief Independent checking of binary certificates of unreachability
+ */
+
+static struct option long_options[] = {{"covering", required_argument, 0, 'c'},
+                                       {"help", no_argument, 0, 'h'},
+                                       {"threads", required_argument, 0, 'j'},
+                                       {"labels", required_argument, 0, 'l'},
+                                       {"block-size", required_argument, 0, 0},
+                                       {"table-size", required_argument, 0, 0},
+                                       {"max-violations", required_argument, 0, 0},
+                                       {0, 0, 0, 0}};
+
+static char const * const options = (char *)"c:hj:l:";
+
+/*!
+ \brief Display usage
+ \param progname : programme name
+ */
+void usage(char * progname)
+{
+  std::cerr << "Usage: " << progname << " [options] model certificate" << std::endl;
+  std::cerr << "   -c covering          covering relation of the certificate:" << std::endl;
+  std::cerr << "          inclusion     zone inclusion (reach and covreach certificates, default)" << std::endl;
+  std::cerr << "          alu           aLU subsumption (aLU-covreach certificates)" << std::endl;
+  std::cerr << "   -h                   help" << std::endl;
+  std::cerr << "   -j n                 number of threads (default: number of hardware threads)" << std::endl;
+  std::cerr << "   -l l1,l2,...         comma-separated list of searched labels" << std::endl;
+  std::cerr << "   --block-size n       size of allocation blocks (default: 10000)" << std::endl;
+  std::cerr << "   --table-size n       size of hash tables (default: 65536)" << std::endl;
+  std::cerr << "   --max-violations n   maximal number of reported violations (default: 10)" << std::endl;
+  std::cerr << "certificate is a binary graph certificate output by tck-reach -C graph --format bin for the labels given"
+            << std::endl;
+  std::cerr << "with option -l. It is valid if every initial state is covered by a node, every successor of a node is"
+            << std::endl;
+  std::cerr << "covered by a node, and no node satisfies the labels. The exit status is 0 if the certificate is valid"
+            << std::endl;
+}
+
+static enum tchecker::zg::certificate::covering_t covering =
+    tchecker::zg::certificate::COVERING_INCLUSION; /*!< Covering relation */
+static bool help = false;                                         /*!< Help flag */
+static std::size_t threads = std::thread::hardware_concurrency(); /*!< Number of threads */
+static std::string labels = "";                                   /*!< Searched labels */
+static std::size_t block_size = 10000;                            /*!< Size of allocated blocks */
+static std::size_t table_size = 65536;                            /*!< Size of hash tables */
+static std::size_t max_violations = 10;                           /*!< Maximal number of reported violations */
+
+/*!
+ \brief Parse command-line arguments
+ \param argc : number of arguments
+ \param argv : array of arguments
+ \pre argv[0] up to argv[argc-1] are valid accesses
+ \post global variables help, covering, threads, labels, block_size, table_size
+ and max_violations have been set from argv
+ */
+int parse_command_line(int argc, char * argv[])
+{
+  while (true) {
+    int long_option_index = -1;
+    int c = getopt_long(argc, argv, options, long_options, &long_option_index);
+
+    if (c == -1)
+      break;
+
+    if (c == ':')
+      throw std::runtime_error("Missing option parameter");
+    else if (c == '?')
+      throw std::runtime_error("Unknown command-line option");
+    else if (c != 0) {
+      switch (c) {
+      case 'c':
+        if (strcmp(optarg, "inclusion") == 0)
+          covering = tchecker::zg::certificate::COVERING_INCLUSION;
+        else if (strcmp(optarg, "alu") == 0)
+          covering = tchecker::zg::certificate::COVERING_ALU;
+        else
+          throw std::runtime_error("Unknown covering relation: " + std::string(optarg));
+        break;
+      case 'h':
+        help = true;
+        break;
+      case 'j': {
+        long long const l = std::strtoll(optarg, nullptr, 10);
+        if (l <= 0)
+          throw std::runtime_error("Invalid number of threads (expecting a positive integer)");
+        threads = static_cast<std::size_t>(l);
+        break;
+      }
+      case 'l':
+        labels = optarg;
+        break;
+      default:
+        throw std::runtime_error("This should never be executed");
+        break;
+      }
+    }
+    else {
+      if (strcmp(long_options[long_option_index].name, "block-size") == 0) {
+        long long int l = std::strtoll(optarg, nullptr, 10);
+        if (l <= 0)
+          throw std::runtime_error("Invalid block size (expecting a positive integer)");
+        block_size = static_cast<std::size_t>(l);
+      }
+      else if (strcmp(long_options[long_option_index].name, "table-size") == 0) {
+        long long int l = std::strtoll(optarg, nullptr, 10);
+        if (l <= 0)
+          throw std::runtime_error("Invalid table size (expecting a positive integer)");
+        table_size = static_cast<std::size_t>(l);
+      }
+      else if (strcmp(long_options[long_option_index].name, "max-violations") == 0) {
+        long long int l = std::strtoll(optarg, nullptr, 10);
+        if (l < 0)
+          throw std::runtime_error("Invalid maximal number of violations (expecting a non-negative integer)");
+        max_violations = static_cast<std::size_t>(l);
+      }
+      else
+        throw std::runtime_error("This also should never be executed");
+    }
+  }
+
+  return optind;
+}
+
+/*!
+ \brief Load a system declaration from a file
+ \param filename : file name
+ \return pointer to a system declaration loaded from filename, nullptr in case of errors
+ \post all errors have been reported to std::cerr
+*/
+std::shared_ptr<tchecker::parsing::system_declaration_t> load_system_declaration(std::string const & filename)
+{
+  std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{nullptr};
+  try {
+    sysdecl = tchecker::parsing::parse_system_declaration(filename);
+    if (sysdecl == nullptr)
+      throw std::runtime_error("nullptr system declaration");
+  }
+  catch (std::exception const & e) {
+    std::cerr << tchecker::log_error << e.what() << std::endl;
+  }
+  return sysdecl;
+}
+
+/*!
+ \brief Main function
+*/
+int main(int argc, char * argv[])
+{
+  try {
+    int optindex = parse_command_line(argc, argv);
+
+    if (help) {
+      usage(argv[0]);
+      return EXIT_SUCCESS;
+    }
+
+    if (argc - optindex != 2) {
+      std::cerr << "Expecting a model and a certificate" << std::endl;
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+    if (threads == 0)
+      threads = 1;
+
+    std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{load_system_declaration(argv[optindex])};
+    if (sysdecl == nullptr || tchecker::log_error_count() > 0)
+      return EXIT_FAILURE;
+
+    std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+
+    tchecker::zg::certificate::reader_t reader{argv[optindex + 1]};
+    tchecker::zg::certificate::check_symbols(reader, *system);
+
+    boost::dynamic_bitset<> const searched_labels = system->as_syncprod_system().labels(labels);
+
+    std::vector<tchecker::zg::certificate::violation_t> violations;
+    tchecker::zg::certificate::check_stats_t stats = tchecker::zg::certificate::check(
+        reader, system, searched_labels, covering, threads, max_violations, block_size, table_size, violations);
+
+    for (tchecker::zg::certificate::violation_t const & violation : violations)
+      std::cout << "VIOLATION " << violation << std::endl;
+
+    std::map<std::string, std::string> m;
+    stats.attributes(m);
+    for (auto && [key, value] : m)
+      std::cout << key << " " << value << std::endl;
+
+    return (stats.valid() ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+  catch (std::exception & e) {
+    std::cerr << tchecker::log_error << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -6,6 +6,7 @@
  */
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <getopt.h>
 #include <iostream>
@@ -13,6 +14,8 @@
 #include <memory>
 #include <string>
 
+#include "tchecker/algorithms/progress.hh"
+#include "tchecker/graph/output.hh"
 #include "tchecker/parsing/parsing.hh"
 #include "tchecker/utils/log.hh"
 #include "zg-couvscc.hh"
@@ -30,6 +33,12 @@ static struct option long_options[] = {{"algorithm", required_argument, 0, 'a'},
                                        {"output", required_argument, 0, 'o'},
                                        {"block-size", required_argument, 0, 0},
                                        {"table-size", required_argument, 0, 0},
+                                       {"progress", required_argument, 0, 0},
+                                       {"progress-file", required_argument, 0, 0},
+                                       {"stream-graph", no_argument, 0, 0},
+                                       {"checkpoint", required_argument, 0, 0},
+                                       {"checkpoint-period", required_argument, 0, 0},
+                                       {"resume", no_argument, 0, 0},
                                        {0, 0, 0, 0}};
 
 static char const * const options = (char *)"a:C:hl:o:";
@@ -56,6 +65,18 @@ void usage(char * progname)
   std::cerr << "   -o out_file   output file for certificate (default is standard output)" << std::endl;
   std::cerr << "   --block-size  size of allocation blocks" << std::endl;
   std::cerr << "   --table-size  size of hash tables" << std::endl;
+  std::cerr << "   --progress period     report progress every period (e.g. 10s, 500ms, 5m) on standard error" << std::endl;
+  std::cerr << "   --progress-file file  write progress reports to file as JSON lines (requires --progress)" << std::endl;
+  std::cerr << "   --stream-graph        output the graph certificate in storage order instead of sorting it in memory"
+            << std::endl;
+  std::cerr << "                         (sort the output with tck-sort-graph to get a deterministic order)" << std::endl;
+  std::cerr << "   --checkpoint file         save the explored graph to file periodically" << std::endl;
+  std::cerr << "   --checkpoint-period sec   time between two checkpoints in seconds (default: 600)" << std::endl;
+  std::cerr << "   --resume                  resume the run saved in the checkpoint file, replaying the search on the saved"
+            << std::endl;
+  std::cerr << "                             graph (RUNNING_TIME_SECONDS covers the resumed part, TOTAL_RUNNING_TIME_SECONDS"
+            << std::endl;
+  std::cerr << "                             all the runs)" << std::endl;
   std::cerr << "reads from standard input if file is not provided" << std::endl;
 }
 
@@ -79,6 +100,12 @@ static std::string output_file = "";                      /*!< Output file name
 static std::ostream * os = &std::cout;                    /*!< Default output stream */
 static std::size_t block_size = 10000;                    /*!< Size of allocated blocks */
 static std::size_t table_size = 65536;                    /*!< Size of hash tables */
+static std::chrono::milliseconds progress_period{0};      /*!< Time between two progress reports (0 means no report) */
+static std::string progress_file = "";                    /*!< Progress file name (empty means standard error) */
+static bool stream_graph = false;                         /*!< Output graph certificate in storage order */
+static std::string checkpoint_file = "";                  /*!< Checkpoint file name (empty means no checkpoint) */
+static std::size_t checkpoint_period = 600;               /*!< Time between two checkpoints (in seconds) */
+static bool resume = false;                               /*!< Resume from checkpoint file */
 
 /*!
  \brief Check if expected certificate is a path
@@ -87,6 +114,25 @@ static std::size_t table_size = 65536;                    /*!< Size of hash tabl
  */
 static bool is_certificate_path(enum certificate_t ctype) { return (ctype == CERTIFICATE_SYMBOLIC); }
 
+/*!
+ \brief Output graph certificate
+ \tparam GRAPH : type of graph
+ \param g : a graph
+ \param name : graph name
+ \param sorted_output : output function that sorts the nodes and edges of g
+ \post g has been output to os in storage order if stream_graph is set, and
+ using sorted_output otherwise
+ */
+template <class GRAPH>
+static void graph_certificate(GRAPH const & g, std::string const & name,
+                              std::ostream & (*sorted_output)(std::ostream &, GRAPH const &, std::string const &))
+{
+  if (stream_graph)
+    tchecker::graph::dot_output_stream(*os, g, name);
+  else
+    sorted_output(*os, g, name);
+}
+
 /*!
  \brief Parse command-line arguments
  \param argc : number of arguments
@@ -147,6 +193,18 @@ int parse_command_line(int argc, char * argv[])
         block_size = std::strtoull(optarg, nullptr, 10);
       else if (strcmp(long_options[long_option_index].name, "table-size") == 0)
         table_size = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "progress") == 0)
+        progress_period = tchecker::algorithms::parse_progress_period(optarg);
+      else if (strcmp(long_options[long_option_index].name, "progress-file") == 0)
+        progress_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "stream-graph") == 0)
+        stream_graph = true;
+      else if (strcmp(long_options[long_option_index].name, "checkpoint") == 0)
+        checkpoint_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "checkpoint-period") == 0)
+        checkpoint_period = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "resume") == 0)
+        resume = true;
       else
         throw std::runtime_error("This also should never be executed");
     }
@@ -185,7 +243,11 @@ std::shared_ptr<tchecker::parsing::system_declaration_t> load_system_declaration
 */
 void ndfs(tchecker::parsing::system_declaration_t const & sysdecl)
 {
-  auto && [stats, state_space] = tchecker::tck_liveness::zg_ndfs::run(sysdecl, labels, block_size, table_size);
+  auto && [stats, state_space] =
+      (checkpoint_file.empty()
+           ? tchecker::tck_liveness::zg_ndfs::run(sysdecl, labels, block_size, table_size)
+           : tchecker::tck_liveness::zg_ndfs::run_checkpoint(sysdecl, labels, checkpoint_file, checkpoint_period, resume,
+                                                             block_size, table_size));
 
   // stats
   std::map<std::string, std::string> m;
@@ -195,7 +257,7 @@ void ndfs(tchecker::parsing::system_declaration_t const & sysdecl)
 
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
-    tchecker::tck_liveness::zg_ndfs::dot_output(*os, state_space->graph(), sysdecl.name());
+    graph_certificate(state_space->graph(), sysdecl.name(), tchecker::tck_liveness::zg_ndfs::dot_output);
   else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.cycle()) {
     std::unique_ptr<tchecker::tck_liveness::zg_ndfs::cex::symbolic_cex_t> cex{
         tchecker::tck_liveness::zg_ndfs::cex::symbolic_counter_example(state_space->graph())};
@@ -220,7 +282,11 @@ void couvscc(tchecker::parsing::system_declaration_t const & sysdecl)
     throw std::runtime_error(
         "*** tck_liveness: cannot compute symbolic counter example with more than 1 label (use graph instead)");
 
-  auto && [stats, state_space] = tchecker::tck_liveness::zg_couvscc::run(sysdecl, labels, block_size, table_size);
+  auto && [stats, state_space] =
+      (checkpoint_file.empty()
+           ? tchecker::tck_liveness::zg_couvscc::run(sysdecl, labels, block_size, table_size)
+           : tchecker::tck_liveness::zg_couvscc::run_checkpoint(sysdecl, labels, checkpoint_file, checkpoint_period, resume,
+                                                                block_size, table_size));
 
   // stats
   std::map<std::string, std::string> m;
@@ -230,7 +296,7 @@ void couvscc(tchecker::parsing::system_declaration_t const & sysdecl)
 
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
-    tchecker::tck_liveness::zg_couvscc::dot_output(*os, state_space->graph(), sysdecl.name());
+    graph_certificate(state_space->graph(), sysdecl.name(), tchecker::tck_liveness::zg_couvscc::dot_output);
   else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.cycle()) {
     std::unique_ptr<tchecker::tck_liveness::zg_couvscc::cex::symbolic_cex_t> cex{
         tchecker::tck_liveness::zg_couvscc::cex::symbolic_counter_example(state_space->graph())};
@@ -259,6 +325,21 @@ int main(int argc, char * argv[])
       return EXIT_SUCCESS;
     }
 
+    if (!progress_file.empty() && progress_period.count() == 0) {
+      std::cerr << "Option --progress-file requires a progress period (option --progress)" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (stream_graph && (certificate != CERTIFICATE_GRAPH)) {
+      std::cerr << "Option --stream-graph requires a graph certificate (option -C graph)" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (resume && checkpoint_file.empty()) {
+      std::cerr << "Option --resume requires a checkpoint file (option --checkpoint)" << std::endl;
+      return EXIT_FAILURE;
+    }
+
     std::string input_file = (optindex == argc ? "" : argv[optindex]);
 
     std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{load_system_declaration(input_file)};
@@ -279,6 +360,24 @@ int main(int argc, char * argv[])
       }
     }
 
+    std::shared_ptr<std::ofstream> progress_os_ptr{nullptr};
+    std::unique_ptr<tchecker::algorithms::progress_reporter_t> progress{nullptr};
+
+    if (progress_period.count() > 0) {
+      if (progress_file.empty())
+        progress = std::make_unique<tchecker::algorithms::progress_reporter_t>(progress_period, std::cerr,
+                                                                               tchecker::algorithms::PROGRESS_TEXT);
+      else {
+        progress_os_ptr = std::make_shared<std::ofstream>(progress_file);
+        if (!progress_os_ptr->is_open()) {
+          std::cerr << tchecker::log_error << "Cannot open progress file " << progress_file << std::endl;
+          return EXIT_FAILURE;
+        }
+        progress = std::make_unique<tchecker::algorithms::progress_reporter_t>(progress_period, *progress_os_ptr,
+                                                                               tchecker::algorithms::PROGRESS_JSON);
+      }
+    }
+
     switch (algorithm) {
     case ALGO_NDFS:
       ndfs(*sysdecl);
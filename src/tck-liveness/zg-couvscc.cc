@@ -5,8 +5,14 @@
  *
  */
 
+#include <chrono>
+#include <functional>
+#include <tuple>
+#include <vector>
+
 #include <boost/dynamic_bitset.hpp>
 
+#include "../tck-reach/checkpoint.hh"
 #include "counter_example.hh"
 #include "tchecker/system/static_analysis.hh"
 #include "tchecker/ta/system.hh"
@@ -179,6 +185,114 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
   return std::make_tuple(stats, state_space);
 }
 
+/*!
+ \brief Add a node to a graph when loading a checkpoint
+ \param g : a graph
+ \param s : a state
+ \return the node of s in g
+ */
+static tchecker::tck_liveness::zg_couvscc::graph_t::node_sptr_t
+checkpoint_add_node(tchecker::tck_liveness::zg_couvscc::graph_t & g, tchecker::zg::state_sptr_t const & s)
+{
+  return std::get<1>(g.add_node(s));
+}
+
+/*!
+ \brief Add an edge to a graph when loading a checkpoint
+ \param g : a graph
+ \param src : source node
+ \param tgt : target node
+ \param t : transition
+ \post an edge from src to tgt with transition t has been added to g
+ */
+static void checkpoint_add_edge(tchecker::tck_liveness::zg_couvscc::graph_t & g,
+                                tchecker::tck_liveness::zg_couvscc::graph_t::node_sptr_t const & src,
+                                tchecker::tck_liveness::zg_couvscc::graph_t::node_sptr_t const & tgt, uint32_t,
+                                tchecker::zg::transition_t const & t)
+{
+  g.add_edge(src, tgt, t);
+}
+
+/*!
+ \brief Run an algorithm with checkpoints
+ \tparam ALGORITHM : type of algorithm
+ \param algorithm : an algorithm
+ \param state_space : a state-space
+ \param labels : accepting labels
+ \param expanded : predicate on the nodes of the graph of state_space that have
+ been expanded by the resumed runs (empty if none)
+ \param checkpoint_file : name of checkpoint file
+ \param checkpoint_period : time between two checkpoints (in seconds)
+ \param stats : statistics
+ \post algorithm has been run on state_space, and the graph of state_space has
+ been saved to checkpoint_file every checkpoint_period seconds
+ */
+template <class ALGORITHM>
+static void run_checkpoint(ALGORITHM & algorithm, tchecker::tck_liveness::zg_couvscc::state_space_t & state_space,
+                           boost::dynamic_bitset<> const & labels, typename ALGORITHM::expanded_t const & expanded,
+                           std::string const & checkpoint_file, std::size_t checkpoint_period,
+                           tchecker::algorithms::couvscc::stats_t & stats)
+{
+  using node_sptr_t = tchecker::tck_liveness::zg_couvscc::graph_t::node_sptr_t;
+
+  typename ALGORITHM::checkpoint_t checkpoint{
+      std::chrono::seconds{checkpoint_period},
+      [&](tchecker::tck_liveness::zg_couvscc::graph_t & g, tchecker::algorithms::couvscc::stats_t const & st) {
+        tchecker::tck_reach::checkpoint::save_dfs(
+            checkpoint_file, tchecker::tck_reach::checkpoint::KIND_COUVSCC, state_space.zg(), g, st,
+            [&](node_sptr_t const & n) { return n->dfsnum() != 0 || (expanded && expanded(n)); });
+      }};
+
+  algorithm.run(state_space.zg(), state_space.graph(), labels, expanded, stats, checkpoint);
+}
+
+std::tuple<tchecker::algorithms::couvscc::stats_t, std::shared_ptr<tchecker::tck_liveness::zg_couvscc::state_space_t>>
+run_checkpoint(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels,
+               std::string const & checkpoint_file, std::size_t checkpoint_period, bool resume, std::size_t block_size,
+               std::size_t table_size)
+{
+  using node_sptr_t = tchecker::tck_liveness::zg_couvscc::graph_t::node_sptr_t;
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+
+  std::shared_ptr<tchecker::tck_liveness::zg_couvscc::state_space_t> state_space =
+      std::make_shared<tchecker::tck_liveness::zg_couvscc::state_space_t>(zg, block_size, table_size);
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  tchecker::algorithms::couvscc::stats_t stats;
+  std::function<bool(node_sptr_t const &)> expanded;
+
+  if (resume) {
+    std::vector<node_sptr_t> deadlocks;
+    tchecker::tck_reach::checkpoint::load_dfs(checkpoint_file, tchecker::tck_reach::checkpoint::KIND_COUVSCC,
+                                              state_space->zg(), state_space->graph(), deadlocks, stats,
+                                              &checkpoint_add_node, &checkpoint_add_edge);
+    expanded = tchecker::tck_reach::checkpoint::expanded_nodes_t<tchecker::tck_liveness::zg_couvscc::graph_t>{
+        state_space->graph(), deadlocks};
+  }
+
+  stats.set_start_time();
+
+  if (accepting_labels.count() > 1) {
+    tchecker::tck_liveness::zg_couvscc::generalized_algorithm_t algorithm;
+    run_checkpoint(algorithm, *state_space, accepting_labels, expanded, checkpoint_file, checkpoint_period, stats);
+  }
+  else {
+    tchecker::tck_liveness::zg_couvscc::single_algorithm_t algorithm;
+    run_checkpoint(algorithm, *state_space, accepting_labels, expanded, checkpoint_file, checkpoint_period, stats);
+  }
+
+  stats.set_end_time();
+
+  return std::make_tuple(stats, state_space);
+}
+
 } // namespace zg_couvscc
 
 } // namespace tck_liveness
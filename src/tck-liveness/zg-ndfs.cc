@@ -5,8 +5,13 @@
  *
  */
 
+#include <chrono>
+#include <tuple>
+#include <vector>
+
 #include <boost/dynamic_bitset.hpp>
 
+#include "../tck-reach/checkpoint.hh"
 #include "counter_example.hh"
 #include "tchecker/system/static_analysis.hh"
 #include "tchecker/ta/system.hh"
@@ -172,6 +177,84 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
   return std::make_tuple(stats, state_space);
 }
 
+/*!
+ \brief Add a node to a graph when loading a checkpoint
+ \param g : a graph
+ \param s : a state
+ \return the node of s in g
+ */
+static tchecker::tck_liveness::zg_ndfs::graph_t::node_sptr_t
+checkpoint_add_node(tchecker::tck_liveness::zg_ndfs::graph_t & g, tchecker::zg::state_sptr_t const & s)
+{
+  return std::get<1>(g.add_node(s));
+}
+
+/*!
+ \brief Add an edge to a graph when loading a checkpoint
+ \param g : a graph
+ \param src : source node
+ \param tgt : target node
+ \param t : transition
+ \post an edge from src to tgt with transition t has been added to g
+ */
+static void checkpoint_add_edge(tchecker::tck_liveness::zg_ndfs::graph_t & g,
+                                tchecker::tck_liveness::zg_ndfs::graph_t::node_sptr_t const & src,
+                                tchecker::tck_liveness::zg_ndfs::graph_t::node_sptr_t const & tgt, uint32_t,
+                                tchecker::zg::transition_t const & t)
+{
+  g.add_edge(src, tgt, t);
+}
+
+std::tuple<tchecker::algorithms::ndfs::stats_t, std::shared_ptr<tchecker::tck_liveness::zg_ndfs::state_space_t>>
+run_checkpoint(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels,
+               std::string const & checkpoint_file, std::size_t checkpoint_period, bool resume, std::size_t block_size,
+               std::size_t table_size)
+{
+  using node_sptr_t = tchecker::tck_liveness::zg_ndfs::graph_t::node_sptr_t;
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+
+  std::shared_ptr<tchecker::tck_liveness::zg_ndfs::state_space_t> state_space =
+      std::make_shared<tchecker::tck_liveness::zg_ndfs::state_space_t>(zg, block_size, table_size);
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  tchecker::algorithms::ndfs::stats_t stats;
+  tchecker::tck_liveness::zg_ndfs::algorithm_t::expanded_t expanded;
+
+  if (resume) {
+    std::vector<node_sptr_t> deadlocks;
+    tchecker::tck_reach::checkpoint::load_dfs(checkpoint_file, tchecker::tck_reach::checkpoint::KIND_NDFS, state_space->zg(),
+                                              state_space->graph(), deadlocks, stats, &checkpoint_add_node,
+                                              &checkpoint_add_edge);
+    expanded = tchecker::tck_reach::checkpoint::expanded_nodes_t<tchecker::tck_liveness::zg_ndfs::graph_t>{
+        state_space->graph(), deadlocks};
+  }
+
+  tchecker::tck_liveness::zg_ndfs::algorithm_t::checkpoint_t checkpoint{
+      std::chrono::seconds{checkpoint_period},
+      [&](tchecker::tck_liveness::zg_ndfs::graph_t & g, tchecker::algorithms::ndfs::stats_t const & st) {
+        tchecker::tck_reach::checkpoint::save_dfs(
+            checkpoint_file, tchecker::tck_reach::checkpoint::KIND_NDFS, state_space->zg(), g, st,
+            [&](node_sptr_t const & n) {
+              return n->color() != tchecker::algorithms::ndfs::WHITE || (expanded && expanded(n));
+            });
+      }};
+
+  tchecker::tck_liveness::zg_ndfs::algorithm_t algorithm;
+
+  stats.set_start_time();
+  algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, expanded, stats, checkpoint);
+  stats.set_end_time();
+
+  return std::make_tuple(stats, state_space);
+}
+
 } // namespace zg_ndfs
 
 } // namespace tck_liveness
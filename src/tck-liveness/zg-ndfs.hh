@@ -257,6 +257,31 @@ std::tuple<tchecker::algorithms::ndfs::stats_t, std::shared_ptr<tchecker::tck_li
 run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels = "", std::size_t block_size = 10000,
     std::size_t table_size = 65536);
 
+/*!
+ \brief Run nested DFS algorithm on the zone graph of a system, with checkpoints
+ \param sysdecl : system declaration
+ \param labels : comma-separated string of labels
+ \param checkpoint_file : name of checkpoint file
+ \param checkpoint_period : time between two checkpoints (in seconds, 0 means no periodic checkpoint)
+ \param resume : resume flag
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \pre labels must appear as node attributes in sysdecl
+ \post if resume is true, the graph saved in checkpoint_file has been loaded, and the run has replayed the search
+ on the loaded graph before continuing it. Otherwise, the run has started from an empty graph. The graph has been
+ saved to checkpoint_file every checkpoint_period seconds
+ \return statistics on the run and the liveness graph
+ \throw std::runtime_error : if clock bounds cannot be computed for the system modeled by sysdecl, or if the
+ checkpoint cannot be read or written
+ \note a resumed run yields the same graph and statistics as an uninterrupted run (except running time and memory
+ usage). The running time only covers the resumed run, and the running time of the resumed runs is set in the
+ statistics (see tchecker::algorithms::stats_t::resumed_running_time)
+ */
+std::tuple<tchecker::algorithms::ndfs::stats_t, std::shared_ptr<tchecker::tck_liveness::zg_ndfs::state_space_t>>
+run_checkpoint(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels,
+               std::string const & checkpoint_file, std::size_t checkpoint_period, bool resume,
+               std::size_t block_size = 10000, std::size_t table_size = 65536);
+
 } // namespace zg_ndfs
 
 } // namespace tck_liveness
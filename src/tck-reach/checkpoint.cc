@@ -0,0 +1,253 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "checkpoint.hh"
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace checkpoint {
+
+static char const header_magic[8] = {'T', 'C', 'K', 'C', 'K', 'P', 'T', '4'}; /*!< Checkpoint header marker */
+static char const end_magic[8] = {'T', 'C', 'K', 'C', 'K', 'E', 'N', 'D'};    /*!< Checkpoint end marker */
+
+/*!
+ \brief Dimensions of a zone graph
+ \param zg : zone graph
+ \return number of processes, number of flattened bounded integer variables,
+ dimension of zones, and size of integers in zg
+ */
+static std::tuple<uint64_t, uint64_t, uint64_t, uint64_t> dimensions(tchecker::zg::zg_t const & zg)
+{
+  tchecker::ta::system_t const & system = zg.system();
+  return std::make_tuple(system.processes_count(), system.intvars_count(tchecker::VK_FLATTENED),
+                         system.clocks_count(tchecker::VK_FLATTENED) + 1, sizeof(tchecker::integer_t));
+}
+
+/* writer_t */
+
+writer_t::writer_t(std::string const & filename, enum tchecker::tck_reach::checkpoint::kind_t kind,
+                   tchecker::zg::zg_t const & zg, enum tchecker::waiting::policy_t policy)
+    : _filename(filename), _tmp_filename(filename + ".tmp"), _ofs(_tmp_filename, std::ios::binary | std::ios::trunc),
+      _committed(false)
+{
+  if (!_ofs.good())
+    throw std::runtime_error("Unable to write checkpoint " + _tmp_filename);
+
+  write_raw(header_magic, sizeof(header_magic));
+  uint32_t const k = kind, p = policy;
+  write_raw(&k, sizeof(k));
+  write_raw(&p, sizeof(p));
+  auto && [processes, intvars, dim, integer_size] = dimensions(zg);
+  write(processes);
+  write(intvars);
+  write(dim);
+  write(integer_size);
+}
+
+writer_t::~writer_t()
+{
+  if (!_committed) {
+    _ofs.close();
+    std::remove(_tmp_filename.c_str());
+  }
+}
+
+void writer_t::write(uint64_t n) { write_raw(&n, sizeof(n)); }
+
+void writer_t::write(tchecker::algorithms::stats_t const & stats)
+{
+  std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - stats.start_time();
+  double const running_time = stats.resumed_running_time() + elapsed.count();
+  write_raw(&running_time, sizeof(running_time));
+}
+
+void writer_t::write(tchecker::algorithms::reach::stats_t const & stats)
+{
+  write(static_cast<tchecker::algorithms::stats_t const &>(stats));
+  write(static_cast<uint64_t>(stats.visited_states()));
+  write(static_cast<uint64_t>(stats.visited_transitions()));
+}
+
+void writer_t::write(tchecker::algorithms::covreach::stats_t const & stats)
+{
+  write(static_cast<tchecker::algorithms::stats_t const &>(stats));
+  write(static_cast<uint64_t>(stats.visited_states()));
+  write(static_cast<uint64_t>(stats.visited_transitions()));
+  write(static_cast<uint64_t>(stats.covered_states()));
+}
+
+void writer_t::write(tchecker::zg::state_t const & s, bool initial, bool final)
+{
+  uint8_t const flags = (initial ? 1 : 0) | (final ? 2 : 0);
+  write_raw(&flags, sizeof(flags));
+
+  tchecker::vloc_t const & vloc = s.vloc();
+  for (std::size_t i = 0; i < vloc.size(); ++i) {
+    tchecker::loc_id_t const id = vloc[i];
+    write_raw(&id, sizeof(id));
+  }
+
+  tchecker::intval_t const & intval = s.intval();
+  for (std::size_t i = 0; i < intval.size(); ++i) {
+    tchecker::integer_t const value = intval[i];
+    write_raw(&value, sizeof(value));
+  }
+
+  tchecker::zg::zone_t const & zone = s.zone();
+  tchecker::dbm::reduce(zone.dbm(), zone.dim(), _constraints);
+  write(static_cast<uint64_t>(_constraints.size()));
+  for (tchecker::dbm::db_constraint_t const & c : _constraints) {
+    write_raw(&c.i, sizeof(c.i));
+    write_raw(&c.j, sizeof(c.j));
+    write_raw(&c.db, sizeof(c.db));
+  }
+}
+
+void writer_t::write(uint64_t tgt, uint32_t edge_type, tchecker::vedge_t const & vedge)
+{
+  write(tgt);
+  write_raw(&edge_type, sizeof(edge_type));
+  for (std::size_t i = 0; i < vedge.size(); ++i) {
+    tchecker::edge_id_t const id = vedge[i];
+    write_raw(&id, sizeof(id));
+  }
+}
+
+void writer_t::commit()
+{
+  write_raw(end_magic, sizeof(end_magic));
+  _ofs.close();
+  if (_ofs.fail())
+    throw std::runtime_error("Unable to write checkpoint " + _tmp_filename);
+  if (std::rename(_tmp_filename.c_str(), _filename.c_str()) != 0)
+    throw std::runtime_error("Unable to replace checkpoint " + _filename);
+  _committed = true;
+}
+
+void writer_t::write_raw(void const * p, std::size_t size)
+{
+  _ofs.write(reinterpret_cast<char const *>(p), size);
+  if (_ofs.fail())
+    throw std::runtime_error("Unable to write checkpoint " + _tmp_filename);
+}
+
+/* reader_t */
+
+reader_t::reader_t(std::string const & filename, enum tchecker::tck_reach::checkpoint::kind_t kind,
+                   tchecker::zg::zg_t const & zg, enum tchecker::waiting::policy_t policy)
+    : _ifs(filename, std::ios::binary), _dim(0)
+{
+  if (!_ifs.good())
+    throw std::runtime_error("Unable to read checkpoint " + filename);
+
+  char magic[sizeof(header_magic)];
+  read_raw(magic, sizeof(magic));
+  if (std::memcmp(magic, header_magic, sizeof(magic)) != 0)
+    throw std::runtime_error(filename + " is not a checkpoint file");
+
+  uint32_t k, p;
+  read_raw(&k, sizeof(k));
+  read_raw(&p, sizeof(p));
+  if (k != kind)
+    throw std::runtime_error("Checkpoint " + filename + " has been produced by another algorithm");
+  if (p != policy)
+    throw std::runtime_error("Checkpoint " + filename + " has been produced with another search order");
+
+  auto && [processes, intvars, dim, integer_size] = dimensions(zg);
+  if (read() != processes || read() != intvars || read() != dim || read() != integer_size)
+    throw std::runtime_error("Checkpoint " + filename + " does not match the model");
+
+  _vloc.resize(processes);
+  _intval.resize(intvars);
+  _dim = static_cast<tchecker::clock_id_t>(dim);
+  _dbm.resize(dim * dim);
+}
+
+uint64_t reader_t::read()
+{
+  uint64_t n;
+  read_raw(&n, sizeof(n));
+  return n;
+}
+
+void reader_t::read(tchecker::algorithms::stats_t & stats)
+{
+  read_raw(&stats.resumed_running_time(), sizeof(double));
+}
+
+void reader_t::read(tchecker::algorithms::reach::stats_t & stats)
+{
+  read(static_cast<tchecker::algorithms::stats_t &>(stats));
+  stats.visited_states() = read();
+  stats.visited_transitions() = read();
+}
+
+void reader_t::read(tchecker::algorithms::covreach::stats_t & stats)
+{
+  read(static_cast<tchecker::algorithms::stats_t &>(stats));
+  stats.visited_states() = read();
+  stats.visited_transitions() = read();
+  stats.covered_states() = read();
+}
+
+tchecker::zg::state_sptr_t reader_t::read(tchecker::zg::zg_t & zg, bool & initial, bool & final)
+{
+  uint8_t flags;
+  read_raw(&flags, sizeof(flags));
+  initial = ((flags & 1) != 0);
+  final = ((flags & 2) != 0);
+
+  read_raw(_vloc.data(), _vloc.size() * sizeof(tchecker::loc_id_t));
+  read_raw(_intval.data(), _intval.size() * sizeof(tchecker::integer_t));
+  _constraints.resize(read());
+  for (tchecker::dbm::db_constraint_t & c : _constraints) {
+    read_raw(&c.i, sizeof(c.i));
+    read_raw(&c.j, sizeof(c.j));
+    read_raw(&c.db, sizeof(c.db));
+    if (c.i >= _dim || c.j >= _dim)
+      throw std::runtime_error("Corrupted checkpoint file");
+  }
+  if (tchecker::dbm::expand(_dbm.data(), _dim, _constraints) == tchecker::dbm::EMPTY)
+    throw std::runtime_error("Corrupted checkpoint file");
+
+  return zg.build_state(_vloc, _intval, _dbm);
+}
+
+void reader_t::read(uint64_t & tgt, uint32_t & edge_type, std::vector<tchecker::edge_id_t> & vedge)
+{
+  tgt = read();
+  read_raw(&edge_type, sizeof(edge_type));
+  vedge.resize(_vloc.size());
+  read_raw(vedge.data(), vedge.size() * sizeof(tchecker::edge_id_t));
+}
+
+void reader_t::check_end()
+{
+  char magic[sizeof(end_magic)];
+  read_raw(magic, sizeof(magic));
+  if (std::memcmp(magic, end_magic, sizeof(magic)) != 0)
+    throw std::runtime_error("Corrupted checkpoint file");
+}
+
+void reader_t::read_raw(void * p, std::size_t size)
+{
+  _ifs.read(reinterpret_cast<char *>(p), size);
+  if (_ifs.gcount() != static_cast<std::streamsize>(size))
+    throw std::runtime_error("Unexpected end of checkpoint file");
+}
+
+} // namespace checkpoint
+
+} // namespace tck_reach
+
+} // namespace tchecker
@@ -0,0 +1,695 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_TCK_REACH_CHECKPOINT_HH
+#define TCHECKER_TCK_REACH_CHECKPOINT_HH
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tchecker/algorithms/covreach/stats.hh"
+#include "tchecker/algorithms/reach/stats.hh"
+#include "tchecker/algorithms/stats.hh"
+#include "tchecker/basictypes.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/syncprod/vedge.hh"
+#include "tchecker/waiting/factory.hh"
+#include "tchecker/zg/state.hh"
+#include "tchecker/zg/zg.hh"
+
+/*!
+ \file checkpoint.hh
+ \brief Checkpoint files for reachability and liveness algorithms
+
+ A checkpoint file is a binary file that stores a snapshot of a run: the
+ running time and the statistics, the nodes of the graph in storage order
+ (flags, tuple of locations, integer valuation and zone as a minimal set of
+ constraints), the edges of the graph (grouped by source node, with edge type
+ and tuple of edges), the waiting nodes in the order in which they are visited,
+ and the witness node of each query. Numbers are stored in the native byte order, hence checkpoint files
+ are not portable across architectures.
+
+ Depth-first liveness algorithms have no waiting container. Their checkpoint
+ files store the running time, the graph, and the expanded nodes that have no
+ successor. They are resumed by replaying the search on the saved graph.
+*/
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace checkpoint {
+
+/*!
+ \brief Index of a missing node (e.g. the witness of an unsatisfied query)
+ */
+constexpr uint64_t NO_NODE = static_cast<uint64_t>(-1);
+
+/*!
+ \brief Kind of algorithm that produced a checkpoint
+ */
+enum kind_t : uint32_t {
+  KIND_REACH = 0,    /*!< Reachability algorithm */
+  KIND_COVREACH = 1, /*!< Covering reachability algorithm */
+  KIND_NDFS = 2,     /*!< Nested DFS liveness algorithm */
+  KIND_COUVSCC = 3,  /*!< Couvreur's SCC liveness algorithm */
+};
+
+/*!
+ \class writer_t
+ \brief Writer of checkpoint files
+ \note the checkpoint is written to a temporary file that replaces the
+ checkpoint file on commit. Hence, the checkpoint file is never left
+ incomplete if the program is interrupted while writing
+ */
+class writer_t {
+public:
+  /*!
+   \brief Constructor
+   \param filename : name of checkpoint file
+   \param kind : kind of algorithm
+   \param zg : zone graph
+   \param policy : waiting policy
+   \post the header of the checkpoint has been written
+   \throw std::runtime_error : if the temporary file cannot be opened
+   */
+  writer_t(std::string const & filename, enum tchecker::tck_reach::checkpoint::kind_t kind, tchecker::zg::zg_t const & zg,
+           enum tchecker::waiting::policy_t policy);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  writer_t(tchecker::tck_reach::checkpoint::writer_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  writer_t(tchecker::tck_reach::checkpoint::writer_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post the temporary file has been removed if the checkpoint has not been
+   committed
+   */
+  ~writer_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::tck_reach::checkpoint::writer_t & operator=(tchecker::tck_reach::checkpoint::writer_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::tck_reach::checkpoint::writer_t & operator=(tchecker::tck_reach::checkpoint::writer_t &&) = delete;
+
+  /*!
+   \brief Write an unsigned integer
+   \param n : an unsigned integer
+   \post n has been written as a 64-bits unsigned integer
+   */
+  void write(uint64_t n);
+
+  /*!
+   \brief Write statistics
+   \param stats : statistics
+   \post the running time since the start of stats, including the resumed
+   runs, has been written
+   */
+  void write(tchecker::algorithms::stats_t const & stats);
+
+  /*!
+   \brief Write statistics
+   \param stats : statistics
+   \post the running time and the counters in stats have been written
+   */
+  void write(tchecker::algorithms::reach::stats_t const & stats);
+
+  /*!
+   \brief Write statistics
+   \param stats : statistics
+   \post the running time and the counters in stats have been written
+   */
+  void write(tchecker::algorithms::covreach::stats_t const & stats);
+
+  /*!
+   \brief Write a state
+   \param s : a state
+   \param initial : initial flag
+   \param final : final flag
+   \post the flags, the tuple of locations, the integer valuation and the zone
+   in s have been written. The zone is written in reduced form (see
+   tchecker::dbm::reduce)
+   */
+  void write(tchecker::zg::state_t const & s, bool initial, bool final);
+
+  /*!
+   \brief Write an edge
+   \param tgt : index of target node
+   \param edge_type : type of edge
+   \param vedge : tuple of edges
+   \post tgt, edge_type and vedge have been written
+   */
+  void write(uint64_t tgt, uint32_t edge_type, tchecker::vedge_t const & vedge);
+
+  /*!
+   \brief Commit the checkpoint
+   \post the checkpoint file has been replaced by the temporary file
+   \throw std::runtime_error : if writing the checkpoint failed
+   */
+  void commit();
+
+private:
+  /*!
+   \brief Write raw bytes
+   \param p : pointer to bytes
+   \param size : number of bytes
+   \post size bytes from p have been written
+   */
+  void write_raw(void const * p, std::size_t size);
+
+  std::string _filename;                                    /*!< Name of checkpoint file */
+  std::string _tmp_filename;                                /*!< Name of temporary file */
+  std::ofstream _ofs;                                       /*!< Output stream to temporary file */
+  bool _committed;                                          /*!< Commit flag */
+  std::vector<tchecker::dbm::db_constraint_t> _constraints; /*!< Buffer for reduced DBMs */
+};
+
+/*!
+ \class reader_t
+ \brief Reader of checkpoint files
+ */
+class reader_t {
+public:
+  /*!
+   \brief Constructor
+   \param filename : name of checkpoint file
+   \param kind : kind of algorithm
+   \param zg : zone graph
+   \param policy : waiting policy
+   \post the header of the checkpoint has been read and checked
+   \throw std::runtime_error : if the file cannot be read, or if the checkpoint
+   has not been produced by an algorithm of the given kind, with the given
+   waiting policy, on a system with the same dimensions as the system of zg
+   */
+  reader_t(std::string const & filename, enum tchecker::tck_reach::checkpoint::kind_t kind, tchecker::zg::zg_t const & zg,
+           enum tchecker::waiting::policy_t policy);
+
+  /*!
+   \brief Read an unsigned integer
+   \return the 64-bits unsigned integer that has been read
+   \throw std::runtime_error : if reading failed
+   */
+  uint64_t read();
+
+  /*!
+   \brief Read statistics
+   \param stats : statistics
+   \post the running time of the resumed runs in stats has been read
+   \throw std::runtime_error : if reading failed
+   */
+  void read(tchecker::algorithms::stats_t & stats);
+
+  /*!
+   \brief Read statistics
+   \param stats : statistics
+   \post the running time of the resumed runs and the counters in stats have
+   been read
+   \throw std::runtime_error : if reading failed
+   */
+  void read(tchecker::algorithms::reach::stats_t & stats);
+
+  /*!
+   \brief Read statistics
+   \param stats : statistics
+   \post the running time of the resumed runs and the counters in stats have
+   been read
+   \throw std::runtime_error : if reading failed
+   */
+  void read(tchecker::algorithms::covreach::stats_t & stats);
+
+  /*!
+   \brief Read a state
+   \param zg : zone graph
+   \param initial : initial flag
+   \param final : final flag
+   \return the state that has been read, built by zg
+   \post initial and final have been set to the flags of the state
+   \throw std::runtime_error : if reading failed
+   */
+  tchecker::zg::state_sptr_t read(tchecker::zg::zg_t & zg, bool & initial, bool & final);
+
+  /*!
+   \brief Read an edge
+   \param tgt : index of target node
+   \param edge_type : type of edge
+   \param vedge : tuple of edges
+   \post tgt, edge_type and vedge have been read
+   \throw std::runtime_error : if reading failed
+   */
+  void read(uint64_t & tgt, uint32_t & edge_type, std::vector<tchecker::edge_id_t> & vedge);
+
+  /*!
+   \brief Check the end of the checkpoint
+   \throw std::runtime_error : if the end marker cannot be read
+   */
+  void check_end();
+
+private:
+  /*!
+   \brief Read raw bytes
+   \param p : pointer to bytes
+   \param size : number of bytes
+   \post size bytes have been read into p
+   \throw std::runtime_error : if reading failed
+   */
+  void read_raw(void * p, std::size_t size);
+
+  std::ifstream _ifs;                                       /*!< Input stream */
+  tchecker::clock_id_t _dim;                                /*!< Dimension of zones */
+  std::vector<tchecker::loc_id_t> _vloc;                    /*!< Buffer for tuples of locations */
+  std::vector<tchecker::integer_t> _intval;                 /*!< Buffer for integer valuations */
+  std::vector<tchecker::dbm::db_t> _dbm;                    /*!< Buffer for DBMs */
+  std::vector<tchecker::dbm::db_constraint_t> _constraints; /*!< Buffer for reduced DBMs */
+};
+
+/*!
+ \class node_index_t
+ \brief Numbering of the nodes of a graph in storage order
+ \tparam GRAPH : type of graph
+ \note nodes are numbered by increasing address. Hence the index only keeps a
+ pointer to each node, and the number of a node is found by binary search
+ */
+template <class GRAPH> class node_index_t {
+public:
+  /*!
+   \brief Type of nodes
+   */
+  using node_t = typename std::remove_reference<decltype(*std::declval<typename GRAPH::node_sptr_t>())>::type;
+
+  /*!
+   \brief Constructor
+   \param graph : a graph
+   \post the nodes of graph have been numbered in storage order
+   */
+  explicit node_index_t(GRAPH const & graph)
+  {
+    _nodes.reserve(graph.nodes_count());
+    for (typename GRAPH::node_sptr_t const & n : graph.nodes())
+      _nodes.push_back(&*n);
+    std::sort(_nodes.begin(), _nodes.end(), std::less<node_t *>{});
+  }
+
+  /*!
+   \brief Accessor
+   \return nodes in storage order
+   */
+  inline std::vector<node_t *> const & nodes() const { return _nodes; }
+
+  /*!
+   \brief Accessor
+   \param n : a node
+   \return number of n, tchecker::tck_reach::checkpoint::NO_NODE if n is nullptr
+   \throw std::invalid_argument : if n is not a node of the graph
+   */
+  uint64_t operator()(typename GRAPH::node_sptr_t const & n) const
+  {
+    if (n.ptr() == nullptr)
+      return tchecker::tck_reach::checkpoint::NO_NODE;
+    auto it = std::lower_bound(_nodes.begin(), _nodes.end(), n.ptr(), std::less<node_t *>{});
+    if (it == _nodes.end() || *it != n.ptr())
+      throw std::invalid_argument("Node is not in the graph");
+    return static_cast<uint64_t>(it - _nodes.begin());
+  }
+
+private:
+  std::vector<node_t *> _nodes; /*!< Nodes sorted by address */
+};
+
+/*!
+ \brief Write a graph
+ \tparam GRAPH : type of graph, nodes should have a method state() that yields
+ a tchecker::zg::state_t
+ \tparam EDGE_TYPE : type of edge type function
+ \param writer : checkpoint writer
+ \param graph : a graph
+ \param index : numbering of the nodes of graph
+ \param edge_type : function that maps an edge of graph to its type (as an
+ unsigned integer)
+ \post the nodes of graph have been written in the order of index, then the
+ edges of graph, grouped by source node in the same order, and in the order of
+ the outgoing edges of each node
+ */
+template <class GRAPH, class EDGE_TYPE>
+void write_graph(tchecker::tck_reach::checkpoint::writer_t & writer, GRAPH const & graph,
+                 tchecker::tck_reach::checkpoint::node_index_t<GRAPH> const & index, EDGE_TYPE && edge_type)
+{
+  writer.write(static_cast<uint64_t>(index.nodes().size()));
+  for (auto const * n : index.nodes())
+    writer.write(n->state(), n->initial(), n->final());
+
+  for (auto * n : index.nodes()) {
+    typename GRAPH::node_sptr_t const src{n};
+    uint64_t out_degree = 0;
+    for ([[maybe_unused]] typename GRAPH::edge_sptr_t const & e : graph.outgoing_edges(src))
+      ++out_degree;
+    writer.write(out_degree);
+    for (typename GRAPH::edge_sptr_t const & e : graph.outgoing_edges(src))
+      writer.write(index(graph.edge_tgt(e)), edge_type(graph, e), e->vedge());
+  }
+}
+
+/*!
+ \brief Write a sequence of nodes
+ \tparam GRAPH : type of graph
+ \param writer : checkpoint writer
+ \param index : numbering of the nodes of a graph
+ \param nodes : nodes of the graph, or nullptr
+ \post the size of nodes, and the number of each node in nodes
+ (tchecker::tck_reach::checkpoint::NO_NODE for nullptr) have been written
+ */
+template <class GRAPH>
+void write_nodes(tchecker::tck_reach::checkpoint::writer_t & writer,
+                 tchecker::tck_reach::checkpoint::node_index_t<GRAPH> const & index,
+                 std::vector<typename GRAPH::node_sptr_t> const & nodes)
+{
+  writer.write(static_cast<uint64_t>(nodes.size()));
+  for (typename GRAPH::node_sptr_t const & n : nodes)
+    writer.write(index(n));
+}
+
+/*!
+ \brief Read a graph
+ \tparam GRAPH : type of graph
+ \tparam ADD_NODE : type of node insertion function
+ \tparam ADD_EDGE : type of edge insertion function
+ \param reader : checkpoint reader
+ \param filename : name of checkpoint file
+ \param zg : zone graph
+ \param graph : a graph over zg
+ \param nodes : nodes of graph
+ \param add_node : function that adds a node to graph: called with graph and
+ a state, it should return the corresponding node
+ \param add_edge : function that adds an edge to graph: called with graph, the
+ source node, the target node, the edge type and a transition
+ \pre graph is empty
+ \post graph has been filled with the nodes and the edges written by
+ tchecker::tck_reach::checkpoint::write_graph, nodes contains the nodes of graph
+ in the order in which they have been written. The transitions on edges have
+ been rebuilt from their tuple of edges (see tchecker::zg::zg_t::build_transition),
+ and the outgoing edges of each node are in the same order as in the written
+ graph
+ \throw std::runtime_error : if reading failed
+ */
+template <class GRAPH, class ADD_NODE, class ADD_EDGE>
+void read_graph(tchecker::tck_reach::checkpoint::reader_t & reader, std::string const & filename, tchecker::zg::zg_t & zg,
+                GRAPH & graph, std::vector<typename GRAPH::node_sptr_t> & nodes, ADD_NODE && add_node,
+                ADD_EDGE && add_edge)
+{
+  uint64_t const nodes_count = reader.read();
+  nodes.clear();
+  nodes.reserve(nodes_count);
+  for (uint64_t i = 0; i < nodes_count; ++i) {
+    bool initial, final;
+    tchecker::zg::state_sptr_t s = reader.read(zg, initial, final);
+    typename GRAPH::node_sptr_t n = add_node(graph, s);
+    n->initial(initial);
+    n->final(final);
+    nodes.push_back(n);
+  }
+
+  // edges are inserted at the head of the outgoing edges of their source node,
+  // hence they are added in reverse order
+  std::vector<std::tuple<uint64_t, uint32_t, tchecker::zg::transition_sptr_t>> out_edges;
+  std::vector<tchecker::edge_id_t> vedge;
+  for (typename GRAPH::node_sptr_t const & src : nodes) {
+    uint64_t const out_degree = reader.read();
+    out_edges.clear();
+    for (uint64_t i = 0; i < out_degree; ++i) {
+      uint64_t tgt;
+      uint32_t edge_type;
+      reader.read(tgt, edge_type, vedge);
+      if (tgt >= nodes.size())
+        throw std::runtime_error("Invalid edge in checkpoint " + filename);
+      out_edges.emplace_back(tgt, edge_type, zg.build_transition(vedge));
+    }
+    for (auto it = out_edges.rbegin(); it != out_edges.rend(); ++it)
+      add_edge(graph, src, nodes[std::get<0>(*it)], std::get<1>(*it), *std::get<2>(*it));
+  }
+}
+
+/*!
+ \brief Read a sequence of nodes
+ \tparam NODE_SPTR : type of pointer to nodes
+ \param reader : checkpoint reader
+ \param filename : name of checkpoint file
+ \param nodes : nodes of a graph, in the order in which they have been written
+ \param v : a sequence of nodes
+ \post v contains the sequence of nodes written by
+ tchecker::tck_reach::checkpoint::write_nodes (nullptr for
+ tchecker::tck_reach::checkpoint::NO_NODE)
+ \throw std::runtime_error : if reading failed
+ */
+template <class NODE_SPTR>
+void read_nodes(tchecker::tck_reach::checkpoint::reader_t & reader, std::string const & filename,
+                std::vector<NODE_SPTR> const & nodes, std::vector<NODE_SPTR> & v)
+{
+  uint64_t const count = reader.read();
+  v.clear();
+  v.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t const k = reader.read();
+    if (k != tchecker::tck_reach::checkpoint::NO_NODE && k >= nodes.size())
+      throw std::runtime_error("Invalid node in checkpoint " + filename);
+    v.push_back(k == tchecker::tck_reach::checkpoint::NO_NODE ? NODE_SPTR{nullptr} : nodes[k]);
+  }
+}
+
+/*!
+ \brief Save a checkpoint
+ \tparam GRAPH : type of graph, nodes should have a method state() that yields
+ a tchecker::zg::state_t
+ \tparam STATS : type of statistics
+ \tparam EDGE_TYPE : type of edge type function
+ \param filename : name of checkpoint file
+ \param kind : kind of algorithm
+ \param zg : zone graph
+ \param graph : a graph over zg
+ \param policy : waiting policy
+ \param waiting : waiting nodes, in the order in which they are visited
+ \param witnesses : witness node of each query (nullptr if none)
+ \param stats : statistics
+ \param edge_type : function that maps an edge of graph to its type (as an
+ unsigned integer)
+ \pre the nodes in waiting and the witnesses belong to graph
+ \post graph, waiting, witnesses and stats have been saved to filename. Nodes and edges are
+ streamed to the file, and the only extra memory is a pointer to each node (see
+ tchecker::tck_reach::checkpoint::node_index_t)
+ \throw std::runtime_error : if writing the checkpoint failed
+ */
+template <class GRAPH, class STATS, class EDGE_TYPE>
+void save(std::string const & filename, enum tchecker::tck_reach::checkpoint::kind_t kind, tchecker::zg::zg_t const & zg,
+          GRAPH const & graph, enum tchecker::waiting::policy_t policy,
+          std::vector<typename GRAPH::node_sptr_t> const & waiting,
+          std::vector<typename GRAPH::node_sptr_t> const & witnesses, STATS const & stats, EDGE_TYPE && edge_type)
+{
+  tchecker::tck_reach::checkpoint::writer_t writer{filename, kind, zg, policy};
+  tchecker::tck_reach::checkpoint::node_index_t<GRAPH> const index{graph};
+
+  writer.write(stats);
+  tchecker::tck_reach::checkpoint::write_graph(writer, graph, index, edge_type);
+  tchecker::tck_reach::checkpoint::write_nodes(writer, index, waiting);
+  tchecker::tck_reach::checkpoint::write_nodes(writer, index, witnesses);
+  writer.commit();
+}
+
+/*!
+ \brief Load a checkpoint
+ \tparam GRAPH : type of graph
+ \tparam STATS : type of statistics
+ \tparam ADD_NODE : type of node insertion function
+ \tparam ADD_EDGE : type of edge insertion function
+ \param filename : name of checkpoint file
+ \param kind : kind of algorithm
+ \param zg : zone graph
+ \param graph : a graph over zg
+ \param policy : waiting policy
+ \param waiting : waiting nodes
+ \param witnesses : witness node of each query
+ \param stats : statistics
+ \param add_node : function that adds a node to graph: called with graph and
+ a state, it should return the corresponding node
+ \param add_edge : function that adds an edge to graph: called with graph, the
+ source node, the target node, the edge type and a transition
+ \pre graph is empty, witnesses has one entry for each query
+ \post graph has been filled with the nodes and edges saved in filename (see
+ tchecker::tck_reach::checkpoint::read_graph). waiting contains the waiting
+ nodes, in the order in which they should be visited, witnesses contains the
+ saved witness node of each query (nullptr if none), and the counters and the
+ running time of the resumed runs in stats have been set from filename
+ \throw std::runtime_error : if the checkpoint cannot be read, or if it does
+ not match kind, zg, policy or the number of queries
+ */
+template <class GRAPH, class STATS, class ADD_NODE, class ADD_EDGE>
+void load(std::string const & filename, enum tchecker::tck_reach::checkpoint::kind_t kind, tchecker::zg::zg_t & zg,
+          GRAPH & graph, enum tchecker::waiting::policy_t policy, std::vector<typename GRAPH::node_sptr_t> & waiting,
+          std::vector<typename GRAPH::node_sptr_t> & witnesses, STATS & stats, ADD_NODE && add_node, ADD_EDGE && add_edge)
+{
+  tchecker::tck_reach::checkpoint::reader_t reader{filename, kind, zg, policy};
+  std::vector<typename GRAPH::node_sptr_t> nodes, saved_witnesses;
+
+  reader.read(stats);
+  tchecker::tck_reach::checkpoint::read_graph(reader, filename, zg, graph, nodes, add_node, add_edge);
+  tchecker::tck_reach::checkpoint::read_nodes(reader, filename, nodes, waiting);
+  if (std::any_of(waiting.begin(), waiting.end(), [](auto const & n) { return n.ptr() == nullptr; }))
+    throw std::runtime_error("Invalid waiting node in checkpoint " + filename);
+  tchecker::tck_reach::checkpoint::read_nodes(reader, filename, nodes, saved_witnesses);
+  if (saved_witnesses.size() != witnesses.size())
+    throw std::runtime_error("Checkpoint " + filename + " has been produced for other queries");
+  witnesses = saved_witnesses;
+  reader.check_end();
+}
+
+/*!
+ \class expanded_nodes_t
+ \brief Predicate on the nodes expanded by the runs saved in a checkpoint of
+ a depth-first search
+ \tparam GRAPH : type of graph
+ */
+template <class GRAPH> class expanded_nodes_t {
+public:
+  /*!
+   \brief Type of nodes
+   */
+  using node_t = typename tchecker::tck_reach::checkpoint::node_index_t<GRAPH>::node_t;
+
+  /*!
+   \brief Constructor
+   \param graph : a graph loaded from a checkpoint
+   \param deadlocks : expanded nodes without successor loaded from the same
+   checkpoint (see tchecker::tck_reach::checkpoint::load_dfs)
+   \note this keeps a pointer on graph
+   */
+  expanded_nodes_t(GRAPH const & graph, std::vector<typename GRAPH::node_sptr_t> const & deadlocks) : _graph(&graph)
+  {
+    _deadlocks.reserve(deadlocks.size());
+    for (typename GRAPH::node_sptr_t const & n : deadlocks)
+      _deadlocks.push_back(n.ptr());
+    std::sort(_deadlocks.begin(), _deadlocks.end(), std::less<node_t *>{});
+  }
+
+  /*!
+   \brief Predicate
+   \param n : a node
+   \return true if n has an outgoing edge or is an expanded node without
+   successor, false otherwise
+   */
+  bool operator()(typename GRAPH::node_sptr_t const & n) const
+  {
+    auto const out_edges = _graph->outgoing_edges(n);
+    return (out_edges.begin() != out_edges.end()) ||
+           std::binary_search(_deadlocks.begin(), _deadlocks.end(), n.ptr(), std::less<node_t *>{});
+  }
+
+private:
+  GRAPH const * _graph;             /*!< Graph */
+  std::vector<node_t *> _deadlocks; /*!< Expanded nodes without successor, sorted by address */
+};
+
+/*!
+ \brief Save a checkpoint of a depth-first search
+ \tparam GRAPH : type of graph, nodes should have a method state() that yields
+ a tchecker::zg::state_t
+ \tparam EXPANDED : type of predicate on expanded nodes
+ \param filename : name of checkpoint file
+ \param kind : kind of algorithm
+ \param zg : zone graph
+ \param graph : a graph over zg
+ \param stats : statistics
+ \param expanded : predicate on the nodes of graph that have been expanded
+ \post graph, the nodes that satisfy expanded and have no outgoing edge, and
+ the running time in stats have been saved to filename
+ \throw std::runtime_error : if writing the checkpoint failed
+ \note the nodes with an outgoing edge have been expanded, hence they are not
+ saved
+ */
+template <class GRAPH, class EXPANDED>
+void save_dfs(std::string const & filename, enum tchecker::tck_reach::checkpoint::kind_t kind, tchecker::zg::zg_t const & zg,
+              GRAPH const & graph, tchecker::algorithms::stats_t const & stats, EXPANDED && expanded)
+{
+  tchecker::tck_reach::checkpoint::writer_t writer{filename, kind, zg, tchecker::waiting::STACK};
+  tchecker::tck_reach::checkpoint::node_index_t<GRAPH> const index{graph};
+
+  std::vector<typename GRAPH::node_sptr_t> deadlocks;
+  for (auto * n : index.nodes()) {
+    typename GRAPH::node_sptr_t const node{n};
+    auto const out_edges = graph.outgoing_edges(node);
+    if (out_edges.begin() == out_edges.end() && expanded(node))
+      deadlocks.push_back(node);
+  }
+
+  writer.write(stats);
+  tchecker::tck_reach::checkpoint::write_graph(
+      writer, graph, index, [](GRAPH const &, typename GRAPH::edge_sptr_t const &) -> uint32_t { return 0; });
+  tchecker::tck_reach::checkpoint::write_nodes(writer, index, deadlocks);
+  writer.commit();
+}
+
+/*!
+ \brief Load a checkpoint of a depth-first search
+ \tparam GRAPH : type of graph
+ \tparam ADD_NODE : type of node insertion function
+ \tparam ADD_EDGE : type of edge insertion function
+ \param filename : name of checkpoint file
+ \param kind : kind of algorithm
+ \param zg : zone graph
+ \param graph : a graph over zg
+ \param deadlocks : expanded nodes without successor
+ \param stats : statistics
+ \param add_node : function that adds a node to graph (see
+ tchecker::tck_reach::checkpoint::read_graph)
+ \param add_edge : function that adds an edge to graph (see
+ tchecker::tck_reach::checkpoint::read_graph)
+ \pre graph is empty
+ \post graph has been filled with the nodes and edges saved in filename,
+ deadlocks contains the saved expanded nodes that have no successor, and the
+ running time of the resumed runs in stats has been set from filename. The
+ expanded nodes are the nodes in deadlocks and the nodes with an outgoing edge
+ \throw std::runtime_error : if the checkpoint cannot be read, or if it does
+ not match kind or zg
+ */
+template <class GRAPH, class ADD_NODE, class ADD_EDGE>
+void load_dfs(std::string const & filename, enum tchecker::tck_reach::checkpoint::kind_t kind, tchecker::zg::zg_t & zg,
+              GRAPH & graph, std::vector<typename GRAPH::node_sptr_t> & deadlocks, tchecker::algorithms::stats_t & stats,
+              ADD_NODE && add_node, ADD_EDGE && add_edge)
+{
+  tchecker::tck_reach::checkpoint::reader_t reader{filename, kind, zg, tchecker::waiting::STACK};
+  std::vector<typename GRAPH::node_sptr_t> nodes;
+
+  reader.read(stats);
+  tchecker::tck_reach::checkpoint::read_graph(reader, filename, zg, graph, nodes, add_node, add_edge);
+  tchecker::tck_reach::checkpoint::read_nodes(reader, filename, nodes, deadlocks);
+  if (std::any_of(deadlocks.begin(), deadlocks.end(), [](auto const & n) { return n.ptr() == nullptr; }))
+    throw std::runtime_error("Invalid expanded node in checkpoint " + filename);
+  reader.check_end();
+}
+
+} // namespace checkpoint
+
+} // namespace tck_reach
+
+} // namespace tchecker
+
+#endif // TCHECKER_TCK_REACH_CHECKPOINT_HH
@@ -175,10 +175,10 @@ std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::concur19::cex:
 /* run */
 
 std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::concur19::state_space_t>>
-run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::string const & search_order,
-    tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size)
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, std::string const & search_order,
+    tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size,
+    tchecker::algorithms::budget_t budget)
 {
-  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
   if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
     std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
 
@@ -199,12 +199,14 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
   tchecker::algorithms::covreach::stats_t stats;
   tchecker::tck_reach::concur19::algorithm_t algorithm;
 
+  budget.memory_usage([&]() { return state_space->refzg().memsize() + state_space->graph().memsize(); });
+
   if (covering == tchecker::algorithms::covreach::COVERING_FULL)
     stats = algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(state_space->refzg(), state_space->graph(),
-                                                                         accepting_labels, policy);
+                                                                         accepting_labels, policy, budget);
   else if (covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
     stats = algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(state_space->refzg(), state_space->graph(),
-                                                                               accepting_labels, policy);
+                                                                               accepting_labels, policy, budget);
   else
     throw std::invalid_argument("Unknown covering policy for covreach algorithm");
 
@@ -8,6 +8,7 @@
 #ifndef TCHECKER_TCK_REACH_COUNTER_EXAMPLE_HH
 #define TCHECKER_TCK_REACH_COUNTER_EXAMPLE_HH
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -58,9 +59,13 @@ template <class GRAPH> bool actual_edge(GRAPH const & g, typename GRAPH::edge_sp
  \brief Compute a symbolic counter example of a zone graph
  \tparam GRAPH : type of graph, see tchecker::algorithms::path::finite::algorithm_t for requirements
  \param g : a graph over the zone graph (reachability graph, subsumption graph, etc)
- \return a finite path from an initial node of g to a final node of g
+ \param filter_last : predicate on target nodes
+ \return a finite path from an initial node of g to a node of g that satisfies filter_last
  */
-template <class GRAPH> tchecker::zg::path::symbolic::finite_path_t * symbolic_counter_example_zg(GRAPH const & g)
+template <class GRAPH>
+tchecker::zg::path::symbolic::finite_path_t *
+symbolic_counter_example_zg(GRAPH const & g,
+                            std::function<bool(GRAPH const &, typename GRAPH::node_sptr_t)> && filter_last)
 {
   std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(
       g.zg().system_ptr(), g.zg().sharing_type(), tchecker::zg::STANDARD_SEMANTICS, tchecker::zg::NO_EXTRAPOLATION, 128, 128)};
@@ -68,8 +73,8 @@ template <class GRAPH> tchecker::zg::path::symbolic::finite_path_t * symbolic_co
   // compute sequence of edges from initial to final node in g
   tchecker::algorithms::finite_path_extraction_algorithm_t<GRAPH> algorithm;
 
-  auto && [found, root, seq] = algorithm.run(g, &tchecker::tck_reach::initial_node<GRAPH>,
-                                             &tchecker::tck_reach::final_node<GRAPH>, &tchecker::tck_reach::actual_edge<GRAPH>);
+  auto && [found, root, seq] = algorithm.run(g, &tchecker::tck_reach::initial_node<GRAPH>, std::move(filter_last),
+                                             &tchecker::tck_reach::actual_edge<GRAPH>);
 
   if (!found)
     return new tchecker::zg::path::symbolic::finite_path_t{zg};
@@ -85,6 +90,32 @@ template <class GRAPH> tchecker::zg::path::symbolic::finite_path_t * symbolic_co
   return tchecker::zg::path::symbolic::compute_finite_path(zg, initial_vloc, vedge_seq, true);
 }
 
+/*!
+ \brief Compute a symbolic counter example of a zone graph
+ \tparam GRAPH : type of graph, see tchecker::algorithms::path::finite::algorithm_t for requirements
+ \param g : a graph over the zone graph (reachability graph, subsumption graph, etc)
+ \return a finite path from an initial node of g to a final node of g
+ */
+template <class GRAPH> tchecker::zg::path::symbolic::finite_path_t * symbolic_counter_example_zg(GRAPH const & g)
+{
+  return tchecker::tck_reach::symbolic_counter_example_zg<GRAPH>(g, &tchecker::tck_reach::final_node<GRAPH>);
+}
+
+/*!
+ \brief Compute a symbolic counter example of a zone graph to a given node
+ \tparam GRAPH : type of graph, see tchecker::algorithms::path::finite::algorithm_t for requirements
+ \param g : a graph over the zone graph (reachability graph, subsumption graph, etc)
+ \param target : a node of g
+ \return a finite path from an initial node of g to target
+ */
+template <class GRAPH>
+tchecker::zg::path::symbolic::finite_path_t * symbolic_counter_example_zg(GRAPH const & g,
+                                                                          typename GRAPH::node_sptr_t const & target)
+{
+  return tchecker::tck_reach::symbolic_counter_example_zg<GRAPH>(
+      g, [&](GRAPH const &, typename GRAPH::node_sptr_t const & n) { return n == target; });
+}
+
 /*!
  \brief Compute a concrete counter example of a zone graph
  \tparam GRAPH : type of graph, see tchecker::algorithms::path::finite::algorithm_t for requirements
@@ -102,6 +133,63 @@ template <class GRAPH> tchecker::zg::path::concrete::finite_path_t * concrete_co
   return cex;
 }
 
+/*!
+ \brief Compute a concrete counter example of a zone graph to a given node
+ \tparam GRAPH : type of graph, see tchecker::algorithms::path::finite::algorithm_t for requirements
+ \param g : a graph over the zone graph (reachability graph, subsumption graph, etc)
+ \param target : a node of g
+ \return a finite path from an initial node of g to target, with concrete clock valuations
+ */
+template <class GRAPH>
+tchecker::zg::path::concrete::finite_path_t * concrete_counter_example_zg(GRAPH const & g,
+                                                                          typename GRAPH::node_sptr_t const & target)
+{
+  std::unique_ptr<tchecker::zg::path::symbolic::finite_path_t> symbolic_cex{
+      tchecker::tck_reach::symbolic_counter_example_zg<GRAPH>(g, target)};
+
+  return tchecker::zg::path::concrete::compute_finite_path(*symbolic_cex);
+}
+
+/*!
+ \brief Compute a symbolic counter example of a zone graph from parent pointers
+ \tparam GRAPH : type of graph, see tchecker::graph::parent::graph_t
+ \param g : a graph of parent nodes over the zone graph
+ \return a finite path from an initial node of g to a final node of g if any,
+ an empty path otherwise
+ \note the sequence of vedges is read along the parent pointers from the final
+ node, then the path is computed by following this sequence from the initial
+ node in a zone graph with standard semantics and no extrapolation
+ */
+template <class GRAPH> tchecker::zg::path::symbolic::finite_path_t * symbolic_counter_example_parent_zg(GRAPH const & g)
+{
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(
+      g.zg().system_ptr(), g.zg().sharing_type(), tchecker::zg::STANDARD_SEMANTICS, tchecker::zg::NO_EXTRAPOLATION, 128, 128)};
+
+  for (typename GRAPH::node_sptr_t const & n : g.nodes()) {
+    if (!n->final())
+      continue;
+    auto && [root, vedge_seq] = g.path(n);
+    return tchecker::zg::path::symbolic::compute_finite_path(zg, root->state().vloc(), vedge_seq, true);
+  }
+
+  return new tchecker::zg::path::symbolic::finite_path_t{zg};
+}
+
+/*!
+ \brief Compute a concrete counter example of a zone graph from parent pointers
+ \tparam GRAPH : type of graph, see tchecker::graph::parent::graph_t
+ \param g : a graph of parent nodes over the zone graph
+ \return a finite path from an initial node of g to a final node of g, with
+ concrete clock valuations
+ */
+template <class GRAPH> tchecker::zg::path::concrete::finite_path_t * concrete_counter_example_parent_zg(GRAPH const & g)
+{
+  std::unique_ptr<tchecker::zg::path::symbolic::finite_path_t> symbolic_cex{
+      tchecker::tck_reach::symbolic_counter_example_parent_zg<GRAPH>(g)};
+
+  return tchecker::zg::path::concrete::compute_finite_path(*symbolic_cex);
+}
+
 /*!
  \brief Compute a symbolic counter example over the zone graph with reference clocks
  \tparam GRAPH : type of graph, see tchecker::algorithms::path::finite::algorithm_t for requirements
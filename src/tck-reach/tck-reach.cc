@@ -5,20 +5,37 @@
  *
  */
 
+#include <chrono>
 #include <fstream>
 #include <getopt.h>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "concur19.hh"
+#include "tchecker/algorithms/budget.hh"
+#include "tchecker/algorithms/progress.hh"
 #include "tchecker/algorithms/reach/algorithm.hh"
+#include "tchecker/graph/output.hh"
 #include "tchecker/parsing/parsing.hh"
+#include "tchecker/ta/system_cache.hh"
+#include "tchecker/utils/block_allocator.hh"
 #include "tchecker/utils/log.hh"
+#include "tchecker/utils/pool.hh"
+#include "tchecker/utils/profile.hh"
+#include "tchecker/utils/trace.hh"
+#include "tchecker/zg/certificate.hh"
 #include "zg-aLU-covreach.hh"
+#include "zg-bitstate.hh"
+#include "zg-bwd-covreach.hh"
 #include "zg-covreach.hh"
+#include "zg-reach-disk.hh"
+#include "zg-reach-parent.hh"
 #include "zg-reach.hh"
+#include "zg-reduced-covreach.hh"
 
 /*!
  \file tck-reach.cc
@@ -33,6 +50,27 @@ static struct option long_options[] = {{"algorithm", required_argument, 0, 'a'},
                                        {"search-order", no_argument, 0, 's'},
                                        {"block-size", required_argument, 0, 0},
                                        {"table-size", required_argument, 0, 0},
+                                       {"checkpoint", required_argument, 0, 0},
+                                       {"checkpoint-period", required_argument, 0, 0},
+                                       {"resume", no_argument, 0, 0},
+                                       {"time-limit", required_argument, 0, 0},
+                                       {"max-states", required_argument, 0, 0},
+                                       {"memory-limit", required_argument, 0, 0},
+                                       {"passed-disk", required_argument, 0, 0},
+                                       {"passed-memory", required_argument, 0, 0},
+                                       {"bits", required_argument, 0, 0},
+                                       {"hashes", required_argument, 0, 0},
+                                       {"huge-pages", required_argument, 0, 0},
+                                       {"clock-reduction", required_argument, 0, 0},
+                                       {"parent-pointers", no_argument, 0, 0},
+                                       {"reduced-zones", no_argument, 0, 0},
+                                       {"profile", no_argument, 0, 0},
+                                       {"progress", required_argument, 0, 0},
+                                       {"progress-file", required_argument, 0, 0},
+                                       {"trace-file", required_argument, 0, 0},
+                                       {"stream-graph", no_argument, 0, 0},
+                                       {"format", required_argument, 0, 0},
+                                       {"model-cache", required_argument, 0, 0},
                                        {0, 0, 0, 0}};
 
 static char const * const options = (char *)"a:C:hl:o:s:";
@@ -50,27 +88,96 @@ void usage(char * progname)
             << std::endl;
   std::cerr << "          covreach       reachability algorithm over the zone graph with inclusion subsumption" << std::endl;
   std::cerr << "          aLU-covreach   reachability algorithm over the zone graph with aLU subsumption" << std::endl;
+  std::cerr << "          bwd-covreach   backward reachability algorithm over the zone graph with inclusion subsumption"
+            << std::endl;
+  std::cerr << "          bidir-covreach bidirectional reachability algorithm over the zone graph with inclusion subsumption"
+            << std::endl;
+  std::cerr << "          bitstate       depth-first reachability over the zone graph with bitstate hashing (may miss states)"
+            << std::endl;
   std::cerr << "   -C type       type of certificate" << std::endl;
   std::cerr << "          none       no certificate (default)" << std::endl;
   std::cerr << "          graph      graph of explored state-space" << std::endl;
   std::cerr << "          symbolic   symbolic run to a state with searched labels if any" << std::endl;
-  std::cerr << "          concrete   concrete run to a state with searched labels if any (only for reach and covreach)"
+  std::cerr << "          concrete   concrete run to a state with searched labels if any (only for reach, covreach, bwd-covreach, bidir-covreach and bitstate)"
             << std::endl;
   std::cerr << "   -h            help" << std::endl;
   std::cerr << "   -l l1,l2,...  comma-separated list of searched labels" << std::endl;
+  std::cerr << "   -l @file      file of queries, one comma-separated list of labels per line (only for reach and covreach)"
+            << std::endl;
   std::cerr << "   -o out_file   output file for certificate (default is standard output)" << std::endl;
   std::cerr << "   -s bfs|dfs    search order" << std::endl;
   std::cerr << "   --block-size  size of allocation blocks" << std::endl;
   std::cerr << "   --table-size  size of hash tables" << std::endl;
+  std::cerr << "   --huge-pages auto|none|transparent|explicit" << std::endl;
+  std::cerr << "                 huge pages for allocation blocks (default: auto, transparent huge pages for blocks of"
+            << std::endl;
+  std::cerr << "                 at least 2MB)" << std::endl;
+  std::cerr << "   --clock-reduction none|active" << std::endl;
+  std::cerr << "                 free the clocks that are inactive in the current locations before extrapolation"
+            << std::endl;
+  std::cerr << "                 (default: none, only for reach and covreach without --passed-disk and --parent-pointers,"
+            << std::endl;
+  std::cerr << "                 a resumed run should use the same reduction as the checkpointed run)" << std::endl;
+  std::cerr << "   --checkpoint file         save the state of the run to file periodically (only for reach and covreach)"
+            << std::endl;
+  std::cerr << "   --checkpoint-period sec   time between two checkpoints in seconds (default: 600)" << std::endl;
+  std::cerr << "   --resume                  resume the run saved in the checkpoint file (RUNNING_TIME_SECONDS covers"
+            << std::endl;
+  std::cerr << "                             the resumed part, TOTAL_RUNNING_TIME_SECONDS all the runs)" << std::endl;
+  std::cerr << "   --time-limit sec          stop after sec seconds (only for reach, covreach, concur19 and bitstate)"
+            << std::endl;
+  std::cerr << "   --max-states n            stop when n states are stored (only for reach, covreach, concur19 and bitstate)"
+            << std::endl;
+  std::cerr << "   --memory-limit MB         stop when states, transitions, nodes and edges use more than MB megabytes"
+            << std::endl;
+  std::cerr << "                             (only for reach, covreach, concur19 and bitstate)" << std::endl;
+  std::cerr << "   when a limit is reached, reachability is reported as unknown" << std::endl;
+  std::cerr << "   --passed-disk file        store visited states in file instead of memory (only for reach with bfs and"
+            << std::endl;
+  std::cerr << "                             no certificate)" << std::endl;
+  std::cerr << "   --passed-memory MB        memory for states kept in memory with --passed-disk (default: 1024)" << std::endl;
+  std::cerr << "   --bits 2^N                number of bits to store visited states for bitstate (default: 2^30)"
+            << std::endl;
+  std::cerr << "   --hashes k                number of hash functions for bitstate (default: 3)" << std::endl;
+  std::cerr << "   --parent-pointers         store the parent of each node instead of the edges of the graph (only for reach"
+            << std::endl;
+  std::cerr << "                             with a single query, without checkpoint and without graph certificate)"
+            << std::endl;
+  std::cerr << "   --reduced-zones           store the zones of nodes as minimal sets of constraints (only for covreach"
+            << std::endl;
+  std::cerr << "                             with a single query, without checkpoint and without graph certificate)"
+            << std::endl;
+  std::cerr << "   --profile                 report the time spent in successor computation (discrete part, zone semantics,"
+            << std::endl;
+  std::cerr << "                             extrapolation, sharing), covering checks, graph and waiting container operations"
+            << std::endl;
+  std::cerr << "   --progress period         report progress every period (e.g. 10s, 500ms, 5m) on standard error" << std::endl;
+  std::cerr << "   --progress-file file      write progress reports to file as JSON lines (requires --progress)" << std::endl;
+  std::cerr << "   --trace-file file         write a timeline of the run to file (Chrome trace event format, for"
+            << std::endl;
+  std::cerr << "                             chrome://tracing or Perfetto)" << std::endl;
+  std::cerr << "   --stream-graph            output the graph certificate in storage order instead of sorting it in memory"
+            << std::endl;
+  std::cerr << "                             (sort the output with tck-sort-graph to get a deterministic order)" << std::endl;
+  std::cerr << "   --format f                format of the graph certificate: dot (default) or bin (binary, only for"
+            << std::endl;
+  std::cerr << "                             algorithms reach, covreach, aLU-covreach and bwd-covreach, see tck-cert-dot)"
+            << std::endl;
+  std::cerr << "   --model-cache dir         load the parsed model from a cache file in dir if it exists, and write it"
+            << std::endl;
+  std::cerr << "                             otherwise (cache files are keyed by a hash of the model)" << std::endl;
   std::cerr << "reads from standard input if file is not provided" << std::endl;
 }
 
 enum algorithm_t {
-  ALGO_REACH,        /*!< Reachability algorithm */
-  ALGO_CONCUR19,     /*!< Covering reachability algorithm over the local-time zone graph */
-  ALGO_COVREACH,     /*!< Covering reachability algorithm */
-  ALGO_ALU_COVREACH, /*!< Covering reachability algorithm with aLU subsumption*/
-  ALGO_NONE,         /*!< No algorithm */
+  ALGO_REACH,          /*!< Reachability algorithm */
+  ALGO_CONCUR19,       /*!< Covering reachability algorithm over the local-time zone graph */
+  ALGO_COVREACH,       /*!< Covering reachability algorithm */
+  ALGO_ALU_COVREACH,   /*!< Covering reachability algorithm with aLU subsumption*/
+  ALGO_BWD_COVREACH,   /*!< Backward covering reachability algorithm */
+  ALGO_BIDIR_COVREACH, /*!< Bidirectional covering reachability algorithm */
+  ALGO_BITSTATE,       /*!< Reachability algorithm with bitstate hashing */
+  ALGO_NONE,           /*!< No algorithm */
 };
 
 enum certificate_t {
@@ -85,10 +192,34 @@ static bool help = false;                                 /*!< Help flag */
 static enum certificate_t certificate = CERTIFICATE_NONE; /*!< Type of certificate */
 static std::string search_order = "bfs";                  /*!< Search order */
 static std::string labels = "";                           /*!< Searched labels */
+static std::vector<std::string> queries;                  /*!< Searched labels, one for each query */
 static std::string output_file = "";                      /*!< Output file name (empty means standard output) */
 static std::ostream * os = &std::cout;                    /*!< Default output stream */
 static std::size_t block_size = 10000;                    /*!< Size of allocated blocks */
 static std::size_t table_size = 65536;                    /*!< Size of hash tables */
+static std::string checkpoint_file = "";                  /*!< Checkpoint file name (empty means no checkpoint) */
+static std::size_t checkpoint_period = 600;               /*!< Time between two checkpoints (in seconds) */
+static bool resume = false;                               /*!< Resume from checkpoint file */
+static std::size_t time_limit = 0;                        /*!< Time limit in seconds (0 means no limit) */
+static std::size_t max_states = 0;                        /*!< Maximal number of stored states (0 means no limit) */
+static std::size_t memory_limit = 0;                      /*!< Memory limit in megabytes (0 means no limit) */
+static std::string passed_disk_file = "";                 /*!< Disk-backed passed list file (empty means in memory) */
+static std::size_t passed_memory = 1024;                  /*!< Memory for disk-backed passed list (in megabytes) */
+static unsigned int bitstate_log2_bits = 30;              /*!< Logarithm in base 2 of the number of bits for bitstate */
+static unsigned int bitstate_hashes = 3;                  /*!< Number of hash functions for bitstate */
+static bool parent_pointers = false;                      /*!< Store parent pointers instead of edges */
+static bool reduced_zones = false;                        /*!< Store the zones of nodes in reduced form */
+static std::chrono::milliseconds progress_period{0};      /*!< Time between two progress reports (0 means no report) */
+static std::string progress_file = "";                    /*!< Progress file name (empty means standard error) */
+static std::string trace_file = "";                       /*!< Trace file name (empty means no trace) */
+static bool stream_graph = false;                         /*!< Output graph certificate in storage order */
+static bool binary_graph = false;                         /*!< Output graph certificate in binary format */
+static std::string model_cache_dir = "";                  /*!< Model cache directory (empty means no cache) */
+
+/*!
+ \brief Clock reduction of the zone graph (only for reach and covreach)
+ */
+static enum tchecker::zg::clock_reduction_type_t clock_reduction = tchecker::zg::NO_CLOCK_REDUCTION;
 
 /*!
  \brief Check if expected certificate is a path
@@ -100,6 +231,63 @@ static bool is_certificate_path(enum certificate_t ctype)
   return (ctype == CERTIFICATE_SYMBOLIC || ctype == CERTIFICATE_CONCRETE);
 }
 
+/*!
+ \brief Output graph certificate
+ \tparam GRAPH : type of graph
+ \param g : a graph
+ \param name : graph name
+ \param sorted_output : output function that sorts the nodes and edges of g
+ \post g has been output to os in storage order if stream_graph is set, and
+ using sorted_output otherwise
+ */
+template <class GRAPH>
+static void graph_certificate(GRAPH const & g, std::string const & name,
+                              std::ostream & (*sorted_output)(std::ostream &, GRAPH const &, std::string const &))
+{
+  if (stream_graph)
+    tchecker::graph::dot_output_stream(*os, g, name);
+  else
+    sorted_output(*os, g, name);
+}
+
+/*!
+ \brief Output graph certificate over the zone graph
+ \tparam GRAPH : type of graph, with a method zg() that yields the zone graph
+ \param g : a graph
+ \param name : graph name
+ \param sorted_output : output function that sorts the nodes and edges of g
+ \post g has been output to os as a binary certificate if binary_graph is set,
+ and as for graph_certificate otherwise
+ */
+template <class GRAPH>
+static void zg_graph_certificate(GRAPH const & g, std::string const & name,
+                                 std::ostream & (*sorted_output)(std::ostream &, GRAPH const &, std::string const &))
+{
+  if (binary_graph)
+    tchecker::zg::certificate::write(*os, g, g.zg().system(), name);
+  else
+    graph_certificate(g, name, sorted_output);
+}
+
+/*!
+ \brief Parse a power of 2
+ \param s : a string
+ \return N if s is 2^N, or if s is the decimal representation of 2^N
+ \throw std::runtime_error : if s is not a power of 2
+ */
+static unsigned int parse_log2(char const * s)
+{
+  if (s[0] == '2' && s[1] == '^')
+    return static_cast<unsigned int>(std::strtoul(s + 2, nullptr, 10));
+  unsigned long long const n = std::strtoull(s, nullptr, 10);
+  if (n == 0 || (n & (n - 1)) != 0)
+    throw std::runtime_error("Expecting a power of 2: " + std::string(s));
+  unsigned int log2 = 0;
+  while ((1ULL << log2) != n)
+    ++log2;
+  return log2;
+}
+
 /*!
  \brief Parse command-line arguments
  \param argc : number of arguments
@@ -132,6 +320,12 @@ int parse_command_line(int argc, char * argv[])
           algorithm = ALGO_COVREACH;
         else if (strcmp(optarg, "aLU-covreach") == 0)
           algorithm = ALGO_ALU_COVREACH;
+        else if (strcmp(optarg, "bwd-covreach") == 0)
+          algorithm = ALGO_BWD_COVREACH;
+        else if (strcmp(optarg, "bidir-covreach") == 0)
+          algorithm = ALGO_BIDIR_COVREACH;
+        else if (strcmp(optarg, "bitstate") == 0)
+          algorithm = ALGO_BITSTATE;
         else
           throw std::runtime_error("Unknown algorithm: " + std::string(optarg));
         break;
@@ -169,6 +363,70 @@ int parse_command_line(int argc, char * argv[])
         block_size = std::strtoull(optarg, nullptr, 10);
       else if (strcmp(long_options[long_option_index].name, "table-size") == 0)
         table_size = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "checkpoint") == 0)
+        checkpoint_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "checkpoint-period") == 0)
+        checkpoint_period = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "resume") == 0)
+        resume = true;
+      else if (strcmp(long_options[long_option_index].name, "time-limit") == 0)
+        time_limit = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "max-states") == 0)
+        max_states = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "memory-limit") == 0)
+        memory_limit = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "passed-disk") == 0)
+        passed_disk_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "passed-memory") == 0)
+        passed_memory = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "bits") == 0)
+        bitstate_log2_bits = parse_log2(optarg);
+      else if (strcmp(long_options[long_option_index].name, "hashes") == 0)
+        bitstate_hashes = static_cast<unsigned int>(std::strtoul(optarg, nullptr, 10));
+      else if (strcmp(long_options[long_option_index].name, "parent-pointers") == 0)
+        parent_pointers = true;
+      else if (strcmp(long_options[long_option_index].name, "reduced-zones") == 0)
+        reduced_zones = true;
+      else if (strcmp(long_options[long_option_index].name, "profile") == 0)
+        tchecker::profile::enable(true);
+      else if (strcmp(long_options[long_option_index].name, "progress") == 0)
+        progress_period = tchecker::algorithms::parse_progress_period(optarg);
+      else if (strcmp(long_options[long_option_index].name, "progress-file") == 0)
+        progress_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "trace-file") == 0)
+        trace_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "stream-graph") == 0)
+        stream_graph = true;
+      else if (strcmp(long_options[long_option_index].name, "model-cache") == 0)
+        model_cache_dir = optarg;
+      else if (strcmp(long_options[long_option_index].name, "format") == 0) {
+        if (strcmp(optarg, "dot") == 0)
+          binary_graph = false;
+        else if (strcmp(optarg, "bin") == 0)
+          binary_graph = true;
+        else
+          throw std::runtime_error("Unknown certificate format: " + std::string(optarg));
+      }
+      else if (strcmp(long_options[long_option_index].name, "huge-pages") == 0) {
+        if (strcmp(optarg, "auto") == 0)
+          tchecker::set_huge_pages(tchecker::HUGE_PAGES_AUTO);
+        else if (strcmp(optarg, "none") == 0)
+          tchecker::set_huge_pages(tchecker::HUGE_PAGES_NONE);
+        else if (strcmp(optarg, "transparent") == 0)
+          tchecker::set_huge_pages(tchecker::HUGE_PAGES_TRANSPARENT);
+        else if (strcmp(optarg, "explicit") == 0)
+          tchecker::set_huge_pages(tchecker::HUGE_PAGES_EXPLICIT);
+        else
+          throw std::runtime_error("Unknown huge pages policy: " + std::string(optarg));
+      }
+      else if (strcmp(long_options[long_option_index].name, "clock-reduction") == 0) {
+        if (strcmp(optarg, "none") == 0)
+          clock_reduction = tchecker::zg::NO_CLOCK_REDUCTION;
+        else if (strcmp(optarg, "active") == 0)
+          clock_reduction = tchecker::zg::ACTIVE_CLOCKS_REDUCTION;
+        else
+          throw std::runtime_error("Unknown clock reduction: " + std::string(optarg));
+      }
       else
         throw std::runtime_error("This also should never be executed");
     }
@@ -178,73 +436,319 @@ int parse_command_line(int argc, char * argv[])
 }
 
 /*!
- \brief Load a system declaration from a file
+ \brief Budget from command-line options
+ \return resource budget with command-line specified limits
+ */
+static tchecker::algorithms::budget_t budget()
+{
+  return tchecker::algorithms::budget_t{time_limit, max_states, memory_limit << 20};
+}
+
+/*!
+ \brief Load a system of timed processes from a file
  \param filename : file name
- \return pointer to a system declaration loaded from filename, nullptr in case
- of errors
+ \return pointer to a system of timed processes loaded from filename (using the
+ cache in model_cache_dir if not empty), nullptr in case of errors
  \post all errors have been reported to std::cerr
 */
-std::shared_ptr<tchecker::parsing::system_declaration_t> load_system_declaration(std::string const & filename)
+std::shared_ptr<tchecker::ta::system_t const> load_system(std::string const & filename)
 {
-  std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{nullptr};
+  std::shared_ptr<tchecker::ta::system_t const> system{nullptr};
   try {
-    sysdecl = tchecker::parsing::parse_system_declaration(filename);
-    if (sysdecl == nullptr)
-      throw std::runtime_error("nullptr system declaration");
+    if (!model_cache_dir.empty()) {
+      system = tchecker::ta::load_system(filename, model_cache_dir);
+      if (system == nullptr)
+        throw std::runtime_error("nullptr system declaration");
+    }
+    else {
+      std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{tchecker::parsing::parse_system_declaration(filename)};
+      if (sysdecl == nullptr)
+        throw std::runtime_error("nullptr system declaration");
+      if (tchecker::log_error_count() == 0)
+        system = std::make_shared<tchecker::ta::system_t const>(*sysdecl);
+    }
   }
   catch (std::exception const & e) {
     std::cerr << tchecker::log_error << e.what() << std::endl;
   }
-  return sysdecl;
+  return system;
+}
+
+/*!
+ \brief Load queries from a file
+ \param filename : file name
+ \return the list of queries in filename: one comma-separated list of labels per
+ line. Empty lines and lines starting with # are ignored
+ \throw std::runtime_error : if filename cannot be read, or if it does not
+ contain any query
+*/
+std::vector<std::string> load_queries(std::string const & filename)
+{
+  std::ifstream ifs{filename};
+  if (!ifs.good())
+    throw std::runtime_error("Unable to read queries from file " + filename);
+
+  std::vector<std::string> queries;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::size_t const first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#')
+      continue;
+    std::size_t const last = line.find_last_not_of(" \t\r");
+    queries.push_back(line.substr(first, last - first + 1));
+  }
+
+  if (queries.empty())
+    throw std::runtime_error("No query in file " + filename);
+
+  return queries;
+}
+
+/*!
+ \brief Output statistics of a multi-query run
+ \tparam NODE_SPTR : type of pointer to witness nodes
+ \param m : statistics of the run
+ \param witnesses : witness node for each query (nullptr if none)
+ \param budget_exhausted : true if the run has been stopped by a limit
+ \post m augmented with the labels and the reachability of each query has been
+ output to standard output. The reachability of a query without witness is
+ unknown if budget_exhausted is true
+ */
+template <class NODE_SPTR>
+void output_queries_stats(std::map<std::string, std::string> & m, std::vector<NODE_SPTR> const & witnesses,
+                          bool budget_exhausted)
+{
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    m["QUERY_" + std::to_string(i) + "_LABELS"] = queries[i];
+    m["QUERY_" + std::to_string(i) + "_REACHABLE"] =
+        (witnesses[i].ptr() != nullptr ? "true" : (budget_exhausted ? "unknown" : "false"));
+  }
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+}
+
+/*!
+ \brief Output memory statistics of a state space
+ \param m : attributes map
+ \param memsize : memory used by the states and the graph (in bytes)
+ \param nodes : number of nodes in the graph
+ \param collection_stats : statistics on the collections of unused memory
+ \post m augmented with the memory used by the state space, the average memory
+ per node (bytes per node are smaller when TChecker is built with option
+ TCHECKER_COMPACT_REFCOUNT), and the number and pause times of collections
+ */
+void output_memory_stats(std::map<std::string, std::string> & m, std::size_t memsize, std::size_t nodes,
+                         tchecker::collection_stats_t const & collection_stats)
+{
+  m["MEMORY_STATE_SPACE"] = std::to_string(memsize);
+  if (nodes > 0)
+    m["MEMORY_PER_NODE"] = std::to_string(memsize / nodes);
+
+  m["COLLECTIONS"] = std::to_string(collection_stats.collections());
+  m["COLLECTED_CHUNKS"] = std::to_string(collection_stats.collected());
+  std::stringstream sstream;
+  sstream << collection_stats.pause_total();
+  m["COLLECTIONS_PAUSE_TOTAL_SECONDS"] = sstream.str();
+  sstream.str("");
+  sstream << collection_stats.pause_max();
+  m["COLLECTIONS_PAUSE_MAX_SECONDS"] = sstream.str();
 }
 
 /*!
  \brief Perform reachability analysis
- \param sysdecl : system declaration
+ \param system : system of timed processes
  \post statistics on reachability analysis of command-line specified labels in
- the system declared by sysdecl have been output to standard output.
+ system have been output to standard output.
  A certification has been output if required.
 */
-void reach(tchecker::parsing::system_declaration_t const & sysdecl)
+void reach(std::shared_ptr<tchecker::ta::system_t const> const & system)
 {
-  auto && [stats, state_space] = tchecker::tck_reach::zg_reach::run(sysdecl, labels, search_order, block_size, table_size);
+  auto && [stats, state_space] =
+      (checkpoint_file.empty()
+           ? tchecker::tck_reach::zg_reach::run(system, labels, search_order, block_size, table_size, budget(),
+                                                clock_reduction)
+           : tchecker::tck_reach::zg_reach::run_checkpoint(system, labels, search_order, checkpoint_file, checkpoint_period,
+                                                           resume, block_size, table_size, budget(), clock_reduction));
 
   // stats
   std::map<std::string, std::string> m;
   stats.attributes(m);
+  tchecker::collection_stats_t collection_stats = state_space->zg().collection_stats();
+  collection_stats += state_space->graph().collection_stats();
+  output_memory_stats(m, state_space->zg().memsize() + state_space->graph().memsize(), state_space->graph().nodes_count(),
+                      collection_stats);
   for (auto && [key, value] : m)
     std::cout << key << " " << value << std::endl;
 
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
-    tchecker::tck_reach::zg_reach::dot_output(*os, state_space->graph(), sysdecl.name());
+    zg_graph_certificate(state_space->graph(), system->name(), tchecker::tck_reach::zg_reach::dot_output);
   else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
     std::unique_ptr<tchecker::tck_reach::zg_reach::cex::concrete_cex_t> cex{
         tchecker::tck_reach::zg_reach::cex::concrete_counter_example(state_space->graph())};
     if (cex->empty())
       throw std::runtime_error("Unable to compute a concrete counter example");
-    tchecker::tck_reach::zg_reach::cex::dot_output(*os, *cex, sysdecl.name());
+    tchecker::tck_reach::zg_reach::cex::dot_output(*os, *cex, system->name());
   }
   else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable()) {
     std::unique_ptr<tchecker::tck_reach::zg_reach::cex::symbolic_cex_t> cex{
         tchecker::tck_reach::zg_reach::cex::symbolic_counter_example(state_space->graph())};
     if (cex->empty())
       throw std::runtime_error("Unable to compute a symbolic counter example");
-    tchecker::tck_reach::zg_reach::cex::dot_output(*os, *cex, sysdecl.name());
+    tchecker::tck_reach::zg_reach::cex::dot_output(*os, *cex, system->name());
+  }
+}
+
+/*!
+ \brief Perform reachability analysis, storing the parent of each node instead of
+ the edges
+ \param system : system of timed processes
+ \post statistics on reachability analysis of command-line specified labels in
+ system have been output to standard output.
+ A certification has been output if required.
+*/
+void reach_parent(std::shared_ptr<tchecker::ta::system_t const> const & system)
+{
+  auto && [stats, state_space] =
+      tchecker::tck_reach::zg_reach_parent::run(system, labels, search_order, block_size, table_size, budget());
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  tchecker::collection_stats_t collection_stats = state_space->zg().collection_stats();
+  collection_stats += state_space->graph().collection_stats();
+  output_memory_stats(m, state_space->zg().memsize() + state_space->graph().memsize(), state_space->graph().nodes_count(),
+                      collection_stats);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
+    std::unique_ptr<tchecker::tck_reach::zg_reach::cex::concrete_cex_t> cex{
+        tchecker::tck_reach::zg_reach_parent::cex::concrete_counter_example(state_space->graph())};
+    if (cex->empty())
+      throw std::runtime_error("Unable to compute a concrete counter example");
+    tchecker::tck_reach::zg_reach::cex::dot_output(*os, *cex, system->name());
+  }
+  else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable()) {
+    std::unique_ptr<tchecker::tck_reach::zg_reach::cex::symbolic_cex_t> cex{
+        tchecker::tck_reach::zg_reach_parent::cex::symbolic_counter_example(state_space->graph())};
+    if (cex->empty())
+      throw std::runtime_error("Unable to compute a symbolic counter example");
+    tchecker::tck_reach::zg_reach::cex::dot_output(*os, *cex, system->name());
+  }
+}
+
+/*!
+ \brief Perform reachability analysis with a disk-backed passed list
+ \param system : system of timed processes
+ \post statistics on reachability analysis of command-line specified labels in
+ system have been output to standard output
+*/
+void reach_disk(std::shared_ptr<tchecker::ta::system_t const> const & system)
+{
+  tchecker::tck_reach::zg_reach_disk::stats_t stats = tchecker::tck_reach::zg_reach_disk::run(
+      system, labels, passed_disk_file, passed_memory << 20, block_size, table_size, budget());
+
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+}
+
+/*!
+ \brief Perform reachability analysis with bitstate hashing
+ \param system : system of timed processes
+ \post statistics on bitstate reachability analysis of command-line specified
+ labels in system have been output to standard output.
+ A certification has been output if required.
+*/
+void bitstate(std::shared_ptr<tchecker::ta::system_t const> const & system)
+{
+  if (certificate == CERTIFICATE_GRAPH)
+    throw std::runtime_error("Graph certificate is not available for bitstate algorithm");
+
+  auto && [stats, cex] = tchecker::tck_reach::zg_bitstate::run(system, labels, bitstate_log2_bits, bitstate_hashes,
+                                                               block_size, table_size, budget());
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable())
+    tchecker::zg::path::symbolic::dot_output(*os, *cex, system->name());
+  else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
+    std::unique_ptr<tchecker::zg::path::concrete::finite_path_t> concrete_cex{
+        tchecker::zg::path::concrete::compute_finite_path(*cex)};
+    if (concrete_cex->empty())
+      throw std::runtime_error("Unable to compute a concrete counter example");
+    tchecker::zg::path::concrete::dot_output(*os, *concrete_cex, system->name());
+  }
+}
+
+/*!
+ \brief Perform reachability analysis for several queries
+ \param system : system of timed processes
+ \post statistics on reachability analysis of all command-line specified queries
+ in system have been output to standard output.
+ A certification has been output if required (one counter-example for each
+ reachable query).
+*/
+void reach_queries(std::shared_ptr<tchecker::ta::system_t const> const & system)
+{
+  auto && [stats, state_space, witnesses] =
+      (checkpoint_file.empty()
+           ? tchecker::tck_reach::zg_reach::run(system, queries, search_order, block_size, table_size, budget(),
+                                                clock_reduction)
+           : tchecker::tck_reach::zg_reach::run_checkpoint(system, queries, search_order, checkpoint_file, checkpoint_period,
+                                                           resume, block_size, table_size, budget(), clock_reduction));
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  output_queries_stats(m, witnesses, stats.budget_exhausted());
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH) {
+    zg_graph_certificate(state_space->graph(), system->name(), tchecker::tck_reach::zg_reach::dot_output);
+    return;
+  }
+
+  for (std::size_t i = 0; i < witnesses.size(); ++i) {
+    if (witnesses[i].ptr() == nullptr)
+      continue;
+    std::string const name = system->name() + "_query" + std::to_string(i);
+    if (certificate == CERTIFICATE_CONCRETE) {
+      std::unique_ptr<tchecker::tck_reach::zg_reach::cex::concrete_cex_t> cex{
+          tchecker::tck_reach::zg_reach::cex::concrete_counter_example(state_space->graph(), witnesses[i])};
+      if (cex->empty())
+        throw std::runtime_error("Unable to compute a concrete counter example");
+      tchecker::tck_reach::zg_reach::cex::dot_output(*os, *cex, name);
+    }
+    else if (certificate == CERTIFICATE_SYMBOLIC) {
+      std::unique_ptr<tchecker::tck_reach::zg_reach::cex::symbolic_cex_t> cex{
+          tchecker::tck_reach::zg_reach::cex::symbolic_counter_example(state_space->graph(), witnesses[i])};
+      if (cex->empty())
+        throw std::runtime_error("Unable to compute a symbolic counter example");
+      tchecker::tck_reach::zg_reach::cex::dot_output(*os, *cex, name);
+    }
   }
 }
 
 /*!
  \brief Perform covering reachability analysis over the local-time zone graph
- \param sysdecl : system declaration
+ \param system : system of timed processes
  \post statistics on covering reachability analysis of command-line specified
- labels in the system declared by sysdecl have been output to standard output.
+ labels in system have been output to standard output.
  A certification has been output if required.
  \note This is the algorithm presented in R. Govind, Frédéric Herbreteau, B.
  Srivathsan, Igor Walukiewicz: "Revisiting Local Time Semantics for Networks of
  Timed Automata". CONCUR 2019: 16:1-16:15
 */
-void concur19(tchecker::parsing::system_declaration_t const & sysdecl)
+void concur19(std::shared_ptr<tchecker::ta::system_t const> const & system)
 {
   if (certificate == CERTIFICATE_CONCRETE)
     throw std::runtime_error("Concrete counter-example is not available for concur19 algorithm");
@@ -254,7 +758,7 @@ void concur19(tchecker::parsing::system_declaration_t const & sysdecl)
                                         : tchecker::algorithms::covreach::COVERING_FULL);
 
   auto && [stats, state_space] =
-      tchecker::tck_reach::concur19::run(sysdecl, labels, search_order, covering, block_size, table_size);
+      tchecker::tck_reach::concur19::run(system, labels, search_order, covering, block_size, table_size, budget());
 
   // stats
   std::map<std::string, std::string> m;
@@ -264,70 +768,178 @@ void concur19(tchecker::parsing::system_declaration_t const & sysdecl)
 
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
-    tchecker::tck_reach::concur19::dot_output(*os, state_space->graph(), sysdecl.name());
+    graph_certificate(state_space->graph(), system->name(), tchecker::tck_reach::concur19::dot_output);
   else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable()) {
     std::unique_ptr<tchecker::tck_reach::concur19::cex::symbolic::cex_t> cex{
         tchecker::tck_reach::concur19::cex::symbolic::counter_example(state_space->graph())};
     if (cex->empty())
       throw std::runtime_error("Unable to compute a symbolic counter example");
-    tchecker::tck_reach::concur19::cex::symbolic::dot_output(*os, *cex, sysdecl.name());
+    tchecker::tck_reach::concur19::cex::symbolic::dot_output(*os, *cex, system->name());
   }
 }
 
 /*!
  \brief Perform covering reachability analysis
- \param sysdecl : system declaration
+ \param system : system of timed processes
  \post statistics on covering reachability analysis of command-line specified
- labels in the system declared by sysdecl have been output to standard output.
+ labels in system have been output to standard output.
  A certification has been output if required.
 */
-void covreach(tchecker::parsing::system_declaration_t const & sysdecl)
+void covreach(std::shared_ptr<tchecker::ta::system_t const> const & system)
 {
   tchecker::algorithms::covreach::covering_t covering =
       (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
                                         : tchecker::algorithms::covreach::COVERING_FULL);
   auto && [stats, state_space] =
-      tchecker::tck_reach::zg_covreach::run(sysdecl, labels, search_order, covering, block_size, table_size);
+      (checkpoint_file.empty()
+           ? tchecker::tck_reach::zg_covreach::run(system, labels, search_order, covering, block_size, table_size, budget(),
+                                                   clock_reduction)
+           : tchecker::tck_reach::zg_covreach::run_checkpoint(system, labels, search_order, covering, checkpoint_file,
+                                                              checkpoint_period, resume, block_size, table_size,
+                                                              budget(), clock_reduction));
 
   // stats
   std::map<std::string, std::string> m;
   stats.attributes(m);
+  tchecker::collection_stats_t collection_stats = state_space->zg().collection_stats();
+  collection_stats += state_space->graph().collection_stats();
+  output_memory_stats(m, state_space->zg().memsize() + state_space->graph().memsize(), state_space->graph().nodes_count(),
+                      collection_stats);
   for (auto && [key, value] : m)
     std::cout << key << " " << value << std::endl;
 
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
-    tchecker::tck_reach::zg_covreach::dot_output(*os, state_space->graph(), sysdecl.name());
+    zg_graph_certificate(state_space->graph(), system->name(), tchecker::tck_reach::zg_covreach::dot_output);
   else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
     std::unique_ptr<tchecker::tck_reach::zg_covreach::cex::concrete_cex_t> cex{
         tchecker::tck_reach::zg_covreach::cex::concrete_counter_example(state_space->graph())};
     if (cex->empty())
       throw std::runtime_error("Unable to compute a concrete counter example");
-    tchecker::tck_reach::zg_covreach::cex::dot_output(*os, *cex, sysdecl.name());
+    tchecker::tck_reach::zg_covreach::cex::dot_output(*os, *cex, system->name());
   }
   else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable()) {
     std::unique_ptr<tchecker::tck_reach::zg_covreach::cex::symbolic_cex_t> cex{
         tchecker::tck_reach::zg_covreach::cex::symbolic_counter_example(state_space->graph())};
     if (cex->empty())
       throw std::runtime_error("Unable to compute a symbolic counter example");
-    tchecker::tck_reach::zg_covreach::cex::dot_output(*os, *cex, sysdecl.name());
+    tchecker::tck_reach::zg_covreach::cex::dot_output(*os, *cex, system->name());
+  }
+}
+
+/*!
+ \brief Perform covering reachability analysis, storing the zones of nodes in
+ reduced form
+ \param system : system of timed processes
+ \post statistics on covering reachability analysis of command-line specified
+ labels in system have been output to standard output.
+ A certification has been output if required.
+*/
+void covreach_reduced(std::shared_ptr<tchecker::ta::system_t const> const & system)
+{
+  tchecker::algorithms::covreach::covering_t covering =
+      (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
+                                        : tchecker::algorithms::covreach::COVERING_FULL);
+  auto && [stats, state_space] = tchecker::tck_reach::zg_reduced_covreach::run(
+      system, labels, search_order, covering, block_size, table_size, budget(), clock_reduction);
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  tchecker::collection_stats_t collection_stats = state_space->zg().collection_stats();
+  collection_stats += state_space->graph().collection_stats();
+  output_memory_stats(m, state_space->zg().memsize() + state_space->graph().memsize(), state_space->graph().nodes_count(),
+                      collection_stats);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
+    std::unique_ptr<tchecker::tck_reach::zg_covreach::cex::concrete_cex_t> cex{
+        tchecker::tck_reach::zg_reduced_covreach::cex::concrete_counter_example(state_space->graph())};
+    if (cex->empty())
+      throw std::runtime_error("Unable to compute a concrete counter example");
+    tchecker::tck_reach::zg_covreach::cex::dot_output(*os, *cex, system->name());
+  }
+  else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable()) {
+    std::unique_ptr<tchecker::tck_reach::zg_covreach::cex::symbolic_cex_t> cex{
+        tchecker::tck_reach::zg_reduced_covreach::cex::symbolic_counter_example(state_space->graph())};
+    if (cex->empty())
+      throw std::runtime_error("Unable to compute a symbolic counter example");
+    tchecker::tck_reach::zg_covreach::cex::dot_output(*os, *cex, system->name());
+  }
+}
+
+/*!
+ \brief Perform covering reachability analysis for several queries
+ \param system : system of timed processes
+ \post statistics on covering reachability analysis of all command-line
+ specified queries in system have been output to
+ standard output.
+ A certification has been output if required (one counter-example for each
+ reachable query).
+ \note witness nodes are only guaranteed to remain in the graph when covering is
+ restricted to leaf nodes, hence path certificates use leaf-node covering
+*/
+void covreach_queries(std::shared_ptr<tchecker::ta::system_t const> const & system)
+{
+  tchecker::algorithms::covreach::covering_t covering =
+      (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
+                                        : tchecker::algorithms::covreach::COVERING_FULL);
+  auto && [stats, state_space, witnesses] =
+      (checkpoint_file.empty()
+           ? tchecker::tck_reach::zg_covreach::run(system, queries, search_order, covering, block_size, table_size,
+                                                   budget(), clock_reduction)
+           : tchecker::tck_reach::zg_covreach::run_checkpoint(system, queries, search_order, covering, checkpoint_file,
+                                                              checkpoint_period, resume, block_size, table_size,
+                                                              budget(), clock_reduction));
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  output_queries_stats(m, witnesses, stats.budget_exhausted());
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH) {
+    zg_graph_certificate(state_space->graph(), system->name(), tchecker::tck_reach::zg_covreach::dot_output);
+    return;
+  }
+
+  for (std::size_t i = 0; i < witnesses.size(); ++i) {
+    if (witnesses[i].ptr() == nullptr)
+      continue;
+    std::string const name = system->name() + "_query" + std::to_string(i);
+    if (certificate == CERTIFICATE_CONCRETE) {
+      std::unique_ptr<tchecker::tck_reach::zg_covreach::cex::concrete_cex_t> cex{
+          tchecker::tck_reach::zg_covreach::cex::concrete_counter_example(state_space->graph(), witnesses[i])};
+      if (cex->empty())
+        throw std::runtime_error("Unable to compute a concrete counter example");
+      tchecker::tck_reach::zg_covreach::cex::dot_output(*os, *cex, name);
+    }
+    else if (certificate == CERTIFICATE_SYMBOLIC) {
+      std::unique_ptr<tchecker::tck_reach::zg_covreach::cex::symbolic_cex_t> cex{
+          tchecker::tck_reach::zg_covreach::cex::symbolic_counter_example(state_space->graph(), witnesses[i])};
+      if (cex->empty())
+        throw std::runtime_error("Unable to compute a symbolic counter example");
+      tchecker::tck_reach::zg_covreach::cex::dot_output(*os, *cex, name);
+    }
   }
 }
 
 /*!
  \brief Perform covering reachability analysis with aLU subsumption
- \param sysdecl : system declaration
+ \param system : system of timed processes
  \post statistics on aLU covering reachability analysis of command-line specified
- labels in the system declared by sysdecl have been output to standard output.
+ labels in system have been output to standard output.
  A certification has been output if required.
 */
-void alu_covreach(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl)
+void alu_covreach(std::shared_ptr<tchecker::ta::system_t const> const & system)
 {
   tchecker::algorithms::covreach::covering_t covering =
       (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
                                         : tchecker::algorithms::covreach::COVERING_FULL);
   auto && [stats, state_space] =
-      tchecker::tck_reach::zg_alu_covreach::run(sysdecl, labels, search_order, covering, block_size, table_size);
+      tchecker::tck_reach::zg_alu_covreach::run(system, labels, search_order, covering, block_size, table_size);
 
   // stats
   std::map<std::string, std::string> m;
@@ -337,20 +949,105 @@ void alu_covreach(std::shared_ptr<tchecker::parsing::system_declaration_t> const
 
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
-    tchecker::tck_reach::zg_alu_covreach::dot_output(*os, state_space->graph(), sysdecl->name());
+    zg_graph_certificate(state_space->graph(), system->name(), tchecker::tck_reach::zg_alu_covreach::dot_output);
   else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
     std::unique_ptr<tchecker::tck_reach::zg_alu_covreach::cex::concrete_cex_t> cex{
         tchecker::tck_reach::zg_alu_covreach::cex::concrete_counter_example(state_space->graph())};
     if (cex->empty())
       throw std::runtime_error("Unable to compute a concrete counter example");
-    tchecker::tck_reach::zg_alu_covreach::cex::dot_output(*os, *cex, sysdecl->name());
+    tchecker::tck_reach::zg_alu_covreach::cex::dot_output(*os, *cex, system->name());
   }
   else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable()) {
     std::unique_ptr<tchecker::tck_reach::zg_alu_covreach::cex::symbolic_cex_t> cex{
         tchecker::tck_reach::zg_alu_covreach::cex::symbolic_counter_example(state_space->graph())};
     if (cex->empty())
       throw std::runtime_error("Unable to compute a symbolic counter example");
-    tchecker::tck_reach::zg_alu_covreach::cex::dot_output(*os, *cex, sysdecl->name());
+    tchecker::tck_reach::zg_alu_covreach::cex::dot_output(*os, *cex, system->name());
+  }
+}
+
+/*!
+ \brief Perform backward covering reachability analysis
+ \param system : system of timed processes
+ \post statistics on backward covering reachability analysis of command-line
+ specified labels in system have been output to standard
+ output. A certification has been output if required.
+*/
+void bwd_covreach(std::shared_ptr<tchecker::ta::system_t const> const & system)
+{
+  tchecker::algorithms::covreach::covering_t covering =
+      (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
+                                        : tchecker::algorithms::covreach::COVERING_FULL);
+  auto && [stats, state_space] =
+      tchecker::tck_reach::zg_bwd_covreach::run(system, labels, search_order, covering, block_size, table_size);
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH)
+    zg_graph_certificate(state_space->graph(), system->name(), tchecker::tck_reach::zg_bwd_covreach::dot_output);
+  else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
+    std::unique_ptr<tchecker::tck_reach::zg_bwd_covreach::cex::concrete_cex_t> cex{
+        tchecker::tck_reach::zg_bwd_covreach::cex::concrete_counter_example(state_space->graph())};
+    if (cex->empty())
+      throw std::runtime_error("Unable to compute a concrete counter example");
+    tchecker::tck_reach::zg_bwd_covreach::cex::dot_output(*os, *cex, system->name());
+  }
+  else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable()) {
+    std::unique_ptr<tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_cex_t> cex{
+        tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_counter_example(state_space->graph())};
+    if (cex->empty())
+      throw std::runtime_error("Unable to compute a symbolic counter example");
+    tchecker::tck_reach::zg_bwd_covreach::cex::dot_output(*os, *cex, system->name());
+  }
+}
+
+/*!
+ \brief Perform bidirectional covering reachability analysis
+ \param system : system of timed processes
+ \post statistics on bidirectional covering reachability analysis of command-line
+ specified labels in system have been output to standard
+ output. A certification has been output if required (the graph certificate
+ consists of the forward graph followed by the backward graph).
+*/
+void bidir_covreach(std::shared_ptr<tchecker::ta::system_t const> const & system)
+{
+  tchecker::algorithms::covreach::covering_t covering =
+      (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
+                                        : tchecker::algorithms::covreach::COVERING_FULL);
+  auto && [stats, state_space] =
+      tchecker::tck_reach::zg_bwd_covreach::run_bidir(system, labels, search_order, covering, block_size, table_size);
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH) {
+    graph_certificate(state_space->fwd().graph(), system->name() + "_fwd", tchecker::tck_reach::zg_bwd_covreach::dot_output);
+    graph_certificate(state_space->bwd().graph(), system->name() + "_bwd", tchecker::tck_reach::zg_bwd_covreach::dot_output);
+  }
+  else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
+    std::unique_ptr<tchecker::tck_reach::zg_bwd_covreach::cex::concrete_cex_t> cex{
+        tchecker::tck_reach::zg_bwd_covreach::cex::concrete_counter_example(state_space->fwd().graph(),
+                                                                            state_space->bwd().graph())};
+    if (cex->empty())
+      throw std::runtime_error("Unable to compute a concrete counter example");
+    tchecker::tck_reach::zg_bwd_covreach::cex::dot_output(*os, *cex, system->name());
+  }
+  else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable()) {
+    std::unique_ptr<tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_cex_t> cex{
+        tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_counter_example(state_space->fwd().graph(),
+                                                                            state_space->bwd().graph())};
+    if (cex->empty())
+      throw std::runtime_error("Unable to compute a symbolic counter example");
+    tchecker::tck_reach::zg_bwd_covreach::cex::dot_output(*os, *cex, system->name());
   }
 }
 
@@ -368,8 +1065,11 @@ int main(int argc, char * argv[])
       return EXIT_FAILURE;
     }
 
-    if ((certificate == CERTIFICATE_CONCRETE) && (algorithm != ALGO_COVREACH) && (algorithm != ALGO_REACH)) {
-      std::cerr << "Concrete counter-example is only available for algorithms covreach and reach" << std::endl;
+    if ((certificate == CERTIFICATE_CONCRETE) && (algorithm != ALGO_COVREACH) && (algorithm != ALGO_REACH) &&
+        (algorithm != ALGO_BWD_COVREACH) && (algorithm != ALGO_BIDIR_COVREACH) && (algorithm != ALGO_BITSTATE)) {
+      std::cerr << "Concrete counter-example is only available for algorithms covreach, reach, bwd-covreach, "
+                   "bidir-covreach and bitstate"
+                << std::endl;
       return EXIT_FAILURE;
     }
 
@@ -378,18 +1078,109 @@ int main(int argc, char * argv[])
       return EXIT_SUCCESS;
     }
 
+    if (resume && checkpoint_file.empty()) {
+      std::cerr << "Option --resume requires a checkpoint file (option --checkpoint)" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (!checkpoint_file.empty() && (algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH)) {
+      std::cerr << "Checkpoints are only available for algorithms reach and covreach" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if ((clock_reduction != tchecker::zg::NO_CLOCK_REDUCTION) &&
+        (((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH)) || !passed_disk_file.empty() || parent_pointers)) {
+      std::cerr << "Clock reduction is only available for algorithms reach and covreach, without disk-backed passed list "
+                   "and without parent pointers"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if ((time_limit != 0 || max_states != 0 || memory_limit != 0) && (algorithm != ALGO_REACH) &&
+        (algorithm != ALGO_COVREACH) && (algorithm != ALGO_CONCUR19) && (algorithm != ALGO_BITSTATE)) {
+      std::cerr << "Limits are only available for algorithms reach, covreach, concur19 and bitstate" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (!passed_disk_file.empty() && ((algorithm != ALGO_REACH) || (search_order != "bfs") ||
+                                      (certificate != CERTIFICATE_NONE) || (!labels.empty() && labels[0] == '@') ||
+                                      !checkpoint_file.empty())) {
+      std::cerr << "Disk-backed passed list is only available for algorithm reach with bfs search order, a single query, "
+                   "no certificate and no checkpoint"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (parent_pointers && ((algorithm != ALGO_REACH) || (certificate == CERTIFICATE_GRAPH) ||
+                            (!labels.empty() && labels[0] == '@') || !checkpoint_file.empty() || !passed_disk_file.empty())) {
+      std::cerr << "Parent pointers are only available for algorithm reach with a single query, no graph certificate, "
+                   "no checkpoint and no disk-backed passed list"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (reduced_zones && ((algorithm != ALGO_COVREACH) || (certificate == CERTIFICATE_GRAPH) ||
+                          (!labels.empty() && labels[0] == '@') || !checkpoint_file.empty())) {
+      std::cerr << "Reduced zones are only available for algorithm covreach with a single query, no graph certificate "
+                   "and no checkpoint"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (!passed_disk_file.empty() && passed_memory == 0) {
+      std::cerr << "Option --passed-memory expects a positive number of megabytes" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (!progress_file.empty() && progress_period.count() == 0) {
+      std::cerr << "Option --progress-file requires a progress period (option --progress)" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (stream_graph && (certificate != CERTIFICATE_GRAPH)) {
+      std::cerr << "Option --stream-graph requires a graph certificate (option -C graph)" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (binary_graph) {
+      if (certificate != CERTIFICATE_GRAPH) {
+        std::cerr << "Option --format bin requires a graph certificate (option -C graph)" << std::endl;
+        return EXIT_FAILURE;
+      }
+      if (stream_graph) {
+        std::cerr << "Options --format bin and --stream-graph are incompatible" << std::endl;
+        return EXIT_FAILURE;
+      }
+      if ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH) && (algorithm != ALGO_ALU_COVREACH) &&
+          (algorithm != ALGO_BWD_COVREACH)) {
+        std::cerr << "Binary graph certificates are only available for algorithms reach, covreach, aLU-covreach and "
+                     "bwd-covreach"
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    if (!labels.empty() && labels[0] == '@') {
+      if ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH)) {
+        std::cerr << "Multiple queries are only available for algorithms reach and covreach" << std::endl;
+        return EXIT_FAILURE;
+      }
+      queries = load_queries(labels.substr(1));
+    }
+
     std::string input_file = (optindex == argc ? "" : argv[optindex]);
 
-    std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{load_system_declaration(input_file)};
+    std::shared_ptr<tchecker::ta::system_t const> system{load_system(input_file)};
 
-    if (tchecker::log_error_count() > 0)
+    if (system == nullptr || tchecker::log_error_count() > 0)
       return EXIT_FAILURE;
 
     std::shared_ptr<std::ofstream> os_ptr{nullptr};
 
     if (certificate != CERTIFICATE_NONE && output_file != "") {
       try {
-        os_ptr = std::make_shared<std::ofstream>(output_file);
+        std::ios::openmode const mode = (binary_graph ? std::ios::out | std::ios::binary : std::ios::out);
+        os_ptr = std::make_shared<std::ofstream>(output_file, mode);
         os = os_ptr.get();
       }
       catch (std::exception & e) {
@@ -398,18 +1189,61 @@ int main(int argc, char * argv[])
       }
     }
 
+    std::unique_ptr<tchecker::trace::writer_t> trace{nullptr};
+    if (!trace_file.empty())
+      trace = std::make_unique<tchecker::trace::writer_t>(trace_file);
+
+    std::shared_ptr<std::ofstream> progress_os_ptr{nullptr};
+    std::unique_ptr<tchecker::algorithms::progress_reporter_t> progress{nullptr};
+
+    if (progress_period.count() > 0) {
+      if (progress_file.empty())
+        progress = std::make_unique<tchecker::algorithms::progress_reporter_t>(progress_period, std::cerr,
+                                                                               tchecker::algorithms::PROGRESS_TEXT);
+      else {
+        progress_os_ptr = std::make_shared<std::ofstream>(progress_file);
+        if (!progress_os_ptr->is_open()) {
+          std::cerr << tchecker::log_error << "Cannot open progress file " << progress_file << std::endl;
+          return EXIT_FAILURE;
+        }
+        progress = std::make_unique<tchecker::algorithms::progress_reporter_t>(progress_period, *progress_os_ptr,
+                                                                               tchecker::algorithms::PROGRESS_JSON);
+      }
+    }
+
     switch (algorithm) {
     case ALGO_REACH:
-      reach(*sysdecl);
+      if (!passed_disk_file.empty())
+        reach_disk(system);
+      else if (parent_pointers)
+        reach_parent(system);
+      else if (queries.empty())
+        reach(system);
+      else
+        reach_queries(system);
       break;
     case ALGO_CONCUR19:
-      concur19(*sysdecl);
+      concur19(system);
       break;
     case ALGO_COVREACH:
-      covreach(*sysdecl);
+      if (reduced_zones)
+        covreach_reduced(system);
+      else if (queries.empty())
+        covreach(system);
+      else
+        covreach_queries(system);
       break;
     case ALGO_ALU_COVREACH:
-      alu_covreach(sysdecl);
+      alu_covreach(system);
+      break;
+    case ALGO_BWD_COVREACH:
+      bwd_covreach(system);
+      break;
+    case ALGO_BIDIR_COVREACH:
+      bidir_covreach(system);
+      break;
+    case ALGO_BITSTATE:
+      bitstate(system);
       break;
     default:
       throw std::runtime_error("No algorithm specified");
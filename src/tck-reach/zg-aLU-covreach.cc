@@ -184,11 +184,10 @@ std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_alu_covreac
 /* run */
 
 std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_alu_covreach::state_space_t>>
-run(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl, std::string const & labels,
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels,
     std::string const & search_order, tchecker::algorithms::covreach::covering_t covering, std::size_t block_size,
     std::size_t table_size)
 {
-  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
   if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
     std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
 
@@ -306,18 +306,18 @@ public:
 
 /*!
  \brief Run covering reachability algorithm on the zone graph of a system
- \param sysdecl : system declaration
+ \param system : system of timed processes
  \param labels : comma-separated string of labels
  \param search_order : search order
  \param covering : covering policy
  \param block_size : number of elements allocated in one block
  \param table_size : size of hash tables
- \pre labels must appear as node attributes in sysdecl
+ \pre labels must appear as node attributes in system
  search_order must be either "dfs" or "bfs"
  \return statistics on the run and a representation of the state-space as a subsumption graph
  */
 std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_alu_covreach::state_space_t>>
-run(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl, std::string const & labels = "",
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels = "",
     std::string const & search_order = "bfs",
     tchecker::algorithms::covreach::covering_t covering = tchecker::algorithms::covreach::COVERING_FULL,
     std::size_t block_size = 10000, std::size_t table_size = 65536);
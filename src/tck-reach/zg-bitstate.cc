@@ -0,0 +1,236 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/progress.hh"
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/bitstate.hh"
+#include "tchecker/utils/log.hh"
+#include "tchecker/zg/state.hh"
+#include "tchecker/zg/transition.hh"
+#include "tchecker/zg/zg.hh"
+#include "zg-bitstate.hh"
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_bitstate {
+
+/* stats_t */
+
+stats_t::stats_t()
+    : _bits(0), _hashes(0), _stored_states(0), _max_depth(0), _fill_ratio(0.0), _omission_probability(0.0),
+      _expected_omissions(0.0)
+{
+}
+
+uint64_t & stats_t::bits() { return _bits; }
+
+uint64_t stats_t::bits() const { return _bits; }
+
+unsigned int & stats_t::hashes() { return _hashes; }
+
+unsigned int stats_t::hashes() const { return _hashes; }
+
+uint64_t & stats_t::stored_states() { return _stored_states; }
+
+uint64_t stats_t::stored_states() const { return _stored_states; }
+
+uint64_t & stats_t::max_depth() { return _max_depth; }
+
+uint64_t stats_t::max_depth() const { return _max_depth; }
+
+double & stats_t::fill_ratio() { return _fill_ratio; }
+
+double stats_t::fill_ratio() const { return _fill_ratio; }
+
+double & stats_t::omission_probability() { return _omission_probability; }
+
+double stats_t::omission_probability() const { return _omission_probability; }
+
+double & stats_t::expected_omissions() { return _expected_omissions; }
+
+double stats_t::expected_omissions() const { return _expected_omissions; }
+
+void stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  tchecker::algorithms::reach::stats_t::attributes(m);
+
+  std::stringstream sstream;
+
+  sstream << _bits;
+  m["BITSTATE_BITS"] = sstream.str();
+
+  sstream.str("");
+  sstream << _hashes;
+  m["BITSTATE_HASHES"] = sstream.str();
+
+  sstream.str("");
+  sstream << _stored_states;
+  m["STORED_STATES"] = sstream.str();
+
+  sstream.str("");
+  sstream << _max_depth;
+  m["MAX_DEPTH"] = sstream.str();
+
+  sstream.str("");
+  sstream << _fill_ratio;
+  m["BITSTATE_FILL_RATIO"] = sstream.str();
+
+  sstream.str("");
+  sstream << _omission_probability;
+  m["BITSTATE_OMISSION_PROBABILITY"] = sstream.str();
+
+  sstream.str("");
+  sstream << _expected_omissions;
+  m["BITSTATE_EXPECTED_OMISSIONS"] = sstream.str();
+
+  if (!reachable() && _expected_omissions > 0.0)
+    m["REACHABLE"] = "unknown";
+}
+
+/*!
+ \class frame_t
+ \brief Frame of the depth-first search stack
+ */
+class frame_t {
+public:
+  /*!
+   \brief Constructor
+   \param s : a state
+   \param vedge : tuple of edges from the state in the previous frame to s
+   (nullptr for initial states)
+   */
+  frame_t(tchecker::zg::const_state_sptr_t const & s, tchecker::const_vedge_sptr_t const & vedge)
+      : _state(s), _vedge(vedge), _expanded(false), _next(0)
+  {
+  }
+
+  tchecker::zg::const_state_sptr_t _state;     /*!< State */
+  tchecker::const_vedge_sptr_t _vedge;         /*!< Tuple of edges to state */
+  bool _expanded;                              /*!< Flag: successors have been computed */
+  std::vector<tchecker::zg::zg_t::sst_t> _sst; /*!< Successors of state */
+  std::size_t _next;                           /*!< Next successor to visit */
+};
+
+/*!
+ \brief Number of visited states between two collections of unused states
+ */
+static constexpr unsigned long COLLECT_PERIOD = 100000;
+
+std::tuple<tchecker::tck_reach::zg_bitstate::stats_t, std::shared_ptr<tchecker::zg::path::symbolic::finite_path_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, unsigned int log2_bits,
+    unsigned int hashes, std::size_t block_size, std::size_t table_size, tchecker::algorithms::budget_t budget)
+{
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  // states are not shared: only the states on the search stack are in memory
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::NO_SHARING,
+                                                               tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  tchecker::bitstate_t visited{log2_bits, hashes};
+
+  budget.memory_usage([&]() { return zg->memsize() + visited.memsize(); });
+
+  tchecker::tck_reach::zg_bitstate::stats_t stats;
+  stats.set_start_time();
+
+  std::vector<tchecker::tck_reach::zg_bitstate::frame_t> stack;
+  std::vector<tchecker::zg::zg_t::sst_t> initial;
+  zg->initial(initial);
+
+  for (auto && [status, s, t] : initial) {
+    if (!visited.find_else_add(tchecker::zg::hash_value(*s)))
+      continue;
+    stack.emplace_back(tchecker::zg::const_state_sptr_t{s}, tchecker::const_vedge_sptr_t{nullptr});
+
+    while (!stack.empty()) {
+      stats.budget_status() = budget.check(stats.start_time(), visited.size());
+      if (stats.budget_exhausted())
+        break;
+
+      tchecker::tck_reach::zg_bitstate::frame_t & top = stack.back();
+
+      // first visit of top state
+      if (!top._expanded) {
+        ++stats.visited_states();
+        tchecker::algorithms::publish_progress(stats.visited_states(), visited.size(), 0, stack.size());
+        if (stack.size() > stats.max_depth())
+          stats.max_depth() = stack.size();
+
+        if (!accepting_labels.none() && accepting_labels.is_subset_of(zg->labels(top._state)) &&
+            zg->is_valid_final(top._state)) {
+          stats.reachable() = true;
+          break;
+        }
+
+        zg->next(top._state, top._sst);
+        top._expanded = true;
+
+        if (stats.visited_states() % COLLECT_PERIOD == 0)
+          zg->collect();
+      }
+
+      if (top._next < top._sst.size()) {
+        auto & [next_status, next_s, next_t] = top._sst[top._next++];
+        ++stats.visited_transitions();
+        tchecker::zg::const_state_sptr_t next_state{next_s};
+        tchecker::const_vedge_sptr_t next_vedge{next_t->vedge_ptr()};
+        // visited successors are released: only the states on the stack are kept
+        next_s.reset();
+        next_t.reset();
+        if (visited.find_else_add(tchecker::zg::hash_value(*next_state)))
+          stack.emplace_back(next_state, next_vedge); // invalidates top
+      }
+      else
+        stack.pop_back();
+    }
+
+    if (stats.reachable() || stats.budget_exhausted())
+      break;
+  }
+
+  stats.set_end_time();
+
+  stats.bits() = visited.bits();
+  stats.hashes() = visited.hashes();
+  stats.stored_states() = visited.size();
+  stats.fill_ratio() = visited.fill_ratio();
+  stats.omission_probability() = visited.omission_probability();
+  stats.expected_omissions() = visited.expected_omissions();
+
+  std::shared_ptr<tchecker::zg::path::symbolic::finite_path_t> cex{nullptr};
+  if (stats.reachable()) {
+    // recompute the run on the stack in a zone graph with standard semantics and no extrapolation
+    std::shared_ptr<tchecker::zg::zg_t> cex_zg{tchecker::zg::factory(system, tchecker::ts::SHARING,
+                                                                     tchecker::zg::STANDARD_SEMANTICS,
+                                                                     tchecker::zg::NO_EXTRAPOLATION, 128, 128)};
+    std::vector<tchecker::const_vedge_sptr_t> seq;
+    for (std::size_t i = 1; i < stack.size(); ++i)
+      seq.push_back(stack[i]._vedge);
+    cex.reset(tchecker::zg::path::symbolic::compute_finite_path(cex_zg, stack.front()._state->vloc(), seq, true));
+  }
+
+  return std::make_tuple(stats, cex);
+}
+
+} // end of namespace zg_bitstate
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
@@ -0,0 +1,181 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_BITSTATE_ALGORITHM_HH
+#define TCHECKER_ZG_BITSTATE_ALGORITHM_HH
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "tchecker/algorithms/budget.hh"
+#include "tchecker/algorithms/reach/stats.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/zg/path.hh"
+
+/*!
+ \file zg-bitstate.hh
+ \brief Bitstate hashing reachability algorithm over the zone graph
+ */
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_bitstate {
+
+/*!
+ \class stats_t
+ \brief Statistics for bitstate hashing reachability algorithm
+ */
+class stats_t : public tchecker::algorithms::reach::stats_t {
+public:
+  /*!
+   \brief Constructor
+   */
+  stats_t();
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of bits
+   */
+  uint64_t & bits();
+
+  /*!
+   \brief Accessor
+   \return Number of bits
+   */
+  uint64_t bits() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of hash functions
+   */
+  unsigned int & hashes();
+
+  /*!
+   \brief Accessor
+   \return Number of hash functions
+   */
+  unsigned int hashes() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of stored states
+   */
+  uint64_t & stored_states();
+
+  /*!
+   \brief Accessor
+   \return Number of stored states
+   */
+  uint64_t stored_states() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the maximal depth of the search stack
+   */
+  uint64_t & max_depth();
+
+  /*!
+   \brief Accessor
+   \return Maximal depth of the search stack
+   */
+  uint64_t max_depth() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the fraction of bits that are set
+   */
+  double & fill_ratio();
+
+  /*!
+   \brief Accessor
+   \return Fraction of bits that are set
+   */
+  double fill_ratio() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the probability that a new state is missed
+   */
+  double & omission_probability();
+
+  /*!
+   \brief Accessor
+   \return Probability that a new state is missed due to hash collisions
+   */
+  double omission_probability() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the expected number of missed states
+   */
+  double & expected_omissions();
+
+  /*!
+   \brief Accessor
+   \return Expected number of states missed due to hash collisions
+   */
+  double expected_omissions() const;
+
+  /*!
+   \brief Extract statistics as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m. Reachability is unknown if no
+   satisfying state has been found (the search is an under-approximation)
+   */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  uint64_t _bits;               /*!< Number of bits */
+  unsigned int _hashes;         /*!< Number of hash functions */
+  uint64_t _stored_states;      /*!< Number of stored states */
+  uint64_t _max_depth;          /*!< Maximal depth of the search stack */
+  double _fill_ratio;           /*!< Fraction of bits that are set */
+  double _omission_probability; /*!< Probability that a new state is missed */
+  double _expected_omissions;   /*!< Expected number of missed states */
+};
+
+/*!
+ \brief Run bitstate hashing reachability algorithm on the zone graph of a
+ system
+ \param system : system of timed processes
+ \param labels : comma-separated string of labels
+ \param log2_bits : logarithm in base 2 of the number of bits to store visited
+ states
+ \param hashes : number of hash functions
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param budget : resource budget, the memory limit applies to the states and
+ transitions allocated by the algorithm, and to the bit array
+ \pre labels must appear as node attributes in system
+ \return statistics on the run, and a symbolic run from an initial state to a
+ state that satisfies labels if one has been found (nullptr otherwise)
+ \throw std::runtime_error : if clock bounds cannot be computed for system
+ \throw std::invalid_argument : if log2_bits or hashes are out of range (see
+ tchecker::bitstate_t)
+ \note the zone graph is explored in depth-first order. Visited states are
+ stored as hashes bits in a bit array instead of nodes of a graph (see
+ tchecker::bitstate_t). Hash collisions may prune unvisited states: the search
+ is an under-approximation that can find reachable states but not prove
+ unreachability. The run to a satisfying state is taken from the search stack
+ */
+std::tuple<tchecker::tck_reach::zg_bitstate::stats_t, std::shared_ptr<tchecker::zg::path::symbolic::finite_path_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, unsigned int log2_bits,
+    unsigned int hashes, std::size_t block_size = 10000, std::size_t table_size = 65536,
+    tchecker::algorithms::budget_t budget = tchecker::algorithms::budget_t{});
+
+} // end of namespace zg_bitstate
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_BITSTATE_ALGORITHM_HH
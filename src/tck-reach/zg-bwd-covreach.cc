@@ -0,0 +1,401 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "counter_example.hh"
+#include "tchecker/algorithms/search_order.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/ta/state.hh"
+#include "tchecker/utils/log.hh"
+#include "zg-bwd-covreach.hh"
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_bwd_covreach {
+
+/* node_t */
+
+node_t::node_t(tchecker::zg::state_sptr_t const & s, bool initial, bool final)
+    : tchecker::graph::node_flags_t(initial, final), tchecker::graph::node_zg_state_t(s)
+{
+}
+
+node_t::node_t(tchecker::zg::const_state_sptr_t const & s, bool initial, bool final)
+    : tchecker::graph::node_flags_t(initial, final), tchecker::graph::node_zg_state_t(s)
+{
+}
+
+/* node_hash_t */
+
+std::size_t node_hash_t::operator()(tchecker::tck_reach::zg_bwd_covreach::node_t const & n) const
+{
+  // NB: we hash on the values in the discrete (i.e. ta) part of the state in n to
+  // check all nodes with same discrete part for covering and for meeting
+  return tchecker::ta::hash_value(n.state());
+}
+
+/* node_le_t */
+
+bool node_le_t::operator()(tchecker::tck_reach::zg_bwd_covreach::node_t const & n1,
+                           tchecker::tck_reach::zg_bwd_covreach::node_t const & n2) const
+{
+  return tchecker::zg::operator<=(n1.state(), n2.state());
+}
+
+/* node_meet_t */
+
+bool node_meet_t::operator()(tchecker::tck_reach::zg_bwd_covreach::node_t const & n1,
+                             tchecker::tck_reach::zg_bwd_covreach::node_t const & n2)
+{
+  if (!tchecker::ta::operator==(n1.state(), n2.state()))
+    return false;
+
+  tchecker::zg::zone_t const & z1 = n1.state().zone();
+  tchecker::zg::zone_t const & z2 = n2.state().zone();
+  std::size_t const dim = z1.dim();
+  if (z2.dim() != dim)
+    return false;
+
+  _dbm.resize(dim * dim);
+  return (tchecker::dbm::intersection(_dbm.data(), z1.dbm(), z2.dbm(), dim) == tchecker::dbm::NON_EMPTY);
+}
+
+/* edge_t */
+
+edge_t::edge_t(tchecker::zg::transition_t const & t) : tchecker::graph::edge_vedge_t(t.vedge_ptr()) {}
+
+/* graph_t */
+
+graph_t::graph_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
+    : tchecker::graph::subsumption::graph_t<
+          tchecker::tck_reach::zg_bwd_covreach::node_t, tchecker::tck_reach::zg_bwd_covreach::edge_t,
+          tchecker::tck_reach::zg_bwd_covreach::node_hash_t, tchecker::tck_reach::zg_bwd_covreach::node_le_t>(
+          block_size, table_size, tchecker::tck_reach::zg_bwd_covreach::node_hash_t(),
+          tchecker::tck_reach::zg_bwd_covreach::node_le_t()),
+      _zg(zg)
+{
+}
+
+bool graph_t::is_actual_edge(edge_sptr_t const & e) const { return edge_type(e) == tchecker::graph::subsumption::EDGE_ACTUAL; }
+
+void graph_t::attributes(tchecker::tck_reach::zg_bwd_covreach::node_t const & n, std::map<std::string, std::string> & m) const
+{
+  _zg->attributes(n.state_ptr(), m);
+  tchecker::graph::attributes(static_cast<tchecker::graph::node_flags_t const &>(n), m);
+}
+
+void graph_t::attributes(tchecker::tck_reach::zg_bwd_covreach::edge_t const & e, std::map<std::string, std::string> & m) const
+{
+  m["vedge"] = tchecker::to_string(e.vedge(), _zg->system().as_system_system());
+}
+
+/* dot_output */
+
+/*!
+ \class node_lexical_less_t
+ \brief Less-than order on nodes based on lexical ordering
+*/
+class node_lexical_less_t {
+public:
+  /*!
+   \brief Less-than order on nodes based on lexical ordering
+   \param n1 : a node
+   \param n2 : a node
+   \return true if n1 is less-than n2 w.r.t. lexical ordering over the states in
+   the nodes
+  */
+  bool operator()(tchecker::tck_reach::zg_bwd_covreach::graph_t::node_sptr_t const & n1,
+                  tchecker::tck_reach::zg_bwd_covreach::graph_t::node_sptr_t const & n2) const
+  {
+    int state_cmp = tchecker::zg::lexical_cmp(n1->state(), n2->state());
+    if (state_cmp != 0)
+      return (state_cmp < 0);
+    return (tchecker::graph::lexical_cmp(static_cast<tchecker::graph::node_flags_t const &>(*n1),
+                                         static_cast<tchecker::graph::node_flags_t const &>(*n2)) < 0);
+  }
+};
+
+/*!
+ \class edge_lexical_less_t
+ \brief Less-than ordering on edges based on lexical ordering
+ */
+class edge_lexical_less_t {
+public:
+  /*!
+   \brief Less-than ordering on edges based on lexical ordering
+   \param e1 : an edge
+   \param e2 : an edge
+   \return true if e1 is less-than  e2 w.r.t. the tuple of edges in e1 and e2
+  */
+  bool operator()(tchecker::tck_reach::zg_bwd_covreach::graph_t::edge_sptr_t const & e1,
+                  tchecker::tck_reach::zg_bwd_covreach::graph_t::edge_sptr_t const & e2) const
+  {
+    return tchecker::lexical_cmp(e1->vedge(), e2->vedge()) < 0;
+  }
+};
+
+std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_bwd_covreach::graph_t const & g, std::string const & name)
+{
+  return tchecker::graph::subsumption::dot_output<tchecker::tck_reach::zg_bwd_covreach::graph_t,
+                                                  tchecker::tck_reach::zg_bwd_covreach::node_lexical_less_t,
+                                                  tchecker::tck_reach::zg_bwd_covreach::edge_lexical_less_t>(os, g, name);
+}
+
+/* state_space_t */
+
+state_space_t::state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
+    : _ss(zg, zg, block_size, table_size)
+{
+}
+
+tchecker::zg::zg_t & state_space_t::zg() { return _ss.ts(); }
+
+tchecker::tck_reach::zg_bwd_covreach::graph_t & state_space_t::graph() { return _ss.state_space(); }
+
+/* bidir_state_space_t */
+
+bidir_state_space_t::bidir_state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & fwd_zg,
+                                         std::shared_ptr<tchecker::zg::zg_t> const & bwd_zg, std::size_t block_size,
+                                         std::size_t table_size)
+    : _fwd(fwd_zg, block_size, table_size), _bwd(bwd_zg, block_size, table_size)
+{
+}
+
+tchecker::tck_reach::zg_bwd_covreach::state_space_t & bidir_state_space_t::fwd() { return _fwd; }
+
+tchecker::tck_reach::zg_bwd_covreach::state_space_t & bidir_state_space_t::bwd() { return _bwd; }
+
+/* counter example */
+namespace cex {
+
+/*!
+ \brief Extract a sequence of tuples of edges from an initial node in a graph
+ built by a forward search
+ \param g : graph built by a forward search
+ \param seq : sequence of tuples of edges
+ \param initial_vloc : tuple of locations
+ \post if g has a path of actual edges from an initial node to a final node,
+ then the sequence of tuples of edges along this path has been added to seq, and
+ initial_vloc points to the tuple of locations of the initial node
+ \return true if a path has been found, false otherwise
+*/
+static bool fwd_sequence(tchecker::tck_reach::zg_bwd_covreach::graph_t const & g,
+                         std::vector<tchecker::const_vedge_sptr_t> & seq, tchecker::vloc_t const *& initial_vloc)
+{
+  using graph_t = tchecker::tck_reach::zg_bwd_covreach::graph_t;
+
+  tchecker::algorithms::finite_path_extraction_algorithm_t<graph_t> algorithm;
+
+  auto && [found, root, edges] = algorithm.run(g, &tchecker::tck_reach::initial_node<graph_t>,
+                                               &tchecker::tck_reach::final_node<graph_t>,
+                                               &tchecker::tck_reach::actual_edge<graph_t>);
+  if (!found)
+    return false;
+
+  for (graph_t::edge_sptr_t const & e : edges)
+    seq.push_back(e->vedge_ptr());
+  initial_vloc = &root->state().vloc();
+  return true;
+}
+
+/*!
+ \brief Extract a sequence of tuples of edges to a final node in a graph built
+ by a backward search
+ \param g : graph built by a backward search
+ \param seq : sequence of tuples of edges
+ \param initial_vloc : tuple of locations
+ \post if g has a path of actual edges from a final node to an initial node,
+ then the sequence of tuples of edges along the reversed path has been added to
+ seq, and initial_vloc points to the tuple of locations of the initial node
+ \return true if a path has been found, false otherwise
+*/
+static bool bwd_sequence(tchecker::tck_reach::zg_bwd_covreach::graph_t const & g,
+                         std::vector<tchecker::const_vedge_sptr_t> & seq, tchecker::vloc_t const *& initial_vloc)
+{
+  using graph_t = tchecker::tck_reach::zg_bwd_covreach::graph_t;
+
+  tchecker::algorithms::finite_path_extraction_algorithm_t<graph_t> algorithm;
+
+  auto && [found, root, edges] = algorithm.run(g, &tchecker::tck_reach::final_node<graph_t>,
+                                               &tchecker::tck_reach::initial_node<graph_t>,
+                                               &tchecker::tck_reach::actual_edge<graph_t>);
+  if (!found)
+    return false;
+
+  // NB: edges in g go from a node to its predecessors
+  for (auto it = edges.rbegin(); it != edges.rend(); ++it)
+    seq.push_back((*it)->vedge_ptr());
+  initial_vloc = (edges.empty() ? &root->state().vloc() : &g.edge_tgt(edges.back())->state().vloc());
+  return true;
+}
+
+/*!
+ \brief Compute a symbolic run in a zone graph with standard semantics and no extrapolation
+ \param zg : a zone graph
+ \param seq : sequence of tuples of edges
+ \param initial_vloc : tuple of initial locations
+ \return the finite path in a zone graph with standard semantics and no
+ extrapolation from initial_vloc along seq, an empty path if initial_vloc is nullptr
+*/
+static tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_cex_t *
+compute_symbolic_cex(tchecker::zg::zg_t const & zg, std::vector<tchecker::const_vedge_sptr_t> const & seq,
+                     tchecker::vloc_t const * initial_vloc)
+{
+  std::shared_ptr<tchecker::zg::zg_t> cex_zg{tchecker::zg::factory(
+      zg.system_ptr(), zg.sharing_type(), tchecker::zg::STANDARD_SEMANTICS, tchecker::zg::NO_EXTRAPOLATION, 128, 128)};
+
+  if (initial_vloc == nullptr)
+    return new tchecker::zg::path::symbolic::finite_path_t{cex_zg};
+
+  return tchecker::zg::path::symbolic::compute_finite_path(cex_zg, *initial_vloc, seq, true);
+}
+
+tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_bwd_covreach::graph_t const & g)
+{
+  std::vector<tchecker::const_vedge_sptr_t> seq;
+  tchecker::vloc_t const * initial_vloc = nullptr;
+
+  bwd_sequence(g, seq, initial_vloc);
+
+  return compute_symbolic_cex(g.zg(), seq, initial_vloc);
+}
+
+tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_bwd_covreach::graph_t const & fwd_g,
+                         tchecker::tck_reach::zg_bwd_covreach::graph_t const & bwd_g)
+{
+  std::vector<tchecker::const_vedge_sptr_t> seq;
+  tchecker::vloc_t const * fwd_initial_vloc = nullptr;
+  tchecker::vloc_t const * bwd_initial_vloc = nullptr;
+
+  // Prefix from an initial node to the meeting node in fwd_g, then suffix from
+  // the meeting node to a final node in bwd_g. When the searches did not meet,
+  // only one of them finds a sequence
+  fwd_sequence(fwd_g, seq, fwd_initial_vloc);
+  bwd_sequence(bwd_g, seq, bwd_initial_vloc);
+
+  return compute_symbolic_cex(fwd_g.zg(), seq, (fwd_initial_vloc != nullptr ? fwd_initial_vloc : bwd_initial_vloc));
+}
+
+std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_cex_t const & cex,
+                          std::string const & name)
+{
+  return tchecker::zg::path::symbolic::dot_output(os, cex, name);
+}
+
+tchecker::tck_reach::zg_bwd_covreach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_bwd_covreach::graph_t const & g)
+{
+  std::unique_ptr<tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_cex_t> symbolic_cex{symbolic_counter_example(g)};
+  return tchecker::zg::path::concrete::compute_finite_path(*symbolic_cex);
+}
+
+tchecker::tck_reach::zg_bwd_covreach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_bwd_covreach::graph_t const & fwd_g,
+                         tchecker::tck_reach::zg_bwd_covreach::graph_t const & bwd_g)
+{
+  std::unique_ptr<tchecker::tck_reach::zg_bwd_covreach::cex::symbolic_cex_t> symbolic_cex{
+      symbolic_counter_example(fwd_g, bwd_g)};
+  return tchecker::zg::path::concrete::compute_finite_path(*symbolic_cex);
+}
+
+std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_bwd_covreach::cex::concrete_cex_t const & cex,
+                          std::string const & name)
+{
+  return tchecker::zg::path::concrete::dot_output(os, cex, name);
+}
+
+} // namespace cex
+
+/* run */
+
+std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_bwd_covreach::state_space_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, std::string const & search_order,
+    tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size)
+{
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  // NB: the backward zone graph is finite without extrapolation
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::NO_EXTRAPOLATION, block_size, table_size)};
+
+  std::shared_ptr<tchecker::tck_reach::zg_bwd_covreach::state_space_t> state_space =
+      std::make_shared<tchecker::tck_reach::zg_bwd_covreach::state_space_t>(zg, block_size, table_size);
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::fast_remove_waiting_policy(search_order);
+
+  tchecker::algorithms::covreach::stats_t stats;
+  tchecker::tck_reach::zg_bwd_covreach::algorithm_t algorithm;
+
+  if (covering == tchecker::algorithms::covreach::COVERING_FULL)
+    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(state_space->zg(), state_space->graph(),
+                                                                         accepting_labels, policy);
+  else if (covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
+    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(state_space->zg(), state_space->graph(),
+                                                                               accepting_labels, policy);
+  else
+    throw std::invalid_argument("Unknown covering policy for bwd-covreach algorithm");
+
+  return std::make_tuple(stats, state_space);
+}
+
+std::tuple<tchecker::algorithms::bidir_covreach::stats_t,
+           std::shared_ptr<tchecker::tck_reach::zg_bwd_covreach::bidir_state_space_t>>
+run_bidir(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels,
+          std::string const & search_order, tchecker::algorithms::covreach::covering_t covering, std::size_t block_size,
+          std::size_t table_size)
+{
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> fwd_zg{tchecker::zg::factory(system, tchecker::ts::SHARING,
+                                                                   tchecker::zg::ELAPSED_SEMANTICS,
+                                                                   tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+
+  std::shared_ptr<tchecker::zg::zg_t> bwd_zg{tchecker::zg::factory(system, tchecker::ts::SHARING,
+                                                                   tchecker::zg::ELAPSED_SEMANTICS,
+                                                                   tchecker::zg::NO_EXTRAPOLATION, block_size, table_size)};
+
+  std::shared_ptr<tchecker::tck_reach::zg_bwd_covreach::bidir_state_space_t> state_space =
+      std::make_shared<tchecker::tck_reach::zg_bwd_covreach::bidir_state_space_t>(fwd_zg, bwd_zg, block_size, table_size);
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::fast_remove_waiting_policy(search_order);
+
+  tchecker::algorithms::bidir_covreach::stats_t stats;
+  tchecker::tck_reach::zg_bwd_covreach::bidir_algorithm_t algorithm;
+
+  if (covering == tchecker::algorithms::covreach::COVERING_FULL)
+    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(
+        state_space->fwd().zg(), state_space->bwd().zg(), state_space->fwd().graph(), state_space->bwd().graph(),
+        accepting_labels, policy);
+  else if (covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
+    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(
+        state_space->fwd().zg(), state_space->bwd().zg(), state_space->fwd().graph(), state_space->bwd().graph(),
+        accepting_labels, policy);
+  else
+    throw std::invalid_argument("Unknown covering policy for bidir-covreach algorithm");
+
+  return std::make_tuple(stats, state_space);
+}
+
+} // namespace zg_bwd_covreach
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
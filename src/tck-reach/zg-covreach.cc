@@ -7,6 +7,7 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include "checkpoint.hh"
 #include "counter_example.hh"
 #include "tchecker/algorithms/search_order.hh"
 #include "tchecker/system/static_analysis.hh"
@@ -150,6 +151,13 @@ symbolic_counter_example(tchecker::tck_reach::zg_covreach::graph_t const & g)
   return tchecker::tck_reach::symbolic_counter_example_zg<tchecker::tck_reach::zg_covreach::graph_t>(g);
 }
 
+tchecker::tck_reach::zg_covreach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_covreach::graph_t const & g,
+                         tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t const & target)
+{
+  return tchecker::tck_reach::symbolic_counter_example_zg<tchecker::tck_reach::zg_covreach::graph_t>(g, target);
+}
+
 std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_covreach::cex::symbolic_cex_t const & cex,
                           std::string const & name)
 {
@@ -162,6 +170,13 @@ concrete_counter_example(tchecker::tck_reach::zg_covreach::graph_t const & g)
   return tchecker::tck_reach::concrete_counter_example_zg<tchecker::tck_reach::zg_covreach::graph_t>(g);
 }
 
+tchecker::tck_reach::zg_covreach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_covreach::graph_t const & g,
+                         tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t const & target)
+{
+  return tchecker::tck_reach::concrete_counter_example_zg<tchecker::tck_reach::zg_covreach::graph_t>(g, target);
+}
+
 std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_covreach::cex::concrete_cex_t const & cex,
                           std::string const & name)
 {
@@ -173,15 +188,16 @@ std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_covreach::c
 /* run */
 
 std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_covreach::state_space_t>>
-run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::string const & search_order,
-    tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size)
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, std::string const & search_order,
+    tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size,
+    tchecker::algorithms::budget_t budget, enum tchecker::zg::clock_reduction_type_t clock_reduction)
 {
-  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
   if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
     std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
 
   std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
-                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, clock_reduction, block_size,
+                                                               table_size)};
 
   std::shared_ptr<tchecker::tck_reach::zg_covreach::state_space_t> state_space =
       std::make_shared<tchecker::tck_reach::zg_covreach::state_space_t>(zg, block_size, table_size);
@@ -193,15 +209,190 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
   tchecker::algorithms::covreach::stats_t stats;
   tchecker::tck_reach::zg_covreach::algorithm_t algorithm;
 
+  budget.memory_usage([&]() { return state_space->zg().memsize() + state_space->graph().memsize(); });
+
+  if (covering == tchecker::algorithms::covreach::COVERING_FULL)
+    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(state_space->zg(), state_space->graph(),
+                                                                         accepting_labels, policy, budget);
+  else if (covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
+    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(state_space->zg(), state_space->graph(),
+                                                                               accepting_labels, policy, budget);
+  else
+    throw std::invalid_argument("Unknown covering policy for covreach algorithm");
+
+  return std::make_tuple(stats, state_space);
+}
+
+std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_covreach::state_space_t>,
+           std::vector<tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::vector<std::string> const & queries,
+    std::string const & search_order, tchecker::algorithms::covreach::covering_t covering, std::size_t block_size,
+    std::size_t table_size, tchecker::algorithms::budget_t budget, enum tchecker::zg::clock_reduction_type_t clock_reduction)
+{
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, clock_reduction, block_size,
+                                                               table_size)};
+
+  std::shared_ptr<tchecker::tck_reach::zg_covreach::state_space_t> state_space =
+      std::make_shared<tchecker::tck_reach::zg_covreach::state_space_t>(zg, block_size, table_size);
+
+  std::vector<boost::dynamic_bitset<>> accepting_labels;
+  for (std::string const & query : queries)
+    accepting_labels.push_back(system->as_syncprod_system().labels(query));
+
+  std::vector<tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t> witnesses;
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::fast_remove_waiting_policy(search_order);
+
+  tchecker::algorithms::covreach::stats_t stats;
+  tchecker::tck_reach::zg_covreach::algorithm_t algorithm;
+
+  budget.memory_usage([&]() { return state_space->zg().memsize() + state_space->graph().memsize(); });
+
   if (covering == tchecker::algorithms::covreach::COVERING_FULL)
     stats = algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(state_space->zg(), state_space->graph(),
-                                                                         accepting_labels, policy);
+                                                                         accepting_labels, policy, witnesses, budget);
   else if (covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
     stats = algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(state_space->zg(), state_space->graph(),
-                                                                               accepting_labels, policy);
+                                                                               accepting_labels, policy, witnesses, budget);
+  else
+    throw std::invalid_argument("Unknown covering policy for covreach algorithm");
+
+  return std::make_tuple(stats, state_space, witnesses);
+}
+
+/* checkpoint */
+
+/*!
+ \brief Add a node to a graph when loading a checkpoint
+ \param g : a graph
+ \param s : a state
+ \return a node for s, added to g
+ */
+static tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t
+checkpoint_add_node(tchecker::tck_reach::zg_covreach::graph_t & g, tchecker::zg::state_sptr_t const & s)
+{
+  return g.add_node(s);
+}
+
+/*!
+ \brief Add an edge to a graph when loading a checkpoint
+ \param g : a graph
+ \param src : source node
+ \param tgt : target node
+ \param edge_type : type of edge
+ \param t : transition
+ \post an edge from src to tgt with type edge_type and transition t has been added to g
+ */
+static void checkpoint_add_edge(tchecker::tck_reach::zg_covreach::graph_t & g,
+                                tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t const & src,
+                                tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t const & tgt, uint32_t edge_type,
+                                tchecker::zg::transition_t const & t)
+{
+  g.add_edge(src, tgt, static_cast<enum tchecker::graph::subsumption::edge_type_t>(edge_type), t);
+}
+
+/*!
+ \brief Type of an edge when saving a checkpoint
+ \param g : a graph
+ \param e : an edge
+ \return the type of e in g
+ */
+static uint32_t checkpoint_edge_type(tchecker::tck_reach::zg_covreach::graph_t const & g,
+                                     tchecker::tck_reach::zg_covreach::graph_t::edge_sptr_t const & e)
+{
+  return static_cast<uint32_t>(g.edge_type(e));
+}
+
+std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_covreach::state_space_t>,
+           std::vector<tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t>>
+run_checkpoint(std::shared_ptr<tchecker::ta::system_t const> const & system, std::vector<std::string> const & queries,
+               std::string const & search_order, tchecker::algorithms::covreach::covering_t covering,
+               std::string const & checkpoint_file, std::size_t checkpoint_period, bool resume, std::size_t block_size,
+               std::size_t table_size, tchecker::algorithms::budget_t budget,
+               enum tchecker::zg::clock_reduction_type_t clock_reduction)
+{
+  using node_sptr_t = tchecker::tck_reach::zg_covreach::graph_t::node_sptr_t;
+
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, clock_reduction, block_size,
+                                                               table_size)};
+
+  std::shared_ptr<tchecker::tck_reach::zg_covreach::state_space_t> state_space =
+      std::make_shared<tchecker::tck_reach::zg_covreach::state_space_t>(zg, block_size, table_size);
+
+  std::vector<boost::dynamic_bitset<>> accepting_labels;
+  for (std::string const & query : queries)
+    accepting_labels.push_back(system->as_syncprod_system().labels(query));
+
+  std::vector<node_sptr_t> witnesses(queries.size(), node_sptr_t{nullptr});
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::fast_remove_waiting_policy(search_order);
+
+  std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+  tchecker::algorithms::covreach::stats_t stats;
+  tchecker::tck_reach::zg_covreach::algorithm_t algorithm;
+
+  if (resume) {
+    std::vector<node_sptr_t> waiting_nodes;
+    tchecker::tck_reach::checkpoint::load(checkpoint_file, tchecker::tck_reach::checkpoint::KIND_COVREACH, state_space->zg(),
+                                          state_space->graph(), policy, waiting_nodes, witnesses, stats,
+                                          &checkpoint_add_node, &checkpoint_add_edge);
+    tchecker::waiting::fill(*waiting, policy, waiting_nodes.begin(), waiting_nodes.end());
+  }
+
+  stats.set_start_time();
+
+  if (!resume) {
+    std::vector<node_sptr_t> nodes;
+    algorithm.expand_initial_nodes(state_space->zg(), state_space->graph(), nodes, stats);
+    for (node_sptr_t const & n : nodes)
+      waiting->insert(n);
+  }
+
+  tchecker::tck_reach::zg_covreach::algorithm_t::checkpoint_t checkpoint{
+      std::chrono::seconds{checkpoint_period},
+      [&](tchecker::waiting::waiting_t<node_sptr_t> & w, tchecker::algorithms::covreach::stats_t const & st) {
+        std::vector<node_sptr_t> waiting_nodes;
+        tchecker::waiting::elements(w, policy, waiting_nodes);
+        tchecker::tck_reach::checkpoint::save(checkpoint_file, tchecker::tck_reach::checkpoint::KIND_COVREACH,
+                                              state_space->zg(), state_space->graph(), policy, waiting_nodes, witnesses,
+                                              st, &checkpoint_edge_type);
+      }};
+
+  budget.memory_usage([&]() { return state_space->zg().memsize() + state_space->graph().memsize(); });
+
+  if (covering == tchecker::algorithms::covreach::COVERING_FULL)
+    algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(state_space->zg(), state_space->graph(), accepting_labels,
+                                                                 *waiting, witnesses, stats, checkpoint, budget);
+  else if (covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
+    algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(state_space->zg(), state_space->graph(),
+                                                                       accepting_labels, *waiting, witnesses, stats,
+                                                                       checkpoint, budget);
   else
     throw std::invalid_argument("Unknown covering policy for covreach algorithm");
 
+  stats.set_end_time();
+
+  return std::make_tuple(stats, state_space, witnesses);
+}
+
+std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_covreach::state_space_t>>
+run_checkpoint(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels,
+               std::string const & search_order, tchecker::algorithms::covreach::covering_t covering,
+               std::string const & checkpoint_file, std::size_t checkpoint_period, bool resume, std::size_t block_size,
+               std::size_t table_size, tchecker::algorithms::budget_t budget,
+               enum tchecker::zg::clock_reduction_type_t clock_reduction)
+{
+  auto && [stats, state_space, witnesses] =
+      run_checkpoint(system, std::vector<std::string>{labels}, search_order, covering, checkpoint_file, checkpoint_period,
+                     resume, block_size, table_size, budget, clock_reduction);
   return std::make_tuple(stats, state_space);
 }
 
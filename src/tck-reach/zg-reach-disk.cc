@@ -0,0 +1,410 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/progress.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/disk_hashset.hh"
+#include "tchecker/utils/log.hh"
+#include "tchecker/zg/state.hh"
+#include "tchecker/zg/zg.hh"
+#include "zg-reach-disk.hh"
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_reach_disk {
+
+/* stats_t */
+
+stats_t::stats_t() : _stored_states(0), _disk_bytes_read(0), _disk_bytes_written(0), _disk_batches(0), _cache_hits(0) {}
+
+unsigned long & stats_t::stored_states() { return _stored_states; }
+
+unsigned long stats_t::stored_states() const { return _stored_states; }
+
+uint64_t & stats_t::disk_bytes_read() { return _disk_bytes_read; }
+
+uint64_t stats_t::disk_bytes_read() const { return _disk_bytes_read; }
+
+uint64_t & stats_t::disk_bytes_written() { return _disk_bytes_written; }
+
+uint64_t stats_t::disk_bytes_written() const { return _disk_bytes_written; }
+
+uint64_t & stats_t::disk_batches() { return _disk_batches; }
+
+uint64_t stats_t::disk_batches() const { return _disk_batches; }
+
+uint64_t & stats_t::cache_hits() { return _cache_hits; }
+
+uint64_t stats_t::cache_hits() const { return _cache_hits; }
+
+void stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  tchecker::algorithms::reach::stats_t::attributes(m);
+
+  std::stringstream sstream;
+
+  sstream << _stored_states;
+  m["STORED_STATES"] = sstream.str();
+
+  sstream.str("");
+  sstream << _disk_bytes_read;
+  m["DISK_BYTES_READ"] = sstream.str();
+
+  sstream.str("");
+  sstream << _disk_bytes_written;
+  m["DISK_BYTES_WRITTEN"] = sstream.str();
+
+  sstream.str("");
+  sstream << _disk_batches;
+  m["DISK_BATCHES"] = sstream.str();
+
+  sstream.str("");
+  sstream << _cache_hits;
+  m["CACHE_HITS"] = sstream.str();
+}
+
+/*!
+ \class codec_t
+ \brief Encoding of states of a zone graph as keys
+ \note a key consists of the tuple of locations, the integer valuation and the
+ zone in reduced form (see tchecker::dbm::reduce). Reduced DBMs are canonical,
+ hence two states are equal if and only if their keys are equal
+ */
+class codec_t {
+public:
+  /*!
+   \brief Constructor
+   \param zg : zone graph
+   */
+  codec_t(tchecker::zg::zg_t const & zg)
+      : _vloc(zg.system().processes_count()), _intval(zg.system().intvars_count(tchecker::VK_FLATTENED)),
+        _dim(static_cast<tchecker::clock_id_t>(zg.system().clocks_count(tchecker::VK_FLATTENED) + 1)), _dbm(_dim * _dim)
+  {
+  }
+
+  /*!
+   \brief Encode a state
+   \param s : a state
+   \param key : a key
+   \post key is the encoding of s
+   */
+  void encode(tchecker::zg::state_t const & s, std::string & key)
+  {
+    key.clear();
+    for (tchecker::loc_id_t const l : s.vloc())
+      append(key, l);
+    for (tchecker::integer_t const v : s.intval())
+      append(key, v);
+    tchecker::dbm::reduce(s.zone().dbm(), s.zone().dim(), _constraints);
+    for (tchecker::dbm::db_constraint_t const & c : _constraints) {
+      append(key, c.i);
+      append(key, c.j);
+      append(key, c.db);
+    }
+  }
+
+  /*!
+   \brief Decode a state
+   \param zg : zone graph
+   \param key : a key
+   \pre key has been computed by encode on a state of zg
+   \return the state encoded by key, built by zg
+   \throw std::runtime_error : if key is not a valid encoding
+   */
+  tchecker::zg::state_sptr_t decode(tchecker::zg::zg_t & zg, std::string const & key)
+  {
+    char const * p = key.data();
+    char const * const end = p + key.size();
+    for (tchecker::loc_id_t & l : _vloc)
+      p = extract(p, end, l);
+    for (tchecker::integer_t & v : _intval)
+      p = extract(p, end, v);
+    _constraints.clear();
+    while (p != end) {
+      tchecker::dbm::db_constraint_t c;
+      p = extract(p, end, c.i);
+      p = extract(p, end, c.j);
+      p = extract(p, end, c.db);
+      if (c.i >= _dim || c.j >= _dim)
+        throw std::runtime_error("Corrupted state on disk");
+      _constraints.push_back(c);
+    }
+    if (tchecker::dbm::expand(_dbm.data(), _dim, _constraints) == tchecker::dbm::EMPTY)
+      throw std::runtime_error("Corrupted state on disk");
+    return zg.build_state(_vloc, _intval, _dbm);
+  }
+
+private:
+  /*!
+   \brief Append a value to a key
+   */
+  template <class T> static void append(std::string & key, T const & x)
+  {
+    key.append(reinterpret_cast<char const *>(&x), sizeof(x));
+  }
+
+  /*!
+   \brief Extract a value from a key
+   \return pointer past the extracted value
+   \throw std::runtime_error : if there is not enough bytes left
+   */
+  template <class T> static char const * extract(char const * p, char const * end, T & x)
+  {
+    if (static_cast<std::size_t>(end - p) < sizeof(x))
+      throw std::runtime_error("Corrupted state on disk");
+    std::memcpy(&x, p, sizeof(x));
+    return p + sizeof(x);
+  }
+
+  std::vector<tchecker::loc_id_t> _vloc;                    /*!< Buffer for tuples of locations */
+  std::vector<tchecker::integer_t> _intval;                 /*!< Buffer for integer valuations */
+  tchecker::clock_id_t _dim;                                /*!< Dimension of zones */
+  std::vector<tchecker::dbm::db_t> _dbm;                    /*!< Buffer for DBMs */
+  std::vector<tchecker::dbm::db_constraint_t> _constraints; /*!< Buffer for reduced DBMs */
+};
+
+/*!
+ \class layer_t
+ \brief File of keys (states in a layer of a breadth-first search)
+ */
+class layer_t {
+public:
+  /*!
+   \brief Constructor
+   \param filename : name of the file
+   \post the file has been created (or truncated), this layer is empty
+   \throw std::runtime_error : if the file cannot be created
+   */
+  layer_t(std::string const & filename)
+      : _filename(filename), _fs(filename, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc), _size(0),
+        _bytes_read(0), _bytes_written(0)
+  {
+    if (!_fs.good())
+      throw std::runtime_error("Unable to create file " + _filename);
+  }
+
+  /*!
+   \brief Destructor
+   \post the file has been removed
+   */
+  ~layer_t()
+  {
+    _fs.close();
+    std::remove(_filename.c_str());
+  }
+
+  /*!
+   \brief Write a key
+   \param key : a key
+   \post key has been appended to this layer
+   \throw std::runtime_error : if writing fails
+   */
+  void write(std::string const & key)
+  {
+    uint32_t const size = static_cast<uint32_t>(key.size());
+    _fs.write(reinterpret_cast<char const *>(&size), sizeof(size));
+    _fs.write(key.data(), key.size());
+    if (!_fs.good())
+      throw std::runtime_error("Unable to write file " + _filename);
+    ++_size;
+    _bytes_written += sizeof(size) + key.size();
+  }
+
+  /*!
+   \brief Start reading
+   \post the keys in this layer can be read in the order in which they have been
+   written
+   */
+  void rewind()
+  {
+    _fs.flush();
+    _fs.seekg(0);
+    _to_read = _size;
+  }
+
+  /*!
+   \brief Read a key
+   \param key : a key
+   \return true if key has been read, false if all the keys have been read
+   \throw std::runtime_error : if reading fails
+   */
+  bool read(std::string & key)
+  {
+    if (_to_read == 0)
+      return false;
+    uint32_t size;
+    _fs.read(reinterpret_cast<char *>(&size), sizeof(size));
+    key.resize(size);
+    _fs.read(key.data(), size);
+    if (!_fs.good())
+      throw std::runtime_error("Unable to read file " + _filename);
+    --_to_read;
+    _bytes_read += sizeof(size) + size;
+    return true;
+  }
+
+  /*!
+   \brief Clear
+   \post this layer is empty
+   */
+  void clear()
+  {
+    _fs.seekp(0);
+    _size = 0;
+    _to_read = 0;
+  }
+
+  /*!
+   \brief Accessor
+   \return number of keys in this layer
+   */
+  inline std::size_t size() const { return _size; }
+
+  /*!
+   \brief Accessor
+   \return number of bytes read from the file
+   */
+  inline uint64_t bytes_read() const { return _bytes_read; }
+
+  /*!
+   \brief Accessor
+   \return number of bytes written to the file
+   */
+  inline uint64_t bytes_written() const { return _bytes_written; }
+
+private:
+  std::string _filename;   /*!< Name of the file */
+  std::fstream _fs;        /*!< File stream */
+  std::size_t _size;       /*!< Number of keys */
+  std::size_t _to_read{0}; /*!< Number of keys left to read */
+  uint64_t _bytes_read;    /*!< Number of bytes read */
+  uint64_t _bytes_written; /*!< Number of bytes written */
+};
+
+tchecker::tck_reach::zg_reach_disk::stats_t run(std::shared_ptr<tchecker::ta::system_t const> const & system,
+                                                 std::string const & labels, std::string const & filename,
+                                                 std::size_t memory, std::size_t block_size, std::size_t table_size,
+                                                 tchecker::algorithms::budget_t budget)
+{
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  // states are not shared: only the states in the current batch are in memory
+  std::unique_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::NO_SHARING,
+                                                               tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  tchecker::disk_hashset_t passed{filename, memory / 2};
+  layer_t layers[2] = {layer_t{filename + ".layer0"}, layer_t{filename + ".layer1"}};
+  std::size_t current = 0;
+
+  std::size_t const batch_limit = memory / 2;
+  std::vector<std::string> batch;
+  std::size_t batch_bytes = 0;
+  std::vector<bool> added;
+
+  budget.memory_usage([&]() { return zg->memsize() + passed.memsize() + batch_bytes; });
+
+  // looks up the states in batch on disk, and adds the new ones to the next layer
+  auto flush = [&]() {
+    passed.find_else_add(batch, added);
+    for (std::size_t i = 0; i < batch.size(); ++i)
+      if (added[i])
+        layers[1 - current].write(batch[i]);
+    batch.clear();
+    batch_bytes = 0;
+    zg->collect();
+  };
+
+  codec_t codec{*zg};
+
+  auto push = [&](tchecker::zg::state_t const & s) {
+    batch.emplace_back();
+    codec.encode(s, batch.back());
+    batch_bytes += batch.back().size() + sizeof(std::string);
+    if (batch_bytes >= batch_limit)
+      flush();
+  };
+
+  tchecker::tck_reach::zg_reach_disk::stats_t stats;
+  stats.set_start_time();
+
+  std::vector<tchecker::zg::zg_t::sst_t> sst;
+  zg->initial(sst);
+  for (auto && [status, s, t] : sst)
+    push(*s);
+  sst.clear();
+  flush();
+
+  std::string key;
+  while (layers[1 - current].size() != 0 && !stats.reachable() && !stats.budget_exhausted()) {
+    current = 1 - current;
+    layers[current].rewind();
+    layers[1 - current].clear();
+
+    while (layers[current].read(key)) {
+      stats.budget_status() = budget.check(stats.start_time(), passed.size());
+      if (stats.budget_exhausted())
+        break;
+
+      tchecker::zg::const_state_sptr_t s{codec.decode(*zg, key)};
+
+      ++stats.visited_states();
+      // waiting states are those of the next layer
+      tchecker::algorithms::publish_progress(stats.visited_states(), passed.size(), 0,
+                                             layers[1 - current].size() + batch.size());
+
+      if (!accepting_labels.none() && accepting_labels.is_subset_of(zg->labels(s)) && zg->is_valid_final(s)) {
+        stats.reachable() = true;
+        break;
+      }
+
+      zg->next(s, sst);
+      for (auto && [status, next_s, t] : sst) {
+        push(*next_s);
+        ++stats.visited_transitions();
+      }
+      sst.clear();
+    }
+
+    flush();
+  }
+
+  stats.set_end_time();
+
+  stats.stored_states() = passed.size();
+  stats.disk_bytes_read() = passed.bytes_read() + layers[0].bytes_read() + layers[1].bytes_read();
+  stats.disk_bytes_written() = passed.bytes_written() + layers[0].bytes_written() + layers[1].bytes_written();
+  stats.disk_batches() = passed.batches();
+  stats.cache_hits() = passed.cache_hits();
+
+  return stats;
+}
+
+} // end of namespace zg_reach_disk
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
@@ -0,0 +1,153 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_REACH_DISK_ALGORITHM_HH
+#define TCHECKER_ZG_REACH_DISK_ALGORITHM_HH
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "tchecker/algorithms/budget.hh"
+#include "tchecker/algorithms/reach/stats.hh"
+#include "tchecker/parsing/declaration.hh"
+
+/*!
+ \file zg-reach-disk.hh
+ \brief Reachability algorithm over the zone graph with a disk-backed passed
+ list
+ */
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_reach_disk {
+
+/*!
+ \class stats_t
+ \brief Statistics for reachability algorithm with a disk-backed passed list
+ */
+class stats_t : public tchecker::algorithms::reach::stats_t {
+public:
+  /*!
+   \brief Constructor
+   */
+  stats_t();
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of stored states
+   */
+  unsigned long & stored_states();
+
+  /*!
+   \brief Accessor
+   \return Number of stored states
+   */
+  unsigned long stored_states() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of bytes read from disk
+   */
+  uint64_t & disk_bytes_read();
+
+  /*!
+   \brief Accessor
+   \return Number of bytes read from disk
+   */
+  uint64_t disk_bytes_read() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of bytes written to disk
+   */
+  uint64_t & disk_bytes_written();
+
+  /*!
+   \brief Accessor
+   \return Number of bytes written to disk
+   */
+  uint64_t disk_bytes_written() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of batches of states looked up on disk
+   */
+  uint64_t & disk_batches();
+
+  /*!
+   \brief Accessor
+   \return Number of batches of states looked up on disk
+   */
+  uint64_t disk_batches() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of states found in memory
+   */
+  uint64_t & cache_hits();
+
+  /*!
+   \brief Accessor
+   \return Number of states found in memory
+   */
+  uint64_t cache_hits() const;
+
+  /*!
+   \brief Extract statistics as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m
+   */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  unsigned long _stored_states; /*!< Number of stored states */
+  uint64_t _disk_bytes_read;    /*!< Number of bytes read from disk */
+  uint64_t _disk_bytes_written; /*!< Number of bytes written to disk */
+  uint64_t _disk_batches;       /*!< Number of batches of states looked up on disk */
+  uint64_t _cache_hits;         /*!< Number of states found in memory */
+};
+
+/*!
+ \brief Run reachability algorithm on the zone graph of a system, with the set
+ of visited states (passed list) and the states to visit stored on disk
+ \param system : system of timed processes
+ \param labels : comma-separated string of labels
+ \param filename : name of the file that stores the passed list. The states to
+ visit are stored in files filename.layer0 and filename.layer1
+ \param memory : memory for the states that are kept in memory (in bytes)
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param budget : resource budget, the memory limit applies to the states and
+ transitions allocated by the algorithm, and to the states kept in memory
+ \pre labels must appear as node attributes in system
+ \return statistics on the run
+ \post the files have been removed
+ \throw std::runtime_error : if clock bounds cannot be computed for system, or
+ if the files cannot be created
+ \note the zone graph is explored in breadth-first order, one layer at a time,
+ and duplicate states are detected in batches: the successors of visited
+ states are collected in memory until half of memory is used, then they are
+ looked up on disk at once (the other half of memory is a cache of the most
+ recently stored states). Hence runs are slower than tchecker::tck_reach::zg_reach::run
+ but need a bounded amount of memory. No graph is built, hence no certificate
+ can be produced
+ */
+tchecker::tck_reach::zg_reach_disk::stats_t
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, std::string const & filename,
+    std::size_t memory, std::size_t block_size = 10000, std::size_t table_size = 65536,
+    tchecker::algorithms::budget_t budget = tchecker::algorithms::budget_t{});
+
+} // end of namespace zg_reach_disk
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_REACH_DISK_ALGORITHM_HH
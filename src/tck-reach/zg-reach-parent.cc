@@ -0,0 +1,95 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "counter_example.hh"
+#include "tchecker/algorithms/search_order.hh"
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/log.hh"
+#include "zg-reach-parent.hh"
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_reach_parent {
+
+/* graph_t */
+
+graph_t::graph_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
+    : tchecker::graph::parent::graph_t<tchecker::tck_reach::zg_reach::node_t, tchecker::tck_reach::zg_reach::node_hash_t,
+                                       tchecker::tck_reach::zg_reach::node_equal_to_t>(
+          block_size, table_size, tchecker::tck_reach::zg_reach::node_hash_t(),
+          tchecker::tck_reach::zg_reach::node_equal_to_t()),
+      _zg(zg)
+{
+}
+
+/* state_space_t */
+
+state_space_t::state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
+    : _ss(zg, zg, block_size, table_size)
+{
+}
+
+tchecker::zg::zg_t & state_space_t::zg() { return _ss.ts(); }
+
+tchecker::tck_reach::zg_reach_parent::graph_t & state_space_t::graph() { return _ss.state_space(); }
+
+/* counter example */
+namespace cex {
+
+tchecker::tck_reach::zg_reach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_reach_parent::graph_t const & g)
+{
+  return tchecker::tck_reach::symbolic_counter_example_parent_zg<tchecker::tck_reach::zg_reach_parent::graph_t>(g);
+}
+
+tchecker::tck_reach::zg_reach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_reach_parent::graph_t const & g)
+{
+  return tchecker::tck_reach::concrete_counter_example_parent_zg<tchecker::tck_reach::zg_reach_parent::graph_t>(g);
+}
+
+} // namespace cex
+
+/* run */
+
+std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach_parent::state_space_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, std::string const & search_order,
+    std::size_t block_size, std::size_t table_size, tchecker::algorithms::budget_t budget)
+{
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+
+  std::shared_ptr<tchecker::tck_reach::zg_reach_parent::state_space_t> state_space =
+      std::make_shared<tchecker::tck_reach::zg_reach_parent::state_space_t>(zg, block_size, table_size);
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  tchecker::tck_reach::zg_reach_parent::algorithm_t algorithm;
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::waiting_policy(search_order);
+
+  budget.memory_usage([&]() { return state_space->zg().memsize() + state_space->graph().memsize(); });
+
+  tchecker::algorithms::reach::stats_t stats =
+      algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, policy, budget);
+
+  return std::make_tuple(stats, state_space);
+}
+
+} // namespace zg_reach_parent
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
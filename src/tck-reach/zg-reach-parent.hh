@@ -0,0 +1,169 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_REACH_PARENT_ALGORITHM_HH
+#define TCHECKER_ZG_REACH_PARENT_ALGORITHM_HH
+
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "tchecker/algorithms/budget.hh"
+#include "tchecker/algorithms/reach/algorithm.hh"
+#include "tchecker/algorithms/reach/stats.hh"
+#include "tchecker/graph/parent_graph.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/ts/state_space.hh"
+#include "tchecker/zg/path.hh"
+#include "tchecker/zg/zg.hh"
+#include "zg-reach.hh"
+
+/*!
+ \file zg-reach-parent.hh
+ \brief Reachability algorithm over the zone graph that only keeps the parent
+ of each node
+ */
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_reach_parent {
+
+/*!
+ \class graph_t
+ \brief Graph over the zone graph that keeps the parent of each node instead of
+ its edges
+*/
+class graph_t
+    : public tchecker::graph::parent::graph_t<tchecker::tck_reach::zg_reach::node_t, tchecker::tck_reach::zg_reach::node_hash_t,
+                                              tchecker::tck_reach::zg_reach::node_equal_to_t> {
+public:
+  /*!
+   \brief Constructor
+   \param zg : zone graph
+   \param block_size : number of objects allocated in a block
+   \param table_size : size of hash table
+   \note this keeps a pointer on zg
+   \note this graph keeps pointers to (part of) states and (part of) transitions
+   allocated by zg. Hence, the graph must be destroyed *before* zg is destroyed.
+   See state_space_t below
+  */
+  graph_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size);
+
+  /*!
+   \brief Accessor
+   \return internal zone graph
+  */
+  inline tchecker::zg::zg_t const & zg() const { return *_zg; }
+
+private:
+  std::shared_ptr<tchecker::zg::zg_t> _zg; /*!< Zone graph */
+};
+
+/*!
+ \class state_space_t
+ \brief State-space representation consisting of a zone graph and a graph of
+ parent nodes
+ */
+class state_space_t {
+public:
+  /*!
+   \brief Constructor
+   \param zg : zone graph
+   \param block_size : number of objects allocated in a block
+   \param table_size : size of hash table
+   \note this keeps a pointer on zg
+   */
+  state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size);
+
+  /*!
+   \brief Accessor
+   \return The zone graph
+   */
+  tchecker::zg::zg_t & zg();
+
+  /*!
+   \brief Accessor
+   \return The graph of parent nodes representing the state-space
+   */
+  tchecker::tck_reach::zg_reach_parent::graph_t & graph();
+
+private:
+  tchecker::ts::state_space_t<tchecker::zg::zg_t, tchecker::tck_reach::zg_reach_parent::graph_t>
+      _ss; /*!< State-space representation */
+};
+
+namespace cex {
+
+/*!
+ \brief Compute a symbolic counter-example from a graph of parent nodes
+ \param g : graph of parent nodes over a zone graph
+ \return a finite path from an initial node to a final node in g if any, an
+ empty path otherwise
+ \note the returned pointer shall be deleted
+ \note the path is computed from the parent pointers of the final node, without
+ any search in g
+*/
+tchecker::tck_reach::zg_reach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_reach_parent::graph_t const & g);
+
+/*!
+ \brief Compute a concrete counter-example from a graph of parent nodes
+ \param g : graph of parent nodes over a zone graph
+ \return a finite path from an initial node to a final node in g with concrete
+ clock valuations if any, an empty path otherwise
+ \note the returned pointer shall be deleted
+*/
+tchecker::tck_reach::zg_reach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_reach_parent::graph_t const & g);
+
+} // namespace cex
+
+/*!
+ \class algorithm_t
+ \brief Reachability algorithm over the zone graph that keeps the parent of each
+ node
+*/
+class algorithm_t
+    : public tchecker::algorithms::reach::algorithm_t<tchecker::zg::zg_t, tchecker::tck_reach::zg_reach_parent::graph_t> {
+public:
+  using tchecker::algorithms::reach::algorithm_t<tchecker::zg::zg_t, tchecker::tck_reach::zg_reach_parent::graph_t>::algorithm_t;
+};
+
+/*!
+ \brief Run reachability algorithm on the zone graph of a system, keeping only
+ the parent of each node
+ \param system : system of timed processes
+ \param labels : comma-separated string of labels
+ \param search_order : search order
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param budget : resource budget, the memory limit applies to the states,
+ transitions and nodes allocated by the algorithm
+ \pre labels must appear as node attributes in system
+ search_order must be either "dfs" or "bfs"
+ \return statistics on the run and a representation of the state-space as a
+ graph of parent nodes (partial if budget has been exhausted)
+ \throw std::runtime_error : if clock bounds cannot be computed for system
+ \note visits the same states as tchecker::tck_reach::zg_reach::run, but stores
+ no edge: each node only keeps a pointer to its parent and the vedge from its
+ parent. This is enough to compute symbolic and concrete counter-examples, while
+ using about as much memory as a run without certificate
+ */
+std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach_parent::state_space_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels = "",
+    std::string const & search_order = "bfs", std::size_t block_size = 10000, std::size_t table_size = 65536,
+    tchecker::algorithms::budget_t budget = tchecker::algorithms::budget_t{});
+
+} // end of namespace zg_reach_parent
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_REACH_PARENT_ALGORITHM_HH
@@ -9,6 +9,7 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include "checkpoint.hh"
 #include "counter_example.hh"
 #include "tchecker/algorithms/search_order.hh"
 #include "tchecker/system/static_analysis.hh"
@@ -147,6 +148,13 @@ tchecker::tck_reach::zg_reach::cex::symbolic_cex_t * symbolic_counter_example(tc
   return tchecker::tck_reach::symbolic_counter_example_zg<tchecker::tck_reach::zg_reach::graph_t>(g);
 }
 
+tchecker::tck_reach::zg_reach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_reach::graph_t const & g,
+                         tchecker::tck_reach::zg_reach::graph_t::node_sptr_t const & target)
+{
+  return tchecker::tck_reach::symbolic_counter_example_zg<tchecker::tck_reach::zg_reach::graph_t>(g, target);
+}
+
 std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_reach::cex::symbolic_cex_t const & cex,
                           std::string const & name)
 {
@@ -158,6 +166,13 @@ tchecker::tck_reach::zg_reach::cex::concrete_cex_t * concrete_counter_example(tc
   return tchecker::tck_reach::concrete_counter_example_zg<tchecker::tck_reach::zg_reach::graph_t>(g);
 }
 
+tchecker::tck_reach::zg_reach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_reach::graph_t const & g,
+                         tchecker::tck_reach::zg_reach::graph_t::node_sptr_t const & target)
+{
+  return tchecker::tck_reach::concrete_counter_example_zg<tchecker::tck_reach::zg_reach::graph_t>(g, target);
+}
+
 std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_reach::cex::concrete_cex_t const & cex,
                           std::string const & name)
 {
@@ -169,15 +184,16 @@ std::ostream & dot_output(std::ostream & os, tchecker::tck_reach::zg_reach::cex:
 /* run */
 
 std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t>>
-run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::string const & search_order,
-    std::size_t block_size, std::size_t table_size)
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, std::string const & search_order,
+    std::size_t block_size, std::size_t table_size, tchecker::algorithms::budget_t budget,
+    enum tchecker::zg::clock_reduction_type_t clock_reduction)
 {
-  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
   if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
     std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
 
   std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
-                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, clock_reduction, block_size,
+                                                               table_size)};
 
   std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t> state_space =
       std::make_shared<tchecker::tck_reach::zg_reach::state_space_t>(zg, block_size, table_size);
@@ -188,8 +204,168 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
 
   enum tchecker::waiting::policy_t policy = tchecker::algorithms::waiting_policy(search_order);
 
-  tchecker::algorithms::reach::stats_t stats = algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, policy);
+  budget.memory_usage([&]() { return state_space->zg().memsize() + state_space->graph().memsize(); });
+
+  tchecker::algorithms::reach::stats_t stats =
+      algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, policy, budget);
+
+  return std::make_tuple(stats, state_space);
+}
+
+std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t>,
+           std::vector<tchecker::tck_reach::zg_reach::graph_t::node_sptr_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::vector<std::string> const & queries,
+    std::string const & search_order, std::size_t block_size, std::size_t table_size, tchecker::algorithms::budget_t budget,
+    enum tchecker::zg::clock_reduction_type_t clock_reduction)
+{
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, clock_reduction, block_size,
+                                                               table_size)};
+
+  std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t> state_space =
+      std::make_shared<tchecker::tck_reach::zg_reach::state_space_t>(zg, block_size, table_size);
 
+  std::vector<boost::dynamic_bitset<>> accepting_labels;
+  for (std::string const & query : queries)
+    accepting_labels.push_back(system->as_syncprod_system().labels(query));
+
+  std::vector<tchecker::tck_reach::zg_reach::graph_t::node_sptr_t> witnesses;
+
+  tchecker::tck_reach::zg_reach::algorithm_t algorithm;
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::waiting_policy(search_order);
+
+  budget.memory_usage([&]() { return state_space->zg().memsize() + state_space->graph().memsize(); });
+
+  tchecker::algorithms::reach::stats_t stats =
+      algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, policy, witnesses, budget);
+
+  return std::make_tuple(stats, state_space, witnesses);
+}
+
+/* checkpoint */
+
+/*!
+ \brief Add a node to a graph when loading a checkpoint
+ \param g : a graph
+ \param s : a state
+ \return the node for s in g
+ */
+static tchecker::tck_reach::zg_reach::graph_t::node_sptr_t
+checkpoint_add_node(tchecker::tck_reach::zg_reach::graph_t & g, tchecker::zg::state_sptr_t const & s)
+{
+  return std::get<1>(g.add_node(s));
+}
+
+/*!
+ \brief Add an edge to a graph when loading a checkpoint
+ \param g : a graph
+ \param src : source node
+ \param tgt : target node
+ \param t : transition
+ \post an edge from src to tgt with transition t has been added to g
+ */
+static void checkpoint_add_edge(tchecker::tck_reach::zg_reach::graph_t & g,
+                                tchecker::tck_reach::zg_reach::graph_t::node_sptr_t const & src,
+                                tchecker::tck_reach::zg_reach::graph_t::node_sptr_t const & tgt, uint32_t,
+                                tchecker::zg::transition_t const & t)
+{
+  g.add_edge(src, tgt, t);
+}
+
+/*!
+ \brief Type of an edge when saving a checkpoint
+ \return 0 (reachability graphs have a single type of edges)
+ */
+static uint32_t checkpoint_edge_type(tchecker::tck_reach::zg_reach::graph_t const &,
+                                     tchecker::tck_reach::zg_reach::graph_t::edge_sptr_t const &)
+{
+  return 0;
+}
+
+std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t>,
+           std::vector<tchecker::tck_reach::zg_reach::graph_t::node_sptr_t>>
+run_checkpoint(std::shared_ptr<tchecker::ta::system_t const> const & system, std::vector<std::string> const & queries,
+               std::string const & search_order, std::string const & checkpoint_file, std::size_t checkpoint_period,
+               bool resume, std::size_t block_size, std::size_t table_size, tchecker::algorithms::budget_t budget,
+               enum tchecker::zg::clock_reduction_type_t clock_reduction)
+{
+  using node_sptr_t = tchecker::tck_reach::zg_reach::graph_t::node_sptr_t;
+
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, clock_reduction, block_size,
+                                                               table_size)};
+
+  std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t> state_space =
+      std::make_shared<tchecker::tck_reach::zg_reach::state_space_t>(zg, block_size, table_size);
+
+  std::vector<boost::dynamic_bitset<>> accepting_labels;
+  for (std::string const & query : queries)
+    accepting_labels.push_back(system->as_syncprod_system().labels(query));
+
+  std::vector<node_sptr_t> witnesses(queries.size(), node_sptr_t{nullptr});
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::waiting_policy(search_order);
+
+  std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+  tchecker::algorithms::reach::stats_t stats;
+  tchecker::tck_reach::zg_reach::algorithm_t algorithm;
+
+  if (resume) {
+    std::vector<node_sptr_t> waiting_nodes;
+    tchecker::tck_reach::checkpoint::load(checkpoint_file, tchecker::tck_reach::checkpoint::KIND_REACH, state_space->zg(),
+                                          state_space->graph(), policy, waiting_nodes, witnesses, stats,
+                                          &checkpoint_add_node, &checkpoint_add_edge);
+    tchecker::waiting::fill(*waiting, policy, waiting_nodes.begin(), waiting_nodes.end());
+  }
+
+  stats.set_start_time();
+
+  if (!resume) {
+    std::vector<tchecker::zg::zg_t::sst_t> sst;
+    state_space->zg().initial(sst);
+    for (auto && [status, s, t] : sst) {
+      auto && [is_new_node, initial_node] = state_space->graph().add_node(s);
+      initial_node->initial(true);
+      if (is_new_node)
+        waiting->insert(initial_node);
+    }
+  }
+
+  tchecker::tck_reach::zg_reach::algorithm_t::checkpoint_t checkpoint{
+      std::chrono::seconds{checkpoint_period},
+      [&](tchecker::waiting::waiting_t<node_sptr_t> & w, tchecker::algorithms::reach::stats_t const & st) {
+        std::vector<node_sptr_t> waiting_nodes;
+        tchecker::waiting::elements(w, policy, waiting_nodes);
+        tchecker::tck_reach::checkpoint::save(checkpoint_file, tchecker::tck_reach::checkpoint::KIND_REACH, state_space->zg(),
+                                              state_space->graph(), policy, waiting_nodes, witnesses, st,
+                                              &checkpoint_edge_type);
+      }};
+
+  budget.memory_usage([&]() { return state_space->zg().memsize() + state_space->graph().memsize(); });
+
+  algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, *waiting, witnesses, stats, checkpoint, budget);
+
+  stats.set_end_time();
+
+  return std::make_tuple(stats, state_space, witnesses);
+}
+
+std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t>>
+run_checkpoint(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels,
+               std::string const & search_order, std::string const & checkpoint_file, std::size_t checkpoint_period,
+               bool resume, std::size_t block_size, std::size_t table_size, tchecker::algorithms::budget_t budget,
+               enum tchecker::zg::clock_reduction_type_t clock_reduction)
+{
+  auto && [stats, state_space, witnesses] =
+      run_checkpoint(system, std::vector<std::string>{labels}, search_order, checkpoint_file, checkpoint_period, resume,
+                     block_size, table_size, budget, clock_reduction);
   return std::make_tuple(stats, state_space);
 }
 
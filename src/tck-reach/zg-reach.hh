@@ -12,7 +12,9 @@
 #include <ostream>
 #include <string>
 #include <tuple>
+#include <vector>
 
+#include "tchecker/algorithms/budget.hh"
 #include "tchecker/algorithms/reach/algorithm.hh"
 #include "tchecker/algorithms/reach/stats.hh"
 #include "tchecker/graph/edge.hh"
@@ -224,6 +226,17 @@ using symbolic_cex_t = tchecker::zg::path::symbolic::finite_path_t;
 */
 tchecker::tck_reach::zg_reach::cex::symbolic_cex_t * symbolic_counter_example(tchecker::tck_reach::zg_reach::graph_t const & g);
 
+/*!
+ \brief Compute a symbolic counter-example to a given node
+ \param g : reachability graph on a zone graph
+ \param target : a node of g
+ \return a finite path from an initial node of g to target if any, nullptr otherwise
+ \note the returned pointer shall be deleted
+*/
+tchecker::tck_reach::zg_reach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_reach::graph_t const & g,
+                         tchecker::tck_reach::zg_reach::graph_t::node_sptr_t const & target);
+
 /*!
  \brief Symbolic counter-example output
  \param os : output stream
@@ -249,6 +262,18 @@ using concrete_cex_t = tchecker::zg::path::concrete::finite_path_t;
 */
 tchecker::tck_reach::zg_reach::cex::concrete_cex_t * concrete_counter_example(tchecker::tck_reach::zg_reach::graph_t const & g);
 
+/*!
+ \brief Compute a concrete counter-example to a given node
+ \param g : reachability graph on a zone graph
+ \param target : a node of g
+ \return a finite path from an initial node of g to target with concrete clock valuations if any,
+ nullptr otherwise
+ \note the returned pointer shall be deleted
+*/
+tchecker::tck_reach::zg_reach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_reach::graph_t const & g,
+                         tchecker::tck_reach::zg_reach::graph_t::node_sptr_t const & target);
+
 /*!
  \brief Concrete counter-example output
  \param os : output stream
@@ -274,19 +299,114 @@ public:
 
 /*!
  \brief Run reachability algorithm on the zone graph of a system
- \param sysdecl : system declaration
+ \param system : system of timed processes
+ \param labels : comma-separated string of labels
+ \param search_order : search order
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param budget : resource budget, the memory limit applies to the states,
+ transitions, nodes and edges allocated by the algorithm
+ \param clock_reduction : type of clock reduction (see tchecker::zg::factory)
+ \pre labels must appear as node attributes in system
+ search_order must be either "dfs" or "bfs"
+ \return statistics on the run and a representation of the state-space as a reachability graph
+ (partial if budget has been exhausted)
+ \throw std::runtime_error : if clock bounds cannot be computed for system
+ */
+std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels = "",
+    std::string const & search_order = "bfs", std::size_t block_size = 10000, std::size_t table_size = 65536,
+    tchecker::algorithms::budget_t budget = tchecker::algorithms::budget_t{},
+    enum tchecker::zg::clock_reduction_type_t clock_reduction = tchecker::zg::NO_CLOCK_REDUCTION);
+
+/*!
+ \brief Run reachability algorithm on the zone graph of a system for several queries
+ \param system : system of timed processes
+ \param queries : comma-separated strings of labels, one for each query
+ \param search_order : search order
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param budget : resource budget, the memory limit applies to the states,
+ transitions, nodes and edges allocated by the algorithm
+ \param clock_reduction : type of clock reduction (see tchecker::zg::factory)
+ \pre labels in queries must appear as node attributes in system
+ search_order must be either "dfs" or "bfs"
+ \return statistics on the run, a representation of the state-space as a reachability graph, and
+ for each query, the first node that satisfies the query if any, nullptr otherwise
+ \throw std::runtime_error : if clock bounds cannot be computed for system
+ */
+std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t>,
+           std::vector<tchecker::tck_reach::zg_reach::graph_t::node_sptr_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::vector<std::string> const & queries,
+    std::string const & search_order = "bfs", std::size_t block_size = 10000, std::size_t table_size = 65536,
+    tchecker::algorithms::budget_t budget = tchecker::algorithms::budget_t{},
+    enum tchecker::zg::clock_reduction_type_t clock_reduction = tchecker::zg::NO_CLOCK_REDUCTION);
+
+/*!
+ \brief Run reachability algorithm on the zone graph of a system for several queries, with checkpoints
+ \param system : system of timed processes
+ \param queries : comma-separated strings of labels, one for each query
+ \param search_order : search order
+ \param checkpoint_file : name of checkpoint file
+ \param checkpoint_period : time between two checkpoints (in seconds, 0 means no periodic checkpoint)
+ \param resume : resume flag
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param budget : resource budget, the memory limit applies to the states,
+ transitions, nodes and edges allocated by the algorithm
+ \param clock_reduction : type of clock reduction (see tchecker::zg::factory)
+ \pre labels in queries must appear as node attributes in system
+ search_order must be either "dfs" or "bfs"
+ \post if resume is true, the run has been resumed from the graph, waiting nodes, witnesses and statistics saved
+ in checkpoint_file. Otherwise, the run has started from the initial states. The state of the run has been saved
+ to checkpoint_file every checkpoint_period seconds
+ \return statistics on the run, a representation of the state-space as a reachability graph, and
+ for each query, a node that satisfies the query if any, nullptr otherwise
+ \throw std::runtime_error : if clock bounds cannot be computed for system, or if the
+ checkpoint cannot be read or written
+ \note a resumed run visits the same states as an uninterrupted run, and yields the same statistics (except
+ running time and memory usage). The running time only covers the resumed run, and the running time of the
+ resumed runs is set in the statistics (see tchecker::algorithms::stats_t::resumed_running_time)
+ */
+std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t>,
+           std::vector<tchecker::tck_reach::zg_reach::graph_t::node_sptr_t>>
+run_checkpoint(std::shared_ptr<tchecker::ta::system_t const> const & system, std::vector<std::string> const & queries,
+               std::string const & search_order, std::string const & checkpoint_file,
+               std::size_t checkpoint_period, bool resume, std::size_t block_size = 10000, std::size_t table_size = 65536,
+               tchecker::algorithms::budget_t budget = tchecker::algorithms::budget_t{},
+               enum tchecker::zg::clock_reduction_type_t clock_reduction = tchecker::zg::NO_CLOCK_REDUCTION);
+
+/*!
+ \brief Run reachability algorithm on the zone graph of a system, with checkpoints
+ \param system : system of timed processes
  \param labels : comma-separated string of labels
  \param search_order : search order
+ \param checkpoint_file : name of checkpoint file
+ \param checkpoint_period : time between two checkpoints (in seconds, 0 means no periodic checkpoint)
+ \param resume : resume flag
  \param block_size : number of elements allocated in one block
  \param table_size : size of hash tables
- \pre labels must appear as node attributes in sysdecl
+ \param budget : resource budget, the memory limit applies to the states,
+ transitions, nodes and edges allocated by the algorithm
+ \param clock_reduction : type of clock reduction (see tchecker::zg::factory)
+ \pre labels must appear as node attributes in system
  search_order must be either "dfs" or "bfs"
+ \post if resume is true, the run has been resumed from the graph, waiting nodes and statistics saved in
+ checkpoint_file. Otherwise, the run has started from the initial states. The state of the run has been saved
+ to checkpoint_file every checkpoint_period seconds
  \return statistics on the run and a representation of the state-space as a reachability graph
- \throw std::runtime_error : if clock bounds cannot be computed for the system modeled by sysdecls
+ \throw std::runtime_error : if clock bounds cannot be computed for system, or if the
+ checkpoint cannot be read or written
+ \note a resumed run visits the same states as an uninterrupted run, and yields the same statistics (except
+ running time and memory usage). The running time only covers the resumed run, and the running time of the
+ resumed runs is set in the statistics (see tchecker::algorithms::stats_t::resumed_running_time)
  */
 std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reach::state_space_t>>
-run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels = "",
-    std::string const & search_order = "bfs", std::size_t block_size = 10000, std::size_t table_size = 65536);
+run_checkpoint(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels,
+               std::string const & search_order, std::string const & checkpoint_file,
+               std::size_t checkpoint_period, bool resume, std::size_t block_size = 10000,
+               std::size_t table_size = 65536, tchecker::algorithms::budget_t budget = tchecker::algorithms::budget_t{},
+               enum tchecker::zg::clock_reduction_type_t clock_reduction = tchecker::zg::NO_CLOCK_REDUCTION);
 
 } // end of namespace zg_reach
 
@@ -0,0 +1,229 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cassert>
+
+#include "counter_example.hh"
+#include "tchecker/algorithms/search_order.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/syncprod/syncprod.hh"
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/utils/log.hh"
+#include "zg-reduced-covreach.hh"
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_reduced_covreach {
+
+/* state_t */
+
+state_t::state_t(tchecker::zg::state_sptr_t const & s)
+    : tchecker::ta::state_t(s->vloc_ptr(), s->intval_ptr()), _reduced_zone(s->zone()), _zone(s->zone_ptr())
+{
+}
+
+tchecker::zg::zone_t const & state_t::zone() const
+{
+  assert(has_zone());
+  return *_zone;
+}
+
+void state_t::release_zone() { _zone = nullptr; }
+
+/* node_t */
+
+node_t::node_t(tchecker::zg::state_sptr_t const & s, bool initial, bool final)
+    : tchecker::graph::node_flags_t(initial, final), _state(s)
+{
+}
+
+/* node_hash_t */
+
+std::size_t node_hash_t::operator()(tchecker::tck_reach::zg_reduced_covreach::node_t const & n) const
+{
+  // NB: we hash on the discrete (i.e. ta) part of the state in n to check all nodes
+  // with same discrete part for covering
+  return tchecker::ta::shared_hash_value(n.state());
+}
+
+/* node_le_t */
+
+node_le_t::node_le_t(tchecker::clock_id_t dim) : _dim(dim), _dbm(dim * dim) {}
+
+bool node_le_t::operator()(tchecker::tck_reach::zg_reduced_covreach::node_t const & n1,
+                           tchecker::tck_reach::zg_reduced_covreach::node_t const & n2) const
+{
+  tchecker::tck_reach::zg_reduced_covreach::state_t const & s1 = n1.state();
+  tchecker::tck_reach::zg_reduced_covreach::state_t const & s2 = n2.state();
+  if (!tchecker::ta::shared_equal_to(s1, s2))
+    return false;
+  if (s1.has_zone())
+    return tchecker::zg::is_le(s1.zone(), s2.reduced_zone());
+  // n1 is a node of the graph that may be covered by the new node n2
+  assert(s2.has_zone());
+  s1.reduced_zone().expand(_dbm.data());
+  return tchecker::dbm::is_le(_dbm.data(), s2.zone().dbm(), _dim);
+}
+
+/* graph_t */
+
+graph_t::graph_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
+    : tchecker::graph::subsumption::graph_t<
+          tchecker::tck_reach::zg_reduced_covreach::node_t, tchecker::tck_reach::zg_covreach::edge_t,
+          tchecker::tck_reach::zg_reduced_covreach::node_hash_t, tchecker::tck_reach::zg_reduced_covreach::node_le_t>(
+          block_size, table_size, tchecker::tck_reach::zg_reduced_covreach::node_hash_t(),
+          tchecker::tck_reach::zg_reduced_covreach::node_le_t(zg->system().clocks_count(tchecker::VK_FLATTENED) + 1)),
+      _zg(zg), _reduced_zones_memsize(0)
+{
+}
+
+graph_t::node_sptr_t graph_t::add_node(tchecker::zg::state_sptr_t const & s)
+{
+  node_sptr_t n = tchecker::graph::subsumption::graph_t<
+      tchecker::tck_reach::zg_reduced_covreach::node_t, tchecker::tck_reach::zg_covreach::edge_t,
+      tchecker::tck_reach::zg_reduced_covreach::node_hash_t,
+      tchecker::tck_reach::zg_reduced_covreach::node_le_t>::add_node(s);
+  _new_nodes.push_back(n);
+  _reduced_zones_memsize += n->state().reduced_zone().memsize();
+  return n;
+}
+
+void graph_t::remove_node(node_sptr_t const & n)
+{
+  _reduced_zones_memsize -= n->state().reduced_zone().memsize();
+  tchecker::graph::subsumption::graph_t<
+      tchecker::tck_reach::zg_reduced_covreach::node_t, tchecker::tck_reach::zg_covreach::edge_t,
+      tchecker::tck_reach::zg_reduced_covreach::node_hash_t,
+      tchecker::tck_reach::zg_reduced_covreach::node_le_t>::remove_node(n);
+}
+
+void graph_t::release_zones()
+{
+  for (node_sptr_t const & n : _new_nodes)
+    n->state().release_zone();
+  _new_nodes.clear();
+}
+
+bool graph_t::is_actual_edge(edge_sptr_t const & e) const { return edge_type(e) == tchecker::graph::subsumption::EDGE_ACTUAL; }
+
+std::size_t graph_t::memsize() const
+{
+  std::size_t const graph_memsize =
+      tchecker::graph::subsumption::graph_t<
+          tchecker::tck_reach::zg_reduced_covreach::node_t, tchecker::tck_reach::zg_covreach::edge_t,
+          tchecker::tck_reach::zg_reduced_covreach::node_hash_t,
+          tchecker::tck_reach::zg_reduced_covreach::node_le_t>::memsize();
+  return graph_memsize + _reduced_zones_memsize;
+}
+
+/* ts_t */
+
+ts_t::ts_t(tchecker::zg::zg_t & zg, tchecker::tck_reach::zg_reduced_covreach::graph_t & graph)
+    : _zg(zg), _graph(graph), _dbm((zg.system().clocks_count(tchecker::VK_FLATTENED) + 1) *
+                                   (zg.system().clocks_count(tchecker::VK_FLATTENED) + 1))
+{
+}
+
+void ts_t::initial(std::vector<sst_t> & v) { _zg.initial(v); }
+
+void ts_t::next(tchecker::tck_reach::zg_reduced_covreach::state_t const * s, std::vector<sst_t> & v)
+{
+  _graph.release_zones();
+
+  tchecker::vloc_t const & vloc = s->vloc();
+  _vloc.assign(vloc.begin(), vloc.end());
+  tchecker::intval_t const & intval = s->intval();
+  _intval.assign(intval.begin(), intval.end());
+  s->reduced_zone().expand(_dbm.data());
+
+  _zg.next(_zg.build_state(_vloc, _intval, _dbm), v);
+}
+
+boost::dynamic_bitset<> ts_t::labels(tchecker::tck_reach::zg_reduced_covreach::state_t const * s) const
+{
+  return tchecker::syncprod::labels(_zg.system().as_syncprod_system(), s->vloc());
+}
+
+bool ts_t::is_valid_final(tchecker::tck_reach::zg_reduced_covreach::state_t const *) const { return true; }
+
+/* state_space_t */
+
+state_space_t::state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
+    : _ss(zg, zg, block_size, table_size)
+{
+}
+
+tchecker::zg::zg_t & state_space_t::zg() { return _ss.ts(); }
+
+tchecker::tck_reach::zg_reduced_covreach::graph_t & state_space_t::graph() { return _ss.state_space(); }
+
+/* counter example */
+namespace cex {
+
+tchecker::tck_reach::zg_covreach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_reduced_covreach::graph_t const & g)
+{
+  return tchecker::tck_reach::symbolic_counter_example_zg<tchecker::tck_reach::zg_reduced_covreach::graph_t>(g);
+}
+
+tchecker::tck_reach::zg_covreach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_reduced_covreach::graph_t const & g)
+{
+  return tchecker::tck_reach::concrete_counter_example_zg<tchecker::tck_reach::zg_reduced_covreach::graph_t>(g);
+}
+
+} // namespace cex
+
+/* run */
+
+std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reduced_covreach::state_space_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels, std::string const & search_order,
+    tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size,
+    tchecker::algorithms::budget_t budget, enum tchecker::zg::clock_reduction_type_t clock_reduction)
+{
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, clock_reduction, block_size,
+                                                               table_size)};
+
+  std::shared_ptr<tchecker::tck_reach::zg_reduced_covreach::state_space_t> state_space =
+      std::make_shared<tchecker::tck_reach::zg_reduced_covreach::state_space_t>(zg, block_size, table_size);
+
+  tchecker::tck_reach::zg_reduced_covreach::ts_t ts{state_space->zg(), state_space->graph()};
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::fast_remove_waiting_policy(search_order);
+
+  tchecker::algorithms::covreach::stats_t stats;
+  tchecker::tck_reach::zg_reduced_covreach::algorithm_t algorithm;
+
+  budget.memory_usage([&]() { return state_space->zg().memsize() + state_space->graph().memsize(); });
+
+  if (covering == tchecker::algorithms::covreach::COVERING_FULL)
+    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(ts, state_space->graph(), accepting_labels, policy,
+                                                                         budget);
+  else if (covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
+    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(ts, state_space->graph(), accepting_labels,
+                                                                               policy, budget);
+  else
+    throw std::invalid_argument("Unknown covering policy for covreach algorithm");
+
+  state_space->graph().release_zones();
+
+  return std::make_tuple(stats, state_space);
+}
+
+} // namespace zg_reduced_covreach
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
@@ -0,0 +1,446 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_REDUCED_COVREACH_ALGORITHM_HH
+#define TCHECKER_ZG_REDUCED_COVREACH_ALGORITHM_HH
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/budget.hh"
+#include "tchecker/algorithms/covreach/algorithm.hh"
+#include "tchecker/graph/node.hh"
+#include "tchecker/graph/subsumption_graph.hh"
+#include "tchecker/ta/state.hh"
+#include "tchecker/ts/state_space.hh"
+#include "tchecker/waiting/waiting.hh"
+#include "tchecker/zg/reduced_zone.hh"
+#include "tchecker/zg/state.hh"
+#include "tchecker/zg/zg.hh"
+#include "zg-covreach.hh"
+
+/*!
+ \file zg-reduced-covreach.hh
+ \brief Covering reachability algorithm over the zone graph with zone inclusion,
+ storing the zones of nodes in reduced form
+ */
+
+namespace tchecker {
+
+namespace tck_reach {
+
+namespace zg_reduced_covreach {
+
+/*!
+ \class state_t
+ \brief State of the zone graph stored with a reduced zone
+ \note the state keeps the zone it has been built from until that zone is
+ released. This allows to check the inclusion of a new state in the states of
+ the graph without expanding their zones (see tchecker::zg::is_le)
+ */
+class state_t : public tchecker::ta::state_t {
+public:
+  /*!
+   \brief Constructor
+   \param s : a state of the zone graph
+   \pre the zone in s is not empty
+   \post this state has the tuple of locations and the integer valuation of s,
+   and the reduced zone of s. It keeps a pointer to the zone of s
+   */
+  explicit state_t(tchecker::zg::state_sptr_t const & s);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  state_t(tchecker::tck_reach::zg_reduced_covreach::state_t const &) = delete;
+
+  /*!
+   \brief Move constructor
+   */
+  state_t(tchecker::tck_reach::zg_reduced_covreach::state_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~state_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::tck_reach::zg_reduced_covreach::state_t &
+  operator=(tchecker::tck_reach::zg_reduced_covreach::state_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::tck_reach::zg_reduced_covreach::state_t &
+  operator=(tchecker::tck_reach::zg_reduced_covreach::state_t &&) = delete;
+
+  /*!
+   \brief Accessor
+   \return reduced zone of this state
+   */
+  inline tchecker::zg::reduced_zone_t const & reduced_zone() const { return _reduced_zone; }
+
+  /*!
+   \brief Accessor
+   \return true if this state still keeps the zone it has been built from, false
+   otherwise
+   */
+  inline bool has_zone() const { return _zone.ptr() != nullptr; }
+
+  /*!
+   \brief Accessor
+   \pre has_zone() (checked by assertion)
+   \return the zone this state has been built from
+   */
+  tchecker::zg::zone_t const & zone() const;
+
+  /*!
+   \brief Release the zone this state has been built from
+   \post has_zone() is false
+   */
+  void release_zone();
+
+private:
+  tchecker::zg::reduced_zone_t _reduced_zone;                                /*!< Reduced zone */
+  tchecker::intrusive_shared_ptr_t<tchecker::zg::shared_zone_t const> _zone; /*!< Zone, until released */
+};
+
+/*!
+ \class node_t
+ \brief Node of the covering reachability graph of a zone graph, with reduced
+ zone
+ */
+class node_t : public tchecker::waiting::element_t, public tchecker::graph::node_flags_t {
+public:
+  /*!
+   \brief Constructor
+   \param s : a zone graph state
+   \param initial : initial node flag
+   \param final : final node flag
+   \post this node stores the state s with a reduced zone (see
+   tchecker::tck_reach::zg_reduced_covreach::state_t), and has initial/final
+   node flags as specified
+   */
+  node_t(tchecker::zg::state_sptr_t const & s, bool initial = false, bool final = false);
+
+  /*!
+   \brief Accessor
+   \return state in this node
+   */
+  inline tchecker::tck_reach::zg_reduced_covreach::state_t const & state() const { return _state; }
+
+  /*!
+   \brief Accessor
+   \return state in this node
+   */
+  inline tchecker::tck_reach::zg_reduced_covreach::state_t & state() { return _state; }
+
+  /*!
+   \brief Accessor
+   \return pointer to the state in this node (see
+   tchecker::tck_reach::zg_reduced_covreach::ts_t)
+   */
+  inline tchecker::tck_reach::zg_reduced_covreach::state_t const * state_ptr() const { return &_state; }
+
+private:
+  tchecker::tck_reach::zg_reduced_covreach::state_t _state; /*!< State */
+};
+
+/*!
+\class node_hash_t
+\brief Hash functor for nodes
+*/
+class node_hash_t {
+public:
+  /*!
+  \brief Hash function
+  \param n : a node
+  \return hash value for n based on the discrete part of n (i.e. the tuple of
+  locations and integer variable valuations) since we need to cover nodes with
+  same discrete part
+  */
+  std::size_t operator()(tchecker::tck_reach::zg_reduced_covreach::node_t const & n) const;
+};
+
+/*!
+\class node_le_t
+\brief Covering predicate for nodes
+*/
+class node_le_t {
+public:
+  /*!
+   \brief Constructor
+   \param dim : dimension of zones
+   */
+  node_le_t(tchecker::clock_id_t dim);
+
+  /*!
+  \brief Covering predicate for nodes
+  \param n1 : a node
+  \param n2 : a node
+  \pre the state in n1 or the state in n2 has its zone (checked by assertion)
+  \return true if n1 and n2 have same discrete part and the zone of n1 is
+  included in the zone of n2, false otherwise
+  \note the zone of n1 is checked against the reduced zone of n2 when n1 has its
+  zone. Otherwise, the reduced zone of n1 is expanded
+  */
+  bool operator()(tchecker::tck_reach::zg_reduced_covreach::node_t const & n1,
+                  tchecker::tck_reach::zg_reduced_covreach::node_t const & n2) const;
+
+private:
+  tchecker::clock_id_t _dim;                     /*!< Dimension of zones */
+  mutable std::vector<tchecker::dbm::db_t> _dbm; /*!< DBM for expanded reduced zones */
+};
+
+/*!
+ \class graph_t
+ \brief Reachability graph over the zone graph, with reduced zones
+ \note the nodes keep the zone of their state from their creation until the
+ next call to release_zones(). The covering reachability algorithm checks
+ covering of new nodes only, hence each covering check compares a zone to a
+ reduced zone (see tchecker::tck_reach::zg_reduced_covreach::node_le_t)
+*/
+class graph_t
+    : public tchecker::graph::subsumption::graph_t<
+          tchecker::tck_reach::zg_reduced_covreach::node_t, tchecker::tck_reach::zg_covreach::edge_t,
+          tchecker::tck_reach::zg_reduced_covreach::node_hash_t, tchecker::tck_reach::zg_reduced_covreach::node_le_t> {
+public:
+  /*!
+   \brief Constructor
+   \param zg : zone graph
+   \param block_size : number of objects allocated in a block
+   \param table_size : size of hash table
+   \note this keeps a pointer on zg
+   \note this graph keeps pointers to (part of) states and (part of) transitions
+   allocated by zg. Hence, the graph must be destroyed *before* zg is destroyed.
+   See state_space_t below
+  */
+  graph_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size);
+
+  /*!
+   \brief Accessor
+   \return internal zone graph
+  */
+  inline tchecker::zg::zg_t const & zg() const { return *_zg; }
+
+  /*!
+   \brief Add a node
+   \param s : a zone graph state
+   \return a new node for state s, that keeps the zone of s until the next call
+   to release_zones()
+   */
+  node_sptr_t add_node(tchecker::zg::state_sptr_t const & s);
+
+  /*!
+   \brief Remove a node
+   \param n : a node
+   \post n has been removed from this graph
+   */
+  void remove_node(node_sptr_t const & n);
+
+  /*!
+   \brief Release the zones of new nodes
+   \post the states in the nodes added since the last call only keep their
+   reduced zone
+   */
+  void release_zones();
+
+  /*!
+   \brief Checks if an edge is an actual edge (not a subsumption edge)
+   \param e : an edge
+   \return true if e is an actual edge, false otherwise (e is a subsumption edge)
+   */
+  bool is_actual_edge(edge_sptr_t const & e) const;
+
+  /*!
+   \brief Accessor
+   \return memory used by the nodes and edges in this graph, including reduced
+   zones
+   */
+  std::size_t memsize() const;
+
+private:
+  std::shared_ptr<tchecker::zg::zg_t> _zg; /*!< Zone graph */
+  std::vector<node_sptr_t> _new_nodes;     /*!< Nodes that keep their zone */
+  std::size_t _reduced_zones_memsize;      /*!< Memory used by reduced zones */
+};
+
+/*!
+ \class ts_t
+ \brief Zone graph seen from the states stored in a graph with reduced zones
+ \note this provides the part of the interface of a transition system that is
+ used by tchecker::algorithms::covreach::algorithm_t. The reduced zone of a state
+ is expanded when the successors of the state are computed
+ */
+class ts_t {
+public:
+  /*!
+   \brief Type of triples (status, state, transition)
+   */
+  using sst_t = tchecker::zg::zg_t::sst_t;
+
+  /*!
+   \brief Constructor
+   \param zg : zone graph
+   \param graph : graph with reduced zones over zg
+   \note this keeps references on zg and graph
+   */
+  ts_t(tchecker::zg::zg_t & zg, tchecker::tck_reach::zg_reduced_covreach::graph_t & graph);
+
+  /*!
+   \brief Initial states and transitions
+   \param v : container
+   \post all tuples (status, s, t) of initial states and transitions of the zone
+   graph with status tchecker::STATE_OK have been pushed to v
+   */
+  void initial(std::vector<sst_t> & v);
+
+  /*!
+   \brief Next states and transitions
+   \param s : state
+   \param v : container
+   \post the zones of the new nodes of the graph have been released (see
+   tchecker::tck_reach::zg_reduced_covreach::graph_t::release_zones). All tuples
+   (status, s', t) of successor states and transitions of s with status
+   tchecker::STATE_OK have been pushed to v
+   */
+  void next(tchecker::tck_reach::zg_reduced_covreach::state_t const * s, std::vector<sst_t> & v);
+
+  /*!
+   \brief Accessor
+   \param s : state
+   \return labels in state s
+   */
+  boost::dynamic_bitset<> labels(tchecker::tck_reach::zg_reduced_covreach::state_t const * s) const;
+
+  /*!
+   \brief Accessor
+   \param s : state
+   \return true, as the states in the graph have non-empty zones
+   */
+  bool is_valid_final(tchecker::tck_reach::zg_reduced_covreach::state_t const * s) const;
+
+private:
+  tchecker::zg::zg_t & _zg;                                   /*!< Zone graph */
+  tchecker::tck_reach::zg_reduced_covreach::graph_t & _graph; /*!< Graph */
+  std::vector<tchecker::loc_id_t> _vloc;                      /*!< Tuple of locations of expanded states */
+  std::vector<tchecker::integer_t> _intval;                   /*!< Integer valuation of expanded states */
+  std::vector<tchecker::dbm::db_t> _dbm;                      /*!< DBM of expanded states */
+};
+
+/*!
+ \class state_space_t
+ \brief State-space representation consisting of a zone graph and a subsumption
+ graph with reduced zones
+ */
+class state_space_t {
+public:
+  /*!
+   \brief Constructor
+   \param zg : zone graph
+   \param block_size : number of objects allocated in a block
+   \param table_size : size of hash table
+   \note this keeps a pointer on zg
+   */
+  state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size);
+
+  /*!
+   \brief Accessor
+   \return The zone graph
+   */
+  tchecker::zg::zg_t & zg();
+
+  /*!
+   \brief Accessor
+   \return The subsumption graph representing the state-space
+   */
+  tchecker::tck_reach::zg_reduced_covreach::graph_t & graph();
+
+private:
+  tchecker::ts::state_space_t<tchecker::zg::zg_t, tchecker::tck_reach::zg_reduced_covreach::graph_t>
+      _ss; /*!< State-space representation */
+};
+
+namespace cex {
+
+/*!
+ \brief Compute a symbolic counter-example from a covering reachability graph
+ with reduced zones
+ \param g : reachability graph on a zone graph
+ \return a finite path from an initial node to a final node in g if any, an
+ empty path otherwise
+ \note the returned pointer shall be deleted
+*/
+tchecker::tck_reach::zg_covreach::cex::symbolic_cex_t *
+symbolic_counter_example(tchecker::tck_reach::zg_reduced_covreach::graph_t const & g);
+
+/*!
+ \brief Compute a concrete counter-example from a covering reachability graph
+ with reduced zones
+ \param g : reachability graph on a zone graph
+ \return a finite path from an initial node to a final node in g with concrete
+ clock valuations if any, an empty path otherwise
+ \note the returned pointer shall be deleted
+*/
+tchecker::tck_reach::zg_covreach::cex::concrete_cex_t *
+concrete_counter_example(tchecker::tck_reach::zg_reduced_covreach::graph_t const & g);
+
+} // namespace cex
+
+/*!
+ \class algorithm_t
+ \brief Covering reachability algorithm over the zone graph with reduced zones
+*/
+class algorithm_t : public tchecker::algorithms::covreach::algorithm_t<tchecker::tck_reach::zg_reduced_covreach::ts_t,
+                                                                         tchecker::tck_reach::zg_reduced_covreach::graph_t> {
+public:
+  using tchecker::algorithms::covreach::algorithm_t<tchecker::tck_reach::zg_reduced_covreach::ts_t,
+                                                    tchecker::tck_reach::zg_reduced_covreach::graph_t>::algorithm_t;
+};
+
+/*!
+ \brief Run covering reachability algorithm on the zone graph of a system,
+ storing the zones of nodes in reduced form
+ \param system : system of timed processes
+ \param labels : comma-separated string of labels
+ \param search_order : search order
+ \param covering : covering policy
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param budget : resource budget, the memory limit applies to the states,
+ transitions, nodes, reduced zones and edges allocated by the algorithm
+ \param clock_reduction : type of clock reduction (see tchecker::zg::factory)
+ \pre labels must appear as node attributes in system
+ search_order must be either "dfs" or "bfs"
+ \return statistics on the run and a representation of the state-space as a
+ subsumption graph (partial if budget has been exhausted)
+ \throw std::runtime_error : if clock bounds cannot be computed for system
+ \note visits the same states as tchecker::tck_reach::zg_covreach::run. The
+ nodes only keep the reduced form of their zone (see tchecker::dbm::reduce),
+ which is expanded when the node is popped from the waiting container
+ */
+std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::tck_reach::zg_reduced_covreach::state_space_t>>
+run(std::shared_ptr<tchecker::ta::system_t const> const & system, std::string const & labels = "",
+    std::string const & search_order = "bfs",
+    tchecker::algorithms::covreach::covering_t covering = tchecker::algorithms::covreach::COVERING_FULL,
+    std::size_t block_size = 10000, std::size_t table_size = 65536,
+    tchecker::algorithms::budget_t budget = tchecker::algorithms::budget_t{},
+    enum tchecker::zg::clock_reduction_type_t clock_reduction = tchecker::zg::NO_CLOCK_REDUCTION);
+
+} // end of namespace zg_reduced_covreach
+
+} // end of namespace tck_reach
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_REDUCED_COVREACH_ALGORITHM_HH
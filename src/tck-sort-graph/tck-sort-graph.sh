@@ -0,0 +1,90 @@
+#!/usr/bin/env bash
+
+# This file is a part of the TChecker project.
+#
+# See files AUTHORS and LICENSE for copyright details.
+
+# Sort the graphs output by tck-reach and tck-liveness with option
+# --stream-graph: nodes are sorted w.r.t. their attributes and renumbered,
+# then edges are sorted w.r.t. their source node, their target node and their
+# attributes. The output is deterministic. Sorting is done on disk by sort(1)
+# and join(1), hence graphs that do not fit in memory can be sorted.
+
+MEMORY="25%"
+TEMPORARY_DIR="${TMPDIR:-/tmp}"
+OUTPUT=""
+
+function usage() {
+    echo "Usage: $0 [options] [file]";
+    echo "       -m size       memory used by sort(1) (default: ${MEMORY})";
+    echo "       -o file       output file (default: standard output)";
+    echo "       -T dir        directory for temporary files (default: ${TEMPORARY_DIR})";
+    echo "reads from standard input if file is not provided"
+}
+
+while getopts "hm:o:T:" OPT; do
+    case $OPT in
+        h) usage; exit 0;;
+        m) MEMORY=$OPTARG;;
+        o) OUTPUT=$OPTARG;;
+        T) TEMPORARY_DIR=$OPTARG;;
+        *) usage; exit 1;;
+    esac
+done
+shift $((OPTIND - 1))
+
+if [ $# -gt 1 ]; then
+    usage
+    exit 1
+fi
+
+INPUT="${1:--}"
+
+WORK_DIR=$(mktemp -d "${TEMPORARY_DIR}/tck-sort-graph.XXXXXX") || exit 1
+trap 'rm -rf "${WORK_DIR}"' EXIT
+
+export LC_ALL=C
+TAB=$'\t'
+
+function sort_records() {
+    sort -t "${TAB}" -S "${MEMORY}" -T "${TEMPORARY_DIR}" "$@"
+}
+
+# Split the input into records, each line is prefixed with the index of its
+# graph:
+#   frame: graph, 0 (header) or 3 (footer), 0, 0, line
+#   nodes: graph, attributes, node
+#   edges: graph:source, graph:target, attributes
+touch "${WORK_DIR}/frame" "${WORK_DIR}/nodes" "${WORK_DIR}/edges"
+awk -v dir="${WORK_DIR}" '
+/^digraph / { ++g; print g "\t0\t0\t0\t" $0 > (dir "/frame"); next }
+/^}/ { print g "\t3\t0\t0\t" $0 > (dir "/frame"); next }
+/^  [0-9]+ -> [0-9]+ / { a = $0; sub(/^  [0-9]+ -> [0-9]+ /, "", a); print g ":" $1 "\t" g ":" $3 "\t" a > (dir "/edges"); next }
+/^  [0-9]+ / { a = $0; sub(/^  [0-9]+ /, "", a); print g "\t" a "\t" $1 > (dir "/nodes"); next }
+/^[[:space:]]*$/ { next }
+{ print "Unexpected line " NR ": " $0 > "/dev/stderr"; exit 1 }
+' "${INPUT}" || exit 1
+
+# Sort nodes w.r.t. attributes and renumber them:
+#   ids: graph:node, new node
+#   sorted-nodes: graph, 1, new node, 0, line
+sort_records -k1,1n -k2,2 -k3,3n "${WORK_DIR}/nodes" | awk -F "\t" -v dir="${WORK_DIR}" '
+$1 != g { g = $1; n = 0 }
+{ print g ":" $3 "\t" n > (dir "/ids"); print g "\t1\t" n "\t0\t  " n " " $2 > (dir "/sorted-nodes"); ++n }
+' || exit 1
+touch "${WORK_DIR}/ids" "${WORK_DIR}/sorted-nodes"
+sort_records -k1,1 -o "${WORK_DIR}/ids" "${WORK_DIR}/ids" || exit 1
+
+# Rename the source then the target of edges:
+#   sorted-edges: graph, 2, new source, new target, line
+sort_records -k1,1 "${WORK_DIR}/edges" | join -t "${TAB}" -o 1.2,2.2,1.3 - "${WORK_DIR}/ids" |
+    sort_records -k1,1 | join -t "${TAB}" -o 1.1,1.2,2.2,1.3 - "${WORK_DIR}/ids" |
+    awk -F "\t" '{ split($1, t, ":"); print t[1] "\t2\t" $2 "\t" $3 "\t  " $2 " -> " $3 " " $4 }' \
+        > "${WORK_DIR}/sorted-edges" || exit 1
+
+# Merge
+if [ -n "${OUTPUT}" ]; then
+    exec > "${OUTPUT}" || exit 1
+fi
+sort_records -k1,1n -k2,2n -k3,3n -k4,4n -k5,5 "${WORK_DIR}/frame" "${WORK_DIR}/sorted-nodes" "${WORK_DIR}/sorted-edges" |
+    cut -f 5-
@@ -0,0 +1,76 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include "tchecker/utils/bitstate.hh"
+
+namespace tchecker {
+
+/*!
+ \brief Mix bits of a hash value
+ \param h : hash value
+ \return h with bits mixed (finalizer of splitmix64)
+ */
+static inline uint64_t mix(uint64_t h)
+{
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
+}
+
+bitstate_t::bitstate_t(unsigned int log2_bits, unsigned int hashes)
+    : _hashes(hashes), _set_bits(0), _size(0), _expected_omissions(0.0)
+{
+  if (log2_bits < 3 || log2_bits > 48)
+    throw std::invalid_argument("tchecker::bitstate_t: number of bits should be between 2^3 and 2^48");
+  if (hashes < 1 || hashes > 64)
+    throw std::invalid_argument("tchecker::bitstate_t: number of hash functions should be between 1 and 64");
+
+  uint64_t const bits = static_cast<uint64_t>(1) << log2_bits;
+  _mask = bits - 1;
+  _words.assign((bits + 63) / 64, 0);
+}
+
+bool bitstate_t::find_else_add(uint64_t hash)
+{
+  // double hashing: position i is h1 + i * h2, with h2 odd to cover all the bits
+  uint64_t const h1 = mix(hash);
+  uint64_t const h2 = mix(h1 ^ 0x9e3779b97f4a7c15ULL) | 1;
+
+  double const p = omission_probability();
+
+  bool added = false;
+  for (unsigned int i = 0; i < _hashes; ++i) {
+    uint64_t const pos = (h1 + i * h2) & _mask;
+    uint64_t & word = _words[pos >> 6];
+    uint64_t const bit = static_cast<uint64_t>(1) << (pos & 63);
+    if ((word & bit) == 0) {
+      word |= bit;
+      ++_set_bits;
+      added = true;
+    }
+  }
+
+  if (added) {
+    ++_size;
+    _expected_omissions += p;
+  }
+  return added;
+}
+
+double bitstate_t::fill_ratio() const { return static_cast<double>(_set_bits) / static_cast<double>(bits()); }
+
+double bitstate_t::omission_probability() const { return std::pow(fill_ratio(), static_cast<double>(_hashes)); }
+
+std::size_t bitstate_t::memsize() const { return _words.capacity() * sizeof(uint64_t); }
+
+} // end of namespace tchecker
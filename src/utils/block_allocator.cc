@@ -0,0 +1,144 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include "tchecker/utils/block_allocator.hh"
+
+namespace tchecker {
+
+/* huge pages policy */
+
+static enum tchecker::huge_pages_t huge_pages_policy = tchecker::HUGE_PAGES_AUTO;
+
+void set_huge_pages(enum tchecker::huge_pages_t policy) { huge_pages_policy = policy; }
+
+enum tchecker::huge_pages_t huge_pages() { return huge_pages_policy; }
+
+/* allocated memory */
+
+static std::atomic<std::size_t> allocated_memory{0};
+
+std::size_t allocated_blocks_memory() { return allocated_memory.load(std::memory_order_relaxed); }
+
+/*!
+ \brief Bind memory to the NUMA node of the calling thread
+ \param addr : address of memory
+ \param size : size of memory
+ \post the pages in addr..addr+size are preferably allocated on the NUMA node
+ of the calling thread (Linux only, the call has no effect otherwise, or if it
+ fails)
+ */
+static void bind_to_local_node(void * addr, std::size_t size)
+{
+#if defined(__linux__) && defined(SYS_getcpu) && defined(SYS_mbind)
+  unsigned int cpu = 0, node = 0;
+  if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 || node >= 64)
+    return;
+  constexpr int MPOL_PREFERRED = 1; // from linux/mempolicy.h
+  unsigned long nodemask = 1UL << node;
+  ::syscall(SYS_mbind, addr, size, MPOL_PREFERRED, &nodemask, 64UL, 0U);
+#else
+  (void)addr;
+  (void)size;
+#endif
+}
+
+/* block_allocator_t */
+
+block_allocator_t::block_allocator_t(std::size_t block_size)
+    : _block_size(block_size),
+      _mapped_size((block_size + tchecker::HUGE_PAGE_SIZE - 1) / tchecker::HUGE_PAGE_SIZE * tchecker::HUGE_PAGE_SIZE),
+      _backend(BACKEND_HEAP)
+{
+  switch (tchecker::huge_pages()) {
+  case tchecker::HUGE_PAGES_AUTO:
+    // small blocks would waste most of a huge page
+    _backend = (block_size >= tchecker::HUGE_PAGE_SIZE ? BACKEND_MMAP_TRANSPARENT : BACKEND_HEAP);
+    break;
+  case tchecker::HUGE_PAGES_NONE:
+    _backend = BACKEND_HEAP;
+    break;
+  case tchecker::HUGE_PAGES_TRANSPARENT:
+    _backend = BACKEND_MMAP_TRANSPARENT;
+    break;
+  case tchecker::HUGE_PAGES_EXPLICIT:
+    _backend = BACKEND_MMAP_EXPLICIT;
+    break;
+  }
+}
+
+void * block_allocator_t::allocate()
+{
+  if (_backend == BACKEND_HEAP) {
+    void * block = new char[_block_size];
+    allocated_memory.fetch_add(_block_size, std::memory_order_relaxed);
+    return block;
+  }
+
+  void * block = map();
+  if (block == nullptr)
+    throw std::bad_alloc();
+  allocated_memory.fetch_add(_mapped_size, std::memory_order_relaxed);
+  return block;
+}
+
+void block_allocator_t::deallocate(void * block)
+{
+  if (_backend == BACKEND_HEAP) {
+    delete[] static_cast<char *>(block);
+    allocated_memory.fetch_sub(_block_size, std::memory_order_relaxed);
+  }
+  else {
+    ::munmap(block, _mapped_size);
+    allocated_memory.fetch_sub(_mapped_size, std::memory_order_relaxed);
+  }
+}
+
+void * block_allocator_t::map()
+{
+#if defined(MAP_HUGETLB)
+  if (_backend == BACKEND_MMAP_EXPLICIT) {
+    void * block = ::mmap(nullptr, _mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (block != MAP_FAILED) {
+      bind_to_local_node(block, _mapped_size);
+      return block;
+    }
+    // no reserved huge page left: fall back to transparent huge pages
+  }
+#endif
+
+  // map one more huge page, then trim to a region aligned on huge pages
+  std::size_t const size = _mapped_size + tchecker::HUGE_PAGE_SIZE;
+  void * p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p == MAP_FAILED)
+    return nullptr;
+
+  uintptr_t const begin = reinterpret_cast<uintptr_t>(p);
+  uintptr_t const aligned = (begin + tchecker::HUGE_PAGE_SIZE - 1) & ~static_cast<uintptr_t>(tchecker::HUGE_PAGE_SIZE - 1);
+  if (aligned > begin)
+    ::munmap(p, aligned - begin);
+  if (aligned + _mapped_size < begin + size)
+    ::munmap(reinterpret_cast<void *>(aligned + _mapped_size), begin + size - aligned - _mapped_size);
+
+  void * block = reinterpret_cast<void *>(aligned);
+#if defined(MADV_HUGEPAGE)
+  ::madvise(block, _mapped_size, MADV_HUGEPAGE);
+#endif
+  bind_to_local_node(block, _mapped_size);
+  return block;
+}
+
+} // end of namespace tchecker
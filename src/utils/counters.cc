@@ -0,0 +1,78 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include "tchecker/utils/counters.hh"
+
+namespace tchecker {
+
+namespace counters {
+
+namespace details {
+
+unsigned long values[tchecker::counters::COUNTERS_COUNT] = {0};
+
+} // end of namespace details
+
+void reset() { std::fill(details::values, details::values + tchecker::counters::COUNTERS_COUNT, 0); }
+
+/*!
+ \brief Ratio as a string
+ \param n : numerator
+ \param d : denominator
+ \return n/d as a string, 0 if d is 0
+ */
+static std::string ratio(unsigned long n, unsigned long d)
+{
+  std::stringstream sstream;
+  sstream << (d == 0 ? 0.0 : static_cast<double>(n) / static_cast<double>(d));
+  return sstream.str();
+}
+
+void attributes(std::map<std::string, std::string> & m)
+{
+  if (!tchecker::counters::enabled())
+    return;
+
+  static char const * const names[tchecker::counters::COUNTERS_COUNT] = {
+      "ZONE_INCLUSION_CHECKS",
+      "ZONE_INCLUSION_SUCCESSES",
+      "ALU_INCLUSION_CHECKS",
+      "ALU_INCLUSION_SUCCESSES",
+      "COVER_CHECKS",
+      "COVER_SCANNED_NODES",
+      "COVER_SCANNED_NODES_MAX",
+      "SUCCESSORS_DISCRETE_REJECTED",
+      "SUCCESSORS_ZONE_EMPTY",
+      "VM_INSTRUCTIONS",
+      "VLOC_CACHE_HITS",
+      "VLOC_CACHE_MISSES",
+      "VEDGE_CACHE_HITS",
+      "VEDGE_CACHE_MISSES",
+      "INTVAL_CACHE_HITS",
+      "INTVAL_CACHE_MISSES",
+      "ZONE_CACHE_HITS",
+      "ZONE_CACHE_MISSES",
+      "POOL_BLOCKS",
+  };
+
+  for (std::size_t c = 0; c < tchecker::counters::COUNTERS_COUNT; ++c)
+    m[std::string("COUNTER_") + names[c]] = std::to_string(details::values[c]);
+
+  m["COUNTER_ZONE_INCLUSION_SUCCESS_RATE"] =
+      ratio(value(tchecker::counters::ZONE_INCLUSION_SUCCESSES), value(tchecker::counters::ZONE_INCLUSION_CHECKS));
+  m["COUNTER_ALU_INCLUSION_SUCCESS_RATE"] =
+      ratio(value(tchecker::counters::ALU_INCLUSION_SUCCESSES), value(tchecker::counters::ALU_INCLUSION_CHECKS));
+  m["COUNTER_COVER_SCANNED_NODES_AVG"] =
+      ratio(value(tchecker::counters::COVER_SCANNED_NODES), value(tchecker::counters::COVER_CHECKS));
+}
+
+} // end of namespace counters
+
+} // end of namespace tchecker
@@ -0,0 +1,209 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "tchecker/utils/disk_hashset.hh"
+
+namespace tchecker {
+
+/*!
+ \brief Offset of no block
+ */
+static constexpr uint64_t NO_BLOCK = std::numeric_limits<uint64_t>::max();
+
+/*!
+ \brief Minimal number of bytes available for keys in a block
+ */
+static constexpr uint64_t BLOCK_CAPACITY = 4096 - 3 * sizeof(uint64_t);
+
+/*!
+ \brief Minimal size of the file
+ */
+static constexpr uint64_t MIN_FILE_SIZE = 1 << 20;
+
+/*!
+ \brief Size of a key in a block (length followed by bytes)
+ \param size : size of the key
+ \return number of bytes used by a key of length size in a block
+ */
+static inline uint64_t stored_size(std::size_t size) { return sizeof(uint32_t) + size; }
+
+disk_hashset_t::disk_hashset_t(std::string const & filename, std::size_t cache_size, std::size_t partitions)
+    : _filename(filename), _fd(-1), _map(nullptr), _map_size(0), _end(0), _cache_bytes(0), _cache_size(cache_size),
+      _size(0), _bytes_read(0), _bytes_written(0), _batches(0), _cache_hits(0)
+{
+  if (partitions == 0)
+    throw std::invalid_argument("tchecker::disk_hashset_t: expecting at least one partition");
+
+  _partitions.assign(partitions, {NO_BLOCK, NO_BLOCK});
+
+  _fd = ::open(_filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (_fd < 0)
+    throw std::runtime_error("Unable to create file " + _filename);
+}
+
+disk_hashset_t::~disk_hashset_t()
+{
+  if (_map != nullptr)
+    ::munmap(_map, _map_size);
+  ::close(_fd);
+  std::remove(_filename.c_str());
+}
+
+void disk_hashset_t::find_else_add(std::vector<std::string> const & keys, std::vector<bool> & added)
+{
+  added.assign(keys.size(), false);
+
+  // keys that are not in the cache, grouped by partition
+  std::vector<std::pair<std::size_t, std::size_t>> pending; // (partition, index in keys)
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    if (cached(keys[i]))
+      ++_cache_hits;
+    else
+      pending.emplace_back(partition(keys[i]), i);
+  }
+  if (pending.empty())
+    return;
+
+  std::sort(pending.begin(), pending.end());
+  ++_batches;
+
+  // scan each partition once, then append the keys that have not been found
+  std::unordered_map<std::string_view, std::size_t> missing;
+  for (auto first = pending.begin(); first != pending.end();) {
+    std::size_t const p = first->first;
+    auto last = std::find_if(first, pending.end(), [&](auto const & x) { return x.first != p; });
+
+    missing.clear();
+    for (auto it = first; it != last; ++it)
+      missing.emplace(keys[it->second], it->second); // keeps the first occurrence of each key
+
+    for (uint64_t offset = _partitions[p].head; offset != NO_BLOCK && !missing.empty(); offset = header(offset)->next) {
+      block_header_t const * h = header(offset);
+      char const * data = _map + offset + sizeof(block_header_t);
+      for (uint64_t pos = 0; pos < h->used && !missing.empty();) {
+        uint32_t size;
+        std::memcpy(&size, data + pos, sizeof(size));
+        missing.erase(std::string_view{data + pos + sizeof(size), size});
+        pos += stored_size(size);
+      }
+      _bytes_read += sizeof(block_header_t) + h->used;
+    }
+
+    for (auto it = first; it != last; ++it) {
+      std::string const & key = keys[it->second];
+      auto m = missing.find(key);
+      if (m == missing.end() || m->second != it->second)
+        continue;
+      append(p, key);
+      cache(key);
+      added[it->second] = true;
+      ++_size;
+    }
+
+    first = last;
+  }
+}
+
+std::size_t disk_hashset_t::memsize() const
+{
+  return _partitions.capacity() * sizeof(partition_t) + 2 * _cache_bytes;
+}
+
+std::size_t disk_hashset_t::partition(std::string_view key) const
+{
+  return std::hash<std::string_view>{}(key) % _partitions.size();
+}
+
+bool disk_hashset_t::cached(std::string const & key) const
+{
+  return (_cache[0].find(key) != _cache[0].end()) || (_cache[1].find(key) != _cache[1].end());
+}
+
+void disk_hashset_t::cache(std::string const & key)
+{
+  std::size_t const size = key.size() + sizeof(std::string);
+  if (2 * (_cache_bytes + size) > _cache_size) {
+    std::swap(_cache[0], _cache[1]);
+    _cache[0].clear();
+    _cache_bytes = 0;
+    if (2 * size > _cache_size)
+      return;
+  }
+  if (_cache[0].insert(key).second)
+    _cache_bytes += size;
+}
+
+void disk_hashset_t::append(std::size_t p, std::string const & key)
+{
+  if (key.size() > std::numeric_limits<uint32_t>::max())
+    throw std::invalid_argument("tchecker::disk_hashset_t: key is too large");
+
+  uint64_t const size = stored_size(key.size());
+  partition_t & partition = _partitions[p];
+
+  if (partition.tail == NO_BLOCK || header(partition.tail)->capacity - header(partition.tail)->used < size) {
+    uint64_t const block = allocate_block(std::max(BLOCK_CAPACITY, size));
+    if (partition.tail == NO_BLOCK)
+      partition.head = block;
+    else
+      header(partition.tail)->next = block;
+    partition.tail = block;
+    _bytes_written += sizeof(block_header_t);
+  }
+
+  block_header_t * h = header(partition.tail);
+  char * data = _map + partition.tail + sizeof(block_header_t) + h->used;
+  uint32_t const key_size = static_cast<uint32_t>(key.size());
+  std::memcpy(data, &key_size, sizeof(key_size));
+  std::memcpy(data + sizeof(key_size), key.data(), key.size());
+  h->used += size;
+  _bytes_written += size;
+}
+
+uint64_t disk_hashset_t::allocate_block(uint64_t capacity)
+{
+  capacity = (capacity + 7) & ~static_cast<uint64_t>(7); // keeps block headers aligned
+  uint64_t const block_size = sizeof(block_header_t) + capacity;
+
+  if (_end + block_size > _map_size) {
+    uint64_t map_size = std::max(_map_size, MIN_FILE_SIZE);
+    while (_end + block_size > map_size)
+      map_size *= 2;
+    if (::ftruncate(_fd, static_cast<off_t>(map_size)) != 0)
+      throw std::runtime_error("Unable to extend file " + _filename);
+    void * map = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (map == MAP_FAILED)
+      throw std::runtime_error("Unable to map file " + _filename);
+    if (_map != nullptr)
+      ::munmap(_map, _map_size);
+    _map = static_cast<char *>(map);
+    _map_size = map_size;
+  }
+
+  uint64_t const offset = _end;
+  _end += block_size;
+  block_header_t * h = header(offset);
+  h->next = NO_BLOCK;
+  h->capacity = capacity;
+  h->used = 0;
+  return offset;
+}
+
+} // end of namespace tchecker
@@ -0,0 +1,43 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+
+#include "tchecker/utils/pool.hh"
+
+namespace tchecker {
+
+/* collection_stats_t */
+
+collection_stats_t::collection_stats_t()
+    : _collections(0), _collected(0), _pause_total(std::chrono::steady_clock::duration::zero()),
+      _pause_max(std::chrono::steady_clock::duration::zero())
+{
+}
+
+void collection_stats_t::add(std::size_t collected, std::chrono::steady_clock::duration pause)
+{
+  ++_collections;
+  _collected += collected;
+  _pause_total += pause;
+  _pause_max = std::max(_pause_max, pause);
+}
+
+tchecker::collection_stats_t & collection_stats_t::operator+=(tchecker::collection_stats_t const & stats)
+{
+  _collections += stats._collections;
+  _collected += stats._collected;
+  _pause_total += stats._pause_total;
+  _pause_max = std::max(_pause_max, stats._pause_max);
+  return *this;
+}
+
+double collection_stats_t::pause_total() const { return std::chrono::duration<double>(_pause_total).count(); }
+
+double collection_stats_t::pause_max() const { return std::chrono::duration<double>(_pause_max).count(); }
+
+} // end of namespace tchecker
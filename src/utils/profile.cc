@@ -0,0 +1,65 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include "tchecker/utils/profile.hh"
+
+namespace tchecker {
+
+namespace profile {
+
+namespace details {
+
+bool enabled = false;
+
+std::uint64_t nanoseconds[tchecker::profile::PHASES_COUNT] = {0};
+
+std::uint64_t calls[tchecker::profile::PHASES_COUNT] = {0};
+
+} // end of namespace details
+
+void enable(bool enable) { details::enabled = enable; }
+
+void reset()
+{
+  std::fill(details::nanoseconds, details::nanoseconds + tchecker::profile::PHASES_COUNT, 0);
+  std::fill(details::calls, details::calls + tchecker::profile::PHASES_COUNT, 0);
+}
+
+double seconds(enum tchecker::profile::phase_t phase) { return static_cast<double>(details::nanoseconds[phase]) / 1e9; }
+
+void attributes(std::map<std::string, std::string> & m, double total)
+{
+  if (!tchecker::profile::enabled())
+    return;
+
+  static char const * const names[tchecker::profile::PHASES_COUNT] = {
+      "DISCRETE", "SEMANTICS", "EXTRAPOLATION", "SHARING", "COVERING", "GRAPH", "WAITING",
+  };
+
+  std::stringstream sstream;
+  double profiled = 0.0;
+  for (std::size_t p = 0; p < tchecker::profile::PHASES_COUNT; ++p) {
+    double const s = seconds(static_cast<enum tchecker::profile::phase_t>(p));
+    profiled += s;
+
+    sstream.str("");
+    sstream << s;
+    m[std::string("PROFILE_") + names[p] + "_SECONDS"] = sstream.str();
+    m[std::string("PROFILE_") + names[p] + "_CALLS"] = std::to_string(details::calls[p]);
+  }
+
+  sstream.str("");
+  sstream << std::max(0.0, total - profiled);
+  m["PROFILE_OTHER_SECONDS"] = sstream.str();
+}
+
+} // end of namespace profile
+
+} // end of namespace tchecker
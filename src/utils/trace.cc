@@ -0,0 +1,130 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+
+#include "tchecker/utils/trace.hh"
+
+namespace tchecker {
+
+namespace trace {
+
+namespace details {
+
+tchecker::trace::writer_t * writer = nullptr;
+
+} // end of namespace details
+
+void emit(tchecker::trace::event_t const & event) { tchecker::trace::details::writer->emit(event); }
+
+/*!
+ \brief Number of events in a buffer handed over to the writing thread
+ */
+static constexpr std::size_t BUFFER_SIZE = 4096;
+
+/* writer_t */
+
+writer_t::writer_t(std::string const & filename) : _ofs(filename), _origin(std::chrono::steady_clock::now()), _stop(false)
+{
+  if (tchecker::trace::details::writer != nullptr)
+    throw std::runtime_error("A trace file is already open");
+  if (!_ofs.is_open())
+    throw std::runtime_error("Cannot open trace file " + filename);
+
+  _ofs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << std::endl;
+  _ofs << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"tchecker\"}}";
+
+  _buffer.reserve(BUFFER_SIZE);
+  _thread = std::thread(&writer_t::run, this);
+  tchecker::trace::details::writer = this;
+}
+
+writer_t::~writer_t()
+{
+  tchecker::trace::details::writer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _full.push_back(std::move(_buffer));
+    _stop = true;
+  }
+  _cv.notify_one();
+  _thread.join();
+
+  _ofs << std::endl << "]}" << std::endl;
+  _ofs.close();
+}
+
+void writer_t::emit(tchecker::trace::event_t const & event)
+{
+  _buffer.push_back(event);
+  if (_buffer.size() < BUFFER_SIZE)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _full.push_back(std::move(_buffer));
+  }
+  _cv.notify_one();
+  _buffer = std::vector<tchecker::trace::event_t>{};
+  _buffer.reserve(BUFFER_SIZE);
+}
+
+void writer_t::run()
+{
+  std::vector<std::vector<tchecker::trace::event_t>> full;
+  bool stop = false;
+  while (!stop) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv.wait(lock, [this]() { return _stop || !_full.empty(); });
+      full.swap(_full);
+      stop = _stop;
+    }
+    for (std::vector<tchecker::trace::event_t> const & buffer : full)
+      for (tchecker::trace::event_t const & event : buffer)
+        write(event);
+    full.clear();
+  }
+}
+
+/*!
+ \brief Microseconds between two time points
+ \param origin : a time point
+ \param t : a time point
+ \return number of microseconds from origin to t, 0 if t is before origin
+ */
+static double microseconds(tchecker::trace::time_point_t const & origin, tchecker::trace::time_point_t const & t)
+{
+  if (t < origin)
+    return 0.0;
+  return std::chrono::duration<double, std::micro>(t - origin).count();
+}
+
+void writer_t::write(tchecker::trace::event_t const & event)
+{
+  double const ts = microseconds(_origin, event.start);
+
+  _ofs << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << "\",\"ph\":\"" << event.phase << "\"";
+  _ofs << ",\"ts\":" << std::fixed << std::setprecision(3) << ts;
+  if (event.phase == 'X')
+    _ofs << ",\"dur\":" << std::max(0.0, microseconds(_origin, event.end) - ts);
+  _ofs << std::defaultfloat << ",\"pid\":1,\"tid\":1,\"args\":{";
+  bool first = true;
+  for (tchecker::trace::arg_t const & arg : event.args) {
+    if (arg.name == nullptr)
+      continue;
+    _ofs << (first ? "" : ",") << "\"" << arg.name << "\":" << arg.value;
+    first = false;
+  }
+  _ofs << "}}";
+}
+
+} // end of namespace trace
+
+} // end of namespace tchecker
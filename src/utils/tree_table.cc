@@ -0,0 +1,202 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+#include "tchecker/utils/tree_table.hh"
+
+namespace tchecker {
+
+/*!
+ \brief Empty slot in pair tables
+ */
+static constexpr tchecker::tree_table_t::index_t EMPTY_SLOT = std::numeric_limits<tchecker::tree_table_t::index_t>::max();
+
+/*!
+ \brief Hash function on pairs
+ \param p : a pair encoded as a 64-bit value
+ \return hash value of p
+ */
+static inline uint64_t pair_hash(uint64_t p)
+{
+  p ^= p >> 33;
+  p *= 0xff51afd7ed558ccdULL;
+  p ^= p >> 33;
+  p *= 0xc4ceb9fe1a85ec53ULL;
+  p ^= p >> 33;
+  return p;
+}
+
+/* tree_table_t::pair_table_t */
+
+tree_table_t::pair_table_t::pair_table_t(std::size_t table_size)
+{
+  std::size_t size = 16;
+  while (size < table_size)
+    size *= 2;
+  _slots.assign(size, EMPTY_SLOT);
+}
+
+std::tuple<bool, tchecker::tree_table_t::index_t> tree_table_t::pair_table_t::find_else_add(uint64_t p)
+{
+  std::size_t const mask = _slots.size() - 1;
+  std::size_t slot = pair_hash(p) & mask;
+  while (_slots[slot] != EMPTY_SLOT) {
+    if (_pairs[_slots[slot]] == p)
+      return std::make_tuple(false, _slots[slot]);
+    slot = (slot + 1) & mask;
+  }
+
+  if (_pairs.size() >= EMPTY_SLOT)
+    throw std::overflow_error("tchecker::tree_table_t: too many pairs");
+
+  tchecker::tree_table_t::index_t const index = static_cast<tchecker::tree_table_t::index_t>(_pairs.size());
+  _pairs.push_back(p);
+  _slots[slot] = index;
+
+  if (2 * _pairs.size() > _slots.size())
+    grow();
+
+  return std::make_tuple(true, index);
+}
+
+std::size_t tree_table_t::pair_table_t::memsize() const
+{
+  return _pairs.capacity() * sizeof(uint64_t) + _slots.capacity() * sizeof(tchecker::tree_table_t::index_t);
+}
+
+void tree_table_t::pair_table_t::clear()
+{
+  _pairs.clear();
+  std::fill(_slots.begin(), _slots.end(), EMPTY_SLOT);
+}
+
+void tree_table_t::pair_table_t::grow()
+{
+  _slots.assign(2 * _slots.size(), EMPTY_SLOT);
+  std::size_t const mask = _slots.size() - 1;
+  for (std::size_t index = 0; index < _pairs.size(); ++index) {
+    std::size_t slot = pair_hash(_pairs[index]) & mask;
+    while (_slots[slot] != EMPTY_SLOT)
+      slot = (slot + 1) & mask;
+    _slots[slot] = static_cast<tchecker::tree_table_t::index_t>(index);
+  }
+}
+
+/* tree_table_t */
+
+tree_table_t::tree_table_t(std::size_t width, std::size_t table_size) : _width(width)
+{
+  build(0, _width);
+  _tables.assign(_nodes.size(), tchecker::tree_table_t::pair_table_t{table_size});
+}
+
+std::tuple<bool, tchecker::tree_table_t::index_t> tree_table_t::insert(tchecker::tree_table_t::value_t const * v)
+{
+  assert(_width == 0 || v != nullptr);
+  return insert(0, v);
+}
+
+void tree_table_t::get(tchecker::tree_table_t::index_t index, tchecker::tree_table_t::value_t * v) const
+{
+  assert(_width == 0 || v != nullptr);
+  get(0, index, v);
+}
+
+tchecker::tree_table_t::value_t tree_table_t::get(tchecker::tree_table_t::index_t index, std::size_t i) const
+{
+  assert(i < _width);
+  std::size_t node = 0;
+  while (true) {
+    node_t const & n = _nodes[node];
+    uint64_t const p = _tables[node].pair(index);
+    if (i < n.mid) {
+      index = static_cast<tchecker::tree_table_t::index_t>(p >> 32);
+      if (n.mid - n.lo == 1)
+        return index;
+      node = n.left;
+    }
+    else {
+      index = static_cast<tchecker::tree_table_t::index_t>(p);
+      if (n.hi - n.mid == 1)
+        return index;
+      node = n.right;
+    }
+  }
+}
+
+std::size_t tree_table_t::size() const { return _tables[0].size(); }
+
+std::size_t tree_table_t::memsize() const
+{
+  std::size_t size = _nodes.capacity() * sizeof(node_t);
+  for (tchecker::tree_table_t::pair_table_t const & table : _tables)
+    size += table.memsize();
+  return size;
+}
+
+void tree_table_t::clear()
+{
+  for (tchecker::tree_table_t::pair_table_t & table : _tables)
+    table.clear();
+}
+
+std::size_t tree_table_t::build(std::size_t lo, std::size_t hi)
+{
+  std::size_t const node = _nodes.size();
+  std::size_t const mid = (hi - lo < 2 ? hi : lo + (hi - lo) / 2);
+  _nodes.push_back({lo, mid, hi, 0, 0});
+  if (mid - lo > 1) {
+    std::size_t const left = build(lo, mid);
+    _nodes[node].left = left;
+  }
+  if (hi - mid > 1) {
+    std::size_t const right = build(mid, hi);
+    _nodes[node].right = right;
+  }
+  return node;
+}
+
+std::tuple<bool, tchecker::tree_table_t::index_t> tree_table_t::insert(std::size_t node,
+                                                                       tchecker::tree_table_t::value_t const * v)
+{
+  node_t const & n = _nodes[node];
+
+  uint64_t left = 0, right = 0;
+  if (n.mid - n.lo == 1)
+    left = v[n.lo];
+  else if (n.mid - n.lo > 1)
+    left = std::get<1>(insert(n.left, v));
+  if (n.hi - n.mid == 1)
+    right = v[n.mid];
+  else if (n.hi - n.mid > 1)
+    right = std::get<1>(insert(n.right, v));
+
+  return _tables[node].find_else_add((left << 32) | right);
+}
+
+void tree_table_t::get(std::size_t node, tchecker::tree_table_t::index_t index, tchecker::tree_table_t::value_t * v) const
+{
+  node_t const & n = _nodes[node];
+  uint64_t const p = _tables[node].pair(index);
+  tchecker::tree_table_t::index_t const left = static_cast<tchecker::tree_table_t::index_t>(p >> 32);
+  tchecker::tree_table_t::index_t const right = static_cast<tchecker::tree_table_t::index_t>(p);
+
+  if (n.mid - n.lo == 1)
+    v[n.lo] = left;
+  else if (n.mid - n.lo > 1)
+    get(n.left, left, v);
+  if (n.hi - n.mid == 1)
+    v[n.mid] = right;
+  else if (n.hi - n.mid > 1)
+    get(n.right, right, v);
+}
+
+} // end of namespace tchecker
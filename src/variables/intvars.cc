@@ -5,14 +5,13 @@
  *
  */
 
+#include <limits>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
-#include <boost/dynamic_bitset.hpp>
-
 #include "tchecker/utils/ordering.hh"
 #include "tchecker/utils/string.hh"
 #include "tchecker/variables/intvars.hh"
@@ -60,6 +59,24 @@ flat_integer_variables_valuations_range(tchecker::flat_integer_variables_t const
   return tchecker::make_range(it, tchecker::past_the_end_iterator);
 }
 
+tchecker::flat_integer_variables_valuations_range_t
+flat_integer_variables_valuations_range(tchecker::flat_integer_variables_t const & intvars,
+                                        tchecker::intvars_intervals_t const & intervals)
+{
+  if (intervals.size() != intvars.size())
+    throw std::invalid_argument("tchecker::flat_integer_variables_valuations_range: incompatible sizes");
+
+  tchecker::flat_integer_variables_valuations_iterator_t it;
+  for (auto && [min, max] : intervals) {
+    if (min > max)
+      throw std::invalid_argument("tchecker::flat_integer_variables_valuations_range: empty interval");
+    if (max == std::numeric_limits<tchecker::integer_t>::max())
+      throw std::overflow_error("tchecker::flat_integer_variables_valuations_range: cannot build range");
+    it.push_back(tchecker::make_integer_range(min, static_cast<tchecker::integer_t>(max + 1)));
+  }
+  return tchecker::make_range(it, tchecker::past_the_end_iterator);
+}
+
 /* intval_t */
 
 void intval_destruct_and_deallocate(tchecker::intval_t * v)
@@ -0,0 +1,519 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cassert>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/graph/output.hh"
+#include "tchecker/graph/subsumption_graph.hh"
+#include "tchecker/zg/certificate.hh"
+
+namespace tchecker {
+
+namespace zg {
+
+namespace certificate {
+
+static char const header_magic[8] = {'T', 'C', 'K', 'C', 'E', 'R', 'T', '1'}; /*!< Certificate header marker */
+static char const end_magic[8] = {'T', 'C', 'K', 'C', 'E', 'E', 'N', 'D'};    /*!< Certificate end marker */
+
+/*!
+ \brief Round up to a multiple
+ \param n : a number
+ \param m : a positive number
+ \return smallest multiple of m that is greater than or equal to n
+ */
+static constexpr std::size_t round_up(std::size_t n, std::size_t m) { return ((n + m - 1) / m) * m; }
+
+/*!
+ \brief Layout of node records
+ \param processes : number of processes
+ \param intvars : number of flattened integer variables
+ \param dim : dimension of zones
+ \return offsets of the tuple of locations, of the integer valuation and of the
+ DBM in node records, and size of node records (a multiple of 8 bytes)
+ */
+static std::tuple<std::size_t, std::size_t, std::size_t, std::size_t> layout(std::size_t processes, std::size_t intvars,
+                                                                              std::size_t dim)
+{
+  std::size_t const vloc_offset = sizeof(uint32_t);
+  std::size_t const intval_offset =
+      round_up(vloc_offset + processes * sizeof(tchecker::loc_id_t), alignof(tchecker::integer_t));
+  std::size_t const dbm_offset = round_up(intval_offset + intvars * sizeof(tchecker::integer_t), alignof(tchecker::dbm::db_t));
+  std::size_t const size = round_up(dbm_offset + dim * dim * sizeof(tchecker::dbm::db_t), 8);
+  return std::make_tuple(vloc_offset, intval_offset, dbm_offset, size);
+}
+
+/* writer_t */
+
+writer_t::writer_t(std::ostream & os, tchecker::ta::system_t const & system, std::string const & name,
+                   enum tchecker::zg::certificate::graph_kind_t kind, uint64_t nodes_count, uint64_t edges_count,
+                   std::vector<std::vector<tchecker::edge_id_t>> const & vedges)
+    : _os(os), _processes(system.processes_count()), _intvars(system.intvars_count(tchecker::VK_FLATTENED)),
+      _dim(static_cast<tchecker::clock_id_t>(system.clocks_count(tchecker::VK_FLATTENED) + 1)), _nodes_count(nodes_count),
+      _edges_count(edges_count), _written_nodes(0), _written_edges(0)
+{
+  write_raw(header_magic, sizeof(header_magic));
+  write(static_cast<uint64_t>(sizeof(tchecker::integer_t)));
+  write(static_cast<uint64_t>(sizeof(tchecker::dbm::db_t)));
+  write(static_cast<uint64_t>(kind));
+
+  // symbol tables
+  write(name);
+
+  write(static_cast<uint64_t>(_processes));
+  for (tchecker::process_id_t pid = 0; pid < _processes; ++pid)
+    write(system.process_name(pid));
+
+  write(static_cast<uint64_t>(system.events_count()));
+  for (tchecker::event_id_t id = 0; id < system.events_count(); ++id)
+    write(system.event_name(id));
+
+  write(static_cast<uint64_t>(system.labels_count()));
+  for (tchecker::label_id_t id = 0; id < system.labels_count(); ++id)
+    write(system.label_name(id));
+
+  write(static_cast<uint64_t>(system.locations_count()));
+  for (tchecker::loc_id_t id = 0; id < system.locations_count(); ++id) {
+    write(static_cast<uint64_t>(system.location(id)->pid()));
+    write(system.location(id)->name());
+    boost::dynamic_bitset<> const & labels = system.labels(id);
+    write(static_cast<uint64_t>(labels.count()));
+    for (std::size_t l = labels.find_first(); l != boost::dynamic_bitset<>::npos; l = labels.find_next(l))
+      write(static_cast<uint64_t>(l));
+  }
+
+  write(static_cast<uint64_t>(system.edges_count()));
+  for (tchecker::edge_id_t id = 0; id < system.edges_count(); ++id) {
+    write(static_cast<uint64_t>(system.edge(id)->pid()));
+    write(static_cast<uint64_t>(system.edge(id)->event_id()));
+  }
+
+  tchecker::intvar_index_t const & intvars_index = system.integer_variables().flattened().index();
+  write(static_cast<uint64_t>(_intvars));
+  for (tchecker::intvar_id_t id = 0; id < _intvars; ++id)
+    write(intvars_index.value(id));
+
+  tchecker::clock_index_t const & clocks_index = system.clock_variables().flattened().index();
+  write(static_cast<uint64_t>(_dim - 1));
+  for (tchecker::clock_id_t id = 0; id < _dim - 1; ++id)
+    write(clocks_index.value(id));
+
+  write(static_cast<uint64_t>(vedges.size()));
+  for (std::vector<tchecker::edge_id_t> const & vedge : vedges) {
+    write(static_cast<uint64_t>(vedge.size()));
+    for (tchecker::edge_id_t id : vedge)
+      write(static_cast<uint64_t>(id));
+  }
+
+  // records
+  write(_nodes_count);
+  write(_edges_count);
+
+  _record.resize(std::get<3>(layout(_processes, _intvars, _dim)));
+}
+
+void writer_t::write_node(tchecker::zg::state_t const & s, bool initial, bool final)
+{
+  if (_written_nodes == _nodes_count)
+    throw std::runtime_error("tchecker::zg::certificate::writer_t: too many nodes");
+  if (s.vloc().size() != _processes || s.intval().size() != _intvars || s.zone().dim() != _dim)
+    throw std::runtime_error("tchecker::zg::certificate::writer_t: state does not match the system");
+
+  auto && [vloc_offset, intval_offset, dbm_offset, size] = layout(_processes, _intvars, _dim);
+  std::memset(_record.data(), 0, size);
+
+  uint32_t flags = 0;
+  if (initial)
+    flags |= tchecker::zg::certificate::NODE_INITIAL;
+  if (final)
+    flags |= tchecker::zg::certificate::NODE_FINAL;
+  std::memcpy(_record.data(), &flags, sizeof(flags));
+
+  tchecker::loc_id_t * vloc = reinterpret_cast<tchecker::loc_id_t *>(_record.data() + vloc_offset);
+  for (std::size_t i = 0; i < _processes; ++i)
+    vloc[i] = s.vloc()[i];
+
+  tchecker::integer_t * intval = reinterpret_cast<tchecker::integer_t *>(_record.data() + intval_offset);
+  for (std::size_t i = 0; i < _intvars; ++i)
+    intval[i] = s.intval()[i];
+
+  std::memcpy(_record.data() + dbm_offset, s.zone().dbm(), _dim * _dim * sizeof(tchecker::dbm::db_t));
+
+  write_raw(_record.data(), size);
+  ++_written_nodes;
+}
+
+void writer_t::write_edge(uint64_t src, uint64_t tgt, uint32_t vedge, uint32_t edge_type)
+{
+  if (_written_nodes != _nodes_count)
+    throw std::runtime_error("tchecker::zg::certificate::writer_t: edges written before all nodes");
+  if (_written_edges == _edges_count)
+    throw std::runtime_error("tchecker::zg::certificate::writer_t: too many edges");
+
+  tchecker::zg::certificate::edge_record_t const record{src, tgt, vedge, edge_type};
+  write_raw(&record, sizeof(record));
+  ++_written_edges;
+}
+
+void writer_t::close()
+{
+  if (_written_nodes != _nodes_count || _written_edges != _edges_count)
+    throw std::runtime_error("tchecker::zg::certificate::writer_t: missing nodes or edges");
+  write_raw(end_magic, sizeof(end_magic));
+  _os.flush();
+  if (_os.fail())
+    throw std::runtime_error("Unable to write certificate");
+}
+
+void writer_t::write_raw(void const * p, std::size_t size)
+{
+  _os.write(reinterpret_cast<char const *>(p), size);
+  if (_os.fail())
+    throw std::runtime_error("Unable to write certificate");
+}
+
+void writer_t::write(uint64_t n) { write_raw(&n, sizeof(n)); }
+
+void writer_t::write(std::string const & s)
+{
+  static char const padding[8] = {0};
+  write(static_cast<uint64_t>(s.size()));
+  write_raw(s.data(), s.size());
+  write_raw(padding, round_up(s.size(), 8) - s.size());
+}
+
+/* reader_t */
+
+/*!
+ \class cursor_t
+ \brief Sequential reading of the header of a mapped certificate
+ */
+class cursor_t {
+public:
+  /*!
+   \brief Constructor
+   \param data : mapped certificate
+   \param size : size of mapped certificate
+   \param filename : name of certificate file
+   */
+  cursor_t(char const * data, std::size_t size, std::string const & filename)
+      : _data(data), _size(size), _offset(0), _filename(filename)
+  {
+  }
+
+  /*!
+   \brief Accessor
+   \return current offset
+   */
+  inline std::size_t offset() const { return _offset; }
+
+  /*!
+   \brief Skip bytes
+   \param size : number of bytes
+   \return pointer to the skipped bytes
+   \throw std::runtime_error : if there are less than size bytes left
+   */
+  char const * skip(std::size_t size)
+  {
+    if (size > _size - _offset)
+      throw std::runtime_error("Truncated certificate " + _filename);
+    char const * p = _data + _offset;
+    _offset += size;
+    return p;
+  }
+
+  /*!
+   \brief Read an unsigned integer
+   \return the 64-bits unsigned integer at current offset
+   \throw std::runtime_error : if there are less than 8 bytes left
+   */
+  uint64_t read()
+  {
+    uint64_t n;
+    std::memcpy(&n, skip(sizeof(n)), sizeof(n));
+    return n;
+  }
+
+  /*!
+   \brief Read a size
+   \param limit : bound on the size
+   \return the 64-bits unsigned integer at current offset
+   \throw std::runtime_error : if there are less than 8 bytes left, or if the
+   size is greater than limit
+   */
+  std::size_t read_size(uint64_t limit)
+  {
+    uint64_t const n = read();
+    if (n > limit)
+      throw std::runtime_error("Invalid certificate " + _filename);
+    return static_cast<std::size_t>(n);
+  }
+
+  /*!
+   \brief Read an identifier
+   \param count : number of identifiers
+   \return the 64-bits unsigned integer at current offset
+   \throw std::runtime_error : if there are less than 8 bytes left, or if the
+   identifier is not less than count
+   */
+  std::size_t read_id(std::size_t count)
+  {
+    uint64_t const n = read();
+    if (n >= count)
+      throw std::runtime_error("Invalid certificate " + _filename);
+    return static_cast<std::size_t>(n);
+  }
+
+  /*!
+   \brief Read a string
+   \return the string at current offset
+   \throw std::runtime_error : if the string is truncated
+   */
+  std::string read_string()
+  {
+    std::size_t const length = read_size(_size);
+    char const * p = skip(round_up(length, 8));
+    return std::string(p, length);
+  }
+
+  /*!
+   \brief Read a table of strings
+   \param v : a vector of strings
+   \post the table of strings at current offset has been read into v
+   \throw std::runtime_error : if the table is truncated
+   */
+  void read_strings(std::vector<std::string> & v)
+  {
+    std::size_t const count = read_size(_size);
+    v.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+      v.push_back(read_string());
+  }
+
+private:
+  char const * _data;            /*!< Mapped certificate */
+  std::size_t _size;             /*!< Size of mapped certificate */
+  std::size_t _offset;           /*!< Current offset */
+  std::string const & _filename; /*!< Name of certificate file */
+};
+
+reader_t::reader_t(std::string const & filename)
+    : _filename(filename), _data(nullptr), _size(0), _kind(tchecker::zg::certificate::KIND_REACHABILITY), _dim(0),
+      _nodes_count(0), _edges_count(0), _vloc_offset(0), _intval_offset(0), _dbm_offset(0), _record_size(0),
+      _nodes(nullptr), _edges(nullptr)
+{
+  int const fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+    throw std::runtime_error("Unable to open certificate " + filename);
+  struct stat st;
+  if (::fstat(fd, &st) == -1 || st.st_size == 0) {
+    ::close(fd);
+    throw std::runtime_error("Unable to read certificate " + filename);
+  }
+  _size = static_cast<std::size_t>(st.st_size);
+  void * p = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED)
+    throw std::runtime_error("Unable to map certificate " + filename);
+  _data = static_cast<char const *>(p);
+
+  try {
+    cursor_t cursor{_data, _size, _filename};
+    if (std::memcmp(cursor.skip(sizeof(header_magic)), header_magic, sizeof(header_magic)) != 0)
+      throw std::runtime_error("Not a certificate: " + filename);
+    if (cursor.read() != sizeof(tchecker::integer_t) || cursor.read() != sizeof(tchecker::dbm::db_t))
+      throw std::runtime_error("Certificate " + filename + " has been produced with another size of integers");
+    uint64_t const kind = cursor.read();
+    if (kind != tchecker::zg::certificate::KIND_REACHABILITY && kind != tchecker::zg::certificate::KIND_SUBSUMPTION)
+      throw std::runtime_error("Invalid certificate " + filename);
+    _kind = static_cast<enum tchecker::zg::certificate::graph_kind_t>(kind);
+
+    // symbol tables
+    _symbols.name = cursor.read_string();
+    cursor.read_strings(_symbols.processes);
+    cursor.read_strings(_symbols.events);
+    cursor.read_strings(_symbols.labels);
+
+    std::size_t const locations_count = cursor.read_size(_size);
+    _symbols.locations.resize(locations_count);
+    for (tchecker::zg::certificate::location_t & loc : _symbols.locations) {
+      loc.pid = static_cast<tchecker::process_id_t>(cursor.read_id(_symbols.processes.size()));
+      loc.name = cursor.read_string();
+      std::size_t const labels_count = cursor.read_size(_symbols.labels.size());
+      for (std::size_t i = 0; i < labels_count; ++i)
+        loc.labels.push_back(static_cast<tchecker::label_id_t>(cursor.read_id(_symbols.labels.size())));
+    }
+
+    std::size_t const edges_count = cursor.read_size(_size);
+    _symbols.edges.resize(edges_count);
+    for (tchecker::zg::certificate::edge_t & edge : _symbols.edges) {
+      edge.pid = static_cast<tchecker::process_id_t>(cursor.read_id(_symbols.processes.size()));
+      edge.event_id = static_cast<tchecker::event_id_t>(cursor.read_id(_symbols.events.size()));
+    }
+
+    cursor.read_strings(_symbols.intvars);
+    cursor.read_strings(_symbols.clocks);
+    _dim = static_cast<tchecker::clock_id_t>(_symbols.clocks.size() + 1);
+
+    std::size_t const vedges_count = cursor.read_size(_size);
+    _symbols.vedges.resize(vedges_count);
+    for (std::vector<tchecker::edge_id_t> & vedge : _symbols.vedges) {
+      std::size_t const size = cursor.read_size(_symbols.processes.size());
+      for (std::size_t i = 0; i < size; ++i)
+        vedge.push_back(static_cast<tchecker::edge_id_t>(cursor.read_id(_symbols.edges.size())));
+    }
+
+    // records
+    _nodes_count = cursor.read_size(_size);
+    _edges_count = cursor.read_size(_size);
+    std::tie(_vloc_offset, _intval_offset, _dbm_offset, _record_size) =
+        layout(_symbols.processes.size(), _symbols.intvars.size(), _dim);
+    if (_nodes_count > 0 && _record_size > (_size - cursor.offset()) / _nodes_count)
+      throw std::runtime_error("Truncated certificate " + filename);
+    _nodes = cursor.skip(_nodes_count * _record_size);
+    if (_edges_count > (_size - cursor.offset()) / sizeof(tchecker::zg::certificate::edge_record_t))
+      throw std::runtime_error("Truncated certificate " + filename);
+    _edges = reinterpret_cast<tchecker::zg::certificate::edge_record_t const *>(
+        cursor.skip(_edges_count * sizeof(tchecker::zg::certificate::edge_record_t)));
+    if (std::memcmp(cursor.skip(sizeof(end_magic)), end_magic, sizeof(end_magic)) != 0)
+      throw std::runtime_error("Invalid certificate " + filename);
+  }
+  catch (...) {
+    ::munmap(const_cast<char *>(_data), _size);
+    throw;
+  }
+}
+
+reader_t::~reader_t() { ::munmap(const_cast<char *>(_data), _size); }
+
+tchecker::zg::certificate::node_t reader_t::node(std::size_t i) const
+{
+  assert(i < _nodes_count);
+  char const * record = _nodes + i * _record_size;
+  tchecker::zg::certificate::node_t n;
+  std::memcpy(&n.flags, record, sizeof(n.flags));
+  n.vloc = reinterpret_cast<tchecker::loc_id_t const *>(record + _vloc_offset);
+  n.intval = reinterpret_cast<tchecker::integer_t const *>(record + _intval_offset);
+  n.dbm = reinterpret_cast<tchecker::dbm::db_t const *>(record + _dbm_offset);
+  return n;
+}
+
+tchecker::zg::certificate::edge_record_t const & reader_t::edge(std::size_t i) const
+{
+  assert(i < _edges_count);
+  return _edges[i];
+}
+
+/* dot_output */
+
+/*!
+ \brief Checked access to a symbol table
+ \param v : a table
+ \param id : an identifier
+ \return v[id]
+ \throw std::runtime_error : if id is out of v
+ */
+template <class T> static T const & symbol(std::vector<T> const & v, std::size_t id)
+{
+  if (id >= v.size())
+    throw std::runtime_error("tchecker::zg::certificate::dot_output: identifier out of symbol tables");
+  return v[id];
+}
+
+std::ostream & dot_output(std::ostream & os, tchecker::zg::certificate::reader_t const & reader)
+{
+  tchecker::zg::certificate::symbols_t const & symbols = reader.symbols();
+  std::size_t const processes = symbols.processes.size();
+  std::map<std::string, std::string> attr;
+  std::stringstream ss;
+  boost::dynamic_bitset<> labels(symbols.labels.size());
+
+  tchecker::graph::dot_output_header(os, symbols.name);
+
+  for (std::size_t i = 0; i < reader.nodes_count(); ++i) {
+    tchecker::zg::certificate::node_t const n = reader.node(i);
+    attr.clear();
+
+    if (n.flags & tchecker::zg::certificate::NODE_INITIAL)
+      attr["initial"] = "true";
+    if (n.flags & tchecker::zg::certificate::NODE_FINAL)
+      attr["final"] = "true";
+
+    ss.str("");
+    labels.reset();
+    ss << "<";
+    for (std::size_t p = 0; p < processes; ++p) {
+      tchecker::zg::certificate::location_t const & loc = symbol(symbols.locations, n.vloc[p]);
+      ss << (p > 0 ? "," : "") << loc.name;
+      for (tchecker::label_id_t l : loc.labels)
+        labels.set(l);
+    }
+    ss << ">";
+    attr["vloc"] = ss.str();
+
+    ss.str("");
+    for (std::size_t l = labels.find_first(); l != boost::dynamic_bitset<>::npos; l = labels.find_next(l))
+      ss << (l != labels.find_first() ? "," : "") << symbols.labels[l];
+    attr["labels"] = ss.str();
+
+    ss.str("");
+    for (std::size_t id = 0; id < symbols.intvars.size(); ++id)
+      ss << (id > 0 ? "," : "") << symbols.intvars[id] << "=" << n.intval[id];
+    attr["intval"] = ss.str();
+
+    ss.str("");
+    tchecker::dbm::output(ss, n.dbm, reader.dim(),
+                          [&](tchecker::clock_id_t id) { return (id == 0 ? "0" : symbols.clocks[id - 1]); });
+    attr["zone"] = ss.str();
+
+    tchecker::graph::dot_output_node(os, std::to_string(i), attr);
+  }
+
+  for (std::size_t i = 0; i < reader.edges_count(); ++i) {
+    tchecker::zg::certificate::edge_record_t const & e = reader.edge(i);
+    if (e.src >= reader.nodes_count() || e.tgt >= reader.nodes_count())
+      throw std::runtime_error("tchecker::zg::certificate::dot_output: node out of certificate");
+    attr.clear();
+
+    if (reader.kind() == tchecker::zg::certificate::KIND_SUBSUMPTION)
+      attr["edge_type"] = (e.edge_type == tchecker::graph::subsumption::EDGE_ACTUAL ? "actual" : "subsumption");
+
+    ss.str("");
+    ss << "<";
+    std::vector<tchecker::edge_id_t> const & vedge = symbol(symbols.vedges, e.vedge);
+    for (std::size_t k = 0; k < vedge.size(); ++k) {
+      tchecker::zg::certificate::edge_t const & edge = symbol(symbols.edges, vedge[k]);
+      ss << (k > 0 ? "," : "") << symbol(symbols.processes, edge.pid) << "@" << symbol(symbols.events, edge.event_id);
+    }
+    ss << ">";
+    attr["vedge"] = ss.str();
+
+    tchecker::graph::dot_output_edge(os, std::to_string(e.src), std::to_string(e.tgt), attr);
+  }
+
+  tchecker::graph::dot_output_footer(os);
+
+  return os;
+}
+
+} // end of namespace certificate
+
+} // end of namespace zg
+
+} // end of namespace tchecker
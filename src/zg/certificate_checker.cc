@@ -0,0 +1,511 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+
+#include "tchecker/clockbounds/clockbounds.hh"
+#include "tchecker/clockbounds/solver.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/syncprod/vedge.hh"
+#include "tchecker/zg/certificate_checker.hh"
+#include "tchecker/zg/zg.hh"
+
+namespace tchecker {
+
+namespace zg {
+
+namespace certificate {
+
+/* violation_t */
+
+std::ostream & operator<<(std::ostream & os, tchecker::zg::certificate::violation_t const & violation)
+{
+  switch (violation.type) {
+  case tchecker::zg::certificate::VIOLATION_INVALID_NODE:
+    return os << "node " << violation.node << " is not a state of the zone graph";
+  case tchecker::zg::certificate::VIOLATION_FINAL_NODE:
+    return os << "node " << violation.node << " " << violation.state << " satisfies the searched labels";
+  case tchecker::zg::certificate::VIOLATION_UNCOVERED_INITIAL:
+    return os << "initial state " << violation.state << " is not covered";
+  case tchecker::zg::certificate::VIOLATION_UNCOVERED_SUCCESSOR:
+    return os << "successor " << violation.state << " of node " << violation.node << " along " << violation.vedge
+              << " is not covered";
+  default:
+    throw std::invalid_argument("Unknown type of violation");
+  }
+}
+
+/* check_stats_t */
+
+check_stats_t::check_stats_t() : _checked_nodes(0), _initial_states(0), _successors(0), _violations(0) {}
+
+unsigned long & check_stats_t::checked_nodes() { return _checked_nodes; }
+
+unsigned long check_stats_t::checked_nodes() const { return _checked_nodes; }
+
+unsigned long & check_stats_t::initial_states() { return _initial_states; }
+
+unsigned long check_stats_t::initial_states() const { return _initial_states; }
+
+unsigned long & check_stats_t::successors() { return _successors; }
+
+unsigned long check_stats_t::successors() const { return _successors; }
+
+unsigned long & check_stats_t::violations() { return _violations; }
+
+unsigned long check_stats_t::violations() const { return _violations; }
+
+void check_stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  tchecker::algorithms::stats_t::attributes(m);
+
+  std::stringstream sstream;
+
+  sstream << _checked_nodes;
+  m["CHECKED_NODES"] = sstream.str();
+
+  sstream.str("");
+  sstream << _initial_states;
+  m["INITIAL_STATES"] = sstream.str();
+
+  sstream.str("");
+  sstream << _successors;
+  m["SUCCESSORS"] = sstream.str();
+
+  sstream.str("");
+  sstream << _violations;
+  m["VIOLATIONS"] = sstream.str();
+
+  sstream.str("");
+  sstream << std::boolalpha << valid();
+  m["VALID_CERTIFICATE"] = sstream.str();
+}
+
+/* check_symbols */
+
+/*!
+ \brief Check a symbol table
+ \param what : name of the table
+ \param v : a table
+ \param count : expected size
+ \param name : function that yields the expected name of an identifier
+ \throw std::runtime_error : if v does not have size count, or if the names in v
+ differ from name
+ */
+static void check_table(char const * what, std::vector<std::string> const & v, std::size_t count,
+                        std::function<std::string(std::size_t)> const & name)
+{
+  if (v.size() != count)
+    throw std::runtime_error(std::string{"Certificate does not match the system: unexpected number of "} + what);
+  for (std::size_t id = 0; id < count; ++id)
+    if (v[id] != name(id))
+      throw std::runtime_error(std::string{"Certificate does not match the system: unexpected "} + what + " " + v[id]);
+}
+
+void check_symbols(tchecker::zg::certificate::reader_t const & reader, tchecker::ta::system_t const & system)
+{
+  tchecker::zg::certificate::symbols_t const & symbols = reader.symbols();
+
+  check_table("processes", symbols.processes, system.processes_count(),
+              [&](std::size_t id) { return system.process_name(static_cast<tchecker::process_id_t>(id)); });
+  check_table("events", symbols.events, system.events_count(),
+              [&](std::size_t id) { return system.event_name(static_cast<tchecker::event_id_t>(id)); });
+  check_table("labels", symbols.labels, system.labels_count(),
+              [&](std::size_t id) { return system.label_name(static_cast<tchecker::label_id_t>(id)); });
+
+  tchecker::intvar_index_t const & intvars_index = system.integer_variables().flattened().index();
+  check_table("integer variables", symbols.intvars, system.intvars_count(tchecker::VK_FLATTENED),
+              [&](std::size_t id) { return intvars_index.value(static_cast<tchecker::intvar_id_t>(id)); });
+
+  tchecker::clock_index_t const & clocks_index = system.clock_variables().flattened().index();
+  check_table("clocks", symbols.clocks, system.clocks_count(tchecker::VK_FLATTENED),
+              [&](std::size_t id) { return clocks_index.value(static_cast<tchecker::clock_id_t>(id)); });
+
+  if (symbols.locations.size() != system.locations_count())
+    throw std::runtime_error("Certificate does not match the system: unexpected number of locations");
+  for (tchecker::loc_id_t id = 0; id < system.locations_count(); ++id)
+    if (symbols.locations[id].pid != system.location(id)->pid() || symbols.locations[id].name != system.location(id)->name())
+      throw std::runtime_error("Certificate does not match the system: unexpected location " + symbols.locations[id].name);
+
+  if (symbols.edges.size() != system.edges_count())
+    throw std::runtime_error("Certificate does not match the system: unexpected number of edges");
+  for (tchecker::edge_id_t id = 0; id < system.edges_count(); ++id)
+    if (symbols.edges[id].pid != system.edge(id)->pid() || symbols.edges[id].event_id != system.edge(id)->event_id())
+      throw std::runtime_error("Certificate does not match the system: unexpected edge " + std::to_string(id));
+}
+
+/* check */
+
+/*!
+ \class node_index_t
+ \brief Index of the nodes of a certificate w.r.t. their discrete part (tuple
+ of locations and integer valuation)
+ \note keys refer to the memory of the certificate: the discrete part of a node
+ record is the sequence of bytes from its tuple of locations to its DBM
+ (padding is zeroed by the writer)
+ */
+class node_index_t {
+public:
+  /*!
+   \brief Constructor
+   \param reader : a certificate
+   \param valid : valid nodes
+   \post all valid nodes of reader have been indexed
+   */
+  node_index_t(tchecker::zg::certificate::reader_t const & reader, std::vector<char> const & valid)
+      : _key_size(0), _intval_offset(0)
+  {
+    if (reader.nodes_count() == 0)
+      return;
+    tchecker::zg::certificate::node_t const n = reader.node(0);
+    _key_size = static_cast<std::size_t>(reinterpret_cast<char const *>(n.dbm) - reinterpret_cast<char const *>(n.vloc));
+    _intval_offset =
+        static_cast<std::size_t>(reinterpret_cast<char const *>(n.intval) - reinterpret_cast<char const *>(n.vloc));
+
+    _index.reserve(reader.nodes_count());
+    for (std::size_t i = 0; i < reader.nodes_count(); ++i)
+      if (valid[i])
+        _index[key(reader.node(i))].push_back(i);
+  }
+
+  /*!
+   \brief Accessor
+   \param s : a state
+   \param buffer : a buffer
+   \return indices of the nodes with the same discrete part as s, nullptr if
+   there is none
+   \post buffer has been overwritten
+   */
+  std::vector<uint64_t> const * nodes(tchecker::zg::state_t const & s, std::string & buffer) const
+  {
+    if (_key_size == 0)
+      return nullptr;
+    buffer.assign(_key_size, '\0');
+    std::memcpy(&buffer[0], s.vloc().ptr(), s.vloc().size() * sizeof(tchecker::loc_id_t));
+    std::memcpy(&buffer[_intval_offset], s.intval().ptr(), s.intval().size() * sizeof(tchecker::integer_t));
+    auto it = _index.find(std::string_view{buffer});
+    return (it == _index.end() ? nullptr : &it->second);
+  }
+
+private:
+  /*!
+   \brief Accessor
+   \param n : a node
+   \return key of n
+   */
+  std::string_view key(tchecker::zg::certificate::node_t const & n) const
+  {
+    return std::string_view{reinterpret_cast<char const *>(n.vloc), _key_size};
+  }
+
+  std::size_t _key_size;                                              /*!< Size of keys */
+  std::size_t _intval_offset;                                         /*!< Offset of integer valuation in keys */
+  std::unordered_map<std::string_view, std::vector<uint64_t>> _index; /*!< Nodes indexed by discrete part */
+};
+
+/*!
+ \brief Check if a node is a state of the zone graph
+ \param n : a node
+ \param dim : dimension of zones
+ \param system : a system of timed processes
+ \return true if the locations in n belong to their processes, the integer
+ valuation in n is within the bounds of the integer variables of system, and the
+ DBM in n is consistent, positive and tight, false otherwise
+ */
+static bool is_valid_node(tchecker::zg::certificate::node_t const & n, tchecker::clock_id_t dim,
+                          tchecker::ta::system_t const & system)
+{
+  for (tchecker::process_id_t pid = 0; pid < system.processes_count(); ++pid)
+    if (n.vloc[pid] >= system.locations_count() || system.location(n.vloc[pid])->pid() != pid)
+      return false;
+
+  auto const & intvars = system.integer_variables().flattened();
+  for (tchecker::intvar_id_t id = 0; id < system.intvars_count(tchecker::VK_FLATTENED); ++id)
+    if (n.intval[id] < intvars.info(id).min() || n.intval[id] > intvars.info(id).max())
+      return false;
+
+  return tchecker::dbm::is_consistent(n.dbm, dim) && tchecker::dbm::is_positive(n.dbm, dim) &&
+         tchecker::dbm::is_tight(n.dbm, dim);
+}
+
+/*!
+ \brief Run a function on a range of indices with several threads
+ \param count : number of indices
+ \param threads : number of threads
+ \param f : function called with a thread number and an index
+ \post f(t, i) has been called for every i in [0..count), where t in
+ [0..threads) identifies the calling thread
+ */
+static void parallel_for(std::size_t count, std::size_t threads, std::function<void(std::size_t, std::size_t)> const & f)
+{
+  static constexpr std::size_t CHUNK = 256;
+  std::atomic<std::size_t> next{0};
+  auto worker = [&](std::size_t t) {
+    for (std::size_t begin = next.fetch_add(CHUNK); begin < count; begin = next.fetch_add(CHUNK))
+      for (std::size_t i = begin; i < std::min(begin + CHUNK, count); ++i)
+        f(t, i);
+  };
+
+  std::vector<std::thread> workers;
+  for (std::size_t t = 1; t < threads; ++t)
+    workers.emplace_back(worker, t);
+  worker(0);
+  for (std::thread & w : workers)
+    w.join();
+}
+
+/*!
+ \brief Attributes of a state
+ \param zg : a zone graph
+ \param s : a state of zg
+ \return the tuple of locations, the integer valuation and the zone of s
+ */
+static std::string state_attributes(tchecker::zg::zg_t const & zg, tchecker::zg::const_state_sptr_t const & s)
+{
+  std::map<std::string, std::string> m;
+  zg.attributes(s, m);
+  return m["vloc"] + " " + m["intval"] + " " + m["zone"];
+}
+
+/*!
+ \class thread_checker_t
+ \brief Checker of the nodes assigned to a thread
+ */
+class thread_checker_t {
+public:
+  /*!
+   \brief Constructor
+   \param reader : a certificate
+   \param system : system of timed processes of the certificate
+   \param clock_bounds : clock bounds of system
+   \param index : index of valid nodes
+   \param covering : covering relation
+   \param block_size : number of objects allocated in a block
+   \param table_size : size of hash tables
+   */
+  thread_checker_t(tchecker::zg::certificate::reader_t const & reader,
+                   std::shared_ptr<tchecker::ta::system_t const> const & system,
+                   tchecker::clockbounds::clockbounds_t const & clock_bounds,
+                   tchecker::zg::certificate::node_index_t const & index, enum tchecker::zg::certificate::covering_t covering,
+                   std::size_t block_size, std::size_t table_size)
+      : _reader(reader), _system(system), _local_lu(clock_bounds.local_lu_map()), _index(index), _covering(covering),
+        _zg(tchecker::zg::factory(system, tchecker::ts::NO_SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                  tchecker::zg::EXTRA_LU_PLUS_LOCAL, clock_bounds, block_size, table_size)),
+        _l(tchecker::clockbounds::allocate_map(clock_bounds.clocks_number())),
+        _u(tchecker::clockbounds::allocate_map(clock_bounds.clocks_number())), _vloc(system->processes_count()),
+        _intval(system->intvars_count(tchecker::VK_FLATTENED)), _dbm(reader.dim() * reader.dim()), _successors(0)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  thread_checker_t(tchecker::zg::certificate::thread_checker_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  thread_checker_t(tchecker::zg::certificate::thread_checker_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  ~thread_checker_t()
+  {
+    tchecker::clockbounds::deallocate_map(_l);
+    tchecker::clockbounds::deallocate_map(_u);
+  }
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::zg::certificate::thread_checker_t & operator=(tchecker::zg::certificate::thread_checker_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::zg::certificate::thread_checker_t & operator=(tchecker::zg::certificate::thread_checker_t &&) = delete;
+
+  /*!
+   \brief Accessor
+   \return zone graph of this thread
+   */
+  inline tchecker::zg::zg_t & zg() { return *_zg; }
+
+  /*!
+   \brief Check if a state is covered by a node
+   \param s : a state
+   \return true if s is covered by a valid node of the certificate, false
+   otherwise
+   */
+  bool covered(tchecker::zg::state_t const & s)
+  {
+    std::vector<uint64_t> const * nodes = _index.nodes(s, _key);
+    if (nodes == nullptr)
+      return false;
+
+    tchecker::dbm::db_t const * dbm = s.zone().dbm();
+    tchecker::clock_id_t const dim = _reader.dim();
+    if (_covering == tchecker::zg::certificate::COVERING_ALU)
+      _local_lu->bounds(s.vloc(), *_l, *_u);
+
+    for (uint64_t i : *nodes) {
+      tchecker::dbm::db_t const * node_dbm = _reader.node(i).dbm;
+      if (_covering == tchecker::zg::certificate::COVERING_ALU) {
+        if (tchecker::dbm::is_alu_le(dbm, node_dbm, dim, _l->ptr(), _u->ptr()))
+          return true;
+      }
+      else if (tchecker::dbm::is_le(dbm, node_dbm, dim))
+        return true;
+    }
+    return false;
+  }
+
+  /*!
+   \brief Check a node
+   \param i : index of a valid node
+   \param labels : searched labels
+   \post the violations of node i have been added to the violations of this
+   thread
+   */
+  void check_node(std::size_t i, boost::dynamic_bitset<> const & labels)
+  {
+    tchecker::zg::certificate::node_t const n = _reader.node(i);
+    std::copy(n.vloc, n.vloc + _vloc.size(), _vloc.begin());
+    std::copy(n.intval, n.intval + _intval.size(), _intval.begin());
+    std::copy(n.dbm, n.dbm + _dbm.size(), _dbm.begin());
+    tchecker::zg::const_state_sptr_t s{_zg->build_state(_vloc, _intval, _dbm)};
+
+    if (!labels.none() && labels.is_subset_of(_zg->labels(s)) && _zg->is_valid_final(s))
+      _violations.push_back({tchecker::zg::certificate::VIOLATION_FINAL_NODE, i, state_attributes(*_zg, s), ""});
+
+    _v.clear();
+    _zg->next(s, _v);
+    for (auto && [status, next_s, next_t] : _v) {
+      ++_successors;
+      if (!covered(*next_s))
+        _violations.push_back({tchecker::zg::certificate::VIOLATION_UNCOVERED_SUCCESSOR, i,
+                               state_attributes(*_zg, tchecker::zg::const_state_sptr_t{next_s}),
+                               tchecker::to_string(next_t->vedge(), _system->as_system_system())});
+    }
+    _v.clear();
+  }
+
+  /*!
+   \brief Accessor
+   \return violations found by this thread
+   */
+  inline std::vector<tchecker::zg::certificate::violation_t> & violations() { return _violations; }
+
+  /*!
+   \brief Accessor
+   \return number of successors computed by this thread
+   */
+  inline unsigned long successors() const { return _successors; }
+
+private:
+  tchecker::zg::certificate::reader_t const & _reader;                    /*!< Certificate */
+  std::shared_ptr<tchecker::ta::system_t const> _system;                  /*!< System of timed processes */
+  std::shared_ptr<tchecker::clockbounds::local_lu_map_t const> _local_lu; /*!< Local LU bounds */
+  tchecker::zg::certificate::node_index_t const & _index;                 /*!< Index of valid nodes */
+  enum tchecker::zg::certificate::covering_t _covering;                   /*!< Covering relation */
+  std::unique_ptr<tchecker::zg::zg_t> _zg;                                /*!< Zone graph of this thread */
+  tchecker::clockbounds::map_t * _l;                                      /*!< Lower bounds for aLU covering */
+  tchecker::clockbounds::map_t * _u;                                      /*!< Upper bounds for aLU covering */
+  std::vector<tchecker::loc_id_t> _vloc;                                  /*!< Buffer for tuples of locations */
+  std::vector<tchecker::integer_t> _intval;                               /*!< Buffer for integer valuations */
+  std::vector<tchecker::dbm::db_t> _dbm;                                  /*!< Buffer for DBMs */
+  std::string _key;                                                       /*!< Buffer for index keys */
+  std::vector<tchecker::zg::zg_t::sst_t> _v;                              /*!< Buffer for successors */
+  unsigned long _successors;                                              /*!< Number of computed successors */
+  std::vector<tchecker::zg::certificate::violation_t> _violations;        /*!< Violations */
+};
+
+tchecker::zg::certificate::check_stats_t check(tchecker::zg::certificate::reader_t const & reader,
+                                               std::shared_ptr<tchecker::ta::system_t const> const & system,
+                                               boost::dynamic_bitset<> const & labels,
+                                               enum tchecker::zg::certificate::covering_t covering, std::size_t threads,
+                                               std::size_t max_violations, std::size_t block_size, std::size_t table_size,
+                                               std::vector<tchecker::zg::certificate::violation_t> & violations)
+{
+  tchecker::zg::certificate::check_stats_t stats;
+  stats.set_start_time();
+
+  std::unique_ptr<tchecker::clockbounds::clockbounds_t> clock_bounds{tchecker::clockbounds::compute_clockbounds(*system)};
+  if (clock_bounds == nullptr)
+    throw std::runtime_error("Cannot compute clock bounds of the system");
+
+  std::vector<tchecker::zg::certificate::violation_t> found;
+
+  // valid nodes
+  std::vector<char> valid(reader.nodes_count(), 0);
+  parallel_for(reader.nodes_count(), threads, [&](std::size_t, std::size_t i) {
+    valid[i] = (is_valid_node(reader.node(i), reader.dim(), *system) ? 1 : 0);
+  });
+  for (std::size_t i = 0; i < reader.nodes_count(); ++i)
+    if (!valid[i])
+      found.push_back({tchecker::zg::certificate::VIOLATION_INVALID_NODE, i, "", ""});
+
+  tchecker::zg::certificate::node_index_t const index{reader, valid};
+
+  std::vector<std::unique_ptr<tchecker::zg::certificate::thread_checker_t>> checkers;
+  for (std::size_t t = 0; t < threads; ++t)
+    checkers.push_back(std::make_unique<tchecker::zg::certificate::thread_checker_t>(reader, system, *clock_bounds, index,
+                                                                                     covering, block_size, table_size));
+
+  // initial states
+  {
+    std::vector<tchecker::zg::zg_t::sst_t> v;
+    checkers[0]->zg().initial(v);
+    for (auto && [status, s, t] : v) {
+      if (!checkers[0]->covered(*s))
+        found.push_back({tchecker::zg::certificate::VIOLATION_UNCOVERED_INITIAL, stats.initial_states(),
+                         state_attributes(checkers[0]->zg(), tchecker::zg::const_state_sptr_t{s}), ""});
+      ++stats.initial_states();
+    }
+  }
+
+  // successors
+  parallel_for(reader.nodes_count(), threads, [&](std::size_t t, std::size_t i) {
+    if (valid[i])
+      checkers[t]->check_node(i, labels);
+  });
+
+  for (std::unique_ptr<tchecker::zg::certificate::thread_checker_t> & checker : checkers) {
+    stats.successors() += checker->successors();
+    found.insert(found.end(), checker->violations().begin(), checker->violations().end());
+  }
+
+  stats.checked_nodes() = reader.nodes_count();
+  stats.violations() = found.size();
+
+  std::stable_sort(found.begin(), found.end(),
+                   [](tchecker::zg::certificate::violation_t const & v1, tchecker::zg::certificate::violation_t const & v2) {
+                     return std::tie(v1.type, v1.node) < std::tie(v2.type, v2.node);
+                   });
+  if (found.size() > max_violations)
+    found.resize(max_violations);
+  violations.insert(violations.end(), found.begin(), found.end());
+
+  stats.set_end_time();
+  return stats;
+}
+
+} // end of namespace certificate
+
+} // end of namespace zg
+
+} // end of namespace tchecker
@@ -7,6 +7,7 @@
 
 #include "tchecker/zg/extrapolation.hh"
 #include "tchecker/clockbounds/solver.hh"
+#include "tchecker/ta/static_analysis.hh"
 
 namespace tchecker {
 
@@ -217,6 +218,33 @@ void local_extra_m_plus_t::extrapolate(tchecker::dbm::db_t * dbm, tchecker::cloc
   tchecker::dbm::extra_m_plus(dbm, dim, _m->ptr());
 }
 
+/* active_clocks_extrapolation_t */
+
+active_clocks_extrapolation_t::active_clocks_extrapolation_t(
+    std::vector<boost::dynamic_bitset<>> const & active_clocks,
+    std::shared_ptr<tchecker::zg::extrapolation_t> const & extrapolation)
+    : _active_clocks(active_clocks), _extrapolation(extrapolation)
+{
+  if (!_active_clocks.empty())
+    _vloc_active_clocks.resize(_active_clocks[0].size());
+}
+
+void active_clocks_extrapolation_t::extrapolate(tchecker::dbm::db_t * dbm, tchecker::clock_id_t dim,
+                                                tchecker::vloc_t const & vloc)
+{
+  assert(dim == _vloc_active_clocks.size() + 1);
+
+  _vloc_active_clocks.reset();
+  for (tchecker::loc_id_t id : vloc)
+    _vloc_active_clocks |= _active_clocks[id];
+
+  for (tchecker::clock_id_t x = 1; x < dim; ++x)
+    if (!_vloc_active_clocks[x - 1]) // translation of clock id from dbm to system
+      tchecker::dbm::free_clock(dbm, dim, x);
+
+  _extrapolation->extrapolate(dbm, dim, vloc);
+}
+
 /* factories */
 
 tchecker::zg::extrapolation_t * extrapolation_factory(enum extrapolation_type_t extrapolation_type,
@@ -259,6 +287,26 @@ tchecker::zg::extrapolation_t * extrapolation_factory(enum extrapolation_type_t
   }
 }
 
+tchecker::zg::extrapolation_t * extrapolation_factory(enum extrapolation_type_t extrapolation_type,
+                                                      enum clock_reduction_type_t clock_reduction_type,
+                                                      tchecker::ta::system_t const & system)
+{
+  std::unique_ptr<tchecker::zg::extrapolation_t> extrapolation{
+      tchecker::zg::extrapolation_factory(extrapolation_type, system)};
+  if (extrapolation.get() == nullptr)
+    return nullptr;
+
+  switch (clock_reduction_type) {
+  case tchecker::zg::NO_CLOCK_REDUCTION:
+    return extrapolation.release();
+  case tchecker::zg::ACTIVE_CLOCKS_REDUCTION:
+    return new tchecker::zg::active_clocks_extrapolation_t{
+        tchecker::ta::active_clocks(system), std::shared_ptr<tchecker::zg::extrapolation_t>{extrapolation.release()}};
+  default:
+    throw std::invalid_argument("Unknown clock reduction");
+  }
+}
+
 } // end of namespace zg
 
 } // end of namespace tchecker
@@ -0,0 +1,42 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cassert>
+
+#include "tchecker/zg/reduced_zone.hh"
+
+namespace tchecker {
+
+namespace zg {
+
+reduced_zone_t::reduced_zone_t(tchecker::zg::zone_t const & zone) : _dim(zone.dim())
+{
+  assert(!zone.is_empty());
+  tchecker::dbm::reduce(zone.dbm(), _dim, _constraints);
+  _constraints.shrink_to_fit();
+}
+
+void reduced_zone_t::expand(tchecker::dbm::db_t * dbm) const
+{
+  [[maybe_unused]] enum tchecker::dbm::status_t status = tchecker::dbm::expand(dbm, _dim, _constraints);
+  assert(status == tchecker::dbm::NON_EMPTY);
+}
+
+std::size_t reduced_zone_t::memsize() const
+{
+  return sizeof(*this) + _constraints.capacity() * sizeof(tchecker::dbm::db_constraint_t);
+}
+
+bool is_le(tchecker::zg::zone_t const & zone, tchecker::zg::reduced_zone_t const & reduced_zone)
+{
+  assert(zone.dim() == reduced_zone.dim());
+  return tchecker::dbm::is_le(zone.dbm(), zone.dim(), reduced_zone.constraints());
+}
+
+} // end of namespace zg
+
+} // end of namespace tchecker
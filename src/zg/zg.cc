@@ -5,9 +5,13 @@
  *
  */
 
+#include <algorithm>
 #include <queue>
+#include <stdexcept>
 
 #include "tchecker/dbm/db.hh"
+#include "tchecker/utils/counters.hh"
+#include "tchecker/utils/profile.hh"
 #include "tchecker/variables/clocks.hh"
 #include "tchecker/zg/zg.hh"
 
@@ -75,20 +79,33 @@ tchecker::state_status_t next(tchecker::ta::system_t const & system, tchecker::v
 {
   bool src_delay_allowed = tchecker::ta::delay_allowed(system, *vloc);
 
-  tchecker::state_status_t status =
-      tchecker::ta::next(system, vloc, intval, vedge, sync_id, src_invariant, guard, reset, tgt_invariant, sync_edges);
-  if (status != tchecker::STATE_OK)
+  tchecker::state_status_t status = tchecker::STATE_OK;
+  {
+    tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_DISCRETE};
+    status = tchecker::ta::next(system, vloc, intval, vedge, sync_id, src_invariant, guard, reset, tgt_invariant, sync_edges);
+  }
+  if (status != tchecker::STATE_OK) {
+    tchecker::counters::increment(tchecker::counters::SUCCESSORS_DISCRETE_REJECTED);
     return status;
+  }
 
   tchecker::dbm::db_t * dbm = zone->dbm();
   tchecker::clock_id_t dim = zone->dim();
   bool tgt_delay_allowed = tchecker::ta::delay_allowed(system, *vloc);
 
-  status = semantics.next(dbm, dim, src_delay_allowed, src_invariant, guard, reset, tgt_delay_allowed, tgt_invariant);
-  if (status != tchecker::STATE_OK)
+  {
+    tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_SEMANTICS};
+    status = semantics.next(dbm, dim, src_delay_allowed, src_invariant, guard, reset, tgt_delay_allowed, tgt_invariant);
+  }
+  if (status != tchecker::STATE_OK) {
+    tchecker::counters::increment(tchecker::counters::SUCCESSORS_ZONE_EMPTY);
     return status;
+  }
 
-  extrapolation.extrapolate(dbm, dim, *vloc);
+  {
+    tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_EXTRAPOLATION};
+    extrapolation.extrapolate(dbm, dim, *vloc);
+  }
 
   return tchecker::STATE_OK;
 }
@@ -240,6 +257,7 @@ void zg_t::next(tchecker::zg::const_state_sptr_t const & s, tchecker::zg::outgoi
   tchecker::state_status_t status = tchecker::zg::next(*_system, *nexts, *nextt, *_semantics, *_extrapolation, out_edge);
   if (status & mask) {
     if (_sharing_type == tchecker::ts::SHARING) {
+      tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_SHARING};
       share(nexts);
       share(nextt);
     }
@@ -277,7 +295,7 @@ void zg_t::final(boost::dynamic_bitset<> const & labels, std::vector<sst_t> & v,
 
 incoming_edges_range_t zg_t::incoming_edges(tchecker::zg::const_state_sptr_t const & s)
 {
-  return tchecker::zg::incoming_edges(*_system, s->vloc_ptr());
+  return tchecker::zg::incoming_edges(*_system, s->vloc_ptr(), s->intval_ptr());
 }
 
 void zg_t::prev(tchecker::zg::const_state_sptr_t const & s, incoming_edges_value_t const & in_edge, std::vector<sst_t> & v,
@@ -316,6 +334,50 @@ void zg_t::build(std::map<std::string, std::string> const & attributes, std::vec
   }
 }
 
+tchecker::zg::state_sptr_t zg_t::build_state(std::vector<tchecker::loc_id_t> const & vloc,
+                                             std::vector<tchecker::integer_t> const & intval,
+                                             std::vector<tchecker::dbm::db_t> const & dbm)
+{
+  tchecker::zg::state_sptr_t s = _state_allocator.construct();
+
+  tchecker::vloc_t & s_vloc = *s->vloc_ptr();
+  tchecker::intval_t & s_intval = *s->intval_ptr();
+  tchecker::zg::zone_t & s_zone = *s->zone_ptr();
+  std::size_t const dim = s_zone.dim();
+
+  if (vloc.size() != s_vloc.size())
+    throw std::invalid_argument("Unexpected size of tuple of locations");
+  if (intval.size() != s_intval.size())
+    throw std::invalid_argument("Unexpected size of integer valuation");
+  if (dbm.size() != dim * dim)
+    throw std::invalid_argument("Unexpected size of DBM");
+
+  for (std::size_t i = 0; i < vloc.size(); ++i)
+    s_vloc[i] = vloc[i];
+  for (std::size_t i = 0; i < intval.size(); ++i)
+    s_intval[i] = intval[i];
+  std::copy(dbm.begin(), dbm.end(), s_zone.dbm());
+
+  if (_sharing_type == tchecker::ts::SHARING)
+    share(s);
+  return s;
+}
+
+tchecker::zg::transition_sptr_t zg_t::build_transition(std::vector<tchecker::edge_id_t> const & vedge)
+{
+  tchecker::zg::transition_sptr_t t = _transition_allocator.construct();
+
+  tchecker::vedge_t & t_vedge = *t->vedge_ptr();
+  if (vedge.size() != t_vedge.size())
+    throw std::invalid_argument("Unexpected size of tuple of edges");
+  for (std::size_t i = 0; i < vedge.size(); ++i)
+    t_vedge[i] = vedge[i];
+
+  if (_sharing_type == tchecker::ts::SHARING)
+    share(t);
+  return t;
+}
+
 // Split
 
 void zg_t::split(tchecker::zg::const_state_sptr_t const & s, tchecker::clock_constraint_t const & c,
@@ -431,6 +493,20 @@ tchecker::zg::zg_t * factory(std::shared_ptr<tchecker::ta::system_t const> const
   return new tchecker::zg::zg_t(system, sharing_type, semantics, extrapolation, block_size, table_size);
 }
 
+tchecker::zg::zg_t * factory(std::shared_ptr<tchecker::ta::system_t const> const & system,
+                             enum tchecker::ts::sharing_type_t sharing_type, enum tchecker::zg::semantics_type_t semantics_type,
+                             enum tchecker::zg::extrapolation_type_t extrapolation_type,
+                             enum tchecker::zg::clock_reduction_type_t clock_reduction_type, std::size_t block_size,
+                             std::size_t table_size)
+{
+  std::shared_ptr<tchecker::zg::extrapolation_t> extrapolation{
+      tchecker::zg::extrapolation_factory(extrapolation_type, clock_reduction_type, *system)};
+  if (extrapolation.get() == nullptr)
+    return nullptr;
+  std::shared_ptr<tchecker::zg::semantics_t> semantics{tchecker::zg::semantics_factory(semantics_type)};
+  return new tchecker::zg::zg_t(system, sharing_type, semantics, extrapolation, block_size, table_size);
+}
+
 tchecker::zg::zg_t * factory(std::shared_ptr<tchecker::ta::system_t const> const & system,
                              enum tchecker::ts::sharing_type_t sharing_type, enum tchecker::zg::semantics_type_t semantics_type,
                              enum tchecker::zg::extrapolation_type_t extrapolation_type,
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "tchecker/dbm/dbm.hh"
+#include "tchecker/utils/counters.hh"
 #include "tchecker/zg/zone.hh"
 
 namespace tchecker {
@@ -50,7 +51,8 @@ bool zone_t::operator<=(tchecker::zg::zone_t const & zone) const
     return true;
   if (zone.is_empty())
     return false;
-  return tchecker::dbm::is_le(dbm_ptr(), zone.dbm_ptr(), _dim);
+  return tchecker::counters::check(tchecker::counters::ZONE_INCLUSION_CHECKS, tchecker::counters::ZONE_INCLUSION_SUCCESSES,
+                                  tchecker::dbm::is_le(dbm_ptr(), zone.dbm_ptr(), _dim));
 }
 
 bool zone_t::is_am_le(tchecker::zg::zone_t const & zone, tchecker::clockbounds::map_t const & m) const
@@ -69,7 +71,8 @@ bool zone_t::is_alu_le(tchecker::zg::zone_t const & zone, tchecker::clockbounds:
     return true;
   if (zone.is_empty())
     return false;
-  return tchecker::dbm::is_alu_le(dbm_ptr(), zone.dbm_ptr(), _dim, l.ptr(), u.ptr());
+  return tchecker::counters::check(tchecker::counters::ALU_INCLUSION_CHECKS, tchecker::counters::ALU_INCLUSION_SUCCESSES,
+                                  tchecker::dbm::is_alu_le(dbm_ptr(), zone.dbm_ptr(), _dim, l.ptr(), u.ptr()));
 }
 
 int zone_t::lexical_cmp(tchecker::zg::zone_t const & zone) const
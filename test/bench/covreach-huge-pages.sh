@@ -0,0 +1,43 @@
+#!/usr/bin/env bash
+
+# This file is a part of the TChecker project.
+#
+# See files AUTHORS and LICENSE for copyright details.
+
+# Compare the throughput (visited states per second) of covering reachability
+# with and without huge pages for allocation blocks, on Fischer's protocol.
+
+function usage() {
+    echo "Usage: $0 tck-reach N [runs]";
+    echo "       tck-reach path to tck-reach executable";
+    echo "       N         number of processes in Fischer's protocol";
+    echo "       runs      number of runs for each policy (default: 3)"
+}
+
+if [ $# -lt 2 ] || [ $# -gt 3 ]; then
+    usage
+    exit 1
+fi
+
+TCK_REACH="$1"
+N="$2"
+RUNS="${3:-3}"
+
+EXAMPLES_DIR="$(cd "$(dirname "$0")/../../examples" && pwd)"
+MODEL="$(mktemp)"
+trap 'rm -f "${MODEL}"' EXIT
+"${EXAMPLES_DIR}/fischer.sh" "${N}" > "${MODEL}"
+
+# Large blocks, such that auto policy uses huge pages
+BLOCK_SIZE=1000000
+
+for POLICY in none transparent explicit; do
+    for RUN in $(seq 1 "${RUNS}"); do
+        OUTPUT=$("${TCK_REACH}" -a covreach --block-size ${BLOCK_SIZE} --huge-pages ${POLICY} "${MODEL}")
+        STATES=$(echo "${OUTPUT}" | awk '$1 == "VISITED_STATES" { print $2 }')
+        TIME=$(echo "${OUTPUT}" | awk '$1 == "RUNNING_TIME_SECONDS" { print $2 }')
+        MEMORY=$(echo "${OUTPUT}" | awk '$1 == "MEMORY_MAX_RSS" { print $2 }')
+        THROUGHPUT=$(awk -v s="${STATES}" -v t="${TIME}" 'BEGIN { if (t > 0) printf "%.0f", s / t; else print "inf" }')
+        echo "huge-pages=${POLICY} run=${RUN} states=${STATES} time=${TIME}s states/s=${THROUGHPUT} maxrss=${MEMORY}"
+    done
+done
@@ -0,0 +1,185 @@
+#!/usr/bin/env bash
+
+# This file is a part of the TChecker project.
+#
+# See files AUTHORS and LICENSE for copyright details.
+
+# Run every algorithm of tck-reach and tck-liveness, with every search order,
+# on models obtained from the generators in the examples directory for
+# increasing values of their parameters. Statistics of each run are output in
+# CSV or JSON format, and compared to a baseline if any.
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+EXAMPLES_DIR="$(cd "${SCRIPT_DIR}/../../examples" && pwd)"
+
+MODELS="${SCRIPT_DIR}/scaling-models.txt"
+TIMEOUT=60
+FORMAT=csv
+OUTPUT=""
+BASELINE=""
+THRESHOLD=10
+
+REACH_ALGORITHMS="reach concur19 covreach aLU-covreach bwd-covreach bidir-covreach bitstate"
+LIVENESS_ALGORITHMS="couvscc ndfs"
+SEARCH_ORDERS="bfs dfs"
+
+COLUMNS="model,tool,algorithm,search_order,status,result,RUNNING_TIME_SECONDS,MEMORY_MAX_RSS,VISITED_STATES,STORED_STATES,COVERED_STATES,VISITED_TRANSITIONS"
+
+function usage() {
+    echo "Usage: $0 [options] tck-reach tck-liveness";
+    echo "       tck-reach     path to tck-reach executable";
+    echo "       tck-liveness  path to tck-liveness executable";
+    echo "       -b file       compare running time and memory to baseline file (CSV output of a previous run)";
+    echo "       -f csv|json   output format (default: ${FORMAT})";
+    echo "       -m file       models (default: ${MODELS})";
+    echo "       -o file       output file (default: standard output)";
+    echo "       -r percent    regression threshold w.r.t. baseline (default: ${THRESHOLD})";
+    echo "       -t seconds    timeout of each run (default: ${TIMEOUT})"
+}
+
+while getopts "b:f:hm:o:r:t:" OPT; do
+    case "${OPT}" in
+        b) BASELINE="${OPTARG}" ;;
+        f) FORMAT="${OPTARG}" ;;
+        h) usage; exit 0 ;;
+        m) MODELS="${OPTARG}" ;;
+        o) OUTPUT="${OPTARG}" ;;
+        r) THRESHOLD="${OPTARG}" ;;
+        t) TIMEOUT="${OPTARG}" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+if [ $# -ne 2 ] || { [ "${FORMAT}" != "csv" ] && [ "${FORMAT}" != "json" ]; }; then
+    usage
+    exit 1
+fi
+
+TCK_REACH="$1"
+TCK_LIVENESS="$2"
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "${WORK_DIR}"' EXIT
+MODEL="${WORK_DIR}/model.txt"
+RESULTS="${WORK_DIR}/results.csv"
+
+# Run a tool on ${MODEL} with a timeout, and append a CSV line to ${RESULTS}
+# $1: model name, $2: tool name, $3: algorithm, $4: search order ("-" if none),
+# remaining arguments: command
+function run() {
+    local NAME="$1" TOOL="$2" ALGORITHM="$3" ORDER="$4"
+    shift 4
+    local STATS STATUS
+    STATS=$(timeout "${TIMEOUT}" "$@" 2> /dev/null < /dev/null)
+    case $? in
+        0) STATUS=ok ;;
+        124) STATUS=timeout ;;
+        *) STATUS=error ;;
+    esac
+    echo "${STATS}" | awk -v prefix="${NAME},${TOOL},${ALGORITHM},${ORDER},${STATUS}" '
+        NF == 2 { stats[$1] = $2 }
+        END {
+            result = ("REACHABLE" in stats) ? stats["REACHABLE"] : stats["CYCLE"]
+            visited = ("VISITED_STATES" in stats) ? stats["VISITED_STATES"] : stats["VISITED_STATES_TOTAL"]
+            transitions = ("VISITED_TRANSITIONS" in stats) ? stats["VISITED_TRANSITIONS"] : stats["VISITED_TRANSITIONS_TOTAL"]
+            printf "%s,%s,%s,%s,%s,%s,%s,%s\n", prefix, result, stats["RUNNING_TIME_SECONDS"], stats["MEMORY_MAX_RSS"],
+                   visited, stats["STORED_STATES"], stats["COVERED_STATES"], transitions
+        }' >> "${RESULTS}"
+}
+
+echo "${COLUMNS}" > "${RESULTS}"
+
+grep -v '^[[:space:]]*\(#\|$\)' "${MODELS}" | while read -r GENERATOR VALUES ARGS; do
+    for VALUE in ${VALUES//,/ }; do
+        # shellcheck disable=SC2086
+        if ! "${EXAMPLES_DIR}/${GENERATOR}" ${VALUE} ${ARGS} > "${MODEL}"; then
+            echo "Unable to generate model: ${GENERATOR} ${VALUE} ${ARGS}" >&2
+            continue
+        fi
+        NAME="$(echo "${GENERATOR%.sh} ${VALUE} ${ARGS}" | xargs | tr ' ' '_')"
+        LABELS="$(awk -F= '/^#labels=/ { print $2; exit }' "${MODEL}")"
+        echo "${NAME}" >&2
+
+        for ALGORITHM in ${REACH_ALGORITHMS}; do
+            if [ "${ALGORITHM}" = "bitstate" ]; then
+                run "${NAME}" tck-reach "${ALGORITHM}" dfs "${TCK_REACH}" -a "${ALGORITHM}" -l "${LABELS}" "${MODEL}"
+                continue
+            fi
+            for ORDER in ${SEARCH_ORDERS}; do
+                run "${NAME}" tck-reach "${ALGORITHM}" "${ORDER}" \
+                    "${TCK_REACH}" -a "${ALGORITHM}" -s "${ORDER}" -l "${LABELS}" "${MODEL}"
+            done
+        done
+
+        # Liveness with no accepting label is trivial
+        if [ -n "${LABELS}" ]; then
+            for ALGORITHM in ${LIVENESS_ALGORITHMS}; do
+                run "${NAME}" tck-liveness "${ALGORITHM}" - "${TCK_LIVENESS}" -a "${ALGORITHM}" -l "${LABELS}" "${MODEL}"
+            done
+        fi
+    done
+done
+
+# Output results
+function output() {
+    if [ "${FORMAT}" = "csv" ]; then
+        cat "${RESULTS}"
+        return
+    fi
+    awk -F, '
+        NR == 1 { for (i = 1; i <= NF; ++i) key[i] = $i; print "["; next }
+        {
+            printf "%s  {", (NR > 2 ? ",\n" : "")
+            for (i = 1; i <= NF; ++i) {
+                if ($i == "")
+                    value = "null"
+                else if (i <= 6)
+                    value = "\"" $i "\""
+                else
+                    value = $i
+                printf "%s\"%s\": %s", (i > 1 ? ", " : ""), key[i], value
+            }
+            printf "}"
+        }
+        END { print "\n]" }' "${RESULTS}"
+}
+
+if [ -n "${OUTPUT}" ]; then
+    output > "${OUTPUT}"
+else
+    output
+fi
+
+if [ -z "${BASELINE}" ]; then
+    exit 0
+fi
+
+# Compare to baseline: a run regresses if it does not terminate anymore, if its
+# result changes, or if its running time or its memory grows by more than
+# ${THRESHOLD} percent
+awk -F, -v threshold="${THRESHOLD}" '
+    FNR == 1 { next }
+    { key = $1 "," $2 "," $3 "," $4 }
+    NR == FNR { status[key] = $5; result[key] = $6; time[key] = $7; memory[key] = $8; next }
+    !(key in status) { next }
+    function regression(what, old, new) {
+        printf "REGRESSION %s %s: %s -> %s\n", key, what, old, new
+        ++regressions
+    }
+    function grows(old, new) {
+        return (old != "") && (new != "") && (new > old * (1 + threshold / 100))
+    }
+    {
+        if (status[key] == "ok" && $5 != "ok")
+            regression("status", status[key], $5)
+        else if (status[key] == "ok" && result[key] != $6)
+            regression("result", result[key], $6)
+        else if ($5 == "ok") {
+            if (grows(time[key], $7))
+                regression("time", time[key], $7)
+            if (grows(memory[key], $8))
+                regression("memory", memory[key], $8)
+        }
+    }
+    END { exit (regressions > 0) }' "${BASELINE}" "${RESULTS}" >&2
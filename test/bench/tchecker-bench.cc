@@ -0,0 +1,595 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/dbm/refdbm.hh"
+#include "tchecker/parsing/parsing.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/log.hh"
+#include "tchecker/variables/clocks.hh"
+#include "tchecker/zg/zg.hh"
+
+/*!
+ \file tchecker-bench.cc
+ \brief Micro-benchmarks of operations on DBMs and on DBMs with reference clocks
+ */
+
+static struct option long_options[] = {{"dimensions", required_argument, 0, 'd'},
+                                       {"help", no_argument, 0, 'h'},
+                                       {"iterations", required_argument, 0, 'i'},
+                                       {"max-constant", required_argument, 0, 'm'},
+                                       {"zones", required_argument, 0, 'n'},
+                                       {"seed", required_argument, 0, 's'},
+                                       {0, 0, 0, 0}};
+
+static char const * const options = (char *)"d:hi:m:n:s:";
+
+/*!
+  \brief Display usage
+  \param progname : programme name
+*/
+void usage(char * progname)
+{
+  std::cerr << "Usage: " << progname << " [options] [file]" << std::endl;
+  std::cerr << "   -d n1,n2,...  numbers of clocks of random zones (default: 2,4,8,16,32)" << std::endl;
+  std::cerr << "   -h            help" << std::endl;
+  std::cerr << "   -i n          number of passes over the zones for each operation (default: 100)" << std::endl;
+  std::cerr << "   -m c          maximal constant in random zones (default: 100)" << std::endl;
+  std::cerr << "   -n n          number of zones for each number of clocks (default: 1000)" << std::endl;
+  std::cerr << "   -s seed       seed of the random generator (default: 0)" << std::endl;
+  std::cerr << "benchmarks operations on random zones, and on the first zones reached by a breadth-first" << std::endl;
+  std::cerr << "exploration of the zone graph of the system in file if provided" << std::endl;
+  std::cerr << "outputs the results in JSON format on standard output" << std::endl;
+}
+
+static std::vector<tchecker::clock_id_t> dimensions{2, 4, 8, 16, 32}; /*!< Numbers of clocks of random zones */
+static bool help = false;                                             /*!< Help flag */
+static std::size_t iterations = 100;                                  /*!< Number of passes over the zones */
+static tchecker::integer_t max_constant = 100;                        /*!< Maximal constant in random zones */
+static std::size_t zones_count = 1000;                                /*!< Number of zones for each number of clocks */
+static unsigned long seed = 0;                                        /*!< Seed of the random generator */
+
+/*!
+ \brief Parse command-line arguments
+ \param argc : number of arguments
+ \param argv : array of arguments
+ \pre argv[0] up to argv[argc-1] are valid accesses
+ \post global variables have been set from argv
+ \return index of the first non-option argument in argv
+ \throw std::runtime_error : if an option is unknown or has an invalid parameter
+*/
+int parse_command_line(int argc, char * argv[])
+{
+  while (true) {
+    int long_option_index = -1;
+    int c = getopt_long(argc, argv, options, long_options, &long_option_index);
+
+    if (c == -1)
+      break;
+
+    if (c == ':')
+      throw std::runtime_error("Missing option parameter");
+    else if (c == '?')
+      throw std::runtime_error("Unknown command-line option");
+
+    switch (c) {
+    case 'd': {
+      dimensions.clear();
+      std::istringstream is{optarg};
+      std::string n;
+      while (std::getline(is, n, ','))
+        dimensions.push_back(static_cast<tchecker::clock_id_t>(std::strtoul(n.c_str(), nullptr, 10)));
+      break;
+    }
+    case 'h':
+      help = true;
+      break;
+    case 'i':
+      iterations = std::strtoull(optarg, nullptr, 10);
+      break;
+    case 'm':
+      max_constant = static_cast<tchecker::integer_t>(std::strtol(optarg, nullptr, 10));
+      break;
+    case 'n':
+      zones_count = std::strtoull(optarg, nullptr, 10);
+      break;
+    case 's':
+      seed = std::strtoul(optarg, nullptr, 10);
+      break;
+    default:
+      throw std::runtime_error("This should never be executed");
+    }
+  }
+
+  for (tchecker::clock_id_t n : dimensions)
+    if (n == 0)
+      throw std::runtime_error("Expecting positive numbers of clocks");
+  if (iterations == 0 || zones_count == 0 || max_constant <= 0)
+    throw std::runtime_error("Expecting positive number of passes, number of zones and maximal constant");
+
+  return optind;
+}
+
+/*!
+ \class zones_t
+ \brief Collection of zones of the same dimension, with DBMs stored contiguously
+ */
+class zones_t {
+public:
+  /*!
+   \brief Constructor
+   \param source : description of the origin of the zones
+   \param dim : dimension of the zones
+   */
+  zones_t(std::string const & source, tchecker::clock_id_t dim) : _source(source), _dim(dim) {}
+
+  /*!
+   \brief Accessor
+   \return description of the origin of the zones
+   */
+  inline std::string const & source() const { return _source; }
+
+  /*!
+   \brief Accessor
+   \return dimension of the zones
+   */
+  inline tchecker::clock_id_t dim() const { return _dim; }
+
+  /*!
+   \brief Accessor
+   \return number of zones
+   */
+  inline std::size_t size() const { return _dbms.size() / (_dim * _dim); }
+
+  /*!
+   \brief Accessor
+   \param i : index of zone
+   \return DBM of the i-th zone
+   \pre i < size()
+   */
+  inline tchecker::dbm::db_t const * operator[](std::size_t i) const { return _dbms.data() + i * _dim * _dim; }
+
+  /*!
+   \brief Add a zone
+   \param dbm : a DBM
+   \pre dbm is a dim()*dim() DBM
+   \post a copy of dbm has been added at the end of this collection
+   */
+  inline void push_back(tchecker::dbm::db_t const * dbm) { _dbms.insert(_dbms.end(), dbm, dbm + _dim * _dim); }
+
+private:
+  std::string _source;                   /*!< Origin of the zones */
+  tchecker::clock_id_t _dim;             /*!< Dimension of the zones */
+  std::vector<tchecker::dbm::db_t> _dbms; /*!< DBMs of the zones */
+};
+
+/*!
+ \brief Reference clocks for benchmarks
+ \param clocks : number of clocks
+ \param refcount : number of reference clocks
+ \return reference clocks such that clock i has reference clock i modulo refcount
+ \pre refcount > 0
+ */
+static tchecker::reference_clock_variables_t reference_clocks(tchecker::clock_id_t clocks, tchecker::clock_id_t refcount)
+{
+  std::vector<std::string> refnames;
+  for (tchecker::clock_id_t k = 0; k < refcount; ++k)
+    refnames.push_back("$" + std::to_string(k));
+  tchecker::reference_clock_variables_t r{refnames};
+  for (tchecker::clock_id_t x = 0; x < clocks; ++x)
+    r.declare("x" + std::to_string(x), refnames[x % refcount]);
+  return r;
+}
+
+/*!
+ \brief Generate random zones
+ \param clocks : number of clocks
+ \param gen : random generator
+ \return zones_count non-empty tight zones over clocks clocks, obtained from the
+ zero zone by a random sequence of delays, upper bounds on clocks and resets
+ */
+static zones_t random_zones(tchecker::clock_id_t clocks, std::mt19937_64 & gen)
+{
+  tchecker::clock_id_t const dim = clocks + 1;
+  std::uniform_int_distribution<tchecker::clock_id_t> clock_dist(1, clocks);
+  std::uniform_int_distribution<tchecker::integer_t> constant_dist(0, max_constant);
+  std::bernoulli_distribution reset_dist(0.5);
+
+  zones_t zones{"random", dim};
+  std::vector<tchecker::dbm::db_t> dbm(dim * dim), tmp(dim * dim);
+  for (std::size_t i = 0; i < zones_count; ++i) {
+    tchecker::dbm::zero(dbm.data(), dim);
+    for (tchecker::clock_id_t step = 0; step < 2 * clocks; ++step) {
+      tchecker::dbm::open_up(dbm.data(), dim);
+      tchecker::dbm::copy(tmp.data(), dbm.data(), dim);
+      if (tchecker::dbm::constrain(tmp.data(), dim, clock_dist(gen), 0, tchecker::LE, constant_dist(gen)) ==
+          tchecker::dbm::NON_EMPTY)
+        tchecker::dbm::copy(dbm.data(), tmp.data(), dim);
+      if (reset_dist(gen))
+        tchecker::dbm::reset_to_value(dbm.data(), dim, clock_dist(gen), 0);
+    }
+    zones.push_back(dbm.data());
+  }
+  return zones;
+}
+
+/*!
+ \brief Generate random zones with reference clocks
+ \param r : reference clocks
+ \param gen : random generator
+ \return zones_count non-empty tight zones over r, obtained from the zero zone
+ by a random sequence of asynchronous delays, upper bounds on clocks and resets
+ to reference clocks
+ */
+static zones_t random_refzones(tchecker::reference_clock_variables_t const & r, std::mt19937_64 & gen)
+{
+  tchecker::clock_id_t const rdim = static_cast<tchecker::clock_id_t>(r.size());
+  tchecker::clock_id_t const clocks = rdim - r.refcount();
+  std::uniform_int_distribution<tchecker::clock_id_t> clock_dist(r.refcount(), rdim - 1);
+  std::uniform_int_distribution<tchecker::integer_t> constant_dist(0, max_constant);
+  std::bernoulli_distribution reset_dist(0.5);
+
+  zones_t zones{"random", rdim};
+  std::vector<tchecker::dbm::db_t> rdbm(rdim * rdim), tmp(rdim * rdim);
+  for (std::size_t i = 0; i < zones_count; ++i) {
+    tchecker::refdbm::zero(rdbm.data(), r);
+    for (tchecker::clock_id_t step = 0; step < 2 * clocks; ++step) {
+      tchecker::refdbm::asynchronous_open_up(rdbm.data(), r);
+      tchecker::dbm::copy(tmp.data(), rdbm.data(), rdim);
+      tchecker::clock_id_t const x = clock_dist(gen);
+      if (tchecker::refdbm::constrain(tmp.data(), r, x, r.refmap()[x], tchecker::LE, constant_dist(gen)) ==
+          tchecker::dbm::NON_EMPTY)
+        tchecker::dbm::copy(rdbm.data(), tmp.data(), rdim);
+      if (reset_dist(gen))
+        tchecker::refdbm::reset(rdbm.data(), r,
+                                tchecker::clock_reset_t{clock_dist(gen) - r.refcount(), tchecker::REFCLOCK_ID, 0});
+    }
+    zones.push_back(rdbm.data());
+  }
+  return zones;
+}
+
+/*!
+ \brief Capture zones from the zone graph of a system
+ \param filename : file name of a system declaration
+ \return the first zones_count zones reached by a breadth-first exploration of
+ the zone graph of the system declared in filename, with ExtraLU+ extrapolation
+ and local clock bounds (as tck-reach)
+ \throw std::runtime_error : if the system cannot be parsed, or if clock bounds
+ cannot be computed for the system
+ */
+static zones_t captured_zones(std::string const & filename)
+{
+  std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{tchecker::parsing::parse_system_declaration(filename)};
+  if (sysdecl == nullptr)
+    throw std::runtime_error("Unable to parse system declaration from " + filename);
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+  std::unique_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::NO_SHARING,
+                                                               tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, 10000, 65536)};
+  if (zg.get() == nullptr)
+    throw std::runtime_error("Unable to compute clock bounds for " + filename);
+
+  tchecker::clock_id_t const dim = static_cast<tchecker::clock_id_t>(system->clocks_count(tchecker::VK_FLATTENED) + 1);
+  zones_t zones{filename, dim};
+
+  std::deque<tchecker::zg::const_state_sptr_t> waiting;
+  std::vector<tchecker::zg::zg_t::sst_t> v;
+  zg->initial(v);
+  for (auto && [status, s, t] : v)
+    waiting.push_back(tchecker::zg::const_state_sptr_t{s});
+  v.clear();
+
+  while (!waiting.empty() && zones.size() < zones_count) {
+    tchecker::zg::const_state_sptr_t s = waiting.front();
+    waiting.pop_front();
+    zones.push_back(s->zone().dbm());
+    zg->next(s, v);
+    for (auto && [status, nexts, nextt] : v)
+      waiting.push_back(tchecker::zg::const_state_sptr_t{nexts});
+    v.clear();
+  }
+
+  return zones;
+}
+
+/*!
+ \class bench_output_t
+ \brief Output of benchmark results in JSON format
+ */
+class bench_output_t {
+public:
+  /*!
+   \brief Constructor
+   \param os : output stream
+   \post the beginning of the JSON document has been output to os
+   */
+  bench_output_t(std::ostream & os) : _os(os), _first(true)
+  {
+    _os << "{" << std::endl;
+    _os << "  \"iterations\": " << iterations << "," << std::endl;
+    _os << "  \"seed\": " << seed << "," << std::endl;
+    _os << "  \"benchmarks\": [";
+  }
+
+  /*!
+   \brief Destructor
+   \post the end of the JSON document has been output
+   */
+  ~bench_output_t() { _os << std::endl << "  ]" << std::endl << "}" << std::endl; }
+
+  /*!
+   \brief Output a benchmark result
+   \param name : name of the benchmarked operation
+   \param zones : benchmarked zones
+   \param refcount : number of reference clocks
+   \param ns_per_op : average time of the operation in nanoseconds
+   */
+  void output(std::string const & name, zones_t const & zones, tchecker::clock_id_t refcount, double ns_per_op)
+  {
+    _os << (_first ? "" : ",") << std::endl;
+    _os << "    {\"name\": \"" << name << "\", \"zones\": \"" << escape(zones.source()) << "\", \"dim\": " << zones.dim()
+        << ", \"refclocks\": " << refcount << ", \"count\": " << zones.size() << ", \"ns_per_op\": " << ns_per_op << "}";
+    _first = false;
+  }
+
+private:
+  /*!
+   \brief Escape a string for JSON
+   \param s : a string
+   \return s with backslashes and double quotes escaped
+   */
+  static std::string escape(std::string const & s)
+  {
+    std::string e;
+    for (char c : s) {
+      if (c == '\\' || c == '"')
+        e.push_back('\\');
+      e.push_back(c);
+    }
+    return e;
+  }
+
+  std::ostream & _os; /*!< Output stream */
+  bool _first;        /*!< First result flag */
+};
+
+static std::size_t sink = 0; /*!< Accumulates results of operations so that they are not optimized away */
+
+/*!
+ \brief Measure an operation on zones
+ \param zones : zones
+ \param op : operation, applied to a copy of the i-th zone if mutable is true,
+ and to the i-th zone otherwise
+ \param mutating : true if op modifies the zone
+ \return average time of op in nanoseconds, over iterations passes on zones
+ \note for operations that modify zones, the time includes the copy of the zone
+ (see the dbm::copy benchmark)
+ */
+static double measure(zones_t const & zones, std::function<std::size_t(tchecker::dbm::db_t *, std::size_t)> const & op,
+                      bool mutating)
+{
+  tchecker::clock_id_t const dim = zones.dim();
+  std::vector<tchecker::dbm::db_t> scratch(dim * dim);
+
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t it = 0; it < iterations; ++it)
+    for (std::size_t i = 0; i < zones.size(); ++i) {
+      if (mutating) {
+        tchecker::dbm::copy(scratch.data(), zones[i], dim);
+        sink += op(scratch.data(), i);
+      }
+      else
+        sink += op(const_cast<tchecker::dbm::db_t *>(zones[i]), i);
+    }
+  auto end = std::chrono::steady_clock::now();
+
+  double const ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  return ns / static_cast<double>(iterations * zones.size());
+}
+
+/*!
+ \brief Benchmark DBM operations
+ \param zones : zones
+ \param gen : random generator
+ \param out : output of results
+ \post the time of each benchmarked DBM operation on zones has been output to out
+ */
+static void bench_dbm(zones_t const & zones, std::mt19937_64 & gen, bench_output_t & out)
+{
+  tchecker::clock_id_t const dim = zones.dim();
+  std::size_t const n = zones.size();
+
+  // Random clock bounds, and random constraints and resets
+  std::uniform_int_distribution<tchecker::clock_id_t> clock_dist(1, dim - 1);
+  std::uniform_int_distribution<tchecker::integer_t> constant_dist(0, max_constant);
+  std::vector<tchecker::integer_t> l(dim - 1), u(dim - 1);
+  for (tchecker::clock_id_t x = 0; x < dim - 1; ++x) {
+    l[x] = constant_dist(gen);
+    u[x] = constant_dist(gen);
+  }
+  std::vector<tchecker::clock_id_t> xs(n);
+  std::vector<tchecker::integer_t> cs(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    xs[i] = clock_dist(gen);
+    cs[i] = constant_dist(gen);
+  }
+
+  out.output("dbm::copy", zones, 1, measure(zones, [&](tchecker::dbm::db_t *, std::size_t) { return 0; }, true));
+
+  out.output("dbm::tighten", zones, 1, measure(zones, [&](tchecker::dbm::db_t * dbm, std::size_t) {
+               return static_cast<std::size_t>(tchecker::dbm::tighten(dbm, dim));
+             }, true));
+
+  out.output("dbm::constrain", zones, 1, measure(zones, [&](tchecker::dbm::db_t * dbm, std::size_t i) {
+               return static_cast<std::size_t>(tchecker::dbm::constrain(dbm, dim, xs[i], 0, tchecker::LE, cs[i]));
+             }, true));
+
+  out.output("dbm::is_le", zones, 1, measure(zones, [&](tchecker::dbm::db_t * dbm, std::size_t i) {
+               return static_cast<std::size_t>(tchecker::dbm::is_le(dbm, zones[(i + 1) % n], dim));
+             }, false));
+
+  out.output("dbm::is_alu_le", zones, 1, measure(zones, [&](tchecker::dbm::db_t * dbm, std::size_t i) {
+               return static_cast<std::size_t>(tchecker::dbm::is_alu_le(dbm, zones[(i + 1) % n], dim, l.data(), u.data()));
+             }, false));
+
+  out.output("dbm::extra_lu_plus", zones, 1, measure(zones, [&](tchecker::dbm::db_t * dbm, std::size_t) {
+               tchecker::dbm::extra_lu_plus(dbm, dim, l.data(), u.data());
+               return 0;
+             }, true));
+
+  out.output("dbm::reset", zones, 1, measure(zones, [&](tchecker::dbm::db_t * dbm, std::size_t i) {
+               tchecker::dbm::reset_to_value(dbm, dim, xs[i], 0);
+               return 0;
+             }, true));
+
+  out.output("dbm::open_up", zones, 1, measure(zones, [&](tchecker::dbm::db_t * dbm, std::size_t) {
+               tchecker::dbm::open_up(dbm, dim);
+               return 0;
+             }, true));
+
+  out.output("dbm::hash", zones, 1, measure(zones, [&](tchecker::dbm::db_t * dbm, std::size_t) {
+               return tchecker::dbm::hash(dbm, dim);
+             }, false));
+}
+
+/*!
+ \brief Benchmark operations on DBMs with reference clocks
+ \param zones : zones over r
+ \param r : reference clocks
+ \param gen : random generator
+ \param out : output of results
+ \post the time of each benchmarked operation on zones has been output to out
+ \note there is no extrapolation of DBMs with reference clocks, the aLU*
+ inclusion check is benchmarked instead
+ */
+static void bench_refdbm(zones_t const & zones, tchecker::reference_clock_variables_t const & r, std::mt19937_64 & gen,
+                         bench_output_t & out)
+{
+  tchecker::clock_id_t const rdim = static_cast<tchecker::clock_id_t>(r.size());
+  tchecker::clock_id_t const refcount = r.refcount();
+  std::size_t const n = zones.size();
+
+  // Random clock bounds, and random constraints and resets on offset clocks
+  std::uniform_int_distribution<tchecker::clock_id_t> clock_dist(refcount, rdim - 1);
+  std::uniform_int_distribution<tchecker::integer_t> constant_dist(0, max_constant);
+  std::vector<tchecker::integer_t> l(rdim - refcount), u(rdim - refcount);
+  for (tchecker::clock_id_t x = 0; x < rdim - refcount; ++x) {
+    l[x] = constant_dist(gen);
+    u[x] = constant_dist(gen);
+  }
+  std::vector<tchecker::clock_id_t> xs(n);
+  std::vector<tchecker::integer_t> cs(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    xs[i] = clock_dist(gen);
+    cs[i] = constant_dist(gen);
+  }
+
+  out.output("refdbm::copy", zones, refcount, measure(zones, [&](tchecker::dbm::db_t *, std::size_t) { return 0; }, true));
+
+  out.output("refdbm::tighten", zones, refcount, measure(zones, [&](tchecker::dbm::db_t * rdbm, std::size_t) {
+               return static_cast<std::size_t>(tchecker::refdbm::tighten(rdbm, r));
+             }, true));
+
+  out.output("refdbm::constrain", zones, refcount, measure(zones, [&](tchecker::dbm::db_t * rdbm, std::size_t i) {
+               return static_cast<std::size_t>(
+                   tchecker::refdbm::constrain(rdbm, r, xs[i], r.refmap()[xs[i]], tchecker::LE, cs[i]));
+             }, true));
+
+  out.output("refdbm::is_le", zones, refcount, measure(zones, [&](tchecker::dbm::db_t * rdbm, std::size_t i) {
+               return static_cast<std::size_t>(tchecker::refdbm::is_le(rdbm, zones[(i + 1) % n], r));
+             }, false));
+
+  out.output("refdbm::is_alu_star_le", zones, refcount, measure(zones, [&](tchecker::dbm::db_t * rdbm, std::size_t i) {
+               return static_cast<std::size_t>(
+                   tchecker::refdbm::is_alu_star_le(rdbm, zones[(i + 1) % n], r, l.data(), u.data()));
+             }, false));
+
+  out.output("refdbm::reset", zones, refcount, measure(zones, [&](tchecker::dbm::db_t * rdbm, std::size_t i) {
+               tchecker::refdbm::reset(rdbm, r, tchecker::clock_reset_t{xs[i] - refcount, tchecker::REFCLOCK_ID, 0});
+               return 0;
+             }, true));
+
+  out.output("refdbm::asynchronous_open_up", zones, refcount, measure(zones, [&](tchecker::dbm::db_t * rdbm, std::size_t) {
+               tchecker::refdbm::asynchronous_open_up(rdbm, r);
+               return 0;
+             }, true));
+
+  out.output("refdbm::hash", zones, refcount, measure(zones, [&](tchecker::dbm::db_t * rdbm, std::size_t) {
+               return tchecker::refdbm::hash(rdbm, r);
+             }, false));
+}
+
+/*!
+ \brief Main function
+*/
+int main(int argc, char * argv[])
+{
+  try {
+    int optindex = parse_command_line(argc, argv);
+
+    if (argc - optindex > 1) {
+      std::cerr << "Too many input files" << std::endl;
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+    if (help) {
+      usage(argv[0]);
+      return EXIT_SUCCESS;
+    }
+
+    std::mt19937_64 gen{seed};
+    bench_output_t out{std::cout};
+
+    for (tchecker::clock_id_t clocks : dimensions) {
+      zones_t zones = random_zones(clocks, gen);
+      bench_dbm(zones, gen, out);
+
+      // Reference clocks as in the local-time zone graph of one process per pair of clocks
+      tchecker::clock_id_t const refcount = (clocks + 1) / 2;
+      tchecker::reference_clock_variables_t r = reference_clocks(clocks, refcount);
+      zones_t refzones = random_refzones(r, gen);
+      bench_refdbm(refzones, r, gen, out);
+    }
+
+    if (argc - optindex == 1) {
+      zones_t zones = captured_zones(argv[optindex]);
+      if (zones.size() > 0 && zones.dim() > 1) {
+        bench_dbm(zones, gen, out);
+
+        // A DBM is a DBM with a single reference clock
+        tchecker::reference_clock_variables_t r = reference_clocks(zones.dim() - 1, 1);
+        bench_refdbm(zones, r, gen, out);
+      }
+    }
+
+    if (sink == 42)
+      std::cerr << std::endl;
+  }
+  catch (std::exception & e) {
+    std::cerr << tchecker::log_error << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -3,8 +3,8 @@
 # This script is a wrapper that extract labels from TChecker files. It looks for
 # a line # labels=l1:l2:... and then invokes tck-reach with the option
 # -l l1,l2,...
-# Additionally it filters the run time out line in order to make outputs usable
-# in non-regression tests.
+# Additionally it filters the run time, pause time and memory usage out lines in
+# order to make outputs usable in non-regression tests.
 #
 
 if ! test -n "${TCK_REACH}";
@@ -40,7 +40,7 @@ else
     exit 1
 fi
 
-eval ${COMMAND} | sed -e 's/\(^MEMORY_MAX_RSS \).*$/\1 xxxx/g' -e 's/\(^RUNNING_TIME_SECONDS \).*$/\1 xxxx/g' -e 's@^@// @g'
+eval ${COMMAND} | sed -e 's/\(^COLLECTIONS_PAUSE_MAX_SECONDS \).*$/\1 xxxx/g' -e 's/\(^COLLECTIONS_PAUSE_TOTAL_SECONDS \).*$/\1 xxxx/g' -e 's/\(^MEMORY_MAX_RSS \).*$/\1 xxxx/g' -e 's/\(^MEMORY_PER_NODE \).*$/\1 xxxx/g' -e 's/\(^MEMORY_STATE_SPACE \).*$/\1 xxxx/g' -e 's/\(^RUNNING_TIME_SECONDS \).*$/\1 xxxx/g' -e 's@^@// @g'
 
 if test -f ${TMPDOTFILE};
 then
@@ -0,0 +1,126 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/syncprod/vloc.hh"
+#include "tchecker/ta/static_analysis.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/zg/extrapolation.hh"
+
+#include "testutils/utils.hh"
+
+TEST_CASE("active clocks", "[active_clocks]")
+{
+  std::string model = "system:active_clocks \n\
+  clock:1:x \n\
+  clock:1:y \n\
+  clock:1:z \n\
+  event:a \n\
+  \n\
+  process:P \n\
+  location:P:l0{initial:} \n\
+  location:P:l1 \n\
+  location:P:l2{invariant: y<=5} \n\
+  edge:P:l0:l1:a{do: x=0} \n\
+  edge:P:l1:l2:a{provided: x>=1} \n\
+  edge:P:l2:l0:a \n\
+  edge:P:l2:l1:a{do: x=z} \n\
+  \n\
+  process:Q \n\
+  location:Q:q0{initial:} \n\
+  location:Q:q1 \n\
+  edge:Q:q0:q1:a{do: y=0} \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  tchecker::ta::system_t system{*sysdecl};
+
+  tchecker::process_id_t const P = system.process_id("P");
+  tchecker::process_id_t const Q = system.process_id("Q");
+
+  tchecker::loc_id_t const l0 = system.location(P, "l0")->id();
+  tchecker::loc_id_t const l1 = system.location(P, "l1")->id();
+  tchecker::loc_id_t const l2 = system.location(P, "l2")->id();
+  tchecker::loc_id_t const q0 = system.location(Q, "q0")->id();
+  tchecker::loc_id_t const q1 = system.location(Q, "q1")->id();
+
+  tchecker::clock_id_t const x = system.clock_id("x");
+  tchecker::clock_id_t const y = system.clock_id("y");
+  tchecker::clock_id_t const z = system.clock_id("z");
+
+  SECTION("Active clocks in locations")
+  {
+    std::vector<boost::dynamic_bitset<>> active = tchecker::ta::active_clocks(system);
+    REQUIRE(active.size() == system.locations_count());
+
+    // x is reset on every edge from l0 and l2 before it is read
+    REQUIRE_FALSE(active[l0][x]);
+    REQUIRE(active[l1][x]);
+    REQUIRE_FALSE(active[l2][x]);
+
+    // y is read by the invariant of l2, and never reset by P
+    REQUIRE(active[l0][y]);
+    REQUIRE(active[l1][y]);
+    REQUIRE(active[l2][y]);
+
+    // z is read by the reset x=z from l2, and never reset
+    REQUIRE(active[l0][z]);
+    REQUIRE(active[l1][z]);
+    REQUIRE(active[l2][z]);
+
+    // Q never reads any clock
+    REQUIRE(active[q0].none());
+    REQUIRE(active[q1].none());
+  }
+
+  SECTION("Inactive clocks are freed by zone extrapolation")
+  {
+    std::unique_ptr<tchecker::zg::extrapolation_t> extrapolation{tchecker::zg::extrapolation_factory(
+        tchecker::zg::NO_EXTRAPOLATION, tchecker::zg::ACTIVE_CLOCKS_REDUCTION, system)};
+    REQUIRE(extrapolation.get() != nullptr);
+
+    tchecker::vloc_t * vloc =
+        tchecker::vloc_allocate_and_construct(static_cast<tchecker::process_id_t>(system.processes_count()),
+                                              static_cast<tchecker::process_id_t>(system.processes_count()));
+    (*vloc)[P] = l0;
+    (*vloc)[Q] = q0;
+
+    tchecker::clock_id_t const dim = static_cast<tchecker::clock_id_t>(system.clocks_count(tchecker::VK_FLATTENED) + 1);
+    std::vector<tchecker::dbm::db_t> dbm(dim * dim), expected(dim * dim);
+
+    // zone x=y=z
+    tchecker::dbm::zero(dbm.data(), dim);
+    tchecker::dbm::open_up(dbm.data(), dim);
+
+    // x is free in (l0,q0), y and z are still equal
+    tchecker::dbm::copy(expected.data(), dbm.data(), dim);
+    tchecker::dbm::free_clock(expected.data(), dim, x + 1);
+
+    extrapolation->extrapolate(dbm.data(), dim, *vloc);
+    REQUIRE(tchecker::dbm::is_equal(dbm.data(), expected.data(), dim));
+
+    // the zone is unchanged in (l1,q0)
+    (*vloc)[P] = l1;
+    tchecker::dbm::zero(dbm.data(), dim);
+    tchecker::dbm::open_up(dbm.data(), dim);
+    tchecker::dbm::copy(expected.data(), dbm.data(), dim);
+
+    extrapolation->extrapolate(dbm.data(), dim, *vloc);
+    REQUIRE(tchecker::dbm::is_equal(dbm.data(), expected.data(), dim));
+
+    tchecker::vloc_destruct_and_deallocate(vloc);
+  }
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <stdexcept>
+
+#include "tchecker/utils/bitstate.hh"
+
+TEST_CASE("Bitstate set of hash values", "[bitstate]")
+{
+  SECTION("Construction")
+  {
+    tchecker::bitstate_t set{10, 3};
+    REQUIRE(set.bits() == 1024);
+    REQUIRE(set.hashes() == 3);
+    REQUIRE(set.size() == 0);
+    REQUIRE(set.set_bits() == 0);
+    REQUIRE(set.fill_ratio() == 0.0);
+    REQUIRE(set.omission_probability() == 0.0);
+    REQUIRE(set.expected_omissions() == 0.0);
+    REQUIRE(set.memsize() >= 1024 / 8);
+  }
+
+  SECTION("Invalid parameters")
+  {
+    REQUIRE_THROWS_AS((tchecker::bitstate_t{2, 3}), std::invalid_argument);
+    REQUIRE_THROWS_AS((tchecker::bitstate_t{49, 3}), std::invalid_argument);
+    REQUIRE_THROWS_AS((tchecker::bitstate_t{10, 0}), std::invalid_argument);
+    REQUIRE_THROWS_AS((tchecker::bitstate_t{10, 65}), std::invalid_argument);
+  }
+
+  SECTION("Hash values that have been added are found")
+  {
+    tchecker::bitstate_t set{20, 3};
+    for (uint64_t h = 0; h < 1000; ++h)
+      REQUIRE(set.find_else_add(h * 0x9e3779b97f4a7c15ULL));
+    REQUIRE(set.size() == 1000);
+    REQUIRE(set.set_bits() <= 3000);
+    for (uint64_t h = 0; h < 1000; ++h)
+      REQUIRE_FALSE(set.find_else_add(h * 0x9e3779b97f4a7c15ULL));
+    REQUIRE(set.size() == 1000);
+  }
+
+  SECTION("Omission probability grows with the fill ratio")
+  {
+    tchecker::bitstate_t set{8, 2};
+    double fill = 0.0, omission = 0.0, expected = 0.0;
+    for (uint64_t h = 1; h <= 200; ++h) {
+      set.find_else_add(h);
+      REQUIRE(set.fill_ratio() >= fill);
+      REQUIRE(set.omission_probability() >= omission);
+      REQUIRE(set.expected_omissions() >= expected);
+      fill = set.fill_ratio();
+      omission = set.omission_probability();
+      expected = set.expected_omissions();
+    }
+    REQUIRE(fill <= 1.0);
+    REQUIRE(omission == fill * fill);
+    REQUIRE(expected > 0.0);
+    REQUIRE(set.size() < 200); // a 256-bit array cannot distinguish 200 values with 2 hashes
+  }
+}
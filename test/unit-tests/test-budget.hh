@@ -0,0 +1,98 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <chrono>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "tchecker/algorithms/budget.hh"
+#include "tchecker/algorithms/reach/stats.hh"
+
+TEST_CASE("unlimited budget", "[budget]")
+{
+  tchecker::algorithms::budget_t budget;
+  REQUIRE(budget.unlimited());
+  REQUIRE(budget.check(std::chrono::steady_clock::now() - std::chrono::hours(24), 1000000) ==
+          tchecker::algorithms::BUDGET_AVAILABLE);
+}
+
+TEST_CASE("budget limits", "[budget]")
+{
+  auto now = std::chrono::steady_clock::now();
+
+  SECTION("states limit")
+  {
+    tchecker::algorithms::budget_t budget{0, 10, 0};
+    REQUIRE(!budget.unlimited());
+    REQUIRE(budget.check(now, 9) == tchecker::algorithms::BUDGET_AVAILABLE);
+    REQUIRE(budget.check(now, 10) == tchecker::algorithms::BUDGET_STATES_EXHAUSTED);
+  }
+
+  SECTION("time limit")
+  {
+    tchecker::algorithms::budget_t budget{60, 0, 0, 1};
+    REQUIRE(budget.check(now, 0) == tchecker::algorithms::BUDGET_AVAILABLE);
+    REQUIRE(budget.check(now - std::chrono::seconds(61), 0) == tchecker::algorithms::BUDGET_TIME_EXHAUSTED);
+  }
+
+  SECTION("memory limit")
+  {
+    std::size_t memory = 0;
+    tchecker::algorithms::budget_t budget{0, 0, 1024, 1};
+    REQUIRE(budget.unlimited());
+    budget.memory_usage([&]() { return memory; });
+    REQUIRE(!budget.unlimited());
+    REQUIRE(budget.check(now, 0) == tchecker::algorithms::BUDGET_AVAILABLE);
+    memory = 2048;
+    REQUIRE(budget.check(now, 0) == tchecker::algorithms::BUDGET_MEMORY_EXHAUSTED);
+  }
+
+  SECTION("time and memory limits are checked periodically")
+  {
+    std::size_t memory = 0;
+    tchecker::algorithms::budget_t budget{60, 10, 1024, 4};
+    budget.memory_usage([&]() { return memory; });
+    REQUIRE(budget.check(now, 0) == tchecker::algorithms::BUDGET_AVAILABLE);
+    memory = 2048;
+    REQUIRE(budget.check(now - std::chrono::seconds(61), 0) == tchecker::algorithms::BUDGET_AVAILABLE);
+    REQUIRE(budget.check(now - std::chrono::seconds(61), 0) == tchecker::algorithms::BUDGET_AVAILABLE);
+    REQUIRE(budget.check(now - std::chrono::seconds(61), 10) == tchecker::algorithms::BUDGET_STATES_EXHAUSTED);
+    REQUIRE(budget.check(now - std::chrono::seconds(61), 0) == tchecker::algorithms::BUDGET_AVAILABLE);
+    REQUIRE(budget.check(now - std::chrono::seconds(61), 0) == tchecker::algorithms::BUDGET_MEMORY_EXHAUSTED);
+    memory = 0;
+    for (int i = 0; i < 3; ++i)
+      REQUIRE(budget.check(now - std::chrono::seconds(61), 0) == tchecker::algorithms::BUDGET_AVAILABLE);
+    REQUIRE(budget.check(now - std::chrono::seconds(61), 0) == tchecker::algorithms::BUDGET_TIME_EXHAUSTED);
+  }
+
+  SECTION("check period should be positive")
+  {
+    REQUIRE_THROWS_AS((tchecker::algorithms::budget_t{60, 0, 0, 0}), std::invalid_argument);
+  }
+}
+
+TEST_CASE("statistics of a run stopped by its budget", "[budget]")
+{
+  tchecker::algorithms::reach::stats_t stats;
+  std::map<std::string, std::string> m;
+
+  stats.attributes(m);
+  REQUIRE(m["REACHABLE"] == "false");
+  REQUIRE(m.find("BUDGET_EXHAUSTED") == m.end());
+
+  stats.budget_status() = tchecker::algorithms::BUDGET_STATES_EXHAUSTED;
+  m.clear();
+  stats.attributes(m);
+  REQUIRE(m["REACHABLE"] == "unknown");
+  REQUIRE(m["BUDGET_EXHAUSTED"] == "states");
+
+  stats.reachable() = true;
+  m.clear();
+  stats.attributes(m);
+  REQUIRE(m["REACHABLE"] == "true");
+}
@@ -251,6 +251,29 @@ TEST_CASE("Cache with many elements", "[cache]")
     REQUIRE(cache.size() == 0);
   }
 
+  SECTION("Collecting unused objects from the cache incrementally")
+  {
+    cache.find_else_add(p1);
+    cache.find_else_add(p2);
+    cache.find_else_add(p3);
+    cache.find_else_add(p4);
+
+    REQUIRE(cache.size() == 4);
+
+    p2 = nullptr;
+    p4 = nullptr;
+
+    std::size_t ncollect = 0;
+    for (std::size_t i = 0; i < 65536 && cache.size() > 2; ++i)
+      ncollect += cache.collect_incremental(1);
+
+    REQUIRE(ncollect == 2);
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.find(p1));
+    REQUIRE(cache.find(p3));
+    REQUIRE(cache.collect_incremental(4) == 0);
+  }
+
   cache.clear();
   p1 = nullptr;
   p2 = nullptr;
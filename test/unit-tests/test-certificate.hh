@@ -0,0 +1,405 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/graph/subsumption_graph.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/zg/certificate.hh"
+#include "tchecker/zg/certificate_checker.hh"
+#include "tchecker/zg/zg.hh"
+
+#include "testutils/utils.hh"
+
+class cert_edge_t;
+
+class cert_node_t {
+public:
+  cert_node_t(tchecker::zg::const_state_sptr_t const & s, bool initial, bool final) : s(s), init(initial), fin(final) {}
+  tchecker::zg::state_t const & state() const { return *s; }
+  bool initial() const { return init; }
+  bool final() const { return fin; }
+  tchecker::zg::const_state_sptr_t s;
+  bool init;
+  bool fin;
+  std::vector<std::shared_ptr<cert_edge_t>> out;
+};
+
+class cert_edge_t {
+public:
+  cert_edge_t(tchecker::zg::const_transition_sptr_t const & t, std::shared_ptr<cert_node_t> const & tgt) : t(t), tgt(tgt) {}
+  tchecker::vedge_t const & vedge() const { return t->vedge(); }
+  tchecker::zg::const_transition_sptr_t t;
+  std::shared_ptr<cert_node_t> tgt;
+};
+
+class cert_graph_t {
+public:
+  using node_sptr_t = std::shared_ptr<cert_node_t>;
+  using edge_sptr_t = std::shared_ptr<cert_edge_t>;
+  ~cert_graph_t()
+  {
+    for (node_sptr_t const & n : _nodes)
+      n->out.clear(); // break cycles
+  }
+  std::vector<node_sptr_t> const & nodes() const { return _nodes; }
+  std::size_t nodes_count() const { return _nodes.size(); }
+  std::vector<edge_sptr_t> const & outgoing_edges(node_sptr_t const & n) const { return n->out; }
+  node_sptr_t const & edge_tgt(edge_sptr_t const & e) const { return e->tgt; }
+  std::vector<node_sptr_t> _nodes;
+};
+
+class cert_subsumption_graph_t : public cert_graph_t {
+public:
+  enum tchecker::graph::subsumption::edge_type_t edge_type(edge_sptr_t const & e) const
+  {
+    return (e->tgt == _nodes[0] ? tchecker::graph::subsumption::EDGE_SUBSUMPTION : tchecker::graph::subsumption::EDGE_ACTUAL);
+  }
+};
+
+/*!
+ \brief Build a graph over the zone graph
+ \param zg : a zone graph
+ \param g : a graph
+ \param depth : number of steps
+ \post g contains the states reachable in at most depth steps from the initial
+ states of zg, with the first successor of each state (states are not merged).
+ The last node is final
+ */
+static void cert_build(tchecker::zg::zg_t & zg, cert_graph_t & g, std::size_t depth)
+{
+  std::vector<tchecker::zg::zg_t::sst_t> v;
+  zg.initial(v);
+  REQUIRE(v.size() == 1);
+  g._nodes.push_back(std::make_shared<cert_node_t>(tchecker::zg::const_state_sptr_t{std::get<1>(v[0])}, true, false));
+  for (std::size_t i = 0; i < depth; ++i) {
+    v.clear();
+    zg.next(g._nodes.back()->s, v);
+    REQUIRE(!v.empty());
+    tchecker::zg::const_state_sptr_t s{std::get<1>(v[0])};
+    tchecker::zg::const_transition_sptr_t t{std::get<2>(v[0])};
+    auto n = std::make_shared<cert_node_t>(s, false, i + 1 == depth);
+    g._nodes.back()->out.push_back(std::make_shared<cert_edge_t>(t, n));
+    g._nodes.push_back(n);
+  }
+}
+
+/*!
+ \brief Build the reachable part of a zone graph
+ \param zg : a zone graph
+ \param g : a graph
+ \post g contains the states reachable from the initial states of zg (equal
+ states are merged), and all transitions between them. No node is final
+ */
+static void cert_explore(tchecker::zg::zg_t & zg, cert_graph_t & g)
+{
+  std::vector<tchecker::zg::zg_t::sst_t> v;
+  auto find_or_add = [&](tchecker::zg::const_state_sptr_t const & s, bool initial) {
+    for (cert_graph_t::node_sptr_t const & n : g._nodes)
+      if (n->state() == *s)
+        return std::make_tuple(n, false);
+    g._nodes.push_back(std::make_shared<cert_node_t>(s, initial, false));
+    return std::make_tuple(g._nodes.back(), true);
+  };
+
+  zg.initial(v);
+  for (auto && [status, s, t] : v)
+    find_or_add(tchecker::zg::const_state_sptr_t{s}, true);
+
+  for (std::size_t i = 0; i < g._nodes.size(); ++i) {
+    cert_graph_t::node_sptr_t n = g._nodes[i];
+    v.clear();
+    zg.next(n->s, v);
+    for (auto && [status, s, t] : v) {
+      auto && [tgt, added] = find_or_add(tchecker::zg::const_state_sptr_t{s}, false);
+      n->out.push_back(std::make_shared<cert_edge_t>(tchecker::zg::const_transition_sptr_t{t}, tgt));
+    }
+  }
+}
+
+TEST_CASE("binary certificates", "[certificate]")
+{
+  std::string model = "system:certificate \n\
+  event:a \n\
+  event:b \n\
+  clock:1:x \n\
+  clock:1:y \n\
+  int:1:0:3:0:i \n\
+  process:P \n\
+  location:P:l0{initial: : invariant: x<=2} \n\
+  location:P:l1{labels: green} \n\
+  edge:P:l0:l1:a{provided: x>=1 : do: i=i+1; y=0} \n\
+  edge:P:l1:l0:b{do: x=0} \n\
+  process:Q \n\
+  location:Q:q0{initial: : labels: red} \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+  std::unique_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, 128, 128)};
+
+  std::string const filename = "test-certificate.bin";
+
+  SECTION("Reachability graph")
+  {
+    cert_graph_t g;
+    cert_build(*zg, g, 3);
+
+    {
+      std::ofstream ofs{filename, std::ios::out | std::ios::binary};
+      tchecker::zg::certificate::write(ofs, g, *system, "cert");
+    }
+
+    {
+      tchecker::zg::certificate::reader_t reader{filename};
+      REQUIRE(reader.kind() == tchecker::zg::certificate::KIND_REACHABILITY);
+      REQUIRE(reader.symbols().name == "cert");
+      REQUIRE((reader.symbols().processes == std::vector<std::string>{"P", "Q"}));
+      REQUIRE((reader.symbols().clocks == std::vector<std::string>{"x", "y"}));
+      REQUIRE(reader.symbols().intvars == std::vector<std::string>{"i"});
+      REQUIRE(reader.symbols().vedges.size() == 2);
+      REQUIRE(reader.dim() == 3);
+      REQUIRE(reader.nodes_count() == 4);
+      REQUIRE(reader.edges_count() == 3);
+
+      for (std::size_t i = 0; i < reader.nodes_count(); ++i) {
+        tchecker::zg::certificate::node_t const n = reader.node(i);
+        tchecker::zg::state_t const & s = g.nodes()[i]->state();
+        REQUIRE(((n.flags & tchecker::zg::certificate::NODE_INITIAL) != 0) == g.nodes()[i]->initial());
+        REQUIRE(((n.flags & tchecker::zg::certificate::NODE_FINAL) != 0) == g.nodes()[i]->final());
+        REQUIRE(n.vloc[0] == s.vloc()[0]);
+        REQUIRE(n.vloc[1] == s.vloc()[1]);
+        REQUIRE(n.intval[0] == s.intval()[0]);
+        REQUIRE(tchecker::dbm::is_equal(n.dbm, s.zone().dbm(), reader.dim()));
+      }
+
+      for (std::size_t i = 0; i < reader.edges_count(); ++i) {
+        tchecker::zg::certificate::edge_record_t const & e = reader.edge(i);
+        REQUIRE(e.src == i);
+        REQUIRE(e.tgt == i + 1);
+        REQUIRE(e.vedge == i % 2);
+      }
+
+      std::stringstream ss;
+      tchecker::zg::certificate::dot_output(ss, reader);
+      std::string const dot = ss.str();
+      REQUIRE(dot.find("digraph cert {") == 0);
+      REQUIRE(dot.find("  0 [initial=\"true\", intval=\"i=0\", labels=\"red\", vloc=\"<l0,q0>\", zone=\"(") !=
+              std::string::npos);
+      REQUIRE(dot.find("  1 [intval=\"i=1\", labels=\"green,red\", vloc=\"<l1,q0>\"") != std::string::npos);
+      REQUIRE(dot.find("  3 [final=\"true\", intval=\"i=2\"") != std::string::npos);
+      REQUIRE(dot.find("  0 -> 1 [vedge=\"<P@a>\"]") != std::string::npos);
+      REQUIRE(dot.find("  1 -> 2 [vedge=\"<P@b>\"]") != std::string::npos);
+    }
+
+    std::remove(filename.c_str());
+  }
+
+  SECTION("Subsumption graph")
+  {
+    cert_subsumption_graph_t g;
+    cert_build(*zg, g, 1);
+    auto e = std::make_shared<cert_edge_t>(g.nodes()[0]->out[0]->t, g.nodes()[0]);
+    g.nodes()[1]->out.push_back(e);
+
+    {
+      std::ofstream ofs{filename, std::ios::out | std::ios::binary};
+      tchecker::zg::certificate::write(ofs, g, *system, "cert");
+    }
+
+    {
+      tchecker::zg::certificate::reader_t reader{filename};
+      REQUIRE(reader.kind() == tchecker::zg::certificate::KIND_SUBSUMPTION);
+      REQUIRE(reader.nodes_count() == 2);
+      REQUIRE(reader.edges_count() == 2);
+      REQUIRE(reader.symbols().vedges.size() == 1);
+      REQUIRE(reader.edge(0).edge_type == tchecker::graph::subsumption::EDGE_ACTUAL);
+      REQUIRE(reader.edge(1).edge_type == tchecker::graph::subsumption::EDGE_SUBSUMPTION);
+
+      std::stringstream ss;
+      tchecker::zg::certificate::dot_output(ss, reader);
+      REQUIRE(ss.str().find("  1 -> 0 [edge_type=\"subsumption\", vedge=\"<P@a>\"]") != std::string::npos);
+    }
+
+    std::remove(filename.c_str());
+  }
+
+  SECTION("Invalid certificates are rejected")
+  {
+    REQUIRE_THROWS_AS(tchecker::zg::certificate::reader_t{"test-certificate-missing.bin"}, std::runtime_error);
+
+    {
+      std::ofstream ofs{filename, std::ios::out | std::ios::binary};
+      ofs << "digraph cert {" << std::endl << "}" << std::endl;
+    }
+    REQUIRE_THROWS_AS(tchecker::zg::certificate::reader_t{filename}, std::runtime_error);
+
+    cert_graph_t g;
+    cert_build(*zg, g, 2);
+    std::stringstream ss;
+    tchecker::zg::certificate::write(ss, g, *system, "cert");
+    std::string const certificate = ss.str();
+    {
+      std::ofstream ofs{filename, std::ios::out | std::ios::binary};
+      ofs << certificate.substr(0, certificate.size() - 16);
+    }
+    REQUIRE_THROWS_AS(tchecker::zg::certificate::reader_t{filename}, std::runtime_error);
+
+    std::remove(filename.c_str());
+  }
+}
+
+TEST_CASE("binary certificate checking", "[certificate]")
+{
+  std::string model = "system:certificate_checking \n\
+  event:a \n\
+  event:b \n\
+  clock:1:x \n\
+  clock:1:y \n\
+  int:1:0:3:0:i \n\
+  process:P \n\
+  location:P:l0{initial: : invariant: x<=2} \n\
+  location:P:l1{labels: green} \n\
+  edge:P:l0:l1:a{provided: x>=1 && i<3 : do: i=i+1; y=0} \n\
+  edge:P:l1:l0:b{do: x=0} \n\
+  process:Q \n\
+  location:Q:q0{initial: : labels: red} \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+  std::unique_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, 128, 128)};
+
+  std::string const filename = "test-certificate-checking.bin";
+  boost::dynamic_bitset<> const no_labels = system->as_syncprod_system().labels("");
+  std::vector<tchecker::zg::certificate::violation_t> violations;
+
+  SECTION("Reachable zone graph is a certificate")
+  {
+    cert_graph_t g;
+    cert_explore(*zg, g);
+
+    {
+      std::ofstream ofs{filename, std::ios::out | std::ios::binary};
+      tchecker::zg::certificate::write(ofs, g, *system, "cert");
+    }
+
+    tchecker::zg::certificate::reader_t reader{filename};
+    REQUIRE_NOTHROW(tchecker::zg::certificate::check_symbols(reader, *system));
+
+    for (std::size_t threads : {1, 2, 4}) {
+      violations.clear();
+      tchecker::zg::certificate::check_stats_t stats = tchecker::zg::certificate::check(
+          reader, system, no_labels, tchecker::zg::certificate::COVERING_INCLUSION, threads, 10, 128, 128, violations);
+      REQUIRE(stats.valid());
+      REQUIRE(violations.empty());
+      REQUIRE(stats.checked_nodes() == g.nodes_count());
+      REQUIRE(stats.initial_states() == 1);
+    }
+
+    tchecker::zg::certificate::check_stats_t stats = tchecker::zg::certificate::check(
+        reader, system, no_labels, tchecker::zg::certificate::COVERING_ALU, 2, 10, 128, 128, violations);
+    REQUIRE(stats.valid());
+
+    std::remove(filename.c_str());
+  }
+
+  SECTION("Nodes that satisfy the searched labels are reported")
+  {
+    cert_graph_t g;
+    cert_explore(*zg, g);
+
+    {
+      std::ofstream ofs{filename, std::ios::out | std::ios::binary};
+      tchecker::zg::certificate::write(ofs, g, *system, "cert");
+    }
+
+    tchecker::zg::certificate::reader_t reader{filename};
+    boost::dynamic_bitset<> const labels = system->as_syncprod_system().labels("green");
+    tchecker::zg::certificate::check_stats_t stats = tchecker::zg::certificate::check(
+        reader, system, labels, tchecker::zg::certificate::COVERING_INCLUSION, 2, 10, 128, 128, violations);
+    REQUIRE(!stats.valid());
+    REQUIRE(!violations.empty());
+    REQUIRE(violations.size() == stats.violations());
+    for (tchecker::zg::certificate::violation_t const & v : violations) {
+      REQUIRE(v.type == tchecker::zg::certificate::VIOLATION_FINAL_NODE);
+      REQUIRE(v.state.find("<l1,q0>") != std::string::npos);
+    }
+
+    std::remove(filename.c_str());
+  }
+
+  SECTION("Uncovered successors are reported")
+  {
+    cert_graph_t g;
+    cert_build(*zg, g, 1);
+
+    {
+      std::ofstream ofs{filename, std::ios::out | std::ios::binary};
+      tchecker::zg::certificate::write(ofs, g, *system, "cert");
+    }
+
+    tchecker::zg::certificate::reader_t reader{filename};
+    tchecker::zg::certificate::check_stats_t stats = tchecker::zg::certificate::check(
+        reader, system, no_labels, tchecker::zg::certificate::COVERING_INCLUSION, 2, 10, 128, 128, violations);
+    REQUIRE(!stats.valid());
+    REQUIRE(stats.violations() == 1);
+    REQUIRE(violations.size() == 1);
+    REQUIRE(violations[0].type == tchecker::zg::certificate::VIOLATION_UNCOVERED_SUCCESSOR);
+    REQUIRE(violations[0].node == 1);
+    REQUIRE(violations[0].vedge == "<P@b>");
+
+    violations.clear();
+    stats = tchecker::zg::certificate::check(reader, system, no_labels, tchecker::zg::certificate::COVERING_INCLUSION, 2, 0,
+                                             128, 128, violations);
+    REQUIRE(stats.violations() == 1);
+    REQUIRE(violations.empty());
+
+    std::remove(filename.c_str());
+  }
+
+  SECTION("Certificates of another system are rejected")
+  {
+    std::string other_model = "system:other \n\
+    event:a \n\
+    clock:1:x \n\
+    process:P \n\
+    location:P:l0{initial:} \n\
+    edge:P:l0:l0:a{} \n\
+    ";
+
+    std::shared_ptr<tchecker::parsing::system_declaration_t const> other_sysdecl{tchecker::test::parse(other_model)};
+    REQUIRE(other_sysdecl != nullptr);
+    tchecker::ta::system_t other_system{*other_sysdecl};
+
+    cert_graph_t g;
+    cert_build(*zg, g, 1);
+
+    {
+      std::ofstream ofs{filename, std::ios::out | std::ios::binary};
+      tchecker::zg::certificate::write(ofs, g, *system, "cert");
+    }
+
+    tchecker::zg::certificate::reader_t reader{filename};
+    REQUIRE_THROWS_AS(tchecker::zg::certificate::check_symbols(reader, other_system), std::runtime_error);
+
+    std::remove(filename.c_str());
+  }
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/ta/static_analysis.hh"
+#include "tchecker/ta/system.hh"
+
+#include "testutils/utils.hh"
+
+TEST_CASE("clock classes", "[clock_classes]")
+{
+  SECTION("Diagonal constraints and clock resets relate clocks")
+  {
+    std::string model = "system:clock_classes \n\
+    clock:1:x \n\
+    clock:1:y \n\
+    clock:1:z \n\
+    clock:1:w \n\
+    clock:1:u \n\
+    event:a \n\
+    \n\
+    process:P \n\
+    location:P:l0{initial:} \n\
+    location:P:l1{invariant: u<=5} \n\
+    edge:P:l0:l1:a{provided: x-y<=3} \n\
+    edge:P:l1:l0:a{provided: u>=2 : do: z=w} \n\
+    ";
+
+    std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+    REQUIRE(sysdecl != nullptr);
+
+    tchecker::ta::system_t system{*sysdecl};
+
+    std::vector<std::size_t> classes = tchecker::ta::clock_classes(system);
+
+    REQUIRE(classes.size() == 5);
+    REQUIRE(classes[system.clock_id("x")] == 0);
+    REQUIRE(classes[system.clock_id("y")] == 0);
+    REQUIRE(classes[system.clock_id("z")] == 1);
+    REQUIRE(classes[system.clock_id("w")] == 1);
+    REQUIRE(classes[system.clock_id("u")] == 2);
+  }
+
+  SECTION("Diagonal constraints in invariants relate clocks transitively")
+  {
+    std::string model = "system:clock_classes \n\
+    clock:1:x \n\
+    clock:1:y \n\
+    clock:1:z \n\
+    event:a \n\
+    \n\
+    process:P \n\
+    location:P:l0{initial: : invariant: x-y<=1} \n\
+    location:P:l1{invariant: z-y<5} \n\
+    edge:P:l0:l1:a \n\
+    ";
+
+    std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+    REQUIRE(sysdecl != nullptr);
+
+    tchecker::ta::system_t system{*sysdecl};
+
+    std::vector<std::size_t> classes = tchecker::ta::clock_classes(system);
+
+    REQUIRE(classes == std::vector<std::size_t>{0, 0, 0});
+  }
+}
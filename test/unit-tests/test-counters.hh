@@ -0,0 +1,57 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <map>
+#include <string>
+
+#include "tchecker/utils/counters.hh"
+
+TEST_CASE("Hot-path counters", "[counters]")
+{
+  tchecker::counters::reset();
+
+  SECTION("Checks return their result")
+  {
+    REQUIRE(tchecker::counters::check(tchecker::counters::ZONE_INCLUSION_CHECKS,
+                                      tchecker::counters::ZONE_INCLUSION_SUCCESSES, true));
+    REQUIRE_FALSE(tchecker::counters::check(tchecker::counters::ZONE_INCLUSION_CHECKS,
+                                            tchecker::counters::ZONE_INCLUSION_SUCCESSES, false));
+  }
+
+  SECTION("Counters are maintained if enabled")
+  {
+    tchecker::counters::check(tchecker::counters::ALU_INCLUSION_CHECKS, tchecker::counters::ALU_INCLUSION_SUCCESSES, true);
+    tchecker::counters::check(tchecker::counters::ALU_INCLUSION_CHECKS, tchecker::counters::ALU_INCLUSION_SUCCESSES, false);
+    tchecker::counters::increment(tchecker::counters::COVER_CHECKS);
+    tchecker::counters::increment(tchecker::counters::COVER_SCANNED_NODES, 5);
+    tchecker::counters::maximize(tchecker::counters::COVER_SCANNED_NODES_MAX, 3);
+    tchecker::counters::maximize(tchecker::counters::COVER_SCANNED_NODES_MAX, 2);
+    tchecker::counters::lookup(tchecker::counters::ZONE_CACHE_HITS, tchecker::counters::ZONE_CACHE_MISSES, false);
+
+    std::map<std::string, std::string> m;
+    tchecker::counters::attributes(m);
+
+    if (tchecker::counters::enabled()) {
+      REQUIRE(tchecker::counters::value(tchecker::counters::ALU_INCLUSION_CHECKS) == 2);
+      REQUIRE(tchecker::counters::value(tchecker::counters::ALU_INCLUSION_SUCCESSES) == 1);
+      REQUIRE(tchecker::counters::value(tchecker::counters::COVER_SCANNED_NODES) == 5);
+      REQUIRE(tchecker::counters::value(tchecker::counters::COVER_SCANNED_NODES_MAX) == 3);
+      REQUIRE(tchecker::counters::value(tchecker::counters::ZONE_CACHE_HITS) == 0);
+      REQUIRE(tchecker::counters::value(tchecker::counters::ZONE_CACHE_MISSES) == 1);
+      REQUIRE(m["COUNTER_ALU_INCLUSION_SUCCESS_RATE"] == "0.5");
+      REQUIRE(m["COUNTER_COVER_SCANNED_NODES_AVG"] == "5");
+    }
+    else {
+      REQUIRE(tchecker::counters::value(tchecker::counters::ALU_INCLUSION_CHECKS) == 0);
+      REQUIRE(tchecker::counters::value(tchecker::counters::COVER_SCANNED_NODES_MAX) == 0);
+      REQUIRE(m.empty());
+    }
+
+    tchecker::counters::reset();
+    REQUIRE(tchecker::counters::value(tchecker::counters::ALU_INCLUSION_CHECKS) == 0);
+  }
+}
@@ -2726,3 +2726,85 @@ TEST_CASE("Clock position", "[dbm]")
     REQUIRE(tchecker::dbm::clock_position(dbm, dim, x4, x4) == tchecker::dbm::CLK_SYNCHRONIZED);
   }
 }
+
+TEST_CASE("Reduced DBMs", "[dbm]")
+{
+  tchecker::clock_id_t const dim = 5;
+  tchecker::clock_id_t const x1 = 1;
+  tchecker::clock_id_t const x2 = 2;
+  tchecker::clock_id_t const x3 = 3;
+  tchecker::clock_id_t const x4 = 4;
+
+  tchecker::dbm::db_t dbm[dim * dim];
+  tchecker::dbm::db_t dbm2[dim * dim];
+  std::vector<tchecker::dbm::db_constraint_t> constraints;
+
+  SECTION("Zero zone is reduced to a cycle")
+  {
+    tchecker::dbm::zero(dbm, dim);
+    tchecker::dbm::reduce(dbm, dim, constraints);
+    REQUIRE(constraints.size() == dim);
+    REQUIRE(tchecker::dbm::expand(dbm2, dim, constraints) == tchecker::dbm::NON_EMPTY);
+    REQUIRE(tchecker::dbm::is_equal(dbm, dbm2, dim));
+  }
+
+  SECTION("Universal positive zone is reduced to positivity constraints")
+  {
+    tchecker::dbm::universal_positive(dbm, dim);
+    tchecker::dbm::reduce(dbm, dim, constraints);
+    REQUIRE(constraints.size() == dim - 1);
+    for (tchecker::dbm::db_constraint_t const & c : constraints) {
+      REQUIRE(c.i == 0);
+      REQUIRE(c.db == tchecker::dbm::LE_ZERO);
+    }
+    REQUIRE(tchecker::dbm::expand(dbm2, dim, constraints) == tchecker::dbm::NON_EMPTY);
+    REQUIRE(tchecker::dbm::is_equal(dbm, dbm2, dim));
+  }
+
+  SECTION("Computed zone")
+  {
+    // Initial zero zone delayed
+    tchecker::dbm::zero(dbm, dim);
+    tchecker::dbm::open_up(dbm, dim);
+    // Guard x1>1
+    tchecker::dbm::constrain(dbm, dim, 0, x1, tchecker::LT, -1);
+    // Reset x2, x3
+    tchecker::dbm::reset_to_value(dbm, dim, x2, 0);
+    tchecker::dbm::reset_to_value(dbm, dim, x3, 0);
+    // Delay, guard x4<=3
+    tchecker::dbm::open_up(dbm, dim);
+    tchecker::dbm::constrain(dbm, dim, x4, 0, tchecker::LE, 3);
+
+    tchecker::dbm::reduce(dbm, dim, constraints);
+    REQUIRE(constraints.size() < dim * dim);
+    REQUIRE(tchecker::dbm::expand(dbm2, dim, constraints) == tchecker::dbm::NON_EMPTY);
+    REQUIRE(tchecker::dbm::is_equal(dbm, dbm2, dim));
+
+    // every constraint is necessary
+    for (std::size_t k = 0; k < constraints.size(); ++k) {
+      std::vector<tchecker::dbm::db_constraint_t> smaller{constraints};
+      smaller.erase(smaller.begin() + k);
+      tchecker::dbm::expand(dbm2, dim, smaller);
+      REQUIRE_FALSE(tchecker::dbm::is_equal(dbm, dbm2, dim));
+    }
+  }
+
+  SECTION("Inclusion w.r.t. reduced DBMs")
+  {
+    tchecker::dbm::zero(dbm, dim);
+    tchecker::dbm::open_up(dbm, dim);
+    tchecker::dbm::constrain(dbm, dim, x1, 0, tchecker::LE, 2);
+    tchecker::dbm::reduce(dbm, dim, constraints);
+
+    REQUIRE(tchecker::dbm::is_le(dbm, dim, constraints));
+
+    tchecker::dbm::zero(dbm2, dim);
+    REQUIRE(tchecker::dbm::is_le(dbm2, dim, constraints));
+
+    tchecker::dbm::universal_positive(dbm2, dim);
+    REQUIRE_FALSE(tchecker::dbm::is_le(dbm2, dim, constraints));
+
+    tchecker::dbm::reduce(dbm2, dim, constraints);
+    REQUIRE(tchecker::dbm::is_le(dbm, dim, constraints));
+  }
+}
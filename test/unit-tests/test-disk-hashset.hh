@@ -0,0 +1,77 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "tchecker/utils/disk_hashset.hh"
+
+TEST_CASE("Disk-backed set of keys", "[disk_hashset]")
+{
+  std::string const filename = "test-disk-hashset.bin";
+
+  SECTION("Batches with duplicates, without cache")
+  {
+    tchecker::disk_hashset_t set{filename, 0, 7};
+    std::set<std::string> expected;
+    std::vector<std::string> batch;
+    std::vector<bool> added;
+
+    for (unsigned int round = 0; round < 20; ++round) {
+      batch.clear();
+      for (unsigned int k = 0; k < 500; ++k)
+        batch.push_back("key" + std::to_string((round * 389 + k * 17) % 3000));
+      batch.push_back(batch.front()); // duplicate in the batch
+
+      set.find_else_add(batch, added);
+
+      REQUIRE(added.size() == batch.size());
+      for (std::size_t i = 0; i < batch.size(); ++i) {
+        bool const is_new = expected.insert(batch[i]).second;
+        REQUIRE(added[i] == is_new);
+      }
+      REQUIRE(set.size() == expected.size());
+    }
+
+    REQUIRE(set.cache_hits() == 0);
+    REQUIRE(set.batches() == 20);
+    REQUIRE(set.bytes_written() > 0);
+    REQUIRE(set.bytes_read() > 0);
+  }
+
+  SECTION("Cache of recent keys")
+  {
+    tchecker::disk_hashset_t set{filename, 1 << 20};
+    std::vector<std::string> batch{"a", "b", "c"};
+    std::vector<bool> added;
+
+    set.find_else_add(batch, added);
+    REQUIRE((added == std::vector<bool>{true, true, true}));
+
+    set.find_else_add(batch, added);
+    REQUIRE((added == std::vector<bool>{false, false, false}));
+    REQUIRE(set.cache_hits() == 3);
+    REQUIRE(set.batches() == 1);
+    REQUIRE(set.size() == 3);
+  }
+
+  SECTION("Large keys")
+  {
+    tchecker::disk_hashset_t set{filename, 0, 1};
+    std::vector<std::string> batch{std::string(10000, 'x'), std::string(10000, 'y'), "z"};
+    std::vector<bool> added;
+
+    set.find_else_add(batch, added);
+    REQUIRE((added == std::vector<bool>{true, true, true}));
+
+    batch.push_back(std::string(9999, 'x'));
+    set.find_else_add(batch, added);
+    REQUIRE((added == std::vector<bool>{false, false, false, true}));
+    REQUIRE(set.size() == 4);
+  }
+}
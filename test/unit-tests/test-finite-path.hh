@@ -5,6 +5,9 @@
  *
  */
 
+#include <sstream>
+
+#include "tchecker/graph/output.hh"
 #include "tchecker/graph/path.hh"
 
 class path_node_t {
@@ -281,4 +284,33 @@ TEST_CASE("Path with more than one edge", "[finite_path]")
       --i;
     }
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Streaming DOT output of a path", "[finite_path]")
+{
+  finite_path_t path;
+
+  int const init_id = 0;
+  path.add_first_node(init_id);
+
+  int const max_id = 9;
+
+  for (int i = 1; i <= max_id; ++i)
+    if (i % 2 == 0)
+      path.extend_back(i, i);
+    else
+      path.extend_front(i, i);
+
+  std::stringstream ss;
+  tchecker::graph::dot_output_stream(ss, path, "foo");
+
+  // Nodes are output in the order they have been added to the path, edges are output in the order of their source node
+  std::string const expected = "digraph foo {\n"
+                               "  0 [id=\"0\"]\n  1 [id=\"1\"]\n  2 [id=\"2\"]\n  3 [id=\"3\"]\n  4 [id=\"4\"]\n"
+                               "  5 [id=\"5\"]\n  6 [id=\"6\"]\n  7 [id=\"7\"]\n  8 [id=\"8\"]\n  9 [id=\"9\"]\n"
+                               "  0 -> 2 [event=\"2\"]\n  1 -> 0 [event=\"1\"]\n  2 -> 4 [event=\"4\"]\n"
+                               "  3 -> 1 [event=\"3\"]\n  4 -> 6 [event=\"6\"]\n  5 -> 3 [event=\"5\"]\n"
+                               "  6 -> 8 [event=\"8\"]\n  7 -> 5 [event=\"7\"]\n  9 -> 7 [event=\"9\"]\n"
+                               "}\n";
+  REQUIRE(ss.str() == expected);
+}
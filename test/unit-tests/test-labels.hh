@@ -180,3 +180,39 @@ TEST_CASE("Labels from comma-separated strings", "[labels]")
 
   SECTION("Bad label") { REQUIRE_THROWS_AS(system.labels("a,c,s,d"), std::invalid_argument); }
 }
+
+TEST_CASE("Final tuples of locations", "[labels]")
+{
+  std::string model = "system:final_labels \n\
+  \n\
+  process:P1 \n\
+  location:P1:l0{initial:} \n\
+  location:P1:l1{initial: : labels: a,b} \n\
+  \n\
+  process:P2 \n\
+  location:P2:l0{initial: : labels: a} \n\
+  location:P2:l1{initial:} \n\
+  \n\
+  process:P3 \n\
+  location:P3:l0{initial:} \n\
+  location:P3:l1{initial: : labels: b,c,d} \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  assert(sysdecl != nullptr);
+
+  tchecker::syncprod::system_t system{*sysdecl};
+
+  auto count_final = [&](std::string const & labels) {
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto && locs : tchecker::syncprod::final_edges(system, system.labels(labels)))
+      ++count;
+    return count;
+  };
+
+  SECTION("Final tuples of locations have all the labels") { REQUIRE(count_final("a,c") == 3); }
+
+  SECTION("Final tuples of locations with labels from one process") { REQUIRE(count_final("c,d") == 4); }
+
+  SECTION("Final tuples of locations with all labels") { REQUIRE(count_final("c,d,a,b") == 3); }
+}
@@ -0,0 +1,109 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "tchecker/graph/node.hh"
+#include "tchecker/graph/parent_graph.hh"
+
+// Node for testing
+class parent_graph_node_t : public tchecker::graph::node_flags_t {
+public:
+  parent_graph_node_t(int x) : _x(x) {}
+  int x() const { return _x; }
+
+private:
+  int _x;
+};
+
+class parent_graph_node_hash_t {
+public:
+  std::size_t operator()(parent_graph_node_t const & n) const { return static_cast<std::size_t>(n.x()); }
+};
+
+class parent_graph_node_equal_to_t {
+public:
+  bool operator()(parent_graph_node_t const & n1, parent_graph_node_t const & n2) const { return n1.x() == n2.x(); }
+};
+
+// Transition for testing (without vedge)
+class parent_graph_transition_t {
+public:
+  tchecker::const_vedge_sptr_t vedge_ptr() const { return tchecker::const_vedge_sptr_t{nullptr}; }
+};
+
+using parent_graph_t = tchecker::graph::parent::graph_t<parent_graph_node_t, parent_graph_node_hash_t, parent_graph_node_equal_to_t>;
+
+TEST_CASE("Graph of parent nodes", "[parent_graph]")
+{
+  parent_graph_t g{10, 16, parent_graph_node_hash_t{}, parent_graph_node_equal_to_t{}};
+  parent_graph_transition_t t;
+
+  // breadth-first exploration of x -> 2x, x -> x+1 from 1, up to 20
+  std::vector<parent_graph_t::node_sptr_t> waiting;
+  auto && [is_new_root, root] = g.add_node(1);
+  REQUIRE(is_new_root);
+  root->initial(true);
+  waiting.push_back(root);
+  for (std::size_t i = 0; i < waiting.size(); ++i) {
+    parent_graph_t::node_sptr_t n = waiting[i];
+    for (int y : {2 * n->x(), n->x() + 1}) {
+      if (y > 20)
+        continue;
+      auto && [is_new, next] = g.add_node(y);
+      if (is_new)
+        waiting.push_back(next);
+      g.add_edge(n, next, t);
+    }
+  }
+  REQUIRE(g.nodes_count() == 20);
+
+  SECTION("Parents form a spanning tree rooted in the initial node")
+  {
+    for (parent_graph_t::node_sptr_t const & n : g.nodes()) {
+      if (n->x() == 1)
+        REQUIRE(n->parent() == nullptr);
+      else {
+        REQUIRE(n->parent() != nullptr);
+        REQUIRE((n->x() == 2 * n->parent()->x() || n->x() == n->parent()->x() + 1));
+      }
+    }
+  }
+
+  SECTION("Edges to initial nodes and to nodes with a parent are ignored")
+  {
+    auto && [is_new, two] = g.add_node(2);
+    REQUIRE_FALSE(is_new);
+    parent_graph_node_t const * parent = two->parent();
+    g.add_edge(waiting.back(), two, t);
+    REQUIRE(two->parent() == parent);
+    g.add_edge(two, root, t);
+    REQUIRE(root->parent() == nullptr);
+  }
+
+  SECTION("Path to a node")
+  {
+    auto && [is_new, n] = g.add_node(20); // 1 -> 2 -> 4 -> 5 -> 10 -> 20
+    REQUIRE_FALSE(is_new);
+    auto && [path_root, vedges] = g.path(n);
+    REQUIRE(path_root->x() == 1);
+    REQUIRE(vedges.size() == 5);
+
+    auto && [root_root, root_vedges] = g.path(root);
+    REQUIRE(root_root->x() == 1);
+    REQUIRE(root_vedges.empty());
+  }
+
+  SECTION("Clear")
+  {
+    waiting.clear();
+    root = nullptr;
+    g.clear();
+    REQUIRE(g.nodes_count() == 0);
+  }
+}
@@ -0,0 +1,212 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "tchecker/utils/block_allocator.hh"
+#include "tchecker/utils/pool.hh"
+#include "tchecker/utils/shared_objects.hh"
+
+// Object for testing
+class P_t {
+public:
+  P_t(uint32_t x) : _x(x) {}
+  uint32_t x() const { return _x; }
+
+private:
+  uint32_t _x;
+};
+
+namespace tchecker {
+template <> class allocation_size_t<P_t> {
+public:
+  template <class... ARGS> static constexpr std::size_t alloc_size(ARGS &&... /*args*/) { return sizeof(P_t); }
+};
+} // namespace tchecker
+
+// Object counting destructions, for testing
+class D_t {
+public:
+  static unsigned long destructions;
+  ~D_t() { ++destructions; }
+};
+
+unsigned long D_t::destructions = 0;
+
+namespace tchecker {
+template <> class allocation_size_t<D_t> {
+public:
+  template <class... ARGS> static constexpr std::size_t alloc_size(ARGS &&... /*args*/) { return sizeof(D_t); }
+};
+} // namespace tchecker
+
+using shared_P32_t = tchecker::make_shared_t<P_t, uint32_t>;
+
+using shared_P64_t = tchecker::make_shared_t<P_t>;
+
+TEST_CASE("Pool of shared objects with 32-bits reference counters", "[pool]")
+{
+  REQUIRE(tchecker::allocation_size_t<shared_P32_t>::alloc_size() == sizeof(P_t) + sizeof(uint32_t));
+  REQUIRE(tchecker::allocation_size_t<shared_P64_t>::alloc_size() == sizeof(P_t) + sizeof(std::size_t));
+
+  // chunks are not aligned on pointers
+  tchecker::pool_t<shared_P32_t> pool{5, tchecker::allocation_size_t<shared_P32_t>::alloc_size() + 4};
+  REQUIRE(pool.alloc_size() == 12);
+
+  SECTION("Reference counting")
+  {
+    tchecker::intrusive_shared_ptr_t<shared_P32_t> p = pool.construct(7);
+    REQUIRE(p->x() == 7);
+    REQUIRE(p->refcount() == 1);
+    {
+      tchecker::intrusive_shared_ptr_t<shared_P32_t> q = p;
+      REQUIRE(p->refcount() == 2);
+    }
+    REQUIRE(p->refcount() == 1);
+    REQUIRE(pool.destruct(p));
+    REQUIRE(p.ptr() == nullptr);
+  }
+
+  SECTION("Collection and reuse of chunks")
+  {
+    std::vector<tchecker::intrusive_shared_ptr_t<shared_P32_t>> v;
+    for (uint32_t i = 0; i < 23; ++i)
+      v.push_back(pool.construct(i));
+    REQUIRE(pool.blocks_count() == 5);
+
+    for (uint32_t i = 0; i < 23; i += 2)
+      v[i] = nullptr;
+    REQUIRE(pool.collect() == 12);
+
+    for (uint32_t i = 0; i < 23; i += 2)
+      v[i] = pool.construct(100 + i);
+    REQUIRE(pool.blocks_count() == 5);
+
+    for (uint32_t i = 0; i < 23; ++i)
+      REQUIRE(v[i]->x() == (i % 2 == 0 ? 100 + i : i));
+
+    v.clear();
+    REQUIRE(pool.collect() == 23);
+  }
+
+  SECTION("Incremental collection")
+  {
+    std::vector<tchecker::intrusive_shared_ptr_t<shared_P32_t>> v;
+    for (uint32_t i = 0; i < 100; ++i)
+      v.push_back(pool.construct(i));
+    std::size_t const blocks = pool.blocks_count();
+    unsigned long const collections = pool.collection_stats().collections();
+    REQUIRE(collections == blocks - 1); // one before each new block
+
+    // objects in the oldest block are eventually collected
+    v[0] = nullptr;
+    v[1] = nullptr;
+    std::size_t collected = 0;
+    for (std::size_t i = 0; i < blocks && collected == 0; ++i)
+      collected += pool.collect_incremental(2);
+    REQUIRE(collected == 2);
+
+    // allocations use the free chunks, then collect young blocks before allocating a new block
+    v[0] = pool.construct(1000);
+    v[1] = pool.construct(1001);
+    REQUIRE(pool.blocks_count() == blocks);
+    v[99] = nullptr;
+    REQUIRE(pool.collection_stats().collections() == collections);
+    pool.construct(1002);
+    REQUIRE(pool.collection_stats().collections() == collections + 1);
+    REQUIRE(pool.collection_stats().collected() == 1);
+    REQUIRE(pool.collection_stats().pause_max() <= pool.collection_stats().pause_total());
+    REQUIRE(pool.blocks_count() == blocks);
+  }
+}
+
+TEST_CASE("Destruction of shared objects", "[pool]")
+{
+  using shared_D_t = tchecker::make_shared_t<D_t, uint32_t>;
+
+  tchecker::pool_t<shared_D_t> pool{5, tchecker::allocation_size_t<shared_D_t>::alloc_size()};
+  D_t::destructions = 0;
+
+  tchecker::intrusive_shared_ptr_t<shared_D_t> p = pool.construct();
+  tchecker::intrusive_shared_ptr_t<shared_D_t> q = pool.construct();
+  tchecker::intrusive_shared_ptr_t<shared_D_t> r = pool.construct();
+
+  SECTION("Destructed objects are not destructed again")
+  {
+    REQUIRE(pool.destruct(p));
+    REQUIRE(p.ptr() == nullptr);
+    REQUIRE(D_t::destructions == 1);
+
+    // the chunk of p is free: it is neither collected nor destructed
+    q = nullptr;
+    REQUIRE(pool.collect() == 1);
+    REQUIRE(D_t::destructions == 2);
+    r = nullptr;
+    pool.destruct_all();
+    REQUIRE(D_t::destructions == 3);
+  }
+
+  SECTION("Destruct does nothing on shared objects")
+  {
+    tchecker::intrusive_shared_ptr_t<shared_D_t> s = p;
+    REQUIRE_FALSE(pool.destruct(p));
+    REQUIRE(p.ptr() != nullptr);
+    REQUIRE(D_t::destructions == 0);
+  }
+
+  SECTION("Destruct does nothing on nullptr")
+  {
+    tchecker::intrusive_shared_ptr_t<shared_D_t> s{nullptr};
+    REQUIRE_FALSE(pool.destruct(s));
+    REQUIRE(D_t::destructions == 0);
+  }
+}
+
+TEST_CASE("Allocation of blocks", "[pool]")
+{
+  SECTION("Choice of backend")
+  {
+    tchecker::set_huge_pages(tchecker::HUGE_PAGES_AUTO);
+    REQUIRE(tchecker::block_allocator_t{4096}.backend() == tchecker::block_allocator_t::BACKEND_HEAP);
+    REQUIRE(tchecker::block_allocator_t{tchecker::HUGE_PAGE_SIZE}.backend() ==
+            tchecker::block_allocator_t::BACKEND_MMAP_TRANSPARENT);
+    tchecker::set_huge_pages(tchecker::HUGE_PAGES_NONE);
+    REQUIRE(tchecker::block_allocator_t{tchecker::HUGE_PAGE_SIZE}.backend() == tchecker::block_allocator_t::BACKEND_HEAP);
+    tchecker::set_huge_pages(tchecker::HUGE_PAGES_EXPLICIT);
+    REQUIRE(tchecker::block_allocator_t{4096}.backend() == tchecker::block_allocator_t::BACKEND_MMAP_EXPLICIT);
+  }
+
+  SECTION("Blocks are usable with all policies")
+  {
+    for (tchecker::huge_pages_t policy : {tchecker::HUGE_PAGES_NONE, tchecker::HUGE_PAGES_TRANSPARENT,
+                                          tchecker::HUGE_PAGES_EXPLICIT, tchecker::HUGE_PAGES_AUTO}) {
+      tchecker::set_huge_pages(policy);
+      tchecker::block_allocator_t allocator{3 * tchecker::HUGE_PAGE_SIZE + 17};
+      char * block = static_cast<char *>(allocator.allocate());
+      REQUIRE(block != nullptr);
+      for (std::size_t i = 0; i < allocator.block_size(); ++i)
+        block[i] = static_cast<char>(i);
+      REQUIRE(block[allocator.block_size() - 1] == static_cast<char>(allocator.block_size() - 1));
+      allocator.deallocate(block);
+    }
+  }
+
+  SECTION("Pool on huge pages")
+  {
+    tchecker::set_huge_pages(tchecker::HUGE_PAGES_TRANSPARENT);
+    tchecker::pool_t<shared_P32_t> pool{1000, tchecker::allocation_size_t<shared_P32_t>::alloc_size()};
+    std::vector<tchecker::intrusive_shared_ptr_t<shared_P32_t>> v;
+    for (uint32_t i = 0; i < 2500; ++i)
+      v.push_back(pool.construct(i));
+    REQUIRE(pool.blocks_count() == 3);
+    for (uint32_t i = 0; i < 2500; ++i)
+      REQUIRE(v[i]->x() == i);
+  }
+
+  tchecker::set_huge_pages(tchecker::HUGE_PAGES_AUTO);
+}
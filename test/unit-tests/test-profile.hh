@@ -0,0 +1,50 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <map>
+#include <string>
+
+#include "tchecker/utils/profile.hh"
+
+TEST_CASE("Profile of phases", "[profile]")
+{
+  tchecker::profile::reset();
+
+  SECTION("Nothing is timed when profiling is disabled")
+  {
+    tchecker::profile::enable(false);
+    {
+      tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_SEMANTICS};
+    }
+    REQUIRE(tchecker::profile::details::calls[tchecker::profile::PHASE_SEMANTICS] == 0);
+
+    std::map<std::string, std::string> m;
+    tchecker::profile::attributes(m, 1.0);
+    REQUIRE(m.empty());
+  }
+
+  SECTION("Scoped timers add to their phase when profiling is enabled")
+  {
+    tchecker::profile::enable(true);
+    for (int i = 0; i < 3; ++i) {
+      tchecker::profile::scoped_timer_t timer{tchecker::profile::PHASE_COVERING};
+    }
+    REQUIRE(tchecker::profile::details::calls[tchecker::profile::PHASE_COVERING] == 3);
+    REQUIRE(tchecker::profile::details::calls[tchecker::profile::PHASE_GRAPH] == 0);
+    REQUIRE(tchecker::profile::seconds(tchecker::profile::PHASE_GRAPH) == 0.0);
+
+    std::map<std::string, std::string> m;
+    tchecker::profile::attributes(m, 1.0);
+    REQUIRE(m["PROFILE_COVERING_CALLS"] == "3");
+    REQUIRE(m["PROFILE_GRAPH_SECONDS"] == "0");
+    REQUIRE(m.find("PROFILE_OTHER_SECONDS") != m.end());
+
+    tchecker::profile::enable(false);
+    tchecker::profile::reset();
+    REQUIRE(tchecker::profile::details::calls[tchecker::profile::PHASE_COVERING] == 0);
+  }
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "tchecker/algorithms/progress.hh"
+
+TEST_CASE("Parsing of progress periods", "[progress]")
+{
+  REQUIRE(tchecker::algorithms::parse_progress_period("10") == std::chrono::milliseconds{10000});
+  REQUIRE(tchecker::algorithms::parse_progress_period("10s") == std::chrono::milliseconds{10000});
+  REQUIRE(tchecker::algorithms::parse_progress_period("250ms") == std::chrono::milliseconds{250});
+  REQUIRE(tchecker::algorithms::parse_progress_period("2m") == std::chrono::milliseconds{120000});
+  REQUIRE(tchecker::algorithms::parse_progress_period("0.5s") == std::chrono::milliseconds{500});
+
+  REQUIRE_THROWS_AS(tchecker::algorithms::parse_progress_period(""), std::invalid_argument);
+  REQUIRE_THROWS_AS(tchecker::algorithms::parse_progress_period("0s"), std::invalid_argument);
+  REQUIRE_THROWS_AS(tchecker::algorithms::parse_progress_period("-1s"), std::invalid_argument);
+  REQUIRE_THROWS_AS(tchecker::algorithms::parse_progress_period("10h"), std::invalid_argument);
+  REQUIRE_THROWS_AS(tchecker::algorithms::parse_progress_period("s"), std::invalid_argument);
+}
+
+TEST_CASE("Progress reports", "[progress]")
+{
+  std::stringstream ss;
+
+  SECTION("Reports in JSON show published progress")
+  {
+    {
+      tchecker::algorithms::progress_reporter_t reporter{std::chrono::milliseconds{1}, ss,
+                                                         tchecker::algorithms::PROGRESS_JSON};
+      tchecker::algorithms::publish_progress(12, 10, 3, 7);
+      std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    }
+    std::string line, last;
+    while (std::getline(ss, line))
+      last = line;
+    REQUIRE(last.front() == '{');
+    REQUIRE(last.back() == '}');
+    REQUIRE(last.find("\"visited\":12,") != std::string::npos);
+    REQUIRE(last.find("\"stored\":10,") != std::string::npos);
+    REQUIRE(last.find("\"covered\":3,") != std::string::npos);
+    REQUIRE(last.find("\"waiting\":7,") != std::string::npos);
+  }
+
+  SECTION("Text reports are output on demand")
+  {
+    tchecker::algorithms::progress_reporter_t reporter{std::chrono::minutes{1}, ss, tchecker::algorithms::PROGRESS_TEXT};
+    tchecker::algorithms::publish_progress(5, 4, 0, 1);
+    reporter.report();
+    REQUIRE(ss.str().find("PROGRESS ") == 0);
+    REQUIRE(ss.str().find("visited 5 stored 4 covered 0 waiting 1") != std::string::npos);
+  }
+
+  SECTION("Reporter stops promptly")
+  {
+    auto const start = std::chrono::steady_clock::now();
+    {
+      tchecker::algorithms::progress_reporter_t reporter{std::chrono::minutes{1}, ss, tchecker::algorithms::PROGRESS_TEXT};
+    }
+    REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds{10});
+    REQUIRE(ss.str().empty());
+  }
+}
@@ -0,0 +1,63 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/dbm/db.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/zg/reduced_zone.hh"
+#include "tchecker/zg/zone.hh"
+
+TEST_CASE("reduced zones", "[reduced_zone]")
+{
+  tchecker::clock_id_t const dim = 4;
+
+  // zone: 0 <= x1 <= 5, x2 - x1 == 2, x3 < 3
+  tchecker::zg::zone_t * zone = tchecker::zg::zone_allocate_and_construct(dim);
+  tchecker::dbm::db_t * dbm = zone->dbm();
+  tchecker::dbm::universal_positive(dbm, dim);
+  REQUIRE(tchecker::dbm::constrain(dbm, dim, 1, 0, tchecker::LE, 5) == tchecker::dbm::NON_EMPTY);
+  REQUIRE(tchecker::dbm::constrain(dbm, dim, 2, 1, tchecker::LE, 2) == tchecker::dbm::NON_EMPTY);
+  REQUIRE(tchecker::dbm::constrain(dbm, dim, 1, 2, tchecker::LE, -2) == tchecker::dbm::NON_EMPTY);
+  REQUIRE(tchecker::dbm::constrain(dbm, dim, 3, 0, tchecker::LT, 3) == tchecker::dbm::NON_EMPTY);
+
+  tchecker::zg::reduced_zone_t reduced_zone{*zone};
+
+  SECTION("Reduced zone has fewer constraints than the DBM")
+  {
+    REQUIRE(reduced_zone.dim() == dim);
+    REQUIRE(reduced_zone.constraints().size() < dim * dim);
+    REQUIRE(reduced_zone.memsize() < tchecker::allocation_size_t<tchecker::zg::zone_t>::alloc_size(dim));
+  }
+
+  SECTION("Expansion yields the zone back")
+  {
+    std::vector<tchecker::dbm::db_t> expanded(dim * dim);
+    reduced_zone.expand(expanded.data());
+    REQUIRE(tchecker::dbm::is_equal(expanded.data(), zone->dbm(), dim));
+  }
+
+  SECTION("Inclusion w.r.t. a reduced zone")
+  {
+    REQUIRE(tchecker::zg::is_le(*zone, reduced_zone));
+
+    tchecker::zg::zone_t * smaller = tchecker::zg::zone_allocate_and_construct(dim);
+    *smaller = *zone;
+    REQUIRE(tchecker::dbm::constrain(smaller->dbm(), dim, 0, 3, tchecker::LE, -1) == tchecker::dbm::NON_EMPTY);
+    REQUIRE(tchecker::zg::is_le(*smaller, reduced_zone));
+
+    tchecker::zg::zone_t * larger = tchecker::zg::zone_allocate_and_construct(dim);
+    tchecker::dbm::universal_positive(larger->dbm(), dim);
+    REQUIRE_FALSE(tchecker::zg::is_le(*larger, reduced_zone));
+
+    tchecker::zg::zone_destruct_and_deallocate(smaller);
+    tchecker::zg::zone_destruct_and_deallocate(larger);
+  }
+
+  tchecker::zg::zone_destruct_and_deallocate(zone);
+}
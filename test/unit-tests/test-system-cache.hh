@@ -0,0 +1,157 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/ta/system_cache.hh"
+
+#include "testutils/utils.hh"
+
+/*!
+ \brief Check that two systems of timed processes are equal
+ \param s1 : a system of timed processes
+ \param s2 : a system of timed processes
+ */
+static void system_cache_require_equal(tchecker::ta::system_t const & s1, tchecker::ta::system_t const & s2)
+{
+  REQUIRE(s1.name() == s2.name());
+  REQUIRE(s1.processes_count() == s2.processes_count());
+  REQUIRE(s1.events_count() == s2.events_count());
+  REQUIRE(s1.labels_count() == s2.labels_count());
+  REQUIRE(s1.synchronizations_count() == s2.synchronizations_count());
+  REQUIRE(s1.clocks_count(tchecker::VK_DECLARED) == s2.clocks_count(tchecker::VK_DECLARED));
+  REQUIRE(s1.clocks_count(tchecker::VK_FLATTENED) == s2.clocks_count(tchecker::VK_FLATTENED));
+  REQUIRE(s1.intvars_count(tchecker::VK_DECLARED) == s2.intvars_count(tchecker::VK_DECLARED));
+  REQUIRE(s1.intvars_count(tchecker::VK_FLATTENED) == s2.intvars_count(tchecker::VK_FLATTENED));
+
+  REQUIRE(s1.locations_count() == s2.locations_count());
+  for (tchecker::loc_id_t id = 0; id < s1.locations_count(); ++id) {
+    REQUIRE(s1.location(id)->name() == s2.location(id)->name());
+    REQUIRE(s1.is_urgent(id) == s2.is_urgent(id));
+    REQUIRE(s1.invariant(id).to_string() == s2.invariant(id).to_string());
+  }
+
+  REQUIRE(s1.edges_count() == s2.edges_count());
+  for (tchecker::edge_id_t id = 0; id < s1.edges_count(); ++id) {
+    REQUIRE(s1.edge(id)->src() == s2.edge(id)->src());
+    REQUIRE(s1.edge(id)->tgt() == s2.edge(id)->tgt());
+    REQUIRE(s1.edge(id)->event_id() == s2.edge(id)->event_id());
+    REQUIRE(s1.guard(id).to_string() == s2.guard(id).to_string());
+    REQUIRE(s1.statement(id).to_string() == s2.statement(id).to_string());
+  }
+}
+
+TEST_CASE("model cache", "[system_cache]")
+{
+  std::string model = "system:cache \n\
+  event:a \n\
+  event:b \n\
+  clock:1:x \n\
+  clock:2:y \n\
+  int:1:0:5:0:i \n\
+  int:3:-2:2:1:t \n\
+  process:P \n\
+  location:P:l0{initial: : invariant: x<=3 && y[1]<=2} \n\
+  location:P:l1{labels: green,red : urgent:} \n\
+  edge:P:l0:l1:a{provided: x>=1 && t[i%3]!=0 : do: i=i+1; y[0]=0} \n\
+  edge:P:l1:l0:b{provided: (if i > 2 then 1 else 0) == 1 : \
+do: local k = 0; local u[3]; while (k < 3) do u[k] = t[k]; k = k + 1 end; if u[0] > 0 then t[0] = -u[0] else x = i end} \n\
+  process:Q \n\
+  location:Q:q0{initial: : labels: red} \n\
+  edge:Q:q0:q0:a \n\
+  sync:P@a:Q@a? \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  tchecker::ta::system_t const system{*sysdecl};
+  std::string const key = tchecker::ta::model_cache_key(model);
+
+  SECTION("Keys depend on the model")
+  {
+    REQUIRE(key == tchecker::ta::model_cache_key(model));
+    REQUIRE(key != tchecker::ta::model_cache_key(model + " "));
+    REQUIRE(key != tchecker::ta::model_cache_key(""));
+  }
+
+  SECTION("Cached system is the same as parsed system")
+  {
+    std::stringstream ss;
+    tchecker::ta::write_cache(ss, system, key);
+
+    std::shared_ptr<tchecker::ta::system_t const> cached{tchecker::ta::read_cache(ss, key)};
+    REQUIRE(cached != nullptr);
+    system_cache_require_equal(system, *cached);
+  }
+
+  SECTION("Cache of another model is ignored")
+  {
+    std::stringstream ss;
+    tchecker::ta::write_cache(ss, system, key);
+    REQUIRE(tchecker::ta::read_cache(ss, tchecker::ta::model_cache_key(model + " ")) == nullptr);
+  }
+
+  SECTION("Invalid caches are rejected")
+  {
+    std::stringstream ss;
+    tchecker::ta::write_cache(ss, system, key);
+    std::string const cache = ss.str();
+
+    std::stringstream garbage{"this is not a cache"};
+    REQUIRE_THROWS_AS(tchecker::ta::read_cache(garbage, key), std::runtime_error);
+
+    std::stringstream truncated{cache.substr(0, cache.size() / 2)};
+    REQUIRE_THROWS_AS(tchecker::ta::read_cache(truncated, key), std::runtime_error);
+
+    std::string corrupted = cache;
+    corrupted[corrupted.size() - 1] ^= 0x5a;
+    std::stringstream corrupted_ss{corrupted};
+    REQUIRE_THROWS_AS(tchecker::ta::read_cache(corrupted_ss, key), std::runtime_error);
+  }
+
+  SECTION("Loading a system writes and reads the cache")
+  {
+    std::string const filename = "test-system-cache.tck";
+    std::string const cache_file = "./" + key + ".tckm";
+    {
+      std::ofstream ofs{filename};
+      ofs << model;
+    }
+    std::remove(cache_file.c_str());
+
+    std::shared_ptr<tchecker::ta::system_t const> loaded{tchecker::ta::load_system(filename, ".")};
+    REQUIRE(loaded != nullptr);
+    system_cache_require_equal(system, *loaded);
+    REQUIRE(std::ifstream{cache_file}.good());
+
+    std::shared_ptr<tchecker::ta::system_t const> reloaded{tchecker::ta::load_system(filename, ".")};
+    REQUIRE(reloaded != nullptr);
+    system_cache_require_equal(system, *reloaded);
+
+    // an invalid cache file is replaced
+    {
+      std::ofstream ofs{cache_file, std::ios::out | std::ios::trunc};
+      ofs << "TCKMODL1 garbage";
+    }
+    std::shared_ptr<tchecker::ta::system_t const> reparsed{tchecker::ta::load_system(filename, ".")};
+    REQUIRE(reparsed != nullptr);
+    system_cache_require_equal(system, *reparsed);
+    std::ifstream ifs{cache_file, std::ios::in | std::ios::binary};
+    REQUIRE(tchecker::ta::read_cache(ifs, key) != nullptr);
+
+    std::remove(cache_file.c_str());
+    std::remove(filename.c_str());
+  }
+}
@@ -0,0 +1,248 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/ta/ta.hh"
+
+#include "testutils/utils.hh"
+
+TEST_CASE("ta previous states with bounded integer variables", "[ta prev]")
+{
+  std::string model = "system:prev_intvars \n\
+  event:a \n\
+  int:1:0:255:0:x \n\
+  int:1:0:255:0:y \n\
+  int:1:0:255:0:z \n\
+  process:P \n\
+  location:P:l0{initial:} \n\
+  location:P:l1 \n\
+  location:P:l2 \n\
+  edge:P:l0:l1:a{do: x=x+1} \n\
+  edge:P:l1:l2:a{provided: y==7} \n\
+  edge:P:l2:l0:a{provided: z<10 : do: y=z+y; z=0} \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+  tchecker::ta::ta_t ta{system, tchecker::ts::SHARING, 128, 128};
+
+  SECTION("incoming edges are narrowed through statements")
+  {
+    std::vector<tchecker::ta::ta_t::sst_t> v;
+    std::map<std::string, std::string> attributes{{"vloc", "<l1>"}, {"intval", "x=5,y=7,z=3"}};
+    ta.build(attributes, v);
+    REQUIRE(v.size() == 1);
+    tchecker::ta::const_state_sptr_t s{std::get<1>(v[0])};
+
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto && in_edge : ta.incoming_edges(s))
+      ++count;
+    REQUIRE(count == 1);
+
+    std::vector<tchecker::ta::ta_t::sst_t> prev;
+    ta.prev(s, prev);
+    REQUIRE(prev.size() == 1);
+    std::map<std::string, std::string> m;
+    ta.attributes(tchecker::ta::const_state_sptr_t{std::get<1>(prev[0])}, m);
+    REQUIRE(m["vloc"] == "<l0>");
+    REQUIRE(m["intval"] == "x=4,y=7,z=3");
+  }
+
+  SECTION("incoming edges without statement keep the target valuation")
+  {
+    std::vector<tchecker::ta::ta_t::sst_t> v;
+    std::map<std::string, std::string> attributes{{"vloc", "<l2>"}, {"intval", "x=5,y=7,z=3"}};
+    ta.build(attributes, v);
+    REQUIRE(v.size() == 1);
+    tchecker::ta::const_state_sptr_t s{std::get<1>(v[0])};
+
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto && in_edge : ta.incoming_edges(s))
+      ++count;
+    REQUIRE(count == 1);
+
+    std::vector<tchecker::ta::ta_t::sst_t> prev;
+    ta.prev(s, prev);
+    REQUIRE(prev.size() == 1);
+    std::map<std::string, std::string> m;
+    ta.attributes(tchecker::ta::const_state_sptr_t{std::get<1>(prev[0])}, m);
+    REQUIRE(m["vloc"] == "<l1>");
+    REQUIRE(m["intval"] == "x=5,y=7,z=3");
+  }
+
+  SECTION("guard is checked on source valuation")
+  {
+    std::vector<tchecker::ta::ta_t::sst_t> v;
+    std::map<std::string, std::string> attributes{{"vloc", "<l2>"}, {"intval", "x=5,y=6,z=3"}};
+    ta.build(attributes, v);
+    REQUIRE(v.size() == 1);
+    tchecker::ta::const_state_sptr_t s{std::get<1>(v[0])};
+
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto && in_edge : ta.incoming_edges(s))
+      ++count;
+    REQUIRE(count == 0);
+
+    std::vector<tchecker::ta::ta_t::sst_t> prev;
+    ta.prev(s, prev);
+    REQUIRE(prev.empty());
+  }
+
+  SECTION("no incoming edge when the statement cannot yield the target valuation")
+  {
+    std::vector<tchecker::ta::ta_t::sst_t> v;
+    std::map<std::string, std::string> attributes{{"vloc", "<l1>"}, {"intval", "x=0,y=7,z=3"}};
+    ta.build(attributes, v);
+    REQUIRE(v.size() == 1);
+    tchecker::ta::const_state_sptr_t s{std::get<1>(v[0])};
+
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto && in_edge : ta.incoming_edges(s))
+      ++count;
+    REQUIRE(count == 0);
+
+    std::vector<tchecker::ta::ta_t::sst_t> prev;
+    ta.prev(s, prev);
+    REQUIRE(prev.empty());
+  }
+
+  SECTION("incoming edges are narrowed through sequences of assignments and guards")
+  {
+    std::vector<tchecker::ta::ta_t::sst_t> v;
+    std::map<std::string, std::string> attributes{{"vloc", "<l0>"}, {"intval", "x=4,y=9,z=0"}};
+    ta.build(attributes, v);
+    REQUIRE(v.size() == 1);
+    tchecker::ta::const_state_sptr_t s{std::get<1>(v[0])};
+
+    // y in [0,9] and z in [0,9] from y=z+y and z<10
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto && in_edge : ta.incoming_edges(s))
+      ++count;
+    REQUIRE(count == 100);
+
+    // predecessors are the valuations with y+z==9
+    std::vector<tchecker::ta::ta_t::sst_t> prev;
+    ta.prev(s, prev);
+    REQUIRE(prev.size() == 10);
+    for (auto && [status, p, t] : prev) {
+      std::map<std::string, std::string> m;
+      ta.attributes(tchecker::ta::const_state_sptr_t{p}, m);
+      REQUIRE(m["vloc"] == "<l2>");
+    }
+  }
+}
+
+TEST_CASE("ta previous states with conditional statements and arrays", "[ta prev]")
+{
+  std::string model = "system:prev_arrays \n\
+  event:a \n\
+  int:3:0:3:0:t \n\
+  int:1:0:3:0:i \n\
+  process:P \n\
+  location:P:l0{initial:} \n\
+  location:P:l1 \n\
+  edge:P:l0:l1:a{do: if i > 1 then t[i] = 0 else t[0] = t[0] + 1 end} \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+  tchecker::ta::ta_t ta{system, tchecker::ts::SHARING, 128, 128};
+
+  SECTION("only the else branch can yield the target valuation")
+  {
+    std::vector<tchecker::ta::ta_t::sst_t> v;
+    std::map<std::string, std::string> attributes{{"vloc", "<l1>"}, {"intval", "t[0]=2,t[1]=1,t[2]=3,i=0"}};
+    ta.build(attributes, v);
+    REQUIRE(v.size() == 1);
+    tchecker::ta::const_state_sptr_t s{std::get<1>(v[0])};
+
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto && in_edge : ta.incoming_edges(s))
+      ++count;
+    REQUIRE(count == 1);
+
+    std::vector<tchecker::ta::ta_t::sst_t> prev;
+    ta.prev(s, prev);
+    REQUIRE(prev.size() == 1);
+    std::map<std::string, std::string> m;
+    ta.attributes(tchecker::ta::const_state_sptr_t{std::get<1>(prev[0])}, m);
+    REQUIRE(m["intval"] == "t[0]=1,t[1]=1,t[2]=3,i=0");
+  }
+
+  SECTION("array cells with a non-constant offset range over their domain")
+  {
+    std::vector<tchecker::ta::ta_t::sst_t> v;
+    std::map<std::string, std::string> attributes{{"vloc", "<l1>"}, {"intval", "t[0]=0,t[1]=1,t[2]=0,i=2"}};
+    ta.build(attributes, v);
+    REQUIRE(v.size() == 1);
+    tchecker::ta::const_state_sptr_t s{std::get<1>(v[0])};
+
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto && in_edge : ta.incoming_edges(s))
+      ++count;
+    REQUIRE(count == 64);
+
+    std::vector<tchecker::ta::ta_t::sst_t> prev;
+    ta.prev(s, prev);
+    REQUIRE(prev.size() == 4);
+  }
+}
+
+TEST_CASE("ta final states with bounded integer variables", "[ta prev]")
+{
+  std::string model = "system:final_intvars \n\
+  event:a \n\
+  int:1:0:255:0:x \n\
+  int:1:0:255:0:y \n\
+  int:1:0:255:0:z \n\
+  process:P \n\
+  location:P:l0{initial: : labels: start} \n\
+  location:P:l1{labels: goal : invariant: x<=10} \n\
+  location:P:l2{labels: unreachable} \n\
+  edge:P:l0:l1:a{provided: y<2 : do: x=x+1; z=0} \n\
+  edge:P:l1:l0:a{do: y=0; z=x} \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+  tchecker::ta::ta_t ta{system, tchecker::ts::SHARING, 128, 128};
+
+  auto count_final = [&](std::string const & labels) {
+    std::vector<tchecker::ta::ta_t::sst_t> v;
+    ta.final(system->as_syncprod_system().labels(labels), v);
+    return v.size();
+  };
+
+  SECTION("final valuations are reached by incoming edges and satisfy invariants")
+  {
+    // x in [1,10] from x=x+1 and x<=10, y in [0,1] from y<2, and z==0
+    REQUIRE(count_final("goal") == 20);
+  }
+
+  SECTION("final valuations of an initial tuple of locations include the initial valuation")
+  {
+    // x in [0,10] from invariant x<=10 in l1, y==0, and z in [0,10] from z=x
+    REQUIRE(count_final("start") == 121);
+  }
+
+  SECTION("no final state in a tuple of locations that is neither initial nor has incoming edges")
+  {
+    REQUIRE(count_final("unreachable") == 0);
+  }
+}
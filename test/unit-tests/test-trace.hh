@@ -0,0 +1,75 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "tchecker/utils/trace.hh"
+
+/*!
+ \brief Content of a file
+ \param filename : file name
+ \return the content of filename
+ */
+static std::string trace_file_content(std::string const & filename)
+{
+  std::ifstream ifs{filename};
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  return ss.str();
+}
+
+TEST_CASE("Trace of events", "[trace]")
+{
+  std::string const filename = "test-trace.json";
+
+  SECTION("Nothing is traced without a writer")
+  {
+    REQUIRE_FALSE(tchecker::trace::enabled());
+    REQUIRE(tchecker::trace::timestamp() == tchecker::trace::time_point_t{});
+    tchecker::trace::batch_t batch{"batch", "test", 1};
+    REQUIRE_FALSE(batch.tick());
+  }
+
+  SECTION("Spans, counters and batches are written to the trace file")
+  {
+    {
+      tchecker::trace::writer_t writer{filename};
+      REQUIRE(tchecker::trace::enabled());
+      REQUIRE_THROWS_AS(tchecker::trace::writer_t{filename + ".other"}, std::runtime_error);
+
+      tchecker::trace::time_point_t const start = tchecker::trace::timestamp();
+      tchecker::trace::span("span", "test", start, tchecker::trace::timestamp(), {"a", 1}, {"b", -2});
+      tchecker::trace::counter("counter", {"value", 42});
+      tchecker::trace::batch_t batch{"batch", "test", 2};
+      REQUIRE_FALSE(batch.tick());
+      REQUIRE(batch.tick());
+      REQUIRE_FALSE(batch.tick());
+      for (int i = 0; i < 10000; ++i)
+        tchecker::trace::counter("loop", {"i", i});
+    }
+    REQUIRE_FALSE(tchecker::trace::enabled());
+
+    std::string const content = trace_file_content(filename);
+    REQUIRE(content.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[") == 0);
+    REQUIRE(content.rfind("]}\n") == content.size() - 3);
+    REQUIRE(content.find("\"name\":\"span\",\"cat\":\"test\",\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(content.find("\"args\":{\"a\":1,\"b\":-2}") != std::string::npos);
+    REQUIRE(content.find("\"name\":\"counter\",\"cat\":\"counter\",\"ph\":\"C\"") != std::string::npos);
+    REQUIRE(content.find("\"args\":{\"value\":42}") != std::string::npos);
+    REQUIRE(content.find("\"args\":{\"iterations\":2}") != std::string::npos);
+    REQUIRE(content.find("\"args\":{\"iterations\":1}") != std::string::npos);
+    REQUIRE(content.find("\"args\":{\"i\":9999}") != std::string::npos);
+
+    std::remove(filename.c_str());
+    std::remove((filename + ".other").c_str());
+  }
+}
@@ -0,0 +1,132 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <vector>
+
+#include "tchecker/ta/discrete_table.hh"
+#include "tchecker/utils/tree_table.hh"
+
+TEST_CASE("Tree table of vectors", "[tree_table]")
+{
+  SECTION("Insertion and decompression")
+  {
+    for (std::size_t width = 0; width < 10; ++width) {
+      tchecker::tree_table_t table(width, 4);
+      std::vector<std::vector<tchecker::tree_table_t::value_t>> vectors;
+      std::vector<tchecker::tree_table_t::index_t> indices;
+
+      for (tchecker::tree_table_t::value_t k = 0; k < 100; ++k) {
+        std::vector<tchecker::tree_table_t::value_t> v(width);
+        for (std::size_t i = 0; i < width; ++i)
+          v[i] = (k * 7 + static_cast<tchecker::tree_table_t::value_t>(i) * 13) % (k % 5 + 2);
+        auto && [added, index] = table.insert(v.data());
+        bool found = false;
+        for (std::size_t j = 0; j < vectors.size(); ++j)
+          if (vectors[j] == v) {
+            REQUIRE(indices[j] == index);
+            found = true;
+          }
+        REQUIRE(added == !found);
+        if (added) {
+          vectors.push_back(v);
+          indices.push_back(index);
+        }
+      }
+
+      REQUIRE(table.size() == vectors.size());
+
+      std::vector<tchecker::tree_table_t::value_t> u(width);
+      for (std::size_t j = 0; j < vectors.size(); ++j) {
+        table.get(indices[j], u.data());
+        REQUIRE(u == vectors[j]);
+        for (std::size_t i = 0; i < width; ++i)
+          REQUIRE(table.get(indices[j], i) == vectors[j][i]);
+      }
+    }
+  }
+
+  SECTION("Vectors that differ in one position share storage")
+  {
+    std::size_t const width = 64;
+    tchecker::tree_table_t table(width);
+    std::vector<tchecker::tree_table_t::value_t> v(width, 3);
+    table.insert(v.data());
+    std::size_t const memsize = table.memsize();
+
+    // Each vector below differs from v in a single position: only the 6 pairs
+    // on the path from the root to that position are new. The internal tables
+    // (1024 slots each) do not need to grow, and storage for pairs is at most
+    // twice the number of pairs
+    for (std::size_t i = 0; i < width; ++i) {
+      std::vector<tchecker::tree_table_t::value_t> u(v);
+      u[i] = 5;
+      auto && [added, index] = table.insert(u.data());
+      REQUIRE(added);
+      REQUIRE(table.get(index, i) == 5);
+    }
+    REQUIRE(table.size() == width + 1);
+    REQUIRE(table.memsize() - memsize <= 2 * width * 6 * sizeof(uint64_t));
+  }
+
+  SECTION("Clear")
+  {
+    tchecker::tree_table_t table(3);
+    tchecker::tree_table_t::value_t v[3] = {1, 2, 3};
+    table.insert(v);
+    REQUIRE(table.size() == 1);
+    table.clear();
+    REQUIRE(table.size() == 0);
+    auto && [added, index] = table.insert(v);
+    REQUIRE(added);
+    REQUIRE(index == 0);
+  }
+}
+
+TEST_CASE("Tree table of discrete parts of states", "[tree_table]")
+{
+  tchecker::vloc_t * vloc = tchecker::vloc_allocate_and_construct(3, 3);
+  tchecker::intval_t * intval = tchecker::intval_allocate_and_construct(2, 2);
+  tchecker::ta::discrete_table_t table(3, 2);
+
+  (*vloc)[0] = 0;
+  (*vloc)[1] = 4;
+  (*vloc)[2] = 2;
+  (*intval)[0] = -7;
+  (*intval)[1] = 12;
+  auto && [added1, index1] = table.insert(*vloc, *intval);
+  REQUIRE(added1);
+
+  (*vloc)[1] = 5;
+  auto && [added2, index2] = table.insert(*vloc, *intval);
+  REQUIRE(added2);
+  REQUIRE(index2 != index1);
+
+  (*vloc)[1] = 4;
+  auto && [added3, index3] = table.insert(*vloc, *intval);
+  REQUIRE(!added3);
+  REQUIRE(index3 == index1);
+
+  REQUIRE(table.size() == 2);
+  REQUIRE(table.location(index2, 1) == 5);
+  REQUIRE(table.location(index2, 2) == 2);
+  REQUIRE(table.value(index2, 0) == -7);
+  REQUIRE(table.value(index2, 1) == 12);
+
+  tchecker::vloc_t * vloc2 = tchecker::vloc_allocate_and_construct(3, 3);
+  tchecker::intval_t * intval2 = tchecker::intval_allocate_and_construct(2, 2);
+  table.get(index2, *vloc2, *intval2);
+  REQUIRE((*vloc2)[0] == 0);
+  REQUIRE((*vloc2)[1] == 5);
+  REQUIRE((*vloc2)[2] == 2);
+  REQUIRE((*intval2)[0] == -7);
+  REQUIRE((*intval2)[1] == 12);
+
+  tchecker::vloc_destruct_and_deallocate(vloc2);
+  tchecker::intval_destruct_and_deallocate(intval2);
+  tchecker::vloc_destruct_and_deallocate(vloc);
+  tchecker::intval_destruct_and_deallocate(intval);
+}
@@ -38,6 +38,12 @@ TEST_CASE("waiting queue", "[waiting]")
     REQUIRE_FALSE(non_empty_queue.empty());
   }
 
+  SECTION("size")
+  {
+    REQUIRE(empty_queue.size() == 0);
+    REQUIRE(non_empty_queue.size() == 3);
+  }
+
   SECTION("insert in empty queue")
   {
     empty_queue.insert(2);
@@ -333,6 +339,12 @@ TEST_CASE("waiting stack", "[waiting]")
     REQUIRE_FALSE(non_empty_stack.empty());
   }
 
+  SECTION("size")
+  {
+    REQUIRE(empty_stack.size() == 0);
+    REQUIRE(non_empty_stack.size() == 4);
+  }
+
   SECTION("insert in empty stack")
   {
     empty_stack.insert(16);
@@ -660,6 +672,12 @@ TEST_CASE("waiting priority queue", "[waiting]")
     REQUIRE_FALSE(non_empty_queue.empty());
   }
 
+  SECTION("size")
+  {
+    REQUIRE(empty_queue.size() == 0);
+    REQUIRE(non_empty_queue.size() == 4);
+  }
+
   SECTION("insert in empty priority queue")
   {
     empty_queue.insert(2);
@@ -8,13 +8,20 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch_test_macros.hpp>
 
+#include "test-active-clocks.hh"
+#include "test-bitstate.hh"
+#include "test-budget.hh"
 #include "test-cache.hh"
+#include "test-certificate.hh"
+#include "test-clock-classes.hh"
 #include "test-clock_updates.hh"
 #include "test-clockbounds.hh"
 #include "test-clocks.hh"
+#include "test-counters.hh"
 #include "test-db.hh"
 #include "test-dbm.hh"
 #include "test-delay_allowed.hh"
+#include "test-disk-hashset.hh"
 #include "test-deterministic.hh"
 #include "test-extract_variables.hh"
 #include "test-finite-path.hh"
@@ -23,9 +30,18 @@
 #include "test-hashtable.hh"
 #include "test-labels.hh"
 #include "test-ordering.hh"
+#include "test-parent-graph.hh"
+#include "test-pool.hh"
+#include "test-profile.hh"
+#include "test-progress.hh"
+#include "test-reduced-zone.hh"
 #include "test-refdbm.hh"
 #include "test-reference_clock_variables.hh"
 #include "test-refzg-semantics.hh"
+#include "test-system-cache.hh"
+#include "test-ta-prev.hh"
+#include "test-trace.hh"
+#include "test-tree-table.hh"
 #include "test-variables-access.hh"
 #include "test-waiting.hh"
 #include "test-zg-semantics.hh"